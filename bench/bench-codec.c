@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <zlib.h>
+
+#include "../src/core/base16.h"
+#include "../src/core/base64.h"
+#include "../src/core/zlib-flate.h"
+
+#include "bench.h"
+#include "synthetic.h"
+
+typedef struct {
+    unsigned char * input;
+    size_t          inputSize;
+
+    char          * encoded;
+    size_t          encodedSize;
+
+    unsigned char * decoded;
+
+    char inputFilePath[PATH_MAX];
+    char deflatedFilePath[PATH_MAX];
+    char outputFilePath[PATH_MAX];
+
+    unsigned int nthreads;
+} CodecState;
+
+static void teardown(void * state) {
+    CodecState * s = (CodecState*)state;
+
+    if (s == NULL) {
+        return;
+    }
+
+    free(s->input);
+    free(s->encoded);
+    free(s->decoded);
+    free(s);
+}
+
+static CodecState * create_the_input(const BenchConfig * config, const size_t size) {
+    CodecState * s = (CodecState*)calloc(1, sizeof(CodecState));
+
+    if (s == NULL) {
+        bench_error("calloc");
+        return NULL;
+    }
+
+    s->inputSize = bench_scaled(config, size);
+    s->input     = (unsigned char*)malloc(s->inputSize);
+    s->encoded   = (char*)malloc(s->inputSize * 2U + 4U);
+    s->decoded   = (unsigned char*)malloc(s->inputSize + 4U);
+
+    if (s->input == NULL || s->encoded == NULL || s->decoded == NULL) {
+        teardown(s);
+        bench_error("malloc");
+        return NULL;
+    }
+
+    synthetic_text((char*)s->input, s->inputSize, 1U);
+
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int setup_base16(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)dataDIR;
+
+    CodecState * s = create_the_input(config, 32U << 20);
+
+    if (s == NULL) {
+        return -1;
+    }
+
+    if (base16_encode(s->encoded, s->input, s->inputSize, false) != 0) {
+        teardown(s);
+        return bench_error("base16_encode");
+    }
+
+    s->encodedSize = s->inputSize * 2U;
+
+    counters->bytes = s->inputSize;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int run_base16_encode(void * state) {
+    CodecState * s = (CodecState*)state;
+    return base16_encode(s->encoded, s->input, s->inputSize, false);
+}
+
+static int run_base16_decode(void * state) {
+    CodecState * s = (CodecState*)state;
+    return base16_decode(s->decoded, s->encoded, s->encodedSize);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int setup_base64(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)dataDIR;
+
+    CodecState * s = create_the_input(config, 32U << 20);
+
+    if (s == NULL) {
+        return -1;
+    }
+
+    s->encodedSize = base64_encode(s->encoded, s->input, s->inputSize);
+
+    counters->bytes = s->inputSize;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int run_base64_encode(void * state) {
+    CodecState * s = (CodecState*)state;
+    return base64_encode(s->encoded, s->input, s->inputSize) == s->encodedSize ? 0 : -1;
+}
+
+static int run_base64_decode(void * state) {
+    CodecState * s = (CodecState*)state;
+
+    size_t n;
+
+    if (base64_decode(s->decoded, &n, s->encoded, s->encodedSize) != 0) {
+        return bench_error("base64_decode");
+    }
+
+    return n == s->inputSize ? 0 : -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int deflate_a_file(const char * inputFilePath, const char * outputFilePath, const unsigned int nthreads) {
+    FILE * inputFile = fopen(inputFilePath, "rb");
+
+    if (inputFile == NULL) {
+        return bench_error(inputFilePath);
+    }
+
+    FILE * outputFile = fopen(outputFilePath, "wb");
+
+    if (outputFile == NULL) {
+        fclose(inputFile);
+        return bench_error(outputFilePath);
+    }
+
+    // 1 thread is the serial implementation, which is what was used before the parallel one
+    int ret;
+
+    if (nthreads == 1U) {
+        ret = zlib_deflate_file_to_file(inputFile, outputFile, Z_DEFAULT_COMPRESSION);
+    } else {
+        ret = zlib_deflate_file_to_file_parallel(inputFile, outputFile, Z_DEFAULT_COMPRESSION, false, nthreads);
+    }
+
+    fclose(inputFile);
+
+    if (fclose(outputFile) != 0) {
+        return bench_error(outputFilePath);
+    }
+
+    return ret == Z_OK ? 0 : -1;
+}
+
+static int inflate_a_file(const char * inputFilePath, const char * outputFilePath) {
+    FILE * inputFile = fopen(inputFilePath, "rb");
+
+    if (inputFile == NULL) {
+        return bench_error(inputFilePath);
+    }
+
+    FILE * outputFile = fopen(outputFilePath, "wb");
+
+    if (outputFile == NULL) {
+        fclose(inputFile);
+        return bench_error(outputFilePath);
+    }
+
+    int ret = zlib_inflate_file_to_file(inputFile, outputFile);
+
+    fclose(inputFile);
+
+    if (fclose(outputFile) != 0) {
+        return bench_error(outputFilePath);
+    }
+
+    return ret == Z_OK ? 0 : -1;
+}
+
+static int setup_zlib(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters, const unsigned int nthreads) {
+    CodecState * s = create_the_input(config, 32U << 20);
+
+    if (s == NULL) {
+        return -1;
+    }
+
+    s->nthreads = nthreads;
+
+    snprintf(s->inputFilePath,    PATH_MAX, "%s/input.txt", dataDIR);
+    snprintf(s->deflatedFilePath, PATH_MAX, "%s/input.txt.z", dataDIR);
+    snprintf(s->outputFilePath,   PATH_MAX, "%s/output.txt", dataDIR);
+
+    FILE * file = fopen(s->inputFilePath, "wb");
+
+    if (file == NULL) {
+        teardown(s);
+        return bench_error(s->inputFilePath);
+    }
+
+    size_t n = fwrite(s->input, 1, s->inputSize, file);
+
+    if (fclose(file) != 0 || n != s->inputSize) {
+        teardown(s);
+        return bench_error(s->inputFilePath);
+    }
+
+    if (deflate_a_file(s->inputFilePath, s->deflatedFilePath, nthreads) != 0) {
+        teardown(s);
+        return -1;
+    }
+
+    counters->bytes = s->inputSize;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int setup_zlib_serial(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    return setup_zlib(config, dataDIR, state, counters, 1U);
+}
+
+static int setup_zlib_parallel(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    return setup_zlib(config, dataDIR, state, counters, 0U);
+}
+
+static int run_zlib_deflate(void * state) {
+    CodecState * s = (CodecState*)state;
+    return deflate_a_file(s->inputFilePath, s->deflatedFilePath, s->nthreads);
+}
+
+static int run_zlib_inflate(void * state) {
+    CodecState * s = (CodecState*)state;
+    return inflate_a_file(s->deflatedFilePath, s->outputFilePath);
+}
+
+const Benchmark codecBenchmarks[] = {
+    { "base16-encode",         setup_base16,        NULL, run_base16_encode, teardown },
+    { "base16-decode",         setup_base16,        NULL, run_base16_decode, teardown },
+    { "base64-encode",         setup_base64,        NULL, run_base64_encode, teardown },
+    { "base64-decode",         setup_base64,        NULL, run_base64_decode, teardown },
+    { "zlib-deflate-serial",   setup_zlib_serial,   NULL, run_zlib_deflate,  teardown },
+    { "zlib-deflate-parallel", setup_zlib_parallel, NULL, run_zlib_deflate,  teardown },
+    { "zlib-inflate",          setup_zlib_parallel, NULL, run_zlib_inflate,  teardown },
+    { NULL, NULL, NULL, NULL, NULL }
+};
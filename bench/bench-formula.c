@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../src/xcpkg.h"
+
+#include "bench.h"
+#include "synthetic.h"
+
+#define REPO_NAME "bench"
+
+typedef struct {
+    char   xcpkgHomeDIR[PATH_MAX];
+    char   formulaDIR[PATH_MAX];
+    size_t packageCount;
+} FormulaState;
+
+static int setup_a_formula_repo(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    FormulaState * s = (FormulaState*)calloc(1, sizeof(FormulaState));
+
+    if (s == NULL) {
+        return bench_error("calloc");
+    }
+
+    s->packageCount = bench_scaled(config, 2000U);
+
+    snprintf(s->xcpkgHomeDIR, PATH_MAX, "%s", dataDIR);
+    snprintf(s->formulaDIR,   PATH_MAX, "%s/repos.d/%s/formula", dataDIR, REPO_NAME);
+
+    if (synthetic_formula_repo_create(dataDIR, REPO_NAME, s->packageCount, 3U, 1U) != 0) {
+        free(s);
+        return -1;
+    }
+
+    counters->items = s->packageCount;
+
+    (*state) = s;
+
+    return 0;
+}
+
+// every benchmark has its own XCPKG_HOME
+static int prepare_the_home_dir(void * state) {
+    FormulaState * s = (FormulaState*)state;
+
+    if (setenv("XCPKG_HOME", s->xcpkgHomeDIR, 1) != 0) {
+        return bench_error("setenv");
+    }
+
+    return 0;
+}
+
+static int load_every_formula_by_path(void * state) {
+    FormulaState * s = (FormulaState*)state;
+
+    char packageName[64];
+    char formulaFilePath[PATH_MAX];
+
+    for (size_t i = 0U; i < s->packageCount; i++) {
+        synthetic_package_name(packageName, 64, REPO_NAME, i);
+
+        snprintf(formulaFilePath, PATH_MAX, "%s/%s.yml", s->formulaDIR, packageName);
+
+        XCPKGFormula * formula = NULL;
+
+        int ret = xcpkg_formula_load(packageName, "macos-14.0-arm64", formulaFilePath, &formula);
+
+        if (ret != XCPKG_OK) {
+            fprintf(stderr, "%s: failed to load, ret=%d\n", formulaFilePath, ret);
+            return -1;
+        }
+
+        xcpkg_formula_free(formula);
+    }
+
+    return 0;
+}
+
+static int load_every_formula_by_name(void * state) {
+    FormulaState * s = (FormulaState*)state;
+
+    char packageName[64];
+
+    for (size_t i = 0U; i < s->packageCount; i++) {
+        synthetic_package_name(packageName, 64, REPO_NAME, i);
+
+        XCPKGFormula * formula = NULL;
+
+        int ret = xcpkg_formula_load(packageName, "macos-14.0-arm64", NULL, &formula);
+
+        if (ret != XCPKG_OK) {
+            fprintf(stderr, "%s: failed to load, ret=%d\n", packageName, ret);
+            return -1;
+        }
+
+        xcpkg_formula_free(formula);
+    }
+
+    return 0;
+}
+
+static int count_a_formula_repo(XCPKGFormulaRepo * formulaRepo, const void * p1, void * p2) {
+    (void)formulaRepo;
+    (void)p1;
+    (*((size_t*)p2))++;
+    return XCPKG_OK;
+}
+
+static int scan_the_formula_repos(void * state) {
+    (void)state;
+
+    size_t n = 0U;
+
+    // a scan parses every repo config, do it as many times as a resolver would do for the packages
+    for (int i = 0; i < 100; i++) {
+        if (xcpkg_formula_repo_scan(count_a_formula_repo, NULL, &n) != XCPKG_OK) {
+            return -1;
+        }
+    }
+
+    return n == 100U ? 0 : bench_error("xcpkg_formula_repo_scan");
+}
+
+static int setup_the_formula_repo_scan(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)config;
+
+    FormulaState * s = (FormulaState*)calloc(1, sizeof(FormulaState));
+
+    if (s == NULL) {
+        return bench_error("calloc");
+    }
+
+    snprintf(s->xcpkgHomeDIR, PATH_MAX, "%s", dataDIR);
+
+    if (synthetic_formula_repo_create(dataDIR, REPO_NAME, 1U, 0U, 1U) != 0) {
+        free(s);
+        return -1;
+    }
+
+    counters->items = 100U;
+
+    (*state) = s;
+
+    return 0;
+}
+
+const Benchmark formulaBenchmarks[] = {
+    { "load-by-path", setup_a_formula_repo,        prepare_the_home_dir, load_every_formula_by_path, free },
+    { "load-by-name", setup_a_formula_repo,        prepare_the_home_dir, load_every_formula_by_name, free },
+    { "repo-scan",    setup_the_formula_repo_scan, prepare_the_home_dir, scan_the_formula_repos,     free },
+    { NULL, NULL, NULL, NULL, NULL }
+};
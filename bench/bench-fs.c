@@ -0,0 +1,355 @@
+#include <ftw.h>
+#include <time.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <openssl/evp.h>
+
+#include "../src/core/tar.h"
+#include "../src/base/sha256sum.h"
+#include "../src/impl/manifest.h"
+#include "../src/xcpkg.h"
+
+#include "bench.h"
+#include "synthetic.h"
+
+typedef struct {
+    char   dataDIR[PATH_MAX];
+    char   treeDIR[PATH_MAX];
+    char   archiveFilePath[PATH_MAX];
+    char   outputDIR[PATH_MAX];
+
+    char ** filePaths;
+    size_t  fileCount;
+
+    char (*sha256sums)[65];
+    int   * rets;
+
+    long    generation;
+} FsState;
+
+static FsState * collectingState;
+
+static int collect_a_file(const char * fpath, const struct stat * st, int typeflag, struct FTW * ftwbuf) {
+    (void)st;
+    (void)ftwbuf;
+
+    if (typeflag != FTW_F) {
+        return 0;
+    }
+
+    FsState * s = collectingState;
+
+    char ** p = (char**)realloc(s->filePaths, (s->fileCount + 1U) * sizeof(char*));
+
+    if (p == NULL) {
+        return -1;
+    }
+
+    s->filePaths = p;
+
+    s->filePaths[s->fileCount] = strdup(fpath);
+
+    if (s->filePaths[s->fileCount] == NULL) {
+        return -1;
+    }
+
+    s->fileCount++;
+
+    return 0;
+}
+
+static void teardown(void * state) {
+    FsState * s = (FsState*)state;
+
+    if (s == NULL) {
+        return;
+    }
+
+    for (size_t i = 0U; i < s->fileCount; i++) {
+        free(s->filePaths[i]);
+    }
+
+    free(s->filePaths);
+    free(s->sha256sums);
+    free(s->rets);
+    free(s);
+}
+
+// the archive has the relative path tree/..., as the packages do
+static int create_the_archive(void * state) {
+    FsState * s = (FsState*)state;
+
+    if (chdir(s->dataDIR) != 0) {
+        return bench_error(s->dataDIR);
+    }
+
+    return tar_create("tree", s->archiveFilePath, ArchiveType_tar_gz, false);
+}
+
+// a tree of many small files, which is what most packages install
+static int setup_a_tree(const char * dataDIR, const size_t fileCount, const size_t averageFileSize, void ** state, BenchCounters * counters) {
+    FsState * s = (FsState*)calloc(1, sizeof(FsState));
+
+    if (s == NULL) {
+        return bench_error("calloc");
+    }
+
+    snprintf(s->dataDIR,         PATH_MAX, "%s", dataDIR);
+    snprintf(s->treeDIR,         PATH_MAX, "%s/tree", dataDIR);
+    snprintf(s->archiveFilePath, PATH_MAX, "%s/tree.tar.gz", dataDIR);
+    snprintf(s->outputDIR,       PATH_MAX, "%s/output", dataDIR);
+
+    size_t totalSize;
+
+    if (synthetic_source_tree_create(s->treeDIR, fileCount, averageFileSize, 100U, 1U, &totalSize) != 0) {
+        teardown(s);
+        return -1;
+    }
+
+    collectingState = s;
+
+    if (nftw(s->treeDIR, collect_a_file, 16, FTW_PHYS) != 0) {
+        teardown(s);
+        return bench_error(s->treeDIR);
+    }
+
+    s->sha256sums = (char(*)[65])calloc(s->fileCount, 65);
+    s->rets       = (int*)calloc(s->fileCount, sizeof(int));
+
+    if (s->sha256sums == NULL || s->rets == NULL) {
+        teardown(s);
+        return bench_error("calloc");
+    }
+
+    if (create_the_archive(s) != 0) {
+        teardown(s);
+        return -1;
+    }
+
+    counters->items = s->fileCount;
+    counters->bytes = totalSize;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int setup_a_source_tree(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    return setup_a_tree(dataDIR, bench_scaled(config, 5000U), 4096U, state, counters);
+}
+
+// 100k files of about 512 bytes, the cost of creating the files and resolving their directories dominates
+static int setup_a_tree_of_100k_small_files(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    return setup_a_tree(dataDIR, bench_scaled(config, 100000U), 512U, state, counters);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int remove_the_archive(void * state) {
+    FsState * s = (FsState*)state;
+
+    if (unlink(s->archiveFilePath) != 0 && errno != ENOENT) {
+        return bench_error(s->archiveFilePath);
+    }
+
+    return 0;
+}
+
+
+static int remove_the_output_dir(void * state) {
+    FsState * s = (FsState*)state;
+
+    struct stat st;
+
+    if (stat(s->outputDIR, &st) == 0) {
+        if (xcpkg_rm_rf(s->outputDIR, false, false) != XCPKG_OK) {
+            return -1;
+        }
+    }
+
+    return xcpkg_mkdir_p(s->outputDIR, false);
+}
+
+static int extract_the_archive(void * state) {
+    FsState * s = (FsState*)state;
+    return tar_extract(s->outputDIR, s->archiveFilePath, ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM, false, 1U);
+}
+
+// the baseline, a secure option makes tar_extract() fall back to archive_write_disk
+static int extract_the_archive_via_write_disk(void * state) {
+    FsState * s = (FsState*)state;
+    return tar_extract(s->outputDIR, s->archiveFilePath, ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM | ARCHIVE_EXTRACT_SECURE_SYMLINKS, false, 1U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the sha256sums are memoized by (dev, ino, size, mtime), a new mtime makes every file a miss
+static int touch_every_file(void * state) {
+    FsState * s = (FsState*)state;
+
+    s->generation++;
+
+    struct timespec times[2];
+
+    times[0].tv_sec  = 1700000000 + s->generation;
+    times[0].tv_nsec = 0;
+    times[1] = times[0];
+
+    for (size_t i = 0U; i < s->fileCount; i++) {
+        if (utimensat(AT_FDCWD, s->filePaths[i], times, 0) != 0) {
+            return bench_error(s->filePaths[i]);
+        }
+    }
+
+    return 0;
+}
+
+static int hash_every_file_one_by_one(void * state) {
+    FsState * s = (FsState*)state;
+
+    for (size_t i = 0U; i < s->fileCount; i++) {
+        if (sha256sum_of_file(s->sha256sums[i], s->filePaths[i]) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// the baseline, a copy of what sha256sum_of_file() did before the contexts and buffers were reused:
+// a new digest context for every file, which was read with 1 KiB freads.
+static int baseline_sha256sum_of_file(char outputBuffer[65], const char * filePath) {
+    FILE * file = fopen(filePath, "rb");
+
+    if (file == NULL) {
+        return bench_error(filePath);
+    }
+
+    EVP_MD_CTX * ctx = EVP_MD_CTX_new();
+
+    if (ctx == NULL || EVP_DigestInit(ctx, EVP_sha256()) != 1) {
+        EVP_MD_CTX_free(ctx);
+        fclose(file);
+        return -1;
+    }
+
+    int ret = 0;
+
+    unsigned char readBuf[1024];
+
+    for (;;) {
+        size_t readSize = fread(readBuf, 1, 1024, file);
+
+        if (ferror(file)) {
+            ret = bench_error(filePath);
+            break;
+        }
+
+        if (readSize > 0U && EVP_DigestUpdate(ctx, readBuf, readSize) != 1) {
+            ret = -1;
+            break;
+        }
+
+        if (feof(file)) {
+            break;
+        }
+    }
+
+    unsigned char md[EVP_MAX_MD_SIZE];
+
+    unsigned int mdLength;
+
+    if (ret == 0 && EVP_DigestFinal(ctx, md, &mdLength) == 1) {
+        const char * const table = "0123456789abcdef";
+
+        for (unsigned int i = 0U; i < 32U; i++) {
+            outputBuffer[i << 1]        = table[md[i] >> 4];
+            outputBuffer[(i << 1) + 1U] = table[md[i] & 0x0F];
+        }
+
+        outputBuffer[64] = '\0';
+    } else {
+        ret = -1;
+    }
+
+    EVP_MD_CTX_free(ctx);
+
+    fclose(file);
+
+    return ret;
+}
+
+static int hash_every_file_one_by_one_baseline(void * state) {
+    FsState * s = (FsState*)state;
+
+    for (size_t i = 0U; i < s->fileCount; i++) {
+        if (baseline_sha256sum_of_file(s->sha256sums[i], s->filePaths[i]) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int hash_every_file_in_a_batch(void * state) {
+    FsState * s = (FsState*)state;
+    return sha256sum_of_files(s->sha256sums, s->rets, (const char * const *)s->filePaths, s->fileCount, 0U);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int setup_an_installed_dir(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    int ret = setup_a_source_tree(config, dataDIR, state, counters);
+
+    if (ret != 0) {
+        return ret;
+    }
+
+    FsState * s = (FsState*)(*state);
+
+    char metaDIR[PATH_MAX];
+
+    snprintf(metaDIR, PATH_MAX, "%s/.xcpkg", s->treeDIR);
+
+    return xcpkg_mkdir_p(metaDIR, false);
+}
+
+static int generate_the_manifest(void * state) {
+    FsState * s = (FsState*)state;
+    return generate_manifest(s->treeDIR, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int restore_the_output_dir(void * state) {
+    if (remove_the_output_dir(state) != 0) {
+        return -1;
+    }
+
+    return extract_the_archive(state);
+}
+
+static int remove_the_output_dir_timed(void * state) {
+    FsState * s = (FsState*)state;
+    return xcpkg_rm_rf(s->outputDIR, false, false);
+}
+
+const Benchmark fsBenchmarks[] = {
+    { "tar-create",                  setup_a_source_tree,              remove_the_archive,     create_the_archive,                  teardown },
+    { "tar-extract",                 setup_a_source_tree,              remove_the_output_dir,  extract_the_archive,                 teardown },
+    { "tar-extract-100k",            setup_a_tree_of_100k_small_files, remove_the_output_dir,  extract_the_archive,                 teardown },
+    { "tar-extract-100k-write-disk", setup_a_tree_of_100k_small_files, remove_the_output_dir,  extract_the_archive_via_write_disk,  teardown },
+    { "sha256-baseline",             setup_a_source_tree,              touch_every_file,       hash_every_file_one_by_one_baseline, teardown },
+    { "sha256-serial",               setup_a_source_tree,              touch_every_file,       hash_every_file_one_by_one,          teardown },
+    { "sha256-batch",                setup_a_source_tree,              touch_every_file,       hash_every_file_in_a_batch,          teardown },
+    { "manifest",                    setup_an_installed_dir,           NULL,                   generate_the_manifest,               teardown },
+    { "rm-rf",                       setup_a_source_tree,              restore_the_output_dir, remove_the_output_dir_timed,         teardown },
+    { NULL, NULL, NULL, NULL, NULL }
+};
@@ -0,0 +1,298 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../src/xcpkg.h"
+#include "../src/impl/install-plan.h"
+
+#include "bench.h"
+#include "synthetic.h"
+
+#define REPO_NAME "plan"
+
+// at most this many direct dependencies per package
+#define MAX_DEP_COUNT 6U
+
+typedef struct {
+    size_t packageCount;
+    size_t edgeCount;
+
+    // names[i] is the name of the i-th package, depPkgs[i] is its dep-pkg, they are laid out like in the formulas
+    char ** names;
+    char ** depPkgs;
+} PlanState;
+
+static void plan_state_free(void * state) {
+    PlanState * s = (PlanState*)state;
+
+    if (s == NULL) {
+        return;
+    }
+
+    for (size_t i = 0U; i < s->packageCount; i++) {
+        if (s->names != NULL) {
+            free(s->names[i]);
+        }
+
+        if (s->depPkgs != NULL) {
+            free(s->depPkgs[i]);
+        }
+    }
+
+    free(s->names);
+    free(s->depPkgs);
+    free(s);
+}
+
+// xorshift64*, the same as the one the synthetic data is generated with
+static uint64_t next_random(uint64_t * state) {
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+
+    *state = x;
+
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+// a random DAG, every package depends on up to MAX_DEP_COUNT random packages which come before it
+static int setup_a_random_dag(const size_t n, void ** state, BenchCounters * counters) {
+    PlanState * s = (PlanState*)calloc(1, sizeof(PlanState));
+
+    if (s == NULL) {
+        return bench_error("calloc");
+    }
+
+    s->packageCount = n;
+    s->names   = (char**)calloc(n, sizeof(char*));
+    s->depPkgs = (char**)calloc(n, sizeof(char*));
+
+    if (s->names == NULL || s->depPkgs == NULL) {
+        plan_state_free(s);
+        return bench_error("calloc");
+    }
+
+    uint64_t randomState = 0x9E3779B97F4A7C15ULL ^ n;
+
+    char buf[64];
+
+    for (size_t i = 0U; i < n; i++) {
+        if (synthetic_package_name(buf, 64, REPO_NAME, i) != 0) {
+            plan_state_free(s);
+            return -1;
+        }
+
+        s->names[i] = strdup(buf);
+
+        size_t depCount = (size_t)(next_random(&randomState) % (MAX_DEP_COUNT + 1U));
+
+        if (depCount > i) {
+            depCount = i;
+        }
+
+        size_t deps[MAX_DEP_COUNT];
+
+        for (size_t k = 0U; k < depCount; k++) {
+            for (;;) {
+                size_t dep = (size_t)(next_random(&randomState) % i);
+
+                size_t j = 0U;
+
+                while (j < k && deps[j] != dep) {
+                    j++;
+                }
+
+                if (j == k) {
+                    deps[k] = dep;
+                    break;
+                }
+            }
+        }
+
+        // every name is shorter than 64 bytes
+        s->depPkgs[i] = (char*)malloc(depCount * 64U + 1U);
+
+        if (s->names[i] == NULL || s->depPkgs[i] == NULL) {
+            plan_state_free(s);
+            return bench_error("malloc");
+        }
+
+        size_t len = 0U;
+
+        s->depPkgs[i][0] = '\0';
+
+        for (size_t k = 0U; k < depCount; k++) {
+            len += (size_t)sprintf(s->depPkgs[i] + len, k == 0U ? "%s-pkg%zu" : " %s-pkg%zu", REPO_NAME, deps[k]);
+        }
+
+        s->edgeCount += depCount;
+    }
+
+    counters->items = n;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int setup_1k (const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) { (void)dataDIR; return setup_a_random_dag(bench_scaled(config, 1000U),  state, counters); }
+static int setup_5k (const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) { (void)dataDIR; return setup_a_random_dag(bench_scaled(config, 5000U),  state, counters); }
+static int setup_10k(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) { (void)dataDIR; return setup_a_random_dag(bench_scaled(config, 10000U), state, counters); }
+
+// what the install planner does after it has read the formulas: add every package and its dependency edges, then sort
+static int build_the_install_plan(void * state) {
+    PlanState * s = (PlanState*)state;
+
+    XCPKGInstallPlan plan = {0};
+
+    int ret = XCPKG_OK;
+
+    for (size_t i = s->packageCount; ret == XCPKG_OK && i > 0U; i--) {
+        size_t index;
+        bool   added;
+
+        ret = xcpkg_install_plan_add(&plan, s->names[i - 1U], strlen(s->names[i - 1U]), &index, &added);
+
+        for (const char * p = s->depPkgs[i - 1U]; ret == XCPKG_OK && p[0] != '\0'; ) {
+            if (p[0] == ' ') {
+                p++;
+                continue;
+            }
+
+            size_t n = 0U;
+
+            while (p[n] != '\0' && p[n] != ' ') {
+                n++;
+            }
+
+            size_t depIndex;
+
+            ret = xcpkg_install_plan_add(&plan, p, n, &depIndex, &added);
+
+            if (ret == XCPKG_OK) {
+                ret = xcpkg_install_plan_add_edge(&plan, index, depIndex);
+            }
+
+            p += n;
+        }
+    }
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_install_plan_sort(&plan);
+    }
+
+    if (ret == XCPKG_OK && plan.packageArraySize != s->packageCount) {
+        ret = XCPKG_ERROR;
+    }
+
+    xcpkg_install_plan_free(&plan);
+
+    return ret == XCPKG_OK ? 0 : -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the baseline, a copy of what the planner did before the hash-indexed graph:
+// the packages were kept in a plain array, which was searched with strcmp for every package and for every dependency edge.
+
+static inline bool _str_equal(const char * p, const char * packageName) {
+    size_t i = 0U;
+
+    for (;;) {
+        if (packageName[i] == '\0') {
+            return p[i] == '\0' || p[i] == ' ' || p[i] == '\n';
+        }
+
+        if (p[i] != packageName[i]) {
+            return false;
+        }
+
+        i++;
+    }
+}
+
+static int build_the_package_set(void * state) {
+    PlanState * s = (PlanState*)state;
+
+    size_t packageSetSize = 0U;
+
+    const char ** packageSet = (const char**)malloc(s->packageCount * sizeof(char*));
+    bool        * marks      = (bool*)calloc(s->packageCount, sizeof(bool));
+    size_t      * indexStack = (size_t*)malloc(s->packageCount * sizeof(size_t));
+
+    if (packageSet == NULL || marks == NULL || indexStack == NULL) {
+        free(packageSet);
+        free(marks);
+        free(indexStack);
+        return bench_error("malloc");
+    }
+
+    for (size_t i = s->packageCount; i > 0U; i--) {
+        const char * packageName = s->names[i - 1U];
+
+        size_t j = 0U;
+
+        while (j < packageSetSize && strcmp(packageSet[j], packageName) != 0) {
+            j++;
+        }
+
+        if (j == packageSetSize) {
+            packageSet[packageSetSize++] = packageName;
+        }
+    }
+
+    // mark_the_needed_packages() from the last package
+    size_t indexStackSize = 0U;
+
+    size_t n = 1U;
+
+    marks[0] = true;
+    indexStack[indexStackSize++] = 0U;
+
+    while (indexStackSize > 0U) {
+        const char * packageName = packageSet[indexStack[--indexStackSize]];
+
+        // the names are synthetic_package_name(REPO_NAME, i)
+        const char * p = s->depPkgs[strtoul(packageName + strlen(REPO_NAME) + 4U, NULL, 10)];
+
+        while (p[0] != '\0') {
+            if (p[0] == ' ') {
+                p++;
+                continue;
+            }
+
+            for (size_t i = 0U; i < packageSetSize; i++) {
+                if (_str_equal(p, packageSet[i])) {
+                    if (!marks[i]) {
+                        marks[i] = true;
+                        n++;
+                        indexStack[indexStackSize++] = i;
+                    }
+                    break;
+                }
+            }
+
+            while (p[0] != '\0' && p[0] != ' ') {
+                p++;
+            }
+        }
+    }
+
+    free(packageSet);
+    free(marks);
+    free(indexStack);
+
+    return n <= s->packageCount ? 0 : -1;
+}
+
+const Benchmark planBenchmarks[] = {
+    { "hash-1k",    setup_1k,  NULL, build_the_install_plan, plan_state_free },
+    { "hash-5k",    setup_5k,  NULL, build_the_install_plan, plan_state_free },
+    { "hash-10k",   setup_10k, NULL, build_the_install_plan, plan_state_free },
+    { "linear-1k",  setup_1k,  NULL, build_the_package_set,  plan_state_free },
+    { "linear-5k",  setup_5k,  NULL, build_the_package_set,  plan_state_free },
+    { "linear-10k", setup_10k, NULL, build_the_package_set,  plan_state_free },
+    { NULL, NULL, NULL, NULL, NULL }
+};
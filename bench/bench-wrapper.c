@@ -0,0 +1,125 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "bench.h"
+
+extern char ** environ;
+
+// the wrappers are built by bench/CMakeLists.txt, their paths are passed in as macros
+#ifndef XCPKG_BENCH_WRAPPER_TARGET_CC
+#define XCPKG_BENCH_WRAPPER_TARGET_CC "wrapper-target-cc"
+#endif
+
+#ifndef XCPKG_BENCH_WRAPPER_NATIVE_CC
+#define XCPKG_BENCH_WRAPPER_NATIVE_CC "wrapper-native-cc"
+#endif
+
+// a configure script invokes the compiler hundreds of times
+#define SPAWN_COUNT 200U
+
+typedef struct {
+    const char * path;
+    char * const * argv;
+} WrapperState;
+
+static char * const compileArgv[] = { "cc", "-c", "-o", "hello.o", "hello.c", "-DNDEBUG", "-I/usr/local/include", NULL };
+
+static int setup_env(void) {
+    // the wrappers execute XCPKG_CC at last, /bin/true is the cheapest compiler there is
+    if (setenv("XCPKG_CC", "/bin/true", 1) != 0
+     || setenv("XCPKG_TARGET_FLAGS", "-isysroot /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk -mmacosx-version-min=11.0 -arch arm64", 1) != 0
+     || setenv("XCPKG_TARGET_CCFLAGS", "-fPIC -O2 -pipe", 1) != 0
+     || setenv("XCPKG_TARGET_LDFLAGS", "-Wl,-dead_strip", 1) != 0
+     || setenv("XCPKG_NATIVE_FLAGS", "-I/usr/local/include", 1) != 0
+     || setenv("XCPKG_NATIVE_CCFLAGS", "-fPIC -O2 -pipe", 1) != 0
+     || setenv("XCPKG_NATIVE_LDFLAGS", "-L/usr/local/lib", 1) != 0) {
+        return bench_error("setenv");
+    }
+
+    unsetenv("XCPKG_VERBOSE");
+
+    return 0;
+}
+
+static int setup(const char * path, void ** state, BenchCounters * counters) {
+    if (setup_env() != 0) {
+        return -1;
+    }
+
+    if (access(path, X_OK) != 0) {
+        return bench_error(path);
+    }
+
+    WrapperState * s = (WrapperState*)malloc(sizeof(WrapperState));
+
+    if (s == NULL) {
+        return bench_error("malloc");
+    }
+
+    s->path = path;
+    s->argv = compileArgv;
+
+    counters->items = SPAWN_COUNT;
+
+    (*state) = s;
+
+    return 0;
+}
+
+static int setup_the_baseline(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)config;
+    (void)dataDIR;
+    return setup("/bin/true", state, counters);
+}
+
+static int setup_the_target_cc(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)config;
+    (void)dataDIR;
+    return setup(XCPKG_BENCH_WRAPPER_TARGET_CC, state, counters);
+}
+
+static int setup_the_native_cc(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters) {
+    (void)config;
+    (void)dataDIR;
+    return setup(XCPKG_BENCH_WRAPPER_NATIVE_CC, state, counters);
+}
+
+static int spawn_many_times(void * state) {
+    WrapperState * s = (WrapperState*)state;
+
+    for (unsigned int i = 0U; i < SPAWN_COUNT; i++) {
+        pid_t pid;
+
+        int ret = posix_spawn(&pid, s->path, NULL, NULL, s->argv, environ);
+
+        if (ret != 0) {
+            errno = ret;
+            return bench_error(s->path);
+        }
+
+        int childProcessExitStatus;
+
+        if (waitpid(pid, &childProcessExitStatus, 0) < 0) {
+            return bench_error("waitpid");
+        }
+
+        if (!WIFEXITED(childProcessExitStatus) || WEXITSTATUS(childProcessExitStatus) != 0) {
+            fprintf(stderr, "%s exited abnormally.\n", s->path);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+const Benchmark wrapperBenchmarks[] = {
+    { "baseline",  setup_the_baseline,  NULL, spawn_many_times, free },
+    { "target-cc", setup_the_target_cc, NULL, spawn_many_times, free },
+    { "native-cc", setup_the_native_cc, NULL, spawn_many_times, free },
+    { NULL, NULL, NULL, NULL, NULL }
+};
@@ -0,0 +1,53 @@
+#ifndef XCPKG_BENCH_H
+#define XCPKG_BENCH_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+typedef struct {
+    // every benchmark creates its data under its own sub-directory of this directory
+    const char * workDIR;
+
+    // 1 is the default size, the quick mode uses a smaller one
+    double scale;
+
+    // the minimum count of the timed runs and the minimum total time of them
+    unsigned int minRuns;
+    double       minSeconds;
+} BenchConfig;
+
+typedef struct {
+    // how many items and bytes one run processes, 0 means not applicable
+    size_t items;
+    size_t bytes;
+} BenchCounters;
+
+typedef struct {
+    const char * name;
+
+    // called once, creates the data and the state. On success, 0 is returned.
+    int  (*setup)(const BenchConfig * config, const char * dataDIR, void ** state, BenchCounters * counters);
+
+    // called before every run, it is not timed. NULL means nothing to do.
+    int  (*prepare)(void * state);
+
+    // the timed work. On success, 0 is returned.
+    int  (*run)(void * state);
+
+    // called once, frees the state. NULL means nothing to do.
+    void (*teardown)(void * state);
+} Benchmark;
+
+// every group is terminated by an element whose name is NULL
+extern const Benchmark formulaBenchmarks[];
+extern const Benchmark fsBenchmarks[];
+extern const Benchmark codecBenchmarks[];
+extern const Benchmark wrapperBenchmarks[];
+extern const Benchmark planBenchmarks[];
+
+size_t bench_scaled(const BenchConfig * config, size_t n);
+
+// the xcpkg functions print their own error messages, these are for the benchmarks themselves
+int bench_error(const char * what);
+
+#endif
@@ -0,0 +1,427 @@
+#include <time.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <unistd.h>
+#include <sys/utsname.h>
+
+#include "../src/core/sysinfo.h"
+#include "../src/xcpkg.h"
+
+#include "bench.h"
+#include "synthetic.h"
+
+typedef struct {
+    const char * group;
+    const char * name;
+    unsigned int runs;
+    double minNs;
+    double medianNs;
+    double meanNs;
+    double maxNs;
+    BenchCounters counters;
+} BenchResult;
+
+static const struct {
+    const char * name;
+    const Benchmark * benchmarks;
+} groups[] = {
+    { "formula", formulaBenchmarks },
+    { "fs",      fsBenchmarks      },
+    { "codec",   codecBenchmarks   },
+    { "wrapper", wrapperBenchmarks },
+    { "plan",    planBenchmarks    },
+};
+
+#define GROUP_COUNT (sizeof(groups) / sizeof(groups[0]))
+
+#define MAX_RUNS 10000U
+
+static double current_time_in_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int compare_doubles(const void * a, const void * b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+size_t bench_scaled(const BenchConfig * config, size_t n) {
+    size_t m = (size_t)((double)n * config->scale);
+    return m == 0U ? 1U : m;
+}
+
+int bench_error(const char * what) {
+    if (errno == 0) {
+        fprintf(stderr, "%s: failed.\n", what);
+    } else {
+        perror(what);
+    }
+
+    return -1;
+}
+
+static int run_a_benchmark(const BenchConfig * config, const char * groupName, const Benchmark * benchmark, BenchResult * result) {
+    char dataDIR[PATH_MAX];
+
+    int ret = snprintf(dataDIR, PATH_MAX, "%s/%s.%s", config->workDIR, groupName, benchmark->name);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    if (xcpkg_mkdir_p(dataDIR, false) != XCPKG_OK) {
+        return -1;
+    }
+
+    fprintf(stderr, "running %s.%s ...\n", groupName, benchmark->name);
+
+    void * state = NULL;
+
+    BenchCounters counters = {0};
+
+    if (benchmark->setup(config, dataDIR, &state, &counters) != 0) {
+        fprintf(stderr, "%s.%s: setup failed.\n", groupName, benchmark->name);
+        return -1;
+    }
+
+    double * samples = (double*)malloc(MAX_RUNS * sizeof(double));
+
+    if (samples == NULL) {
+        perror(NULL);
+        ret = -1;
+        goto finalize;
+    }
+
+    // one untimed run to warm up the page cache and the lazy initializations
+    unsigned int runs = 0U;
+
+    double total = 0;
+
+    for (int warmup = 1; runs < MAX_RUNS; warmup = 0) {
+        if (benchmark->prepare != NULL) {
+            if (benchmark->prepare(state) != 0) {
+                fprintf(stderr, "%s.%s: prepare failed.\n", groupName, benchmark->name);
+                ret = -1;
+                goto finalize;
+            }
+        }
+
+        double t0 = current_time_in_ns();
+
+        if (benchmark->run(state) != 0) {
+            fprintf(stderr, "%s.%s: run failed.\n", groupName, benchmark->name);
+            ret = -1;
+            goto finalize;
+        }
+
+        double t1 = current_time_in_ns();
+
+        if (warmup) {
+            continue;
+        }
+
+        samples[runs++] = t1 - t0;
+
+        total += t1 - t0;
+
+        if (runs >= config->minRuns && total >= config->minSeconds * 1e9) {
+            break;
+        }
+    }
+
+    qsort(samples, runs, sizeof(double), compare_doubles);
+
+    result->group    = groupName;
+    result->name     = benchmark->name;
+    result->runs     = runs;
+    result->minNs    = samples[0];
+    result->maxNs    = samples[runs - 1U];
+    result->meanNs   = total / runs;
+    result->medianNs = (runs & 1U) ? samples[runs / 2U] : (samples[runs / 2U - 1U] + samples[runs / 2U]) / 2;
+    result->counters = counters;
+
+    ret = 0;
+
+finalize:
+    free(samples);
+
+    if (benchmark->teardown != NULL) {
+        benchmark->teardown(state);
+    }
+
+    return ret;
+}
+
+static void print_results_as_json(FILE * file, const BenchConfig * config, const BenchResult results[], const size_t n) {
+    struct utsname uts;
+
+    if (uname(&uts) != 0) {
+        memset(&uts, 0, sizeof(struct utsname));
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"host\": {\"sysname\": \"%s\", \"release\": \"%s\", \"machine\": \"%s\", \"ncpu\": %d},\n", uts.sysname, uts.release, uts.machine, sysinfo_ncpu());
+    fprintf(file, "  \"scale\": %g,\n", config->scale);
+    fprintf(file, "  \"benchmarks\": [");
+
+    for (size_t i = 0U; i < n; i++) {
+        const BenchResult * r = &results[i];
+
+        // the rates are computed from the median, which is not disturbed by a few slow runs
+        double seconds = r->medianNs / 1e9;
+
+        fprintf(file, "%s\n    {\"name\": \"%s.%s\", \"runs\": %u, \"min_ns\": %.0f, \"median_ns\": %.0f, \"mean_ns\": %.0f, \"max_ns\": %.0f, \"items\": %zu, \"bytes\": %zu, \"items_per_sec\": %.1f, \"bytes_per_sec\": %.1f}",
+            i == 0U ? "" : ",", r->group, r->name, r->runs, r->minNs, r->medianNs, r->meanNs, r->maxNs, r->counters.items, r->counters.bytes,
+            seconds > 0 ? r->counters.items / seconds : 0, seconds > 0 ? r->counters.bytes / seconds : 0);
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+}
+
+static void print_results_as_text(FILE * file, const BenchResult results[], const size_t n) {
+    fprintf(file, "%-32s %6s %14s %14s %14s %14s\n", "benchmark", "runs", "min(ms)", "median(ms)", "items/s", "MiB/s");
+
+    for (size_t i = 0U; i < n; i++) {
+        const BenchResult * r = &results[i];
+
+        char name[64];
+
+        snprintf(name, 64, "%s.%s", r->group, r->name);
+
+        double seconds = r->medianNs / 1e9;
+
+        fprintf(file, "%-32s %6u %14.3f %14.3f %14.1f %14.2f\n", name, r->runs, r->minNs / 1e6, r->medianNs / 1e6,
+            seconds > 0 ? r->counters.items / seconds : 0, seconds > 0 ? r->counters.bytes / seconds / 1048576 : 0);
+    }
+}
+
+static int generate(int argc, char* argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s generate formula-repo <XCPKG_HOME> [-n <PACKAGE-COUNT>] [-m <DEP-COUNT>] [--name=<REPO-NAME>] [--seed=<N>]\n", argv[0]);
+        fprintf(stderr, "       %s generate source-tree  <DIR> [-n <FILE-COUNT>] [-s <AVERAGE-FILE-SIZE>] [--seed=<N>]\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    size_t n = 1000U;
+    size_t m = 3U;
+    size_t s = 4096U;
+
+    unsigned int seed = 1U;
+
+    const char * repoName = "synthetic";
+
+    for (int i = 4; i < argc; i++) {
+        if ((strcmp(argv[i], "-n") == 0 || strcmp(argv[i], "-m") == 0 || strcmp(argv[i], "-s") == 0) && i + 1 < argc) {
+            char * end;
+
+            errno = 0;
+
+            unsigned long long v = strtoull(argv[i + 1], &end, 10);
+
+            if (errno != 0 || end[0] != '\0' || end == argv[i + 1]) {
+                fprintf(stderr, "%s: invalid value for %s\n", argv[i + 1], argv[i]);
+                return XCPKG_ERROR_ARG_IS_INVALID;
+            }
+
+            switch (argv[i][1]) {
+                case 'n': n = (size_t)v; break;
+                case 'm': m = (size_t)v; break;
+                case 's': s = (size_t)v; break;
+            }
+
+            i++;
+        } else if (strncmp(argv[i], "--name=", 7) == 0) {
+            repoName = argv[i] + 7;
+        } else if (strncmp(argv[i], "--seed=", 7) == 0) {
+            seed = (unsigned int)strtoul(argv[i] + 7, NULL, 10);
+        } else {
+            fprintf(stderr, "unrecognized argument: %s\n", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        }
+    }
+
+    if (strcmp(argv[2], "formula-repo") == 0) {
+        return synthetic_formula_repo_create(argv[3], repoName, n, m, seed) == 0 ? XCPKG_OK : XCPKG_ERROR;
+    }
+
+    if (strcmp(argv[2], "source-tree") == 0) {
+        size_t totalSize;
+
+        if (synthetic_source_tree_create(argv[3], n, s, 100U, seed, &totalSize) != 0) {
+            return XCPKG_ERROR;
+        }
+
+        printf("%zu files, %zu bytes\n", n, totalSize);
+
+        return XCPKG_OK;
+    }
+
+    fprintf(stderr, "unrecognized argument: %s\n", argv[2]);
+    return XCPKG_ERROR_ARG_IS_UNKNOWN;
+}
+
+static int show_help(const char * arg0) {
+    printf("Usage: %s [--quick] [--scale=<FLOAT>] [--filter=<SUBSTR>] [--workdir=<DIR>] [--format=json|text] [-o <FILE>] [--list]\n", arg0);
+    printf("       %s generate formula-repo|source-tree ...\n", arg0);
+    return XCPKG_OK;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "generate") == 0) {
+        return generate(argc, argv);
+    }
+
+    BenchConfig config = { .workDIR = NULL, .scale = 1, .minRuns = 5U, .minSeconds = 1 };
+
+    const char * filter = NULL;
+    const char * outputFilePath = NULL;
+    const char * workDIR = NULL;
+
+    bool json = true;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            return show_help(argv[0]);
+        } else if (strcmp(argv[i], "--quick") == 0) {
+            config.scale = 0.1;
+            config.minRuns = 3U;
+            config.minSeconds = 0.2;
+        } else if (strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else if (strncmp(argv[i], "--scale=", 8) == 0) {
+            config.scale = strtod(argv[i] + 8, NULL);
+
+            if (config.scale <= 0) {
+                fprintf(stderr, "--scale=<FLOAT>, FLOAT should be a positive number.\n");
+                return XCPKG_ERROR_ARG_IS_INVALID;
+            }
+        } else if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        } else if (strncmp(argv[i], "--workdir=", 10) == 0) {
+            workDIR = argv[i] + 10;
+        } else if (strcmp(argv[i], "--format=json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--format=text") == 0) {
+            json = false;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputFilePath = argv[++i];
+        } else {
+            fprintf(stderr, "unrecognized argument: %s\n", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        }
+    }
+
+    if (list) {
+        for (size_t g = 0U; g < GROUP_COUNT; g++) {
+            for (const Benchmark * b = groups[g].benchmarks; b->name != NULL; b++) {
+                printf("%s.%s\n", groups[g].name, b->name);
+            }
+        }
+
+        return XCPKG_OK;
+    }
+
+    //////////////////////////////////////////////////////////////////
+
+    char workDIRBuf[PATH_MAX];
+
+    if (workDIR == NULL) {
+        const char * tmpDIR = getenv("TMPDIR");
+
+        if (tmpDIR == NULL || tmpDIR[0] == '\0') {
+            tmpDIR = "/tmp";
+        }
+
+        int ret = snprintf(workDIRBuf, PATH_MAX, "%s/xcpkg-bench-%d", tmpDIR, getpid());
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        workDIR = workDIRBuf;
+    }
+
+    config.workDIR = workDIR;
+
+    if (xcpkg_mkdir_p(workDIR, false) != XCPKG_OK) {
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////
+
+    size_t capacity = 0U;
+
+    for (size_t g = 0U; g < GROUP_COUNT; g++) {
+        for (const Benchmark * b = groups[g].benchmarks; b->name != NULL; b++) {
+            capacity++;
+        }
+    }
+
+    BenchResult results[capacity == 0U ? 1U : capacity];
+
+    size_t n = 0U;
+
+    int ret = XCPKG_OK;
+
+    for (size_t g = 0U; g < GROUP_COUNT; g++) {
+        for (const Benchmark * b = groups[g].benchmarks; b->name != NULL; b++) {
+            if (filter != NULL) {
+                char name[64];
+
+                snprintf(name, 64, "%s.%s", groups[g].name, b->name);
+
+                if (strstr(name, filter) == NULL) {
+                    continue;
+                }
+            }
+
+            if (run_a_benchmark(&config, groups[g].name, b, &results[n]) == 0) {
+                n++;
+            } else {
+                ret = XCPKG_ERROR;
+            }
+        }
+    }
+
+    // the work directory is removed only when we created it
+    if (workDIR == workDIRBuf) {
+        xcpkg_rm_rf(workDIR, false, false);
+    }
+
+    //////////////////////////////////////////////////////////////////
+
+    FILE * outputFile = stdout;
+
+    if (outputFilePath != NULL) {
+        outputFile = fopen(outputFilePath, "w");
+
+        if (outputFile == NULL) {
+            perror(outputFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    if (json) {
+        print_results_as_json(outputFile, &config, results, n);
+    } else {
+        print_results_as_text(outputFile, results, n);
+    }
+
+    if (outputFile != stdout) {
+        if (fclose(outputFile) != 0) {
+            perror(outputFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    return ret;
+}
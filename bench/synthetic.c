@@ -0,0 +1,311 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <limits.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../src/xcpkg.h"
+
+#include "synthetic.h"
+
+// xorshift64*, it is good enough for generating data, and it is the same on every platform
+static uint64_t next_random(uint64_t * state) {
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+
+    *state = x;
+
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static const char * const words[] = {
+    "static", "int", "const", "char", "return", "if", "else", "for", "while", "size_t", "struct", "void",
+    "NULL", "0U", "ret", "buf", "len", "ptr", "(", ")", "{", "}", ";", "=", "==", "!=", "->", "+", "&&",
+    "XCPKG_OK", "XCPKG_ERROR", "perror", "snprintf", "strlen", "memcpy", "malloc", "free", "goto", "finalize",
+};
+
+#define WORD_COUNT (sizeof(words) / sizeof(words[0]))
+
+static void fill_text(char buf[], const size_t size, uint64_t * state) {
+    size_t written = 0U;
+    size_t column  = 0U;
+
+    while (written < size) {
+        const char * word = words[next_random(state) % WORD_COUNT];
+
+        size_t len = strlen(word);
+
+        if (written + len + 1U > size) {
+            len = size - written - 1U;
+        }
+
+        memcpy(buf + written, word, len);
+
+        column  += len + 1U;
+        written += len + 1U;
+
+        if (column > 72U) {
+            buf[written - 1U] = '\n';
+            column = 0U;
+        } else {
+            buf[written - 1U] = ' ';
+        }
+    }
+}
+
+void synthetic_text(char buf[], const size_t size, const unsigned int seed) {
+    uint64_t state = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 2);
+    fill_text(buf, size, &state);
+}
+
+int synthetic_package_name(char buf[], const size_t bufSize, const char * repoName, const size_t i) {
+    int ret = snprintf(buf, bufSize, "%s-pkg%zu", repoName, i);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int write_a_formula(FILE * file, const char * repoName, const size_t i, const size_t depCount, uint64_t * state) {
+    char packageName[64];
+
+    if (synthetic_package_name(packageName, 64, repoName, i) != 0) {
+        return -1;
+    }
+
+    char sha[65];
+
+    for (int k = 0; k < 64; k += 16) {
+        snprintf(sha + k, 17, "%016llx", (unsigned long long)next_random(state));
+    }
+
+    unsigned int major = (unsigned int)(next_random(state) % 5U);
+    unsigned int minor = (unsigned int)(next_random(state) % 30U);
+
+    fprintf(file, "summary: %s is a synthetic package for measuring how fast the formulas are handled\n", packageName);
+    fprintf(file, "license: MIT\n");
+    fprintf(file, "web-url: https://example.invalid/%s/%s\n", repoName, packageName);
+    fprintf(file, "src-url: https://example.invalid/%s/releases/%s-%u.%u.%zu.tar.gz\n", repoName, packageName, major, minor, i % 10U);
+    fprintf(file, "src-sha: %s\n", sha);
+
+    // the dependencies are picked from the packages before this one
+    size_t n = depCount < i ? depCount : i;
+
+    if (n != 0U) {
+        fprintf(file, "dep-pkg: ");
+
+        size_t start = (size_t)(next_random(state) % i);
+
+        // consecutive packages, so no one is listed twice
+        for (size_t k = 0U; k < n; k++) {
+            size_t dep = (start + k) % i;
+
+            fprintf(file, k == 0U ? "%s-pkg%zu" : " %s-pkg%zu", repoName, dep);
+        }
+
+        fprintf(file, "\n");
+    }
+
+    fprintf(file, "ccflags: -DSYNTHETIC_PACKAGE_%zu=1 -fno-common\n", i);
+    fprintf(file, "ldflags: -Wl,-dead_strip\n");
+    fprintf(file, "bsystem: cmake\n\n");
+
+    fprintf(file, "dopatch: |\n");
+    fprintf(file, "    sed -i 's|-Werror||g' CMakeLists.txt\n\n");
+
+    fprintf(file, "install: |\n");
+    fprintf(file, "    cmakew \\\n");
+
+    size_t optionCount = 8U + (size_t)(next_random(state) % 40U);
+
+    for (size_t k = 0U; k < optionCount; k++) {
+        fprintf(file, "        -DSYNTHETIC_OPTION_%zu_%llu=%s \\\n", k, (unsigned long long)(next_random(state) % 1000U), (next_random(state) & 1U) ? "ON" : "OFF");
+    }
+
+    fprintf(file, "        -DBUILD_TESTING=OFF\n");
+
+    return ferror(file) ? -1 : 0;
+}
+
+int synthetic_formula_repo_create(const char * xcpkgHomeDIR, const char * repoName, const size_t packageCount, const size_t depCount, const unsigned int seed) {
+    char formulaDIR[PATH_MAX];
+
+    int ret = snprintf(formulaDIR, PATH_MAX, "%s/repos.d/%s/formula", xcpkgHomeDIR, repoName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    if (xcpkg_mkdir_p(formulaDIR, false) != XCPKG_OK) {
+        return -1;
+    }
+
+    char filePath[PATH_MAX];
+
+    ret = snprintf(filePath, PATH_MAX, "%s/repos.d/%s/%s", xcpkgHomeDIR, repoName, XCPKG_FORMULA_REPO_CONFIG_FILENAME);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    FILE * file = fopen(filePath, "w");
+
+    if (file == NULL) {
+        perror(filePath);
+        return -1;
+    }
+
+    fprintf(file, "url: https://example.invalid/%s.git\nbranch: master\npinned: 0\nenabled: 1\ncreated: 1700000000\nupdated: 1700000000\n", repoName);
+
+    if (fclose(file) != 0) {
+        perror(filePath);
+        return -1;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL ^ seed;
+
+    for (size_t i = 0U; i < packageCount; i++) {
+        ret = snprintf(filePath, PATH_MAX, "%s/%s-pkg%zu.yml", formulaDIR, repoName, i);
+
+        if (ret < 0) {
+            perror(NULL);
+            return -1;
+        }
+
+        file = fopen(filePath, "w");
+
+        if (file == NULL) {
+            perror(filePath);
+            return -1;
+        }
+
+        ret = write_a_formula(file, repoName, i, depCount, &state);
+
+        if (fclose(file) != 0 || ret != 0) {
+            perror(filePath);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int synthetic_source_tree_create(const char * dir, const size_t fileCount, const size_t averageFileSize, const size_t filesPerDIR, const unsigned int seed, size_t * totalSize) {
+    uint64_t state = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)seed << 1);
+
+    size_t total = 0U;
+
+    char subDIR[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    char * buf = NULL;
+    size_t bufCapacity = 0U;
+
+    for (size_t i = 0U; i < fileCount; i++) {
+        int ret = snprintf(subDIR, PATH_MAX, "%s/d%04zu", dir, i / filesPerDIR);
+
+        if (ret < 0) {
+            perror(NULL);
+            free(buf);
+            return -1;
+        }
+
+        if (i % filesPerDIR == 0U) {
+            if (xcpkg_mkdir_p(subDIR, false) != XCPKG_OK) {
+                free(buf);
+                return -1;
+            }
+        }
+
+        static const char * const suffixes[] = { "c", "h", "c", "txt" };
+
+        const char * suffix = suffixes[i & 3U];
+
+        ret = snprintf(filePath, PATH_MAX, "%s/f%06zu.%s", subDIR, i, suffix);
+
+        if (ret < 0) {
+            perror(NULL);
+            free(buf);
+            return -1;
+        }
+
+        size_t size = averageFileSize / 2U + (size_t)(next_random(&state) % (averageFileSize + 1U));
+
+        if (i % 50U == 49U) {
+            size = averageFileSize * 8U;
+        }
+
+        if (size > bufCapacity) {
+            char * p = (char*)realloc(buf, size);
+
+            if (p == NULL) {
+                perror(NULL);
+                free(buf);
+                return -1;
+            }
+
+            buf = p;
+            bufCapacity = size;
+        }
+
+        fill_text(buf, size, &state);
+
+        FILE * file = fopen(filePath, "w");
+
+        if (file == NULL) {
+            perror(filePath);
+            free(buf);
+            return -1;
+        }
+
+        size_t n = fwrite(buf, 1, size, file);
+
+        if (fclose(file) != 0 || n != size) {
+            perror(filePath);
+            free(buf);
+            return -1;
+        }
+
+        total += size;
+
+        if (i % 100U == 99U) {
+            char linkPath[PATH_MAX];
+            char target[32];
+
+            snprintf(target, 32, "f%06zu.%s", i, suffix);
+
+            ret = snprintf(linkPath, PATH_MAX, "%s/f%06zu.link", subDIR, i);
+
+            if (ret < 0) {
+                perror(NULL);
+                free(buf);
+                return -1;
+            }
+
+            if (symlink(target, linkPath) != 0) {
+                perror(linkPath);
+                free(buf);
+                return -1;
+            }
+        }
+    }
+
+    free(buf);
+
+    if (totalSize != NULL) {
+        (*totalSize) = total;
+    }
+
+    return 0;
+}
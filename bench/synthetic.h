@@ -0,0 +1,36 @@
+#ifndef XCPKG_BENCH_SYNTHETIC_H
+#define XCPKG_BENCH_SYNTHETIC_H
+
+#include <stdlib.h>
+
+/** write the name of the i-th package of the given synthetic formula repository to buf.
+ */
+int synthetic_package_name(char buf[], const size_t bufSize, const char * repoName, const size_t i);
+
+/** fill buf with size bytes of C tokens separated by spaces and line breaks, they compress like real source code.
+ */
+void synthetic_text(char buf[], const size_t size, const unsigned int seed);
+
+/** create a formula repository named repoName under <xcpkgHomeDIR>/repos.d.
+ *
+ *  it has packageCount formulas, every formula depends on at most depCount packages which come before it, so there is no cycle.
+ *  the formulas look like the real ones: summary, urls, sha256sums, flags and a multi-line install script, they are 1K ~ 3K bytes.
+ *
+ *  the same seed always creates the same formulas.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int synthetic_formula_repo_create(const char * xcpkgHomeDIR, const char * repoName, const size_t packageCount, const size_t depCount, const unsigned int seed);
+
+/** create a source tree under dir, it has fileCount files spread over sub-directories which have filesPerDIR files each.
+ *
+ *  most files are around averageFileSize bytes, every 50th file is 8 times as large, every 100th file has a symlink next to it.
+ *  the contents are made of C tokens, so they compress like real source code.
+ *
+ *  the total size of the regular files is stored in *totalSize if it is not NULL.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int synthetic_source_tree_create(const char * dir, const size_t fileCount, const size_t averageFileSize, const size_t filesPerDIR, const unsigned int seed, size_t * totalSize);
+
+#endif
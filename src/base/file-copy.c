@@ -3,6 +3,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "../core/trace.h"
+
 #include "../xcpkg.h"
 
 int xcpkg_copy_file(const char * fromFilePath, const char * toFilePath) {
@@ -21,6 +23,10 @@ int xcpkg_copy_file(const char * fromFilePath, const char * toFilePath) {
         return XCPKG_ERROR;
     }
 
+    uint64_t startTime = trace_now();
+
+    uint64_t copiedBytes = 0U;
+
     unsigned char buf[1024];
 
     for (;;) {
@@ -36,6 +42,7 @@ int xcpkg_copy_file(const char * fromFilePath, const char * toFilePath) {
         if (readSize == 0) {
             close(fromFD);
             close(toFD);
+            trace_record("copy", "xcpkg_copy_file", 1U, copiedBytes, startTime);
             return 0;
         }
 
@@ -54,5 +61,7 @@ int xcpkg_copy_file(const char * fromFilePath, const char * toFilePath) {
             fprintf(stderr, "not fully written to %s\n", toFilePath);
             return XCPKG_ERROR;
         }
+
+        copiedBytes += (uint64_t)writeSize;
     }
 }
@@ -6,12 +6,15 @@
 #include <sys/wait.h>
 
 #include "../core/log.h"
+#include "../core/trace.h"
 
 #include "../xcpkg.h"
 
 int xcpkg_fork_exec(char * cmd) {
     fprintf(stderr, "%s==>%s %s%s%s\n", COLOR_PURPLE, COLOR_OFF, COLOR_GREEN, cmd, COLOR_OFF);
 
+    uint64_t startTime = trace_now();
+
     pid_t pid = fork();
 
     if (pid < 0) {
@@ -68,6 +71,18 @@ int xcpkg_fork_exec(char * cmd) {
             return XCPKG_ERROR;
         }
 
+        if (trace_enabled()) {
+            // the counter is named after argv[0], which is the first word of cmd
+            size_t n = strcspn(cmd, " ");
+
+            char name[n + 1U];
+
+            memcpy(name, cmd, n);
+            name[n] = '\0';
+
+            trace_record("spawn", name, 1U, 0U, startTime);
+        }
+
         if (status == 0) {
             return XCPKG_OK;
         }
@@ -100,6 +115,8 @@ int xcpkg_fork_exec2(const size_t n, ...) {
 
     //////////////////////////////////
 
+    uint64_t startTime = trace_now();
+
     pid_t pid = fork();
 
     if (pid < 0) {
@@ -143,6 +160,8 @@ int xcpkg_fork_exec2(const size_t n, ...) {
             return XCPKG_ERROR;
         }
 
+        trace_record("spawn", argv[0], 1U, 0U, startTime);
+
         if (status == 0) {
             return XCPKG_OK;
         }
@@ -4,6 +4,7 @@
 #include <string.h>
 #include <stdbool.h>
 
+#include <limits.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <sys/stat.h>
@@ -11,18 +12,24 @@
 #include <git2.h>
 
 #include "url-transform.h"
+#include "sha256sum.h"
+
+#include "../core/parallel.h"
 
 #include "../xcpkg.h"
 
 typedef struct {
     git_indexer_progress indexerProgress;
+
+    // where the progress messages are written to
+    FILE * output;
 } ProgressPayload;
 
 // https://libgit2.org/libgit2/#HEAD/group/callback/git_transport_message_cb
 static int git_transport_message_callback(const char * str, int len, void * payload) {
-    (void)payload; /* unused */
-	printf("remote: %.*s", len, str);
-	fflush(stdout);
+    ProgressPayload * progressPayload = (ProgressPayload*)payload;
+	fprintf(progressPayload->output, "remote: %.*s", len, str);
+	fflush(progressPayload->output);
 	return 0;
 }
 
@@ -34,24 +41,24 @@ static int git_indexer_progress_callback(const git_indexer_progress * stats, voi
 }
 
 // https://libgit2.org/libgit2/#HEAD/group/callback/git_checkout_progress_cb
-static void git_checkout_progress_callback(const char * path, size_t completed_steps, size_t total_steps, void * payload) {
+static void git_checkout_progress_callback(const char * path __attribute__((unused)), size_t completed_steps, size_t total_steps, void * payload) {
     if (completed_steps == total_steps) {
         ProgressPayload * progressPayload = (ProgressPayload*)payload;
         git_indexer_progress indexerProgress = progressPayload->indexerProgress;
 
         if (indexerProgress.received_objects != 0) {
-            printf("Receiving objects: 100%% (%u/%u), %.2f KiB, done.\n", indexerProgress.received_objects, indexerProgress.total_objects, indexerProgress.received_bytes / 1024.0);
+            fprintf(progressPayload->output, "Receiving objects: 100%% (%u/%u), %.2f KiB, done.\n", indexerProgress.received_objects, indexerProgress.total_objects, indexerProgress.received_bytes / 1024.0);
         }
 
         if (indexerProgress.indexed_deltas != 0) {
-            printf("Resolving deltas: 100%% (%u/%u), done.\n", indexerProgress.indexed_deltas, indexerProgress.total_deltas);
+            fprintf(progressPayload->output, "Resolving deltas: 100%% (%u/%u), done.\n", indexerProgress.indexed_deltas, indexerProgress.total_deltas);
         }
     }
 }
 
 // https://libgit2.org/libgit2/#HEAD/group/credential/git_credential_ssh_key_new
 // https://libgit2.org/libgit2/#HEAD/group/callback/git_credential_acquire_cb
-static int git_credential_acquire_callback(git_credential ** credential, const char * url, const char * username_from_url, unsigned int allowed_types, void * payload) {
+static int git_credential_acquire_callback(git_credential ** credential, const char * url, const char * username_from_url, unsigned int allowed_types __attribute__((unused)), void * payload __attribute__((unused))) {
     fprintf(stderr, "git_credential_acquire_callback() url=%s\n", url);
     const char * const userHomeDIR = getenv("HOME");
 
@@ -95,11 +102,9 @@ static int git_credential_acquire_callback(git_credential ** credential, const c
     return 1;
 }
 
-static int git_submodule_foreach_callback(git_submodule * submodule, const char * name, void * payload) {
-    // git submodule update --init
-    // https://libgit2.org/libgit2/#HEAD/group/submodule/git_submodule_update
-    return git_submodule_update(submodule, true, NULL);
-}
+// git submodule update --init --recursive --depth=fetchDepth
+// mirrorRootDIR is NULL means fetching from the submodule's remote directly
+static int xcpkg_git_submodule_update_all(git_repository * gitRepo, const char * mirrorRootDIR, const size_t fetchDepth, FILE * output, FILE * errput);
 
 /**
  *  check if the given path is a empty dir
@@ -152,6 +157,13 @@ static int is_empty_dir(const char * const dirpath) {
 // git fetch --progress origin +refs/heads/master:refs/remotes/origin/master
 // git checkout --progress --force -B master refs/remotes/origin/master
 int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const char * remoteRefPath, const char * remoteTrackingRefPath, const char * checkoutToBranchName, const size_t fetchDepth) {
+    return xcpkg_git_sync_with_log(repositoryDIR, remoteUrl, remoteRefPath, remoteTrackingRefPath, checkoutToBranchName, fetchDepth, NULL);
+}
+
+int xcpkg_git_sync_with_log(const char * repositoryDIR, const char * remoteUrl, const char * remoteRefPath, const char * remoteTrackingRefPath, const char * checkoutToBranchName, const size_t fetchDepth, FILE * logFile) {
+    FILE * out = logFile == NULL ? stdout : logFile;
+    FILE * err = logFile == NULL ? stderr : logFile;
+
     //fprintf(stderr, "xcpkg_git_sync() repositoryDIR=%s remoteUrl=%s remoteRefPath=%s remoteTrackingRefPath=%s\n", repositoryDIR, remoteUrl, remoteRefPath, remoteTrackingRefPath);
     if ((repositoryDIR == NULL) || (repositoryDIR[0] == '\0')) {
         repositoryDIR = ".";
@@ -216,11 +228,11 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
                     needInitGitRepo = false;
             }
         } else {
-            fprintf(stderr, "%s exist and it is not a git repository.", repositoryDIR);
+            fprintf(err, "%s exist and it is not a git repository.", repositoryDIR);
             return XCPKG_ERROR;
         }
     } else {
-        fprintf(stderr, "%s dir is not exist.", repositoryDIR);
+        fprintf(err, "%s dir is not exist.", repositoryDIR);
         return XCPKG_ERROR;
     }
 
@@ -258,6 +270,8 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
     const git_error * gitError        = NULL;
 
+    int submoduleUpdateRet = XCPKG_OK;
+
     //////////////////////////////////////////////////////////////////////////////////////////////
 
     char * transformedUrl = NULL;
@@ -267,7 +281,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
         case  1: remoteUrl = transformedUrl;
     }
 
-    fprintf(stderr, "git Fetching: %s\n", remoteUrl);
+    fprintf(err, "git Fetching: %s\n", remoteUrl);
 
     //////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -276,7 +290,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
         if (ret != GIT_OK) {
             gitError = git_error_last();
-            fprintf(stderr, "%s\n", gitError->message);
+            fprintf(err, "%s\n", gitError->message);
             git_repository_state_cleanup(gitRepo);
             git_repository_free(gitRepo);
             git_libgit2_shutdown();
@@ -289,7 +303,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
         if (ret != GIT_OK) {
             gitError = git_error_last();
-            fprintf(stderr, "%s\n", gitError->message);
+            fprintf(err, "%s\n", gitError->message);
             git_repository_state_cleanup(gitRepo);
             git_repository_free(gitRepo);
             git_libgit2_shutdown();
@@ -301,7 +315,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
         if (ret != GIT_OK) {
             gitError = git_error_last();
-            fprintf(stderr, "%s\n", gitError->message);
+            fprintf(err, "%s\n", gitError->message);
             git_repository_state_cleanup(gitRepo);
             git_repository_free(gitRepo);
             git_libgit2_shutdown();
@@ -321,7 +335,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
         if (ret != GIT_OK) {
             gitError = git_error_last();
-            fprintf(stderr, "%s\n", gitError->message);
+            fprintf(err, "%s\n", gitError->message);
             git_repository_state_cleanup(gitRepo);
             git_repository_free(gitRepo);
             git_libgit2_shutdown();
@@ -332,16 +346,18 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
     //////////////////////////////////////////////////////////////////////////////////////////////
 
-    ProgressPayload progressPayload = {0};
+    ProgressPayload progressPayload = { .output = out };
 
-    git_remote_callbacks gitRemoteCallbacks = GIT_REMOTE_CALLBACKS_INIT;
+    git_remote_callbacks gitRemoteCallbacks;
+    git_remote_init_callbacks(&gitRemoteCallbacks, GIT_REMOTE_CALLBACKS_VERSION);
 
 	gitRemoteCallbacks.sideband_progress = git_transport_message_callback;
 	gitRemoteCallbacks.transfer_progress = git_indexer_progress_callback;
 	gitRemoteCallbacks.credentials       = git_credential_acquire_callback;
 	gitRemoteCallbacks.payload           = &progressPayload;
 
-    git_fetch_options gitFetchOptions = GIT_FETCH_OPTIONS_INIT;
+    git_fetch_options gitFetchOptions;
+    git_fetch_options_init(&gitFetchOptions, GIT_FETCH_OPTIONS_VERSION);
     gitFetchOptions.callbacks = gitRemoteCallbacks;
     gitFetchOptions.download_tags = (fetchDepth == 0U) ? GIT_REMOTE_DOWNLOAD_TAGS_ALL : GIT_REMOTE_DOWNLOAD_TAGS_NONE;
 
@@ -350,7 +366,8 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
     gitFetchOptions.depth = (int)fetchDepth;
 #endif
 
-    git_checkout_options gitCheckoutOptions = GIT_CHECKOUT_OPTIONS_INIT;
+    git_checkout_options gitCheckoutOptions;
+    git_checkout_options_init(&gitCheckoutOptions, GIT_CHECKOUT_OPTIONS_VERSION);
     gitCheckoutOptions.checkout_strategy    = GIT_CHECKOUT_FORCE;
     gitCheckoutOptions.progress_cb          = git_checkout_progress_callback;
     gitCheckoutOptions.progress_payload     = &progressPayload;
@@ -394,7 +411,7 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
     }
 
     for (size_t i = 0U; i < refs.count; i++) {
-        printf("ref:%s\n", refs.strings[i]);
+        fprintf(out, "ref:%s\n", refs.strings[i]);
         free(refs.strings[i]);
     }
 
@@ -503,19 +520,19 @@ int xcpkg_git_sync(const char * repositoryDIR, const char * remoteUrl, const cha
 
     //////////////////////////////////////////////////////////////////////////////////////////////
 
-    // https://libgit2.org/libgit2/#HEAD/group/submodule/git_submodule_foreach
-    ret = git_submodule_foreach(gitRepo, git_submodule_foreach_callback, gitRepo);
+    submoduleUpdateRet = xcpkg_git_submodule_update_all(gitRepo, NULL, fetchDepth, out, err);
 
-    if (ret != GIT_OK) {
-        gitError = git_error_last();
+    if (submoduleUpdateRet != XCPKG_OK) {
+        // the error has been reported
+        ret = GIT_ERROR;
     }
 
 finalize:
     if (ret == GIT_OK) {
-        printf("%s\n", "Already up to date.");
+        fprintf(out, "%s\n", "Already up to date.");
     } else {
         if (gitError != NULL) {
-            fprintf(stderr, "%s\n", gitError->message);
+            fprintf(err, "%s\n", gitError->message);
         }
     }
 
@@ -539,5 +556,973 @@ finalize:
 
     git_libgit2_shutdown();
 
+    if (submoduleUpdateRet != XCPKG_OK) {
+        return submoduleUpdateRet;
+    }
+
     return ret == GIT_OK ? XCPKG_OK : abs(ret) + XCPKG_ERROR_LIBGIT2_BASE;
 }
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+static int report_git_error_to(FILE * errput, const int ret) {
+    const git_error * gitError = git_error_last();
+
+    if (gitError != NULL) {
+        fprintf(errput, "%s\n", gitError->message);
+    }
+
+    return abs(ret) + XCPKG_ERROR_LIBGIT2_BASE;
+}
+
+static bool is_a_commit_id(const char * p) {
+    for (int i = 0; i < 40; i++) {
+        const char c = p[i];
+
+        if (!(((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'f')) || ((c >= 'A') && (c <= 'F')))) {
+            return false;
+        }
+    }
+
+    return p[40] == '\0';
+}
+
+// every remote url has its own mirror, named after the sha256sum of the url
+static int xcpkg_git_mirror_path(char mirrorDIR[PATH_MAX], const char * mirrorRootDIR, const char * remoteUrl) {
+    char remoteUrlSHA256[65] = {0};
+
+    int ret = sha256sum_of_string(remoteUrlSHA256, remoteUrl);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = snprintf(mirrorDIR, PATH_MAX, "%s/git-mirrors/%s.git", mirrorRootDIR, remoteUrlSHA256);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+// git init --bare
+// the mirror is initialized in a temporary directory then renamed, so that others never see a half initialized mirror
+static int xcpkg_git_mirror_open(git_repository ** gitRepo, const char * mirrorDIR, FILE * errput) {
+    struct stat st;
+
+    if (stat(mirrorDIR, &st) != 0) {
+        char tmpDIR[PATH_MAX];
+
+        int ret = snprintf(tmpDIR, PATH_MAX, "%s.%d.tmp", mirrorDIR, getpid());
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        git_repository * tmpRepo = NULL;
+
+        ret = git_repository_init(&tmpRepo, tmpDIR, true);
+
+        git_repository_free(tmpRepo);
+
+        if (ret != GIT_OK) {
+            return report_git_error_to(errput, ret);
+        }
+
+        if (rename(tmpDIR, mirrorDIR) != 0) {
+            // someone else has created it in the meantime
+            if (errno == EEXIST || errno == ENOTEMPTY) {
+                ret = xcpkg_rm_rf(tmpDIR, false, false);
+
+                if (ret != XCPKG_OK) {
+                    return ret;
+                }
+            } else {
+                perror(mirrorDIR);
+                return XCPKG_ERROR;
+            }
+        }
+    }
+
+    int ret = git_repository_open_ext(gitRepo, mirrorDIR, GIT_REPOSITORY_OPEN_NO_SEARCH | GIT_REPOSITORY_OPEN_BARE, NULL);
+
+    if (ret != GIT_OK) {
+        return report_git_error_to(errput, ret);
+    }
+
+    return XCPKG_OK;
+}
+
+// git fetch --progress origin refspec...
+static int xcpkg_git_fetch_refspecs(git_repository * gitRepo, const char * remoteUrl, char * refspecs[], const size_t refspecCount, const size_t fetchDepth, FILE * output, FILE * errput) {
+    char * transformedUrl = NULL;
+
+    switch (transform_url(remoteUrl, &transformedUrl)) {
+        case -1: return XCPKG_ERROR_MEMORY_ALLOCATE;
+        case  1: remoteUrl = transformedUrl;
+    }
+
+    fprintf(errput, "git Fetching: %s\n", remoteUrl);
+
+    git_remote * gitRemote = NULL;
+
+    int ret = git_remote_lookup(&gitRemote, gitRepo, "origin");
+
+    if (ret == GIT_ENOTFOUND) {
+        ret = git_remote_create(&gitRemote, gitRepo, "origin", remoteUrl);
+    } else if (ret == GIT_OK) {
+        ret = git_remote_set_instance_url(gitRemote, remoteUrl);
+    }
+
+    if (ret == GIT_OK) {
+        ProgressPayload progressPayload = { .output = output };
+
+        git_fetch_options gitFetchOptions;
+        git_fetch_options_init(&gitFetchOptions, GIT_FETCH_OPTIONS_VERSION);
+
+        gitFetchOptions.callbacks.sideband_progress = git_transport_message_callback;
+        gitFetchOptions.callbacks.transfer_progress = git_indexer_progress_callback;
+        gitFetchOptions.callbacks.credentials       = git_credential_acquire_callback;
+        gitFetchOptions.callbacks.payload           = &progressPayload;
+
+        gitFetchOptions.download_tags = (fetchDepth == 0U) ? GIT_REMOTE_DOWNLOAD_TAGS_ALL : GIT_REMOTE_DOWNLOAD_TAGS_NONE;
+
+        // this feature was introduced in libgit2-1.7.0
+#if ((LIBGIT2_VER_MAJOR == 1) && (LIBGIT2_VER_MINOR >= 7)) || (LIBGIT2_VER_MAJOR > 1)
+        gitFetchOptions.depth = (int)fetchDepth;
+#endif
+
+        git_strarray refspecArray = { .strings = refspecs, .count = refspecCount };
+
+        // only the objects which the mirror does not have yet are transferred
+        ret = git_remote_fetch(gitRemote, &refspecArray, &gitFetchOptions, NULL);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+    }
+
+    git_remote_free(gitRemote);
+
+    free(transformedUrl);
+
+    return ret;
+}
+
+static int xcpkg_git_fetch_refspec(git_repository * gitRepo, const char * remoteUrl, const char * refspec, const size_t fetchDepth, FILE * output, FILE * errput) {
+    char * refspecs[1] = { (char*)refspec };
+
+    return xcpkg_git_fetch_refspecs(gitRepo, remoteUrl, refspecs, 1U, fetchDepth, output, errput);
+}
+
+// a commit id is only accepted as a refspec by a server which sets uploadpack.allowReachableSHA1InWant, otherwise all the branches and the tags are fetched in full, commitId is then expected to be reachable from one of them
+static int xcpkg_git_fetch_default_refs(git_repository * gitRepo, const char * remoteUrl, const char * commitId, const char * headsRefPath, const char * tagsRefPath, FILE * output, FILE * errput) {
+    fprintf(errput, "commit %s could not be fetched by its id, fetching the branches and the tags instead.\n", commitId);
+
+    char headsRefspec[PATH_MAX];
+    char tagsRefspec[PATH_MAX];
+
+    int ret = snprintf(headsRefspec, PATH_MAX, "+refs/heads/*:%s/*", headsRefPath);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    ret = snprintf(tagsRefspec, PATH_MAX, "+refs/tags/*:%s/*", tagsRefPath);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    char * refspecs[2] = { headsRefspec, tagsRefspec };
+
+    return xcpkg_git_fetch_refspecs(gitRepo, remoteUrl, refspecs, 2U, 0U, output, errput);
+}
+
+// the progress and the errors are written to output and errput, a submodule job writes them to the streams of its sync
+static int xcpkg_git_mirror_fetch_to(const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const size_t fetchDepth, char mirrorDIR[], char commitId[41], FILE * output, FILE * errput) {
+    if (mirrorRootDIR == NULL || remoteUrl == NULL || remoteRef == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (mirrorRootDIR[0] == '\0' || remoteUrl[0] == '\0' || remoteRef[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    char mirrorDIRBuf[PATH_MAX];
+
+    if (mirrorDIR == NULL) {
+        mirrorDIR = mirrorDIRBuf;
+    }
+
+    int ret = xcpkg_git_mirror_path(mirrorDIR, mirrorRootDIR, remoteUrl);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char mirrorsDIR[PATH_MAX];
+
+    ret = snprintf(mirrorsDIR, PATH_MAX, "%s/git-mirrors", mirrorRootDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    ret = xcpkg_mkdir_p(mirrorsDIR, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    const bool remoteRefIsACommitId = is_a_commit_id(remoteRef);
+
+    // the fetched commit is referenced under refs/xcpkg/ so that it is never pruned from the mirror
+    char mirrorRefPath[PATH_MAX];
+
+    if (remoteRefIsACommitId) {
+        ret = snprintf(mirrorRefPath, PATH_MAX, "refs/xcpkg/commits/%s", remoteRef);
+    } else if (strncmp(remoteRef, "refs/", 5) == 0) {
+        ret = snprintf(mirrorRefPath, PATH_MAX, "refs/xcpkg/%s", remoteRef + 5);
+    } else {
+        ret = snprintf(mirrorRefPath, PATH_MAX, "refs/xcpkg/%s", remoteRef);
+    }
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    git_libgit2_init();
+
+    git_repository * gitRepo = NULL;
+    git_reference  * gitRef  = NULL;
+    git_object     * gitCommit = NULL;
+
+    ret = xcpkg_git_mirror_open(&gitRepo, mirrorDIR, errput);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    bool needFetch = true;
+
+    if (remoteRefIsACommitId) {
+        git_oid oid;
+
+        ret = git_oid_fromstr(&oid, remoteRef);
+
+        if (ret != GIT_OK) {
+            ret = report_git_error_to(errput, ret);
+            goto finalize;
+        }
+
+        // a pinned commit never changes, if the mirror already has it, there is no need to touch the network
+        if (git_object_lookup(&gitCommit, gitRepo, &oid, GIT_OBJECT_COMMIT) == GIT_OK) {
+            ret = git_reference_create(&gitRef, gitRepo, mirrorRefPath, &oid, true, NULL);
+
+            if (ret != GIT_OK) {
+                ret = report_git_error_to(errput, ret);
+                goto finalize;
+            }
+
+            fprintf(errput, "git Using mirror: %s %s\n", remoteUrl, remoteRef);
+
+            needFetch = false;
+        }
+    }
+
+    if (needFetch) {
+        size_t refspecCapacity = strlen(remoteRef) + strlen(mirrorRefPath) + 3U;
+        char   refspec[refspecCapacity];
+
+        ret = snprintf(refspec, refspecCapacity, "+%s:%s", remoteRef, mirrorRefPath);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        ret = xcpkg_git_fetch_refspec(gitRepo, remoteUrl, refspec, fetchDepth, output, errput);
+
+        if (ret != XCPKG_OK && remoteRefIsACommitId) {
+            ret = xcpkg_git_fetch_default_refs(gitRepo, remoteUrl, remoteRef, "refs/xcpkg/heads", "refs/xcpkg/tags", output, errput);
+
+            if (ret == XCPKG_OK) {
+                git_oid oid;
+
+                ret = git_oid_fromstr(&oid, remoteRef);
+
+                // fails if the commit is still missing
+                if (ret == GIT_OK) {
+                    ret = git_reference_create(&gitRef, gitRepo, mirrorRefPath, &oid, true, NULL);
+                }
+
+                if (ret != GIT_OK) {
+                    ret = report_git_error_to(errput, ret);
+                    goto finalize;
+                }
+
+                git_reference_free(gitRef);
+                gitRef = NULL;
+            }
+        }
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+
+        ret = git_reference_lookup(&gitRef, gitRepo, mirrorRefPath);
+
+        if (ret != GIT_OK) {
+            ret = report_git_error_to(errput, ret);
+            goto finalize;
+        }
+
+        ret = git_reference_peel(&gitCommit, gitRef, GIT_OBJECT_COMMIT);
+
+        if (ret != GIT_OK) {
+            ret = report_git_error_to(errput, ret);
+            goto finalize;
+        }
+    }
+
+    if (commitId != NULL) {
+        git_oid_tostr(commitId, 41, git_object_id(gitCommit));
+    }
+
+    ret = XCPKG_OK;
+
+finalize:
+    git_object_free(gitCommit);
+    git_reference_free(gitRef);
+    git_repository_free(gitRepo);
+
+    git_libgit2_shutdown();
+
+    return ret;
+}
+
+int xcpkg_git_mirror_fetch(const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const size_t fetchDepth, char mirrorDIR[], char commitId[41]) {
+    return xcpkg_git_mirror_fetch_to(mirrorRootDIR, remoteUrl, remoteRef, fetchDepth, mirrorDIR, commitId, stdout, stderr);
+}
+
+// let the objects of the working repository be looked up from the mirror, so that they are never copied
+// https://git-scm.com/docs/gitrepository-layout#Documentation/gitrepository-layout.txt-objectsinfoalternates
+static int xcpkg_git_use_mirror_as_alternate(git_repository * gitRepo, const char * mirrorDIR, FILE * errput) {
+    const char * gitDIR = git_repository_path(gitRepo);
+
+    char mirrorObjectsDIR[PATH_MAX];
+
+    int ret = snprintf(mirrorObjectsDIR, PATH_MAX, "%s/objects", mirrorDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    char alternatesFilePath[PATH_MAX];
+
+    ret = snprintf(alternatesFilePath, PATH_MAX, "%sobjects/info/alternates", gitDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * file = fopen(alternatesFilePath, "w");
+
+    if (file == NULL) {
+        perror(alternatesFilePath);
+        return XCPKG_ERROR;
+    }
+
+    fprintf(file, "%s\n", mirrorObjectsDIR);
+
+    if (fclose(file) != 0) {
+        perror(alternatesFilePath);
+        return XCPKG_ERROR;
+    }
+
+    // a shallow mirror makes a shallow working repository, otherwise git would look for the missing parents
+    char mirrorShallowFilePath[PATH_MAX];
+
+    ret = snprintf(mirrorShallowFilePath, PATH_MAX, "%s/shallow", mirrorDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    char shallowFilePath[PATH_MAX];
+
+    ret = snprintf(shallowFilePath, PATH_MAX, "%sshallow", gitDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (stat(mirrorShallowFilePath, &st) == 0) {
+        ret = xcpkg_copy_file(mirrorShallowFilePath, shallowFilePath);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    } else {
+        if (unlink(shallowFilePath) != 0 && errno != ENOENT) {
+            perror(shallowFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    // the alternates file is read when the repository is opened, the running one has to be told explicitly
+    git_odb * gitOdb = NULL;
+
+    ret = git_repository_odb(&gitOdb, gitRepo);
+
+    if (ret == GIT_OK) {
+        ret = git_odb_add_disk_alternate(gitOdb, mirrorObjectsDIR);
+    }
+
+    git_odb_free(gitOdb);
+
+    if (ret != GIT_OK) {
+        return report_git_error_to(errput, ret);
+    }
+
+    return XCPKG_OK;
+}
+
+// implement following steps:
+// git -c init.defaultBranch=master init
+// echo "$MIRROR_DIR/objects" > .git/objects/info/alternates
+// git remote add origin https://github.com/leleliu008/xcpkg-formula-repository-official-core.git
+// git update-ref refs/remotes/origin/master $COMMIT_ID
+// git checkout --progress --force -B master refs/remotes/origin/master
+static int xcpkg_git_checkout_from_mirror(const char * repositoryDIR, const char * mirrorRootDIR, const char * mirrorDIR, const char * commitId, const char * remoteUrl, const char * remoteTrackingRefPath, const char * checkoutToBranchName, const size_t fetchDepth, FILE * output, FILE * errput) {
+    bool needInitGitRepo = false;
+
+    struct stat st;
+
+    if (stat(repositoryDIR, &st) == 0) {
+        if (S_ISDIR(st.st_mode)) {
+            switch (is_empty_dir(repositoryDIR)) {
+                case -1:
+                    perror(repositoryDIR);
+                    return XCPKG_ERROR;
+                case 0:
+                    needInitGitRepo = true;
+                    break;
+                case 1:
+                    needInitGitRepo = false;
+            }
+        } else {
+            fprintf(errput, "%s exist and it is not a git repository.", repositoryDIR);
+            return XCPKG_ERROR;
+        }
+    } else {
+        fprintf(errput, "%s dir is not exist.", repositoryDIR);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t checkoutToBranchRefPathLength = strlen(checkoutToBranchName) + 12U;
+    char   checkoutToBranchRefPath[checkoutToBranchRefPathLength];
+
+    int ret = snprintf(checkoutToBranchRefPath, checkoutToBranchRefPathLength, "refs/heads/%s", checkoutToBranchName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    git_repository * gitRepo   = NULL;
+    git_remote     * gitRemote = NULL;
+    git_reference  * gitRef    = NULL;
+    git_commit     * gitCommit = NULL;
+    git_tree       * gitTree   = NULL;
+
+    if (needInitGitRepo) {
+        ret = git_repository_init(&gitRepo, repositoryDIR, false);
+    } else {
+        ret = git_repository_open_ext(&gitRepo, repositoryDIR, GIT_REPOSITORY_OPEN_NO_SEARCH, NULL);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+        goto finalize;
+    }
+
+    ret = xcpkg_git_use_mirror_as_alternate(gitRepo, mirrorDIR, errput);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    // build scripts may ask for the url of origin
+    ret = git_remote_lookup(&gitRemote, gitRepo, "origin");
+
+    if (ret == GIT_ENOTFOUND) {
+        ret = git_remote_create(&gitRemote, gitRepo, "origin", remoteUrl);
+    } else if (ret == GIT_OK) {
+        ret = git_remote_set_url(gitRepo, "origin", remoteUrl);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+        goto finalize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    git_oid oid;
+
+    ret = git_oid_fromstr(&oid, commitId);
+
+    if (ret == GIT_OK) {
+        ret = git_commit_lookup(&gitCommit, gitRepo, &oid);
+    }
+
+    if (ret == GIT_OK) {
+        ret = git_commit_tree(&gitTree, gitCommit);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+        goto finalize;
+    }
+
+    ProgressPayload progressPayload = { .output = output };
+
+    git_checkout_options gitCheckoutOptions;
+    git_checkout_options_init(&gitCheckoutOptions, GIT_CHECKOUT_OPTIONS_VERSION);
+    gitCheckoutOptions.checkout_strategy    = GIT_CHECKOUT_FORCE;
+    gitCheckoutOptions.progress_cb          = git_checkout_progress_callback;
+    gitCheckoutOptions.progress_payload     = &progressPayload;
+
+    // https://libgit2.org/libgit2/#HEAD/group/checkout/git_checkout_tree
+    ret = git_checkout_tree(gitRepo, (git_object*)gitTree, &gitCheckoutOptions);
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+        goto finalize;
+    }
+
+    ret = git_reference_create(&gitRef, gitRepo, remoteTrackingRefPath, &oid, true, NULL);
+
+    if (ret == GIT_OK) {
+        git_reference_free(gitRef);
+        gitRef = NULL;
+
+        ret = git_reference_create(&gitRef, gitRepo, checkoutToBranchRefPath, &oid, true, NULL);
+    }
+
+    if (ret == GIT_OK) {
+        ret = git_repository_set_head(gitRepo, checkoutToBranchRefPath);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(errput, ret);
+        goto finalize;
+    }
+
+    // every submodule is fetched into its own mirror too
+    ret = xcpkg_git_submodule_update_all(gitRepo, mirrorRootDIR, fetchDepth, output, errput);
+
+finalize:
+    git_tree_free(gitTree);
+    git_commit_free(gitCommit);
+    git_reference_free(gitRef);
+    git_remote_free(gitRemote);
+    git_repository_free(gitRepo);
+
+    return ret;
+}
+
+int xcpkg_git_sync_via_mirror(const char * repositoryDIR, const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRefPath, const char * checkoutToBranchName, const size_t fetchDepth) {
+    return xcpkg_git_sync_via_mirror_with_log(repositoryDIR, mirrorRootDIR, remoteUrl, remoteRef, remoteTrackingRefPath, checkoutToBranchName, fetchDepth, NULL);
+}
+
+int xcpkg_git_sync_via_mirror_with_log(const char * repositoryDIR, const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRefPath, const char * checkoutToBranchName, const size_t fetchDepth, FILE * logFile) {
+    FILE * out = logFile == NULL ? stdout : logFile;
+    FILE * err = logFile == NULL ? stderr : logFile;
+
+    if ((repositoryDIR == NULL) || (repositoryDIR[0] == '\0')) {
+        repositoryDIR = ".";
+    }
+
+    if (remoteTrackingRefPath == NULL || checkoutToBranchName == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (remoteTrackingRefPath[0] == '\0' || checkoutToBranchName[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    char mirrorDIR[PATH_MAX];
+    char commitId[41];
+
+    int ret = xcpkg_git_mirror_fetch_to(mirrorRootDIR, remoteUrl, remoteRef, fetchDepth, mirrorDIR, commitId, out, err);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    git_libgit2_init();
+
+    ret = xcpkg_git_checkout_from_mirror(repositoryDIR, mirrorRootDIR, mirrorDIR, commitId, remoteUrl, remoteTrackingRefPath, checkoutToBranchName, fetchDepth, out, err);
+
+    git_libgit2_shutdown();
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    char * name;
+    char * url;
+    char * workDIR;
+
+    // the commit recorded by the superproject
+    char   commitId[41];
+
+    int    ret;
+} SubmoduleJob;
+
+typedef struct {
+    // the submodules of every depth, breadth-first, the nested ones are appended after their superprojects have been checked out
+    SubmoduleJob * jobArray;
+    size_t         jobArraySize;
+    size_t         jobArrayCapacity;
+
+    // where the jobs being run start in jobArray
+    size_t         jobArrayOffset;
+
+    const char * mirrorRootDIR;
+    size_t       fetchDepth;
+
+    FILE * output;
+    FILE * errput;
+
+    // the error which is not reported by libgit2
+    int    ret;
+} SubmoduleUpdatePayload;
+
+// git submodule init
+// this writes the config of the superproject and sets up .git/modules/<name>, so it is done serially before any job starts
+static int git_submodule_foreach_callback(git_submodule * submodule, const char * name, void * payload) {
+    SubmoduleUpdatePayload * submoduleUpdatePayload = (SubmoduleUpdatePayload*)payload;
+
+    const git_oid * oid = git_submodule_index_id(submodule);
+
+    if (oid == NULL) {
+        oid = git_submodule_head_id(submodule);
+    }
+
+    // nothing recorded, nothing to check out
+    if (oid == NULL) {
+        return GIT_OK;
+    }
+
+    int ret = git_submodule_init(submodule, false);
+
+    if (ret != GIT_OK) {
+        return ret;
+    }
+
+    git_repository * subRepo = NULL;
+
+    ret = git_submodule_open(&subRepo, submodule);
+
+    if (ret != GIT_OK) {
+        ret = git_submodule_repo_init(&subRepo, submodule, true);
+    }
+
+    git_repository_free(subRepo);
+
+    if (ret != GIT_OK) {
+        return ret;
+    }
+
+    git_repository * gitRepo = git_submodule_owner(submodule);
+
+    // a relative url is relative to the url of the superproject
+    git_buf url = {0};
+
+    ret = git_submodule_resolve_url(&url, gitRepo, git_submodule_url(submodule));
+
+    if (ret != GIT_OK) {
+        return ret;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    if (submoduleUpdatePayload->jobArraySize == submoduleUpdatePayload->jobArrayCapacity) {
+        size_t newCapacity = submoduleUpdatePayload->jobArrayCapacity + 8U;
+
+        SubmoduleJob * p = (SubmoduleJob*)realloc(submoduleUpdatePayload->jobArray, newCapacity * sizeof(SubmoduleJob));
+
+        if (p == NULL) {
+            git_buf_dispose(&url);
+            submoduleUpdatePayload->ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+            return GIT_ERROR;
+        }
+
+        submoduleUpdatePayload->jobArray = p;
+        submoduleUpdatePayload->jobArrayCapacity = newCapacity;
+    }
+
+    SubmoduleJob * job = &submoduleUpdatePayload->jobArray[submoduleUpdatePayload->jobArraySize];
+
+    memset(job, 0, sizeof(SubmoduleJob));
+
+    submoduleUpdatePayload->jobArraySize++;
+
+    git_oid_tostr(job->commitId, 41, oid);
+
+    job->name = strdup(name);
+    job->url  = strdup(url.ptr);
+
+    git_buf_dispose(&url);
+
+    // git_repository_workdir() ends with a slash
+    const char * superprojectWorkDIR = git_repository_workdir(gitRepo);
+    const char * submodulePath = git_submodule_path(submodule);
+
+    size_t workDIRCapacity = strlen(superprojectWorkDIR) + strlen(submodulePath) + 1U;
+
+    job->workDIR = (char*)malloc(workDIRCapacity);
+
+    if (job->name == NULL || job->url == NULL || job->workDIR == NULL) {
+        submoduleUpdatePayload->ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        return GIT_ERROR;
+    }
+
+    ret = snprintf(job->workDIR, workDIRCapacity, "%s%s", superprojectWorkDIR, submodulePath);
+
+    if (ret < 0) {
+        perror(NULL);
+        submoduleUpdatePayload->ret = XCPKG_ERROR;
+        return GIT_ERROR;
+    }
+
+    return GIT_OK;
+}
+
+// git -C <path> fetch --depth=fetchDepth origin <commit>
+// git -C <path> checkout --force --detach <commit>
+static int xcpkg_git_submodule_update(const SubmoduleUpdatePayload * payload, const SubmoduleJob * job) {
+    FILE * out = payload->output;
+    FILE * err = payload->errput;
+
+    fprintf(out, "Submodule '%s' (%s) checking out '%s'\n", job->name, job->url, job->commitId);
+
+    char mirrorDIR[PATH_MAX];
+
+    int ret;
+
+    if (payload->mirrorRootDIR != NULL) {
+        ret = xcpkg_git_mirror_fetch_to(payload->mirrorRootDIR, job->url, job->commitId, payload->fetchDepth, mirrorDIR, NULL, out, err);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+
+    git_repository * subRepo   = NULL;
+    git_object     * gitCommit = NULL;
+    git_tree       * gitTree   = NULL;
+
+    git_oid oid;
+
+    // every job opens its own repository, libgit2 objects must not be shared between threads
+    ret = git_repository_open_ext(&subRepo, job->workDIR, GIT_REPOSITORY_OPEN_NO_SEARCH, NULL);
+
+    if (ret == GIT_OK) {
+        ret = git_oid_fromstr(&oid, job->commitId);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(err, ret);
+        goto finalize;
+    }
+
+    if (payload->mirrorRootDIR != NULL) {
+        ret = xcpkg_git_use_mirror_as_alternate(subRepo, mirrorDIR, err);
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+    }
+
+    if (git_object_lookup(&gitCommit, subRepo, &oid, GIT_OBJECT_COMMIT) != GIT_OK) {
+        ret = xcpkg_git_fetch_refspec(subRepo, job->url, job->commitId, payload->fetchDepth, out, err);
+
+        if (ret != XCPKG_OK) {
+            ret = xcpkg_git_fetch_default_refs(subRepo, job->url, job->commitId, "refs/remotes/origin", "refs/tags", out, err);
+        }
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+
+        ret = git_object_lookup(&gitCommit, subRepo, &oid, GIT_OBJECT_COMMIT);
+
+        if (ret != GIT_OK) {
+            ret = report_git_error_to(err, ret);
+            goto finalize;
+        }
+    }
+
+    ret = git_commit_tree(&gitTree, (git_commit*)gitCommit);
+
+    if (ret == GIT_OK) {
+        git_checkout_options gitCheckoutOptions;
+        git_checkout_options_init(&gitCheckoutOptions, GIT_CHECKOUT_OPTIONS_VERSION);
+        gitCheckoutOptions.checkout_strategy    = GIT_CHECKOUT_FORCE;
+
+        ret = git_checkout_tree(subRepo, (git_object*)gitTree, &gitCheckoutOptions);
+    }
+
+    if (ret == GIT_OK) {
+        ret = git_repository_set_head_detached(subRepo, &oid);
+    }
+
+    if (ret != GIT_OK) {
+        ret = report_git_error_to(err, ret);
+        goto finalize;
+    }
+
+    ret = XCPKG_OK;
+
+finalize:
+    git_tree_free(gitTree);
+    git_object_free(gitCommit);
+    git_repository_free(subRepo);
+
+    return ret;
+}
+
+static int xcpkg_git_submodule_update_job(size_t index, void * arg) {
+    SubmoduleUpdatePayload * payload = (SubmoduleUpdatePayload*)arg;
+
+    SubmoduleJob * job = &payload->jobArray[payload->jobArrayOffset + index];
+
+    job->ret = xcpkg_git_submodule_update(payload, job);
+
+    return job->ret;
+}
+
+// git submodule init for the submodules of gitRepo, they are appended to payload->jobArray
+static int xcpkg_git_submodule_collect(git_repository * gitRepo, SubmoduleUpdatePayload * payload) {
+    // https://libgit2.org/libgit2/#HEAD/group/submodule/git_submodule_foreach
+    int ret = git_submodule_foreach(gitRepo, git_submodule_foreach_callback, payload);
+
+    if (ret == GIT_OK) {
+        return XCPKG_OK;
+    }
+
+    if (payload->ret == XCPKG_OK) {
+        return report_git_error_to(payload->errput, ret);
+    } else {
+        return payload->ret;
+    }
+}
+
+static int xcpkg_git_submodule_update_all(git_repository * gitRepo, const char * mirrorRootDIR, const size_t fetchDepth, FILE * output, FILE * errput) {
+    SubmoduleUpdatePayload payload = {
+        .mirrorRootDIR = mirrorRootDIR,
+        .fetchDepth = fetchDepth,
+        .output = output,
+        .errput = errput
+    };
+
+    int ret = xcpkg_git_submodule_collect(gitRepo, &payload);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    // one depth at a time, so that at most parallel_network_jobs() fetches are running however deeply the submodules are nested
+    while (payload.jobArrayOffset < payload.jobArraySize) {
+        const size_t begin = payload.jobArrayOffset;
+        const size_t end   = payload.jobArraySize;
+
+        // the submodules of the same depth are independent of each other, a slow one does not hold up the others
+        if (parallel_for(end - begin, parallel_network_jobs(), xcpkg_git_submodule_update_job, &payload) != 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        for (size_t i = begin; i < end; i++) {
+            SubmoduleJob * job = &payload.jobArray[i];
+
+            if (job->ret != XCPKG_OK) {
+                fprintf(errput, "failed to update submodule: %s\n", job->name);
+
+                if (ret == XCPKG_OK) {
+                    ret = job->ret;
+                }
+
+                continue;
+            }
+
+            // git submodule init writes the config of the superproject, so it is done serially
+            git_repository * subRepo = NULL;
+
+            int ret2 = git_repository_open_ext(&subRepo, job->workDIR, GIT_REPOSITORY_OPEN_NO_SEARCH, NULL);
+
+            if (ret2 == GIT_OK) {
+                ret2 = xcpkg_git_submodule_collect(subRepo, &payload);
+            } else {
+                ret2 = report_git_error_to(errput, ret2);
+            }
+
+            git_repository_free(subRepo);
+
+            if (ret2 != XCPKG_OK) {
+                fprintf(errput, "failed to update the submodules of submodule: %s\n", job->name);
+
+                if (ret == XCPKG_OK) {
+                    ret = ret2;
+                }
+            }
+        }
+
+        payload.jobArrayOffset = end;
+    }
+
+finalize:
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        free(payload.jobArray[i].name);
+        free(payload.jobArray[i].url);
+        free(payload.jobArray[i].workDIR);
+    }
+
+    free(payload.jobArray);
+
+    return ret;
+}
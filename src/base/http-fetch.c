@@ -16,6 +16,8 @@
 
 #include "sha256sum.h"
 
+#include "../core/trace.h"
+
 #include "../xcpkg.h"
 
 int xcpkg_http_fetch_to_stream(const char * url, FILE * outputFile, const bool verbose, const bool showProgress) {
@@ -185,8 +187,15 @@ int xcpkg_http_fetch_to_file(const char * url, const char * outputFilePath, cons
         return XCPKG_ERROR;
     }
 
+    uint64_t startTime = trace_now();
+
     int ret = xcpkg_http_fetch_to_stream(url, file, verbose, showProgress);
 
+    if (trace_enabled()) {
+        long size = ftell(file);
+        trace_record("fetch", "xcpkg_http_fetch_to_file", 1U, size > 0 ? (uint64_t)size : 0U, startTime);
+    }
+
     fclose(file);
 
     return ret;
@@ -369,74 +378,7 @@ static inline int xcpkg_http_fetch_to_proxy(const char * to, const char * url, c
     return xcpkg_http_fetch_to(to, URL, verbose);
 }
 
-int xcpkg_http_fetch(const char * url, const char * uri, const char * expectedSHA256SUM, const char * outputPath, const bool verbose) {
-    if (verbose) {
-        fprintf(stderr, "Fetching: %s %s %s => %s\n", url, uri, expectedSHA256SUM, outputPath);
-    }
-
-    if (url == NULL) {
-        return XCPKG_ERROR_ARG_IS_NULL;
-    }
-
-    if (url[0] == '\0') {
-        return XCPKG_ERROR_ARG_IS_EMPTY;
-    }
-
-    if (expectedSHA256SUM != NULL) {
-        if (strlen(expectedSHA256SUM) != 64U) {
-            return XCPKG_ERROR_ARG_IS_INVALID;
-        }
-    }
-
-    //////////////////////////////////////////////////////////////////////////
-
-    if (outputPath == NULL || outputPath[0] == '\0' || (outputPath[0] == '-' && outputPath[1] == '\0') || strcmp(outputPath, "/dev/stdout") == 0) {
-        return xcpkg_http_fetch_to_proxy("-", url, uri, verbose);
-    }
-
-    if (strcmp(outputPath, "/dev/stderr") == 0) {
-        return xcpkg_http_fetch_to_proxy("+", url, uri, verbose);
-    }
-
-    char outputFilePath[PATH_MAX];
-
-    if (strcmp(outputPath, ".") == 0 || strcmp(outputPath, "./") == 0) {
-        int ret = xcpkg_extract_filename_from_url(url, outputFilePath, PATH_MAX);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
-    }
-
-    if (strcmp(outputPath, "..") == 0 || strcmp(outputPath, "../") == 0) {
-        outputFilePath[0] = '.';
-        outputFilePath[1] = '.';
-        outputFilePath[2] = '/';
-
-        int ret = xcpkg_extract_filename_from_url(url, outputFilePath + 3, PATH_MAX - 3);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
-    }
-
-    size_t outputPathLength = strlen(outputPath);
-
-    if (outputPath[outputPathLength - 1U] == '/') {
-        strncpy(outputFilePath, outputPath, outputPathLength);
-
-        int ret = xcpkg_extract_filename_from_url(url, outputFilePath + outputPathLength, PATH_MAX - outputPathLength);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
-    } else {
-        strncpy(outputFilePath, outputPath, outputPathLength);
-        outputFilePath[outputPathLength] = '\0';
-    }
-
-    //////////////////////////////////////////////////////////////////////////
-
+static int xcpkg_http_fetch_to_file_path(const char * url, const char * uri, const char * expectedSHA256SUM, const char * outputFilePath, const bool verbose) {
     struct stat st;
 
     if (stat(outputFilePath, &st) == 0) {
@@ -564,6 +506,104 @@ int xcpkg_http_fetch(const char * url, const char * uri, const char * expectedSH
     }
 }
 
+int xcpkg_http_fetch(const char * url, const char * uri, const char * expectedSHA256SUM, const char * outputPath, const bool verbose) {
+    if (verbose) {
+        fprintf(stderr, "Fetching: %s %s %s => %s\n", url, uri, expectedSHA256SUM, outputPath);
+    }
+
+    if (url == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (url[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    if (expectedSHA256SUM != NULL) {
+        if (strlen(expectedSHA256SUM) != 64U) {
+            return XCPKG_ERROR_ARG_IS_INVALID;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    if (outputPath == NULL || outputPath[0] == '\0' || (outputPath[0] == '-' && outputPath[1] == '\0') || strcmp(outputPath, "/dev/stdout") == 0) {
+        return xcpkg_http_fetch_to_proxy("-", url, uri, verbose);
+    }
+
+    if (strcmp(outputPath, "/dev/stderr") == 0) {
+        return xcpkg_http_fetch_to_proxy("+", url, uri, verbose);
+    }
+
+    char outputFilePath[PATH_MAX];
+
+    if (strcmp(outputPath, ".") == 0 || strcmp(outputPath, "./") == 0) {
+        int ret = xcpkg_extract_filename_from_url(url, outputFilePath, PATH_MAX);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    if (strcmp(outputPath, "..") == 0 || strcmp(outputPath, "../") == 0) {
+        outputFilePath[0] = '.';
+        outputFilePath[1] = '.';
+        outputFilePath[2] = '/';
+
+        int ret = xcpkg_extract_filename_from_url(url, outputFilePath + 3, PATH_MAX - 3);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    size_t outputPathLength = strlen(outputPath);
+
+    if (outputPath[outputPathLength - 1U] == '/') {
+        strncpy(outputFilePath, outputPath, outputPathLength);
+
+        int ret = xcpkg_extract_filename_from_url(url, outputFilePath + outputPathLength, PATH_MAX - outputPathLength);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    } else {
+        strncpy(outputFilePath, outputPath, outputPathLength);
+        outputFilePath[outputPathLength] = '\0';
+    }
+
+    if (expectedSHA256SUM == NULL) {
+        return xcpkg_http_fetch_to_file_path(url, uri, NULL, outputFilePath, verbose);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    // one fetch per file at a time
+
+    char lockName[74];
+
+    int ret = snprintf(lockName, 74, "download-%s", expectedSHA256SUM);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    int lockFD;
+
+    ret = xcpkg_lock_named(lockName, url, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_http_fetch_to_file_path(url, uri, expectedSHA256SUM, outputFilePath, verbose);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
 int xcpkg_http_fetch_then_unpack(const char * url, const char * uri, const char * expectedSHA256SUM, const char * downloadDIR, size_t downloadDIRLength, const char * unpackDIR, size_t unpackDIRLength, const bool verbose) {
     char fileType[XCPKG_FILE_EXTENSION_MAX_CAPACITY] = {0};
 
@@ -8,6 +8,7 @@
 #include <crt_externs.h>
 
 #include "../core/log.h"
+#include "../core/trace.h"
 
 #include "../xcpkg.h"
 
@@ -16,6 +17,8 @@ static inline __attribute__((always_inline)) int xcpkg_posix_spawn_internal(cons
 
     //////////////////////////////////
 
+    uint64_t startTime = trace_now();
+
     pid_t pid;
 
     if (posix_spawnp(&pid, argv[0], NULL, NULL, argv, *_NSGetEnviron()) != 0) {
@@ -30,6 +33,8 @@ static inline __attribute__((always_inline)) int xcpkg_posix_spawn_internal(cons
         return XCPKG_ERROR;
     }
 
+    trace_record("spawn", argv[0], 1U, 0U, startTime);
+
     if (status == 0) {
         return XCPKG_OK;
     }
@@ -1,9 +1,18 @@
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
 #include <openssl/evp.h>
 #include <openssl/sha.h>
 
+#include "../core/trace.h"
+#include "../core/parallel.h"
+
 #include "sha256sum.h"
 
 #include "../xcpkg.h"
@@ -104,6 +113,217 @@ finally:
     return !ret;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+// a few large reads instead of lots of small ones
+#define SHA256SUM_READ_BUFFER_SIZE 4194304
+
+// every thread has its own digest context and read buffer, they are reused by all the files hashed in that thread and freed when that thread exits
+typedef struct {
+    EVP_MD_CTX    * ctx;
+    unsigned char * buf;
+} Hasher;
+
+static pthread_key_t  hasherKey;
+static pthread_once_t hasherKeyOnce = PTHREAD_ONCE_INIT;
+
+static void hasher_free(void * p) {
+    Hasher * hasher = (Hasher*)p;
+
+    EVP_MD_CTX_free(hasher->ctx);
+    free(hasher->buf);
+    free(hasher);
+}
+
+static void hasher_key_create() {
+    pthread_key_create(&hasherKey, hasher_free);
+}
+
+static Hasher * hasher_get() {
+    pthread_once(&hasherKeyOnce, hasher_key_create);
+
+    Hasher * hasher = (Hasher*)pthread_getspecific(hasherKey);
+
+    if (hasher != NULL) {
+        return hasher;
+    }
+
+    hasher = (Hasher*)calloc(1, sizeof(Hasher));
+
+    if (hasher == NULL) {
+        return NULL;
+    }
+
+    hasher->ctx = EVP_MD_CTX_new();
+    hasher->buf = (unsigned char*)malloc(SHA256SUM_READ_BUFFER_SIZE);
+
+    if (hasher->ctx == NULL || hasher->buf == NULL || pthread_setspecific(hasherKey, hasher) != 0) {
+        hasher_free(hasher);
+        return NULL;
+    }
+
+    return hasher;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// a file is identified by these, if none of them changed, its sha256sum is not computed again in this process
+typedef struct {
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    long  mtimeSec;
+    long  mtimeNsec;
+    char  sha256sum[65];
+} HashedFile;
+
+static HashedFile * hashedFileArray;
+static size_t       hashedFileArraySize;
+static size_t       hashedFileArrayCapacity;
+
+// an open addressing hash table indexed by dev and ino, 0 means an empty slot, otherwise it is 1 + the index in hashedFileArray
+static size_t * hashedFileSlotArray;
+static size_t   hashedFileSlotArraySize;
+
+static pthread_mutex_t hashedFileMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void get_mtime(const struct stat * st, long * sec, long * nsec) {
+#if defined (__APPLE__)
+    *sec  = (long)st->st_mtimespec.tv_sec;
+    *nsec = (long)st->st_mtimespec.tv_nsec;
+#else
+    *sec  = (long)st->st_mtim.tv_sec;
+    *nsec = (long)st->st_mtim.tv_nsec;
+#endif
+}
+
+static size_t hash_of_file(const dev_t dev, const ino_t ino) {
+    uint64_t h = ((uint64_t)ino * 0x9E3779B97F4A7C15ULL) ^ (uint64_t)dev;
+
+    return (size_t)(h ^ (h >> 29));
+}
+
+// the slot of the given file, or the empty slot where it should be put
+static size_t hashed_file_slot(const dev_t dev, const ino_t ino) {
+    size_t mask = hashedFileSlotArraySize - 1U;
+
+    size_t j = hash_of_file(dev, ino) & mask;
+
+    for (;;) {
+        size_t k = hashedFileSlotArray[j];
+
+        if (k == 0U) {
+            return j;
+        }
+
+        const HashedFile * f = &hashedFileArray[k - 1U];
+
+        if (f->ino == ino && f->dev == dev) {
+            return j;
+        }
+
+        j = (j + 1U) & mask;
+    }
+}
+
+static bool hashed_file_lookup(const struct stat * st, char outputBuffer[65]) {
+    long sec, nsec;
+
+    get_mtime(st, &sec, &nsec);
+
+    bool found = false;
+
+    pthread_mutex_lock(&hashedFileMutex);
+
+    if (hashedFileSlotArraySize != 0U) {
+        size_t k = hashedFileSlotArray[hashed_file_slot(st->st_dev, st->st_ino)];
+
+        if (k != 0U) {
+            const HashedFile * f = &hashedFileArray[k - 1U];
+
+            if (f->size == st->st_size && f->mtimeSec == sec && f->mtimeNsec == nsec) {
+                memcpy(outputBuffer, f->sha256sum, 65);
+                found = true;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&hashedFileMutex);
+
+    return found;
+}
+
+static bool hashed_file_rehash(const size_t newSlotArraySize) {
+    size_t * slotArray = (size_t*)calloc(newSlotArraySize, sizeof(size_t));
+
+    if (slotArray == NULL) {
+        return false;
+    }
+
+    free(hashedFileSlotArray);
+
+    hashedFileSlotArray = slotArray;
+    hashedFileSlotArraySize = newSlotArraySize;
+
+    for (size_t i = 0U; i < hashedFileArraySize; i++) {
+        hashedFileSlotArray[hashed_file_slot(hashedFileArray[i].dev, hashedFileArray[i].ino)] = i + 1U;
+    }
+
+    return true;
+}
+
+static void hashed_file_add(const struct stat * st, const char sha256sum[65]) {
+    pthread_mutex_lock(&hashedFileMutex);
+
+    // keep the load factor below 0.5
+    if (((hashedFileArraySize + 1U) << 1) > hashedFileSlotArraySize) {
+        // it is only a cache
+        if (!hashed_file_rehash(hashedFileSlotArraySize == 0U ? 64U : (hashedFileSlotArraySize << 1))) {
+            pthread_mutex_unlock(&hashedFileMutex);
+            return;
+        }
+    }
+
+    size_t j = hashed_file_slot(st->st_dev, st->st_ino);
+
+    HashedFile * f;
+
+    // the file was changed since it was hashed
+    if (hashedFileSlotArray[j] != 0U) {
+        f = &hashedFileArray[hashedFileSlotArray[j] - 1U];
+    } else {
+        if (hashedFileArraySize == hashedFileArrayCapacity) {
+            size_t newCapacity = hashedFileArrayCapacity == 0U ? 32U : (hashedFileArrayCapacity << 1);
+
+            HashedFile * p = (HashedFile*)realloc(hashedFileArray, newCapacity * sizeof(HashedFile));
+
+            if (p == NULL) {
+                pthread_mutex_unlock(&hashedFileMutex);
+                return;
+            }
+
+            hashedFileArray = p;
+            hashedFileArrayCapacity = newCapacity;
+        }
+
+        f = &hashedFileArray[hashedFileArraySize];
+
+        hashedFileSlotArray[j] = ++hashedFileArraySize;
+    }
+
+    f->dev  = st->st_dev;
+    f->ino  = st->st_ino;
+    f->size = st->st_size;
+
+    get_mtime(st, &f->mtimeSec, &f->mtimeNsec);
+
+    memcpy(f->sha256sum, sha256sum, 65);
+
+    pthread_mutex_unlock(&hashedFileMutex);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 int sha256sum_of_stream(char outputBuffer[65], FILE * file) {
     if (outputBuffer == NULL) {
         return XCPKG_ERROR_ARG_IS_NULL;
@@ -113,26 +333,18 @@ int sha256sum_of_stream(char outputBuffer[65], FILE * file) {
         return XCPKG_ERROR_ARG_IS_NULL;
     }
 
-    unsigned char sha256Bytes[SHA256_DIGEST_LENGTH] = {0};
-  
-    EVP_MD_CTX * ctx = EVP_MD_CTX_new();
+    Hasher * hasher = hasher_get();
 
-    if (ctx == NULL) {
+    if (hasher == NULL) {
         return XCPKG_ERROR;
     }
 
-    unsigned int len;
-
-    int ret;
-
-    if ((ret = EVP_DigestInit(ctx, EVP_sha256())) != 1) {
-        goto finally;
+    if (EVP_DigestInit_ex(hasher->ctx, EVP_sha256(), NULL) != 1) {
+        return XCPKG_ERROR;
     }
 
-    unsigned char readBuf[1024];
-
     for (;;) {
-        size_t readSize = fread(readBuf, 1, 1024, file);
+        size_t readSize = fread(hasher->buf, 1, SHA256SUM_READ_BUFFER_SIZE, file);
 
         if (ferror(file)) {
             perror(NULL);
@@ -140,8 +352,8 @@ int sha256sum_of_stream(char outputBuffer[65], FILE * file) {
         }
 
         if (readSize > 0U) {
-            if ((ret = EVP_DigestUpdate(ctx, readBuf, readSize)) != 1) {
-                goto finally;
+            if (EVP_DigestUpdate(hasher->ctx, hasher->buf, readSize) != 1) {
+                return XCPKG_ERROR;
             }
         }
 
@@ -150,16 +362,19 @@ int sha256sum_of_stream(char outputBuffer[65], FILE * file) {
         }
     }
 
-    if ((ret = EVP_DigestFinal(ctx, sha256Bytes, &len)) != 1) {
-        goto finally;
+    unsigned char sha256Bytes[SHA256_DIGEST_LENGTH] = {0};
+
+    unsigned int len;
+
+    if (EVP_DigestFinal_ex(hasher->ctx, sha256Bytes, &len) != 1) {
+        return XCPKG_ERROR;
     }
 
     tohex(outputBuffer, sha256Bytes);
 
-finally:
-    EVP_MD_CTX_free(ctx);
+    outputBuffer[64] = '\0';
 
-    return !ret;
+    return XCPKG_OK;
 }
 
 int sha256sum_of_file(char outputBuffer[65], const char * filepath) {
@@ -175,16 +390,131 @@ int sha256sum_of_file(char outputBuffer[65], const char * filepath) {
         return XCPKG_ERROR_ARG_IS_EMPTY;
     }
 
-    FILE * file = fopen(filepath, "rb");
+    int fd = open(filepath, O_RDONLY | O_CLOEXEC);
 
-    if (file == NULL) {
+    if (fd == -1) {
         perror(filepath);
         return XCPKG_ERROR;
     }
 
-    int ret = sha256sum_of_stream(outputBuffer, file);
+    struct stat st;
 
-    fclose(file);
+    if (fstat(fd, &st) != 0) {
+        perror(filepath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    if (S_ISREG(st.st_mode) && hashed_file_lookup(&st, outputBuffer)) {
+        close(fd);
+        trace_record("hash", "sha256sum_of_file memoized", 1U, 0U, 0U);
+        return XCPKG_OK;
+    }
+
+    uint64_t startTime = trace_now();
+
+    uint64_t hashedBytes = 0U;
+
+    Hasher * hasher = hasher_get();
+
+    if (hasher == NULL) {
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    // the file is read once from the beginning to the end, let the kernel read ahead aggressively
+#if defined (__APPLE__)
+    fcntl(fd, F_RDAHEAD, 1);
+#elif defined (POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    if (EVP_DigestInit_ex(hasher->ctx, EVP_sha256(), NULL) != 1) {
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    for (;;) {
+        ssize_t readSize = read(fd, hasher->buf, SHA256SUM_READ_BUFFER_SIZE);
+
+        if (readSize == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            perror(filepath);
+            close(fd);
+            return XCPKG_ERROR;
+        }
+
+        if (readSize == 0) {
+            break;
+        }
+
+        if (EVP_DigestUpdate(hasher->ctx, hasher->buf, (size_t)readSize) != 1) {
+            close(fd);
+            return XCPKG_ERROR;
+        }
+
+        hashedBytes += (uint64_t)readSize;
+    }
+
+    close(fd);
+
+    unsigned char sha256Bytes[SHA256_DIGEST_LENGTH] = {0};
+
+    unsigned int len;
+
+    if (EVP_DigestFinal_ex(hasher->ctx, sha256Bytes, &len) != 1) {
+        return XCPKG_ERROR;
+    }
+
+    tohex(outputBuffer, sha256Bytes);
+
+    outputBuffer[64] = '\0';
+
+    if (S_ISREG(st.st_mode)) {
+        hashed_file_add(&st, outputBuffer);
+    }
+
+    trace_record("hash", "sha256sum_of_file", 1U, hashedBytes, startTime);
+
+    return XCPKG_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    const char * const * filePaths;
+    char (*outputBuffers)[65];
+    int * rets;
+} Batch;
+
+static int sha256sum_of_the_nth_file(size_t index, void * arg) {
+    Batch * batch = (Batch*)arg;
+
+    batch->rets[index] = sha256sum_of_file(batch->outputBuffers[index], batch->filePaths[index]);
+
+    return batch->rets[index];
+}
+
+int sha256sum_of_files(char outputBuffers[][65], int rets[], const char * const filePaths[], const size_t n, const unsigned int nthreads) {
+    if (outputBuffers == NULL || rets == NULL || filePaths == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    Batch batch = { filePaths, outputBuffers, rets };
+
+    if (parallel_for(n, nthreads, sha256sum_of_the_nth_file, &batch) != 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    for (size_t i = 0U; i < n; i++) {
+        if (rets[i] != XCPKG_OK) {
+            return rets[i];
+        }
+    }
 
-    return ret;
+    return XCPKG_OK;
 }
@@ -9,4 +9,13 @@ int sha256sum_of_string(char outputBuffer[65], const char * str);
 int sha256sum_of_file  (char outputBuffer[65], const char * filepath);
 int sha256sum_of_stream(char outputBuffer[65], FILE * file);
 
+/** compute the sha256sum of every given file concurrently, 0 means as many threads as cpus.
+ *
+ *  the result of filePaths[i] is written to outputBuffers[i] and rets[i].
+ *  the first failed one of rets is returned.
+ *
+ *  the sha256sum of a file is remembered in this process until the file is changed, so checking the same file again later costs nothing.
+ */
+int sha256sum_of_files(char outputBuffers[][65], int rets[], const char * const filePaths[], const size_t n, const unsigned int nthreads);
+
 #endif
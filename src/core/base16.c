@@ -2,9 +2,206 @@
 
 #include <errno.h>
 #include <string.h>
+#include <unistd.h>
 
+#include "simd.h"
 #include "base16.h"
 
+#define BASE16_STREAM_BUFFER_SIZE 1048576U
+
+static const char * const base16UpperTable = "0123456789ABCDEF";
+static const char * const base16LowerTable = "0123456789abcdef";
+
+//////////////////////////////////////////////////////////////////////////////
+
+// every kernel returns how many input bytes it has consumed, the rest is left to the scalar code
+
+#if defined (SIMD_X86)
+
+SIMD_TARGET_SSSE3
+static size_t base16_encode_ssse3(char * outputBuf, const unsigned char * inputBuf, size_t inputBufSizeInBytes, const char * table) {
+    const __m128i lut = _mm_loadu_si128((const __m128i *)table);
+    const __m128i low4bits = _mm_set1_epi8(0x0F);
+
+    size_t i = 0U;
+
+    for (; i + 16U <= inputBufSizeInBytes; i += 16U) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(inputBuf + i));
+
+        __m128i h = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), low4bits));
+        __m128i l = _mm_shuffle_epi8(lut, _mm_and_si128(x, low4bits));
+
+        _mm_storeu_si128((__m128i *)(outputBuf + (i << 1)),       _mm_unpacklo_epi8(h, l));
+        _mm_storeu_si128((__m128i *)(outputBuf + (i << 1) + 16U), _mm_unpackhi_epi8(h, l));
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2
+static size_t base16_encode_avx2(char * outputBuf, const unsigned char * inputBuf, size_t inputBufSizeInBytes, const char * table) {
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)table));
+    const __m256i low4bits = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0U;
+
+    for (; i + 32U <= inputBufSizeInBytes; i += 32U) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(inputBuf + i));
+
+        __m256i h = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), low4bits));
+        __m256i l = _mm256_shuffle_epi8(lut, _mm256_and_si256(x, low4bits));
+
+        // unpack works in 128-bit lanes
+        __m256i a = _mm256_unpacklo_epi8(h, l);
+        __m256i b = _mm256_unpackhi_epi8(h, l);
+
+        _mm256_storeu_si256((__m256i *)(outputBuf + (i << 1)),       _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i *)(outputBuf + (i << 1) + 32U), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return i;
+}
+
+// converts 16 hex digits to their values, every invalid one is marked in the returned mask
+SIMD_TARGET_SSSE3
+static inline __m128i hex2dec_ssse3(__m128i c, __m128i * invalid) {
+    __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+    __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(d, _mm_set1_epi8(-1)), _mm_cmpgt_epi8(_mm_set1_epi8(10), d));
+    __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(l, _mm_set1_epi8(-1)), _mm_cmpgt_epi8(_mm_set1_epi8(6),  l));
+
+    *invalid = _mm_or_si128(*invalid, _mm_andnot_si128(_mm_or_si128(isDigit, isAlpha), _mm_set1_epi8(-1)));
+
+    return _mm_or_si128(_mm_and_si128(isDigit, d), _mm_and_si128(isAlpha, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+SIMD_TARGET_SSSE3
+static size_t base16_decode_ssse3(unsigned char * outputBuf, const char * inputBuf, size_t inputBufSizeInBytes) {
+    const __m128i weights = _mm_set1_epi16(0x0110);
+
+    size_t i = 0U;
+
+    for (; i + 32U <= inputBufSizeInBytes; i += 32U) {
+        __m128i invalid = _mm_setzero_si128();
+
+        __m128i a = hex2dec_ssse3(_mm_loadu_si128((const __m128i *)(inputBuf + i)),       &invalid);
+        __m128i b = hex2dec_ssse3(_mm_loadu_si128((const __m128i *)(inputBuf + i + 16U)), &invalid);
+
+        if (_mm_movemask_epi8(invalid) != 0) {
+            break;
+        }
+
+        // high * 16 + low for every pair
+        a = _mm_maddubs_epi16(a, weights);
+        b = _mm_maddubs_epi16(b, weights);
+
+        _mm_storeu_si128((__m128i *)(outputBuf + (i >> 1)), _mm_packus_epi16(a, b));
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2
+static inline __m256i hex2dec_avx2(__m256i c, __m256i * invalid) {
+    __m256i d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    __m256i l = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+
+    __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(d, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(10), d));
+    __m256i isAlpha = _mm256_and_si256(_mm256_cmpgt_epi8(l, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(6),  l));
+
+    *invalid = _mm256_or_si256(*invalid, _mm256_andnot_si256(_mm256_or_si256(isDigit, isAlpha), _mm256_set1_epi8(-1)));
+
+    return _mm256_or_si256(_mm256_and_si256(isDigit, d), _mm256_and_si256(isAlpha, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+}
+
+SIMD_TARGET_AVX2
+static size_t base16_decode_avx2(unsigned char * outputBuf, const char * inputBuf, size_t inputBufSizeInBytes) {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    size_t i = 0U;
+
+    for (; i + 64U <= inputBufSizeInBytes; i += 64U) {
+        __m256i invalid = _mm256_setzero_si256();
+
+        __m256i a = hex2dec_avx2(_mm256_loadu_si256((const __m256i *)(inputBuf + i)),       &invalid);
+        __m256i b = hex2dec_avx2(_mm256_loadu_si256((const __m256i *)(inputBuf + i + 32U)), &invalid);
+
+        if (_mm256_movemask_epi8(invalid) != 0) {
+            break;
+        }
+
+        a = _mm256_maddubs_epi16(a, weights);
+        b = _mm256_maddubs_epi16(b, weights);
+
+        // pack works in 128-bit lanes
+        _mm256_storeu_si256((__m256i *)(outputBuf + (i >> 1)), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+
+    return i;
+}
+
+#elif defined (SIMD_NEON)
+
+static size_t base16_encode_neon(char * outputBuf, const unsigned char * inputBuf, size_t inputBufSizeInBytes, const char * table) {
+    const uint8x16_t lut = vld1q_u8((const uint8_t *)table);
+    const uint8x16_t low4bits = vdupq_n_u8(0x0F);
+
+    size_t i = 0U;
+
+    for (; i + 16U <= inputBufSizeInBytes; i += 16U) {
+        uint8x16_t x = vld1q_u8(inputBuf + i);
+
+        uint8x16x2_t hl;
+
+        hl.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(x, 4));
+        hl.val[1] = vqtbl1q_u8(lut, vandq_u8(x, low4bits));
+
+        // interleaved store
+        vst2q_u8((uint8_t *)(outputBuf + (i << 1)), hl);
+    }
+
+    return i;
+}
+
+static inline uint8x16_t hex2dec_neon(uint8x16_t c, uint8x16_t * valid) {
+    uint8x16_t d = vsubq_u8(c, vdupq_n_u8('0'));
+    uint8x16_t l = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+
+    uint8x16_t isDigit = vcltq_u8(d, vdupq_n_u8(10));
+    uint8x16_t isAlpha = vcltq_u8(l, vdupq_n_u8(6));
+
+    *valid = vandq_u8(*valid, vorrq_u8(isDigit, isAlpha));
+
+    return vbslq_u8(isDigit, d, vaddq_u8(l, vdupq_n_u8(10)));
+}
+
+static size_t base16_decode_neon(unsigned char * outputBuf, const char * inputBuf, size_t inputBufSizeInBytes) {
+    size_t i = 0U;
+
+    for (; i + 32U <= inputBufSizeInBytes; i += 32U) {
+        // the high digits and the low digits are de-interleaved
+        uint8x16x2_t hl = vld2q_u8((const uint8_t *)(inputBuf + i));
+
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+
+        uint8x16_t h = hex2dec_neon(hl.val[0], &valid);
+        uint8x16_t l = hex2dec_neon(hl.val[1], &valid);
+
+        if (vminvq_u8(valid) == 0U) {
+            break;
+        }
+
+        vst1q_u8(outputBuf + (i >> 1), vorrq_u8(vshlq_n_u8(h, 4), l));
+    }
+
+    return i;
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
 int base16_encode(char * outputBuf, const unsigned char * inputBuf, size_t inputBufSizeInBytes, const bool isToUpper) {
     if (outputBuf == NULL) {
         errno = EINVAL;
@@ -21,9 +218,25 @@ int base16_encode(char * outputBuf, const unsigned char * inputBuf, size_t input
         return -1;
     }
 
-    const char * const table = isToUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+    const char * const table = isToUpper ? base16UpperTable : base16LowerTable;
+
+    size_t i;
+
+#if defined (SIMD_X86)
+    if (simd_has_avx2()) {
+        i = base16_encode_avx2(outputBuf, inputBuf, inputBufSizeInBytes, table);
+    } else if (simd_has_ssse3()) {
+        i = base16_encode_ssse3(outputBuf, inputBuf, inputBufSizeInBytes, table);
+    } else {
+        i = 0U;
+    }
+#elif defined (SIMD_NEON)
+    i = base16_encode_neon(outputBuf, inputBuf, inputBufSizeInBytes, table);
+#else
+    i = 0U;
+#endif
 
-    for (size_t i = 0; i < inputBufSizeInBytes; i++) {
+    for (; i < inputBufSizeInBytes; i++) {
         //向右移动4bit，获得高4bit
         unsigned char highByte = inputBuf[i] >> 4;
         //与0x0f做位与运算，获得低4bit
@@ -49,7 +262,7 @@ static short hex2dec(char c) {
     } else if ('A' <= c && c <= 'F') {
         return c - 'A' + 10;
     } else {
-        return 0;
+        return -1;
     }
 }
 
@@ -74,28 +287,181 @@ int base16_decode(unsigned char * outputBuf, const char * inputBuf, size_t input
         return -1;
     }
 
-    size_t halfInputSize = inputBufSizeInBytes >> 1;
+    size_t j;
 
-    for (size_t i = 0; i < halfInputSize; i++) {
-        //16进制数字转换为10进制数字的过程
-        size_t j = i << 1;
+    // a kernel stops at the first block which has an invalid digit, the scalar code reports it
+#if defined (SIMD_X86)
+    if (simd_has_avx2()) {
+        j = base16_decode_avx2(outputBuf, inputBuf, inputBufSizeInBytes);
+    } else if (simd_has_ssse3()) {
+        j = base16_decode_ssse3(outputBuf, inputBuf, inputBufSizeInBytes);
+    } else {
+        j = 0U;
+    }
+#elif defined (SIMD_NEON)
+    j = base16_decode_neon(outputBuf, inputBuf, inputBufSizeInBytes);
+#else
+    j = 0U;
+#endif
 
-        char c1 = hex2dec(inputBuf[j]) << 4;
+    for (; j < inputBufSizeInBytes; j += 2U) {
+        //16进制数字转换为10进制数字的过程
+        short c1 = hex2dec(inputBuf[j]);
 
         if (c1 < 0) {
             errno = EINVAL;
             return -1;
         }
 
-        char c0 = hex2dec(inputBuf[j + 1U]);
+        short c0 = hex2dec(inputBuf[j + 1U]);
 
         if (c0 < 0) {
             errno = EINVAL;
             return -1;
         }
 
-        outputBuf[i] = c1 + c0;
+        outputBuf[j >> 1] = (unsigned char)((c1 << 4) + c0);
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int write_fully(int fd, const void * buf, size_t size) {
+    const char * p = (const char *)buf;
+
+    while (size != 0U) {
+        ssize_t n = write(fd, p, size);
+
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return -1;
+        }
+
+        p    += n;
+        size -= (size_t)n;
     }
 
     return 0;
 }
+
+static ssize_t read_some(int fd, void * buf, size_t size) {
+    for (;;) {
+        ssize_t n = read(fd, buf, size);
+
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+
+        return n;
+    }
+}
+
+int base16_encode_stream(int inputFD, int outputFD, const bool isToUpper) {
+    unsigned char * inputBuf = (unsigned char *)malloc(BASE16_STREAM_BUFFER_SIZE * 3U);
+
+    if (inputBuf == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    char * outputBuf = (char *)(inputBuf + BASE16_STREAM_BUFFER_SIZE);
+
+    int ret = 0;
+
+    for (;;) {
+        ssize_t n = read_some(inputFD, inputBuf, BASE16_STREAM_BUFFER_SIZE);
+
+        if (n <= 0) {
+            ret = (int)n;
+            break;
+        }
+
+        base16_encode(outputBuf, inputBuf, (size_t)n, isToUpper);
+
+        ret = write_fully(outputFD, outputBuf, (size_t)n << 1);
+
+        if (ret != 0) {
+            break;
+        }
+    }
+
+    free(inputBuf);
+
+    return ret;
+}
+
+int base16_decode_stream(int inputFD, int outputFD) {
+    char * inputBuf = (char *)malloc(BASE16_STREAM_BUFFER_SIZE + (BASE16_STREAM_BUFFER_SIZE >> 1) + 1U);
+
+    if (inputBuf == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    unsigned char * outputBuf = (unsigned char *)(inputBuf + BASE16_STREAM_BUFFER_SIZE + 1U);
+
+    // the digit which has no pair in the last chunk
+    size_t pending = 0U;
+
+    int ret = 0;
+
+    for (;;) {
+        ssize_t n = read_some(inputFD, inputBuf + pending, BASE16_STREAM_BUFFER_SIZE);
+
+        if (n == -1) {
+            ret = -1;
+            break;
+        }
+
+        if (n == 0) {
+            if (pending != 0U) {
+                errno = EINVAL;
+                ret = -1;
+            }
+
+            break;
+        }
+
+        // line breaks and blanks are allowed, they are dropped
+        size_t size = pending;
+
+        for (size_t i = pending; i < pending + (size_t)n; i++) {
+            char c = inputBuf[i];
+
+            if (c != '\n' && c != '\r' && c != ' ' && c != '\t') {
+                inputBuf[size++] = c;
+            }
+        }
+
+        size_t even = size & ~(size_t)1U;
+
+        if (even != 0U) {
+            ret = base16_decode(outputBuf, inputBuf, even);
+
+            if (ret != 0) {
+                break;
+            }
+
+            ret = write_fully(outputFD, outputBuf, even >> 1);
+
+            if (ret != 0) {
+                break;
+            }
+        }
+
+        pending = size - even;
+
+        if (pending != 0U) {
+            inputBuf[0] = inputBuf[even];
+        }
+    }
+
+    free(inputBuf);
+
+    return ret;
+}
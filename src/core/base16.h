@@ -17,4 +17,14 @@ int base16_encode(char * outputBuf, const unsigned char * inputBuf, size_t input
  */
 int base16_decode(unsigned char * outputBuf, const char * inputBuf, size_t inputBufSizeInBytes);
 
+/* 从inputFD读取直到EOF, 把base16编码后的内容写入outputFD
+ * 成功返回0, 失败返回-1并设置errno
+ */
+int base16_encode_stream(int inputFD, int outputFD, const bool isToUpper);
+
+/* 从inputFD读取base16编码的内容直到EOF, 把解码后的字节写入outputFD, 换行符和空白符会被忽略
+ * 成功返回0, 失败返回-1并设置errno, 内容不合法时errno为EINVAL
+ */
+int base16_decode_stream(int inputFD, int outputFD);
+
 #endif
@@ -1,11 +1,406 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 
-#include <openssl/evp.h>
-
+#include "simd.h"
 #include "base64.h"
 
+#define BASE64_STREAM_BUFFER_SIZE 1048576U
+
+static const char base64EncodeTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 0xFF means it is not a base64 character
+static const unsigned char base64DecodeTable[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+// every kernel returns how many input bytes it has consumed, the rest is left to the scalar code
+// the x86 kernels are the well-known pshufb based ones: http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html and http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+
+#if defined (SIMD_X86)
+
+// 12 bytes in, 16 characters out
+SIMD_TARGET_SSSE3
+static inline __m128i base64_encode_block_ssse3(__m128i x) {
+    x = _mm_shuffle_epi8(x, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    // split every 3 bytes into 4 6-bit indices
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(x, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(x, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+
+    __m128i indices = _mm_or_si128(t0, t1);
+
+    // map every index to the offset of its range: A-Z a-z 0-9 + /
+    __m128i r = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+
+    r = _mm_or_si128(r, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, r), indices);
+}
+
+SIMD_TARGET_SSSE3
+static size_t base64_encode_ssse3(char * output, const unsigned char * input, size_t inputSizeInBytes) {
+    size_t i = 0U;
+    size_t j = 0U;
+
+    // 16 bytes are loaded, 12 of them are used
+    for (; i + 16U <= inputSizeInBytes; i += 12U, j += 16U) {
+        _mm_storeu_si128((__m128i *)(output + j), base64_encode_block_ssse3(_mm_loadu_si128((const __m128i *)(input + i))));
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2
+static inline __m256i base64_encode_block_avx2(__m256i x) {
+    x = _mm256_shuffle_epi8(x, _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)));
+
+    __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(x, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(x, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+
+    __m256i indices = _mm256_or_si256(t0, t1);
+
+    __m256i r = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+
+    r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+
+    return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, r), indices);
+}
+
+SIMD_TARGET_AVX2
+static size_t base64_encode_avx2(char * output, const unsigned char * input, size_t inputSizeInBytes) {
+    size_t i = 0U;
+    size_t j = 0U;
+
+    // every 128-bit lane takes 12 bytes, 28 bytes are loaded, 24 of them are used
+    for (; i + 28U <= inputSizeInBytes; i += 24U, j += 32U) {
+        __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(input + i))), _mm_loadu_si128((const __m128i *)(input + i + 12U)), 1);
+
+        _mm256_storeu_si256((__m256i *)(output + j), base64_encode_block_avx2(x));
+    }
+
+    return i;
+}
+
+// 16 characters in, 12 bytes out, returns false if there is a non-base64 character
+SIMD_TARGET_SSSE3
+static inline bool base64_decode_block_ssse3(__m128i x, __m128i * out) {
+    const __m128i hi = _mm_and_si128(_mm_srli_epi32(x, 4), _mm_set1_epi8(0x0F));
+
+    // the valid range of every high nibble
+    const __m128i lowerBounds = _mm_setr_epi8(1, 1, 0x2B, 0x30, 0x41, 0x50, 0x61, 0x70, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m128i upperBounds = _mm_setr_epi8(0, 0, 0x2B, 0x39, 0x4F, 0x5A, 0x6F, 0x7A, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i shifts      = _mm_setr_epi8(0, 0, 0x3E - 0x2B, 0x34 - 0x30, 0x00 - 0x41, 0x0F - 0x50, 0x1A - 0x61, 0x29 - 0x70, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    const __m128i isSlash = _mm_cmpeq_epi8(x, _mm_set1_epi8('/'));
+
+    __m128i outside = _mm_or_si128(_mm_cmplt_epi8(x, _mm_shuffle_epi8(lowerBounds, hi)), _mm_cmpgt_epi8(x, _mm_shuffle_epi8(upperBounds, hi)));
+
+    if (_mm_movemask_epi8(_mm_andnot_si128(isSlash, outside)) != 0) {
+        return false;
+    }
+
+    __m128i values = _mm_add_epi8(_mm_add_epi8(x, _mm_shuffle_epi8(shifts, hi)), _mm_and_si128(isSlash, _mm_set1_epi8(-3)));
+
+    // join every 4 6-bit values into 3 bytes
+    values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+
+    *out = _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+    return true;
+}
+
+SIMD_TARGET_SSSE3
+static size_t base64_decode_ssse3(unsigned char * output, const char * input, size_t inputSizeInBytes) {
+    size_t i = 0U;
+    size_t j = 0U;
+
+    for (; i + 16U <= inputSizeInBytes; i += 16U, j += 12U) {
+        __m128i out;
+
+        if (!base64_decode_block_ssse3(_mm_loadu_si128((const __m128i *)(input + i)), &out)) {
+            break;
+        }
+
+        int tail = _mm_cvtsi128_si32(_mm_srli_si128(out, 8));
+
+        _mm_storel_epi64((__m128i *)(output + j), out);
+        memcpy(output + j + 8U, &tail, 4U);
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2
+static inline bool base64_decode_block_avx2(__m256i x, __m256i * out) {
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi32(x, 4), _mm256_set1_epi8(0x0F));
+
+    const __m256i lowerBounds = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 1, 0x2B, 0x30, 0x41, 0x50, 0x61, 0x70, 1, 1, 1, 1, 1, 1, 1, 1));
+    const __m256i upperBounds = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 0, 0x2B, 0x39, 0x4F, 0x5A, 0x6F, 0x7A, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i shifts      = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 0, 0x3E - 0x2B, 0x34 - 0x30, 0x00 - 0x41, 0x0F - 0x50, 0x1A - 0x61, 0x29 - 0x70, 0, 0, 0, 0, 0, 0, 0, 0));
+
+    const __m256i isSlash = _mm256_cmpeq_epi8(x, _mm256_set1_epi8('/'));
+
+    __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi8(_mm256_shuffle_epi8(lowerBounds, hi), x), _mm256_cmpgt_epi8(x, _mm256_shuffle_epi8(upperBounds, hi)));
+
+    if (_mm256_movemask_epi8(_mm256_andnot_si256(isSlash, outside)) != 0) {
+        return false;
+    }
+
+    __m256i values = _mm256_add_epi8(_mm256_add_epi8(x, _mm256_shuffle_epi8(shifts, hi)), _mm256_and_si256(isSlash, _mm256_set1_epi8(-3)));
+
+    values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+    values = _mm256_shuffle_epi8(values, _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+
+    // move the 12 bytes of the high lane next to the 12 bytes of the low lane
+    *out = _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+    return true;
+}
+
+SIMD_TARGET_AVX2
+static size_t base64_decode_avx2(unsigned char * output, const char * input, size_t inputSizeInBytes) {
+    size_t i = 0U;
+    size_t j = 0U;
+
+    for (; i + 32U <= inputSizeInBytes; i += 32U, j += 24U) {
+        __m256i out;
+
+        if (!base64_decode_block_avx2(_mm256_loadu_si256((const __m256i *)(input + i)), &out)) {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)(output + j), _mm256_castsi256_si128(out));
+        _mm_storel_epi64((__m128i *)(output + j + 16U), _mm256_extracti128_si256(out, 1));
+    }
+
+    return i;
+}
+
+#elif defined (SIMD_NEON)
+
+static size_t base64_encode_neon(char * output, const unsigned char * input, size_t inputSizeInBytes) {
+    const uint8_t * t = (const uint8_t *)base64EncodeTable;
+
+    const uint8x16x4_t table = {{ vld1q_u8(t), vld1q_u8(t + 16), vld1q_u8(t + 32), vld1q_u8(t + 48) }};
+
+    const uint8x16_t low6bits = vdupq_n_u8(0x3F);
+
+    size_t i = 0U;
+    size_t j = 0U;
+
+    for (; i + 48U <= inputSizeInBytes; i += 48U, j += 64U) {
+        // de-interleaved: the 1st, 2nd and 3rd byte of every 3 bytes
+        uint8x16x3_t x = vld3q_u8(input + i);
+
+        uint8x16x4_t y;
+
+        y.val[0] = vshrq_n_u8(x.val[0], 2);
+        y.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(x.val[0], 4), vshrq_n_u8(x.val[1], 4)), low6bits);
+        y.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(x.val[1], 2), vshrq_n_u8(x.val[2], 6)), low6bits);
+        y.val[3] = vandq_u8(x.val[2], low6bits);
+
+        y.val[0] = vqtbl4q_u8(table, y.val[0]);
+        y.val[1] = vqtbl4q_u8(table, y.val[1]);
+        y.val[2] = vqtbl4q_u8(table, y.val[2]);
+        y.val[3] = vqtbl4q_u8(table, y.val[3]);
+
+        vst4q_u8((uint8_t *)(output + j), y);
+    }
+
+    return i;
+}
+
+static size_t base64_decode_neon(unsigned char * output, const char * input, size_t inputSizeInBytes) {
+    const uint8_t * t = base64DecodeTable;
+
+    const uint8x16x4_t table0 = {{ vld1q_u8(t),      vld1q_u8(t + 16), vld1q_u8(t + 32), vld1q_u8(t + 48)  }};
+    const uint8x16x4_t table1 = {{ vld1q_u8(t + 64), vld1q_u8(t + 80), vld1q_u8(t + 96), vld1q_u8(t + 112) }};
+
+    const uint8x16_t x40 = vdupq_n_u8(0x40);
+    const uint8x16_t x80 = vdupq_n_u8(0x80);
+
+    size_t i = 0U;
+    size_t j = 0U;
+
+    for (; i + 64U <= inputSizeInBytes; i += 64U, j += 48U) {
+        uint8x16x4_t x = vld4q_u8((const uint8_t *)(input + i));
+
+        uint8x16_t error = vdupq_n_u8(0);
+
+        for (int k = 0; k < 4; k++) {
+            uint8x16_t c = x.val[k];
+
+            // the characters above 0x7F are not looked up by both tables, they are marked as error by their high bit
+            uint8x16_t v = vqtbx4q_u8(vqtbl4q_u8(table0, c), table1, vsubq_u8(c, x40));
+
+            error = vorrq_u8(error, vorrq_u8(v, vandq_u8(c, x80)));
+
+            x.val[k] = v;
+        }
+
+        if (vmaxvq_u8(error) > 0x3F) {
+            break;
+        }
+
+        uint8x16x3_t y;
+
+        y.val[0] = vorrq_u8(vshlq_n_u8(x.val[0], 2), vshrq_n_u8(x.val[1], 4));
+        y.val[1] = vorrq_u8(vshlq_n_u8(x.val[1], 4), vshrq_n_u8(x.val[2], 2));
+        y.val[2] = vorrq_u8(vshlq_n_u8(x.val[2], 6), x.val[3]);
+
+        vst3q_u8(output + j, y);
+    }
+
+    return i;
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+size_t base64_encode(char * output, const unsigned char * input, size_t inputSizeInBytes) {
+    size_t i;
+
+#if defined (SIMD_X86)
+    if (simd_has_avx2()) {
+        i = base64_encode_avx2(output, input, inputSizeInBytes);
+    } else if (simd_has_ssse3()) {
+        i = base64_encode_ssse3(output, input, inputSizeInBytes);
+    } else {
+        i = 0U;
+    }
+#elif defined (SIMD_NEON)
+    i = base64_encode_neon(output, input, inputSizeInBytes);
+#else
+    i = 0U;
+#endif
+
+    size_t j = i / 3U * 4U;
+
+    for (; i + 3U <= inputSizeInBytes; i += 3U, j += 4U) {
+        unsigned int x = ((unsigned int)input[i] << 16) | ((unsigned int)input[i + 1U] << 8) | input[i + 2U];
+
+        output[j]      = base64EncodeTable[(x >> 18) & 0x3F];
+        output[j + 1U] = base64EncodeTable[(x >> 12) & 0x3F];
+        output[j + 2U] = base64EncodeTable[(x >> 6) & 0x3F];
+        output[j + 3U] = base64EncodeTable[x & 0x3F];
+    }
+
+    switch (inputSizeInBytes - i) {
+        case 1:
+            output[j++] = base64EncodeTable[input[i] >> 2];
+            output[j++] = base64EncodeTable[(input[i] & 0x03) << 4];
+            output[j++] = '=';
+            output[j++] = '=';
+            break;
+        case 2:
+            output[j++] = base64EncodeTable[input[i] >> 2];
+            output[j++] = base64EncodeTable[((input[i] & 0x03) << 4) | (input[i + 1U] >> 4)];
+            output[j++] = base64EncodeTable[(input[i + 1U] & 0x0F) << 2];
+            output[j++] = '=';
+            break;
+    }
+
+    return j;
+}
+
+int base64_decode(unsigned char * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes) {
+    if ((inputSizeInBytes & 3U) != 0U) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (inputSizeInBytes == 0U) {
+        (*outputSizeInBytes) = 0U;
+        return 0;
+    }
+
+    // the last 4 characters might have paddings, they are always left to the scalar code
+    size_t n = inputSizeInBytes - 4U;
+
+    size_t i;
+
+    // a kernel stops at the first block which has a non-base64 character, the scalar code reports it
+#if defined (SIMD_X86)
+    if (simd_has_avx2()) {
+        i = base64_decode_avx2(output, input, n);
+    } else if (simd_has_ssse3()) {
+        i = base64_decode_ssse3(output, input, n);
+    } else {
+        i = 0U;
+    }
+#elif defined (SIMD_NEON)
+    i = base64_decode_neon(output, input, n);
+#else
+    i = 0U;
+#endif
+
+    size_t j = (i >> 2) * 3U;
+
+    for (; i < inputSizeInBytes; i += 4U) {
+        unsigned char a = base64DecodeTable[(unsigned char)input[i]];
+        unsigned char b = base64DecodeTable[(unsigned char)input[i + 1U]];
+        unsigned char c = base64DecodeTable[(unsigned char)input[i + 2U]];
+        unsigned char d = base64DecodeTable[(unsigned char)input[i + 3U]];
+
+        // 0xFF has the high 2 bits set
+        if (((a | b | c | d) & 0xC0) == 0) {
+            output[j++] = (unsigned char)((a << 2) | (b >> 4));
+            output[j++] = (unsigned char)((b << 4) | (c >> 2));
+            output[j++] = (unsigned char)((c << 6) | d);
+            continue;
+        }
+
+        // only the last 4 characters might have paddings: xx== or xxx=
+        if (i != n || a == 0xFF || b == 0xFF || input[i + 3U] != '=') {
+            errno = EINVAL;
+            return -1;
+        }
+
+        output[j++] = (unsigned char)((a << 2) | (b >> 4));
+
+        if (input[i + 2U] != '=') {
+            if (c == 0xFF) {
+                errno = EINVAL;
+                return -1;
+            }
+
+            output[j++] = (unsigned char)((b << 4) | (c >> 2));
+        }
+    }
+
+    (*outputSizeInBytes) = j;
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 int base64_encode_of_string(char * * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes) {
     if (output == NULL) {
         errno = EINVAL;
@@ -40,25 +435,24 @@ int base64_encode_of_bytes(char * * output, size_t * outputSizeInBytes, const un
         return -1;
     }
 
-    size_t bufLength = (inputSizeInBytes << 2U) / 3U + 3U;
-    char   buf[bufLength];
-    memset(buf, 0, bufLength);
+    char * p = (char *)malloc((inputSizeInBytes + 2U) / 3U * 4U + 1U);
+
+    if (p == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    size_t n = base64_encode(p, input, inputSizeInBytes);
 
-    int n = EVP_EncodeBlock((unsigned char *)buf, input, inputSizeInBytes);
+    p[n] = '\0';
 
     if (outputSizeInBytes != NULL) {
         (*outputSizeInBytes) = n;
     }
 
-    char * p = strndup(buf, n);
+    (*output) = p;
 
-    if (p == NULL) {
-        errno = ENOMEM;
-        return -1;
-    } else {
-        (*output) = p;
-        return 0;
-    }
+    return 0;
 }
 
 int base64_decode_to_bytes(unsigned char * * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes) {
@@ -81,27 +475,20 @@ int base64_decode_to_bytes(unsigned char * * output, size_t * outputSizeInBytes,
         return -1;
     }
 
-    size_t bufLength = (inputSizeInBytes * 3U) >> 2;
-    unsigned char  buf[bufLength];
-    memset(buf, 0, bufLength);
+    unsigned char * p = (unsigned char *)malloc((inputSizeInBytes >> 2) * 3U + 1U);
 
-    // EVP_DecodeBlock() returns the length of the data decoded or -1 on error.
-    int n = EVP_DecodeBlock(buf, (unsigned char *)input, inputSizeInBytes);
-
-    if (n == -1) {
-        errno = EINVAL;
+    if (p == NULL) {
+        errno = ENOMEM;
         return -1;
     }
 
-    unsigned char * p = (unsigned char *)calloc(n, sizeof(unsigned char));
+    size_t n;
 
-    if (p == NULL) {
-        errno = ENOMEM;
+    if (base64_decode(p, &n, input, inputSizeInBytes) != 0) {
+        free(p);
         return -1;
     }
 
-    memcpy(p, buf, n);
-
     (*output) = p;
 
     if (outputSizeInBytes != NULL) {
@@ -112,48 +499,192 @@ int base64_decode_to_bytes(unsigned char * * output, size_t * outputSizeInBytes,
 }
 
 int base64_decode_to_string(char * * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes) {
-    if (output == NULL) {
-        errno = EINVAL;
+    unsigned char * p = NULL;
+
+    size_t n;
+
+    if (base64_decode_to_bytes(&p, &n, input, inputSizeInBytes) != 0) {
         return -1;
     }
 
-    if (input == NULL) {
-        errno = EINVAL;
-        return -1;
+    p[n] = '\0';
+
+    (*output) = (char *)p;
+
+    if (outputSizeInBytes != NULL) {
+        (*outputSizeInBytes) = n;
     }
 
-    if (inputSizeInBytes == 0U) {
-        inputSizeInBytes = strlen(input);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int write_fully(int fd, const void * buf, size_t size) {
+    const char * p = (const char *)buf;
+
+    while (size != 0U) {
+        ssize_t n = write(fd, p, size);
+
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return -1;
+        }
+
+        p    += n;
+        size -= (size_t)n;
     }
 
-    if (inputSizeInBytes == 0U) {
-        errno = EINVAL;
-        return -1;
+    return 0;
+}
+
+static ssize_t read_some(int fd, void * buf, size_t size) {
+    for (;;) {
+        ssize_t n = read(fd, buf, size);
+
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+
+        return n;
     }
+}
 
-    size_t bufLength = ((inputSizeInBytes * 3U) >> 2U) + 1U;
-    char   buf[bufLength];
-    memset(buf, 0, bufLength);
+int base64_encode_stream(int inputFD, int outputFD) {
+    // at most 2 bytes are carried over to the next chunk
+    const size_t inputBufCapacity  = BASE64_STREAM_BUFFER_SIZE + 2U;
+    const size_t outputBufCapacity = (inputBufCapacity + 2U) / 3U * 4U;
 
-    // EVP_DecodeBlock() returns the length of the data decoded or -1 on error.
-    int n = EVP_DecodeBlock((unsigned char *)buf, (unsigned char *)input, inputSizeInBytes);
+    unsigned char * inputBuf = (unsigned char *)malloc(inputBufCapacity + outputBufCapacity);
 
-    if (n == -1) {
-        errno = EINVAL;
+    if (inputBuf == NULL) {
+        errno = ENOMEM;
         return -1;
     }
 
-    if (outputSizeInBytes != NULL) {
-        (*outputSizeInBytes) = n;
+    char * outputBuf = (char *)(inputBuf + inputBufCapacity);
+
+    size_t pending = 0U;
+
+    int ret = 0;
+
+    for (;;) {
+        ssize_t n = read_some(inputFD, inputBuf + pending, BASE64_STREAM_BUFFER_SIZE);
+
+        if (n == -1) {
+            ret = -1;
+            break;
+        }
+
+        // only the last chunk might have paddings
+        size_t size = (n == 0) ? pending : pending + (size_t)n - (pending + (size_t)n) % 3U;
+
+        if (size != 0U) {
+            ret = write_fully(outputFD, outputBuf, base64_encode(outputBuf, inputBuf, size));
+
+            if (ret != 0) {
+                break;
+            }
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        pending = pending + (size_t)n - size;
+
+        memmove(inputBuf, inputBuf + size, pending);
     }
 
-    char * p = strndup(buf, n);
+    free(inputBuf);
 
-    if (p == NULL) {
+    return ret;
+}
+
+int base64_decode_stream(int inputFD, int outputFD) {
+    // at most 3 characters are carried over to the next chunk
+    const size_t inputBufCapacity  = BASE64_STREAM_BUFFER_SIZE + 3U;
+    const size_t outputBufCapacity = (inputBufCapacity >> 2) * 3U;
+
+    char * inputBuf = (char *)malloc(inputBufCapacity + outputBufCapacity);
+
+    if (inputBuf == NULL) {
         errno = ENOMEM;
         return -1;
-    } else {
-        (*output) = p;
-        return 0;
     }
+
+    unsigned char * outputBuf = (unsigned char *)(inputBuf + inputBufCapacity);
+
+    size_t pending = 0U;
+
+    // nothing but blanks is allowed after the paddings
+    bool padded = false;
+
+    int ret = 0;
+
+    for (;;) {
+        ssize_t n = read_some(inputFD, inputBuf + pending, BASE64_STREAM_BUFFER_SIZE);
+
+        if (n == -1) {
+            ret = -1;
+            break;
+        }
+
+        if (n == 0) {
+            if (pending != 0U) {
+                errno = EINVAL;
+                ret = -1;
+            }
+
+            break;
+        }
+
+        // line breaks and blanks are allowed, they are dropped
+        size_t size = pending;
+
+        for (size_t i = pending; i < pending + (size_t)n; i++) {
+            char c = inputBuf[i];
+
+            if (c != '\n' && c != '\r' && c != ' ' && c != '\t') {
+                inputBuf[size++] = c;
+            }
+        }
+
+        if (padded && size != 0U) {
+            errno = EINVAL;
+            ret = -1;
+            break;
+        }
+
+        size_t whole = size & ~(size_t)3U;
+
+        if (whole != 0U) {
+            size_t outputSize;
+
+            ret = base64_decode(outputBuf, &outputSize, inputBuf, whole);
+
+            if (ret != 0) {
+                break;
+            }
+
+            padded = outputSize != (whole >> 2) * 3U;
+
+            ret = write_fully(outputFD, outputBuf, outputSize);
+
+            if (ret != 0) {
+                break;
+            }
+        }
+
+        pending = size - whole;
+
+        memmove(inputBuf, inputBuf + whole, pending);
+    }
+
+    free(inputBuf);
+
+    return ret;
 }
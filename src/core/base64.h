@@ -9,4 +9,31 @@ int base64_encode_of_string(char * * output, size_t * outputSizeInBytes, const
 int base64_decode_to_bytes(unsigned char * * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes);
 int base64_decode_to_string(        char * * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes);
 
+/** encode inputSizeInBytes bytes with paddings, output should be able to hold (inputSizeInBytes + 2) / 3 * 4 characters, no '\0' is appended.
+ *
+ *  the count of the written characters is returned.
+ */
+size_t base64_encode(char * output, const unsigned char * input, size_t inputSizeInBytes);
+
+/** decode inputSizeInBytes characters, which should be a multiple of 4, only the last 4 characters might have paddings.
+ *
+ *  output should be able to hold inputSizeInBytes / 4 * 3 bytes.
+ *
+ *  On success, 0 is returned and the count of the written bytes is stored in *outputSizeInBytes.
+ *  On error, -1 is returned and errno is set to EINVAL.
+ */
+int base64_decode(unsigned char * output, size_t * outputSizeInBytes, const char * input, size_t inputSizeInBytes);
+
+/** read from inputFD until EOF, write the encoded characters to outputFD.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and errno is set.
+ */
+int base64_encode_stream(int inputFD, int outputFD);
+
+/** read the encoded characters from inputFD until EOF, write the decoded bytes to outputFD, line breaks and blanks are ignored.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and errno is set, it is EINVAL if the input is not valid base64.
+ */
+int base64_decode_stream(int inputFD, int outputFD);
+
 #endif
@@ -0,0 +1,95 @@
+#include <errno.h>
+#include <string.h>
+#include <limits.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "openat-beneath.h"
+
+// Linux reports ENOTDIR for a symlink opened with O_DIRECTORY | O_NOFOLLOW, macOS reports ELOOP
+static int openat_a_dir_nofollow(const int dirFD, const char * name, const bool create) {
+    for (int i = 0; ; i++) {
+        int fd = openat(dirFD, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+        if (fd != -1) {
+            return fd;
+        }
+
+        if (errno == ENOTDIR) {
+            struct stat st;
+
+            if (fstatat(dirFD, name, &st, AT_SYMLINK_NOFOLLOW) == 0 && S_ISLNK(st.st_mode)) {
+                errno = ELOOP;
+            } else {
+                errno = ENOTDIR;
+            }
+
+            return -1;
+        }
+
+        if (errno != ENOENT || !create || i > 0) {
+            return -1;
+        }
+
+        // another thread or process might have just created it
+        if (mkdirat(dirFD, name, 0755) != 0 && errno != EEXIST) {
+            return -1;
+        }
+    }
+}
+
+int openat_beneath(const int dirFD, const char * path, const bool create) {
+    int fd = fcntl(dirFD, F_DUPFD_CLOEXEC, 0);
+
+    if (fd == -1) {
+        return -1;
+    }
+
+    for (const char * p = path; ; ) {
+        while (p[0] == '/') p++;
+
+        if (p[0] == '\0') {
+            return fd;
+        }
+
+        size_t n = strcspn(p, "/");
+
+        if (n > NAME_MAX) {
+            close(fd);
+            errno = ENAMETOOLONG;
+            return -1;
+        }
+
+        char name[NAME_MAX + 1];
+
+        memcpy(name, p, n);
+        name[n] = '\0';
+
+        p += n;
+
+        if (strcmp(name, ".") == 0) {
+            continue;
+        }
+
+        if (strcmp(name, "..") == 0) {
+            close(fd);
+            errno = EXDEV;
+            return -1;
+        }
+
+        int childFD = openat_a_dir_nofollow(fd, name, create);
+
+        int err = errno;
+
+        close(fd);
+
+        if (childFD == -1) {
+            errno = err;
+            return -1;
+        }
+
+        fd = childFD;
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef _OPENAT_BENEATH_H
+#define _OPENAT_BENEATH_H
+
+#include <stdbool.h>
+
+/** open the directory at the given relative path beneath dirFD, the missing directories are created if create is true.
+ *
+ *  every component is opened with O_NOFOLLOW, so neither a symlink nor a '..' can lead it out of dirFD,
+ *  this is how the entries of an archive are kept inside the directory it is extracted into, even if the archive contains a symlink to elsewhere.
+ *
+ *  On success, a new fd is returned, the caller should close it. On error, -1 is returned and errno is set, ELOOP if a component is a symlink.
+ */
+int openat_beneath(const int dirFD, const char * path, const bool create);
+
+#endif
@@ -0,0 +1,122 @@
+#include <errno.h>
+#include <pthread.h>
+
+#include "sysinfo.h"
+#include "parallel.h"
+
+typedef struct {
+    pthread_mutex_t mutex;
+
+    size_t next;
+    size_t count;
+
+    ParallelWork work;
+    void *       arg;
+} ParallelContext;
+
+static void* parallel_worker(void * p) {
+    ParallelContext * ctx = (ParallelContext*)p;
+
+    for (;;) {
+        pthread_mutex_lock(&ctx->mutex);
+
+        size_t index = ctx->next;
+
+        if (index < ctx->count) {
+            ctx->next++;
+        }
+
+        pthread_mutex_unlock(&ctx->mutex);
+
+        if (index >= ctx->count) {
+            return NULL;
+        }
+
+        ctx->work(index, ctx->arg);
+    }
+}
+
+int parallel_for(size_t count, unsigned int nthreads, ParallelWork work, void * arg) {
+    if (work == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (nthreads == 0U) {
+        nthreads = (unsigned int)sysinfo_ncpu();
+    }
+
+    if (nthreads > count) {
+        nthreads = (unsigned int)count;
+    }
+
+    if (nthreads <= 1U) {
+        for (size_t i = 0U; i < count; i++) {
+            work(i, arg);
+        }
+
+        return 0;
+    }
+
+    pthread_t * threads = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
+
+    if (threads == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    ParallelContext ctx = {
+        .next  = 0U,
+        .count = count,
+        .work  = work,
+        .arg   = arg
+    };
+
+    int ret = pthread_mutex_init(&ctx.mutex, NULL);
+
+    if (ret != 0) {
+        free(threads);
+        errno = ret;
+        return -1;
+    }
+
+    unsigned int n = 0U;
+
+    for (; n < nthreads; n++) {
+        if (pthread_create(&threads[n], NULL, parallel_worker, &ctx) != 0) {
+            break;
+        }
+    }
+
+    // the threads which are already running take over the remaining work, if none could be created, run it on the calling thread
+    if (n == 0U) {
+        parallel_worker(&ctx);
+    }
+
+    for (unsigned int i = 0U; i < n; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&ctx.mutex);
+
+    free(threads);
+
+    return 0;
+}
+
+// a thread waiting for the network does not keep a cpu busy, so more threads than cpus are worthwhile, but too many connections to the same server are likely to be throttled
+unsigned int parallel_network_jobs() {
+    int ncpu = sysinfo_ncpu();
+
+    unsigned int n = ncpu > 0 ? 2U * (unsigned int)ncpu : 0U;
+
+    if (n < 8U) {
+        return 8U;
+    }
+
+    if (n > 16U) {
+        return 16U;
+    }
+
+    return n;
+}
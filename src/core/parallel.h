@@ -0,0 +1,24 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdlib.h>
+
+typedef int (*ParallelWork)(size_t index, void * arg);
+
+/** run work(i, arg) for every i in [0, count) on a pool of at most nthreads threads.
+ *
+ *  the indexes are handed out in ascending order, one at a time, to whichever thread becomes idle first.
+ *  if nthreads is 0, the count of online cpus is used. if only one thread is needed, the work is run on the calling thread.
+ *
+ *  the return values of work are ignored, work is expected to record its own result at index.
+ *
+ *  On success,  0 is returned.
+ *  On error,   -1 is returned and errno is set to indicate the error, no work has been run in this case.
+ */
+int parallel_for(size_t count, unsigned int nthreads, ParallelWork work, void * arg);
+
+/** the nthreads for the works which are mostly waiting for the network, such as fetching and downloading.
+ */
+unsigned int parallel_network_jobs();
+
+#endif
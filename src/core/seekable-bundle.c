@@ -0,0 +1,971 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include <openssl/evp.h>
+
+#include "seekable-bundle.h"
+#include "openat-beneath.h"
+
+#define CHUNK 65536
+
+// deflate never compresses better than about 1032:1, a larger uncompressed size in the trailer is a lie
+#define DEFLATE_MAX_RATIO 1032U
+
+static void sha256_to_hex(const unsigned char * md, char hex[65]) {
+    const char * const table = "0123456789abcdef";
+
+    for (int i = 0; i < 32; i++) {
+        hex[i << 1]       = table[md[i] >> 4];
+        hex[(i << 1) + 1] = table[md[i] & 0x0F];
+    }
+
+    hex[64] = '\0';
+}
+
+static void uint64_to_le(unsigned char * p, uint64_t v) {
+    for (int i = 0; i < 8; i++) {
+        p[i] = (unsigned char)(v >> (i << 3));
+    }
+}
+
+static uint64_t uint64_from_le(const unsigned char * p) {
+    uint64_t v = 0U;
+
+    for (int i = 7; i >= 0; i--) {
+        v = (v << 8) | p[i];
+    }
+
+    return v;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    FILE * outputFile;
+
+    // how many bytes have been written into outputFile
+    uint64_t offset;
+
+    // the index lines
+    FILE * indexFile;
+
+    bool verbose;
+
+    unsigned char inBuf[CHUNK];
+    unsigned char outBuf[CHUNK];
+} SeekableBundleWriter;
+
+// compress data into a new frame, if fd is -1, data is the whole input, otherwise the input is read from fd
+static int write_a_frame(SeekableBundleWriter * writer, int fd, const unsigned char * data, size_t dataSize, uint64_t * frameSize, uint64_t * inputSize, char sha256sum[65]) {
+    z_stream zStream;
+    zStream.zalloc = Z_NULL;
+    zStream.zfree  = Z_NULL;
+    zStream.opaque = Z_NULL;
+
+    if (deflateInit(&zStream, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        fprintf(stderr, "deflateInit() failed.\n");
+        return -1;
+    }
+
+    EVP_MD_CTX * ctx = EVP_MD_CTX_new();
+
+    if (ctx == NULL || EVP_DigestInit_ex(ctx, EVP_sha256(), NULL) != 1) {
+        fprintf(stderr, "EVP_DigestInit_ex() failed.\n");
+        EVP_MD_CTX_free(ctx);
+        deflateEnd(&zStream);
+        return -1;
+    }
+
+    uint64_t nIn  = 0U;
+    uint64_t nOut = 0U;
+
+    int ret = 0;
+
+    for (;;) {
+        int flush;
+
+        if (fd == -1) {
+            zStream.next_in  = (unsigned char *)data;
+            zStream.avail_in = (uInt)dataSize;
+            flush = Z_FINISH;
+        } else {
+            ssize_t readSize = read(fd, writer->inBuf, CHUNK);
+
+            if (readSize < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                perror(NULL);
+                ret = -1;
+                break;
+            }
+
+            zStream.next_in  = writer->inBuf;
+            zStream.avail_in = (uInt)readSize;
+            flush = (readSize == 0) ? Z_FINISH : Z_NO_FLUSH;
+        }
+
+        EVP_DigestUpdate(ctx, zStream.next_in, zStream.avail_in);
+
+        nIn += zStream.avail_in;
+
+        do {
+            zStream.next_out  = writer->outBuf;
+            zStream.avail_out = CHUNK;
+
+            deflate(&zStream, flush);
+
+            size_t have = CHUNK - zStream.avail_out;
+
+            if (fwrite(writer->outBuf, 1, have, writer->outputFile) != have) {
+                perror(NULL);
+                ret = -1;
+                break;
+            }
+
+            nOut += have;
+        } while (zStream.avail_out == 0);
+
+        if (ret != 0 || flush == Z_FINISH) {
+            break;
+        }
+    }
+
+    deflateEnd(&zStream);
+
+    unsigned char md[EVP_MAX_MD_SIZE];
+
+    if (ret == 0) {
+        if (EVP_DigestFinal_ex(ctx, md, NULL) != 1) {
+            fprintf(stderr, "EVP_DigestFinal_ex() failed.\n");
+            ret = -1;
+        }
+    }
+
+    EVP_MD_CTX_free(ctx);
+
+    if (ret == 0) {
+        *frameSize = nOut;
+        *inputSize = nIn;
+
+        if (sha256sum != NULL) {
+            sha256_to_hex(md, sha256sum);
+        }
+    }
+
+    return ret;
+}
+
+static int compare_dirent_by_name(const struct dirent ** a, const struct dirent ** b) {
+    return strcmp((*a)->d_name, (*b)->d_name);
+}
+
+static int skip_dot_dirent(const struct dirent * p) {
+    if (p->d_name[0] == '.') {
+        if (p->d_name[1] == '\0') return 0;
+        if (p->d_name[1] == '.' && p->d_name[2] == '\0') return 0;
+    }
+
+    return 1;
+}
+
+// filePath is the path on disk, entryPath is the path in the bundle
+static int write_an_entry(SeekableBundleWriter * writer, const char * filePath, const char * entryPath) {
+    if (strpbrk(entryPath, "\t\n") != NULL) {
+        fprintf(stderr, "path contains tab or newline, which is not supported: %s\n", filePath);
+        return -1;
+    }
+
+    struct stat st;
+
+    if (lstat(filePath, &st) != 0) {
+        perror(filePath);
+        return -1;
+    }
+
+    if (writer->verbose) {
+        fprintf(stderr, "a %s\n", entryPath);
+    }
+
+    unsigned int mode = (unsigned int)(st.st_mode & 07777);
+
+    if (S_ISLNK(st.st_mode)) {
+        char linkTarget[PATH_MAX];
+
+        ssize_t n = readlink(filePath, linkTarget, PATH_MAX - 1);
+
+        if (n < 0) {
+            perror(filePath);
+            return -1;
+        }
+
+        linkTarget[n] = '\0';
+
+        fprintf(writer->indexFile, "l\t%o\t0\t0\t0\t-\t%s\t%s\n", mode, entryPath, linkTarget);
+        return 0;
+    }
+
+    if (S_ISREG(st.st_mode)) {
+        int fd = open(filePath, O_RDONLY);
+
+        if (fd == -1) {
+            perror(filePath);
+            return -1;
+        }
+
+        uint64_t frameSize;
+        uint64_t fileSize;
+
+        char sha256sum[65];
+
+        int ret = write_a_frame(writer, fd, NULL, 0U, &frameSize, &fileSize, sha256sum);
+
+        close(fd);
+
+        if (ret != 0) {
+            return ret;
+        }
+
+        fprintf(writer->indexFile, "f\t%o\t%llu\t%llu\t%llu\t%s\t%s\n", mode, (unsigned long long)writer->offset, (unsigned long long)frameSize, (unsigned long long)fileSize, sha256sum, entryPath);
+
+        writer->offset += frameSize;
+        return 0;
+    }
+
+    if (!S_ISDIR(st.st_mode)) {
+        fprintf(stderr, "neither a regular file nor a directory nor a symlink, skipped: %s\n", filePath);
+        return 0;
+    }
+
+    fprintf(writer->indexFile, "d\t%o\t0\t0\t0\t-\t%s\n", mode, entryPath);
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    struct dirent ** dirents = NULL;
+
+    int n = scandir(filePath, &dirents, skip_dot_dirent, compare_dirent_by_name);
+
+    if (n < 0) {
+        perror(filePath);
+        return -1;
+    }
+
+    int ret = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (ret == 0) {
+            char childFilePath[PATH_MAX];
+            char childEntryPath[PATH_MAX];
+
+            if (snprintf(childFilePath, PATH_MAX, "%s/%s", filePath, dirents[i]->d_name) < 0 || snprintf(childEntryPath, PATH_MAX, "%s/%s", entryPath, dirents[i]->d_name) < 0) {
+                perror(NULL);
+                ret = -1;
+            } else {
+                ret = write_an_entry(writer, childFilePath, childEntryPath);
+            }
+        }
+
+        free(dirents[i]);
+    }
+
+    free(dirents);
+
+    return ret;
+}
+
+static int write_the_children_of_the_root(SeekableBundleWriter * writer, const char * inputDir) {
+    struct dirent ** dirents = NULL;
+
+    int n = scandir(inputDir, &dirents, skip_dot_dirent, compare_dirent_by_name);
+
+    if (n < 0) {
+        perror(inputDir);
+        return -1;
+    }
+
+    int ret = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (ret == 0) {
+            char filePath[PATH_MAX];
+
+            if (snprintf(filePath, PATH_MAX, "%s/%s", inputDir, dirents[i]->d_name) < 0) {
+                perror(NULL);
+                ret = -1;
+            } else {
+                ret = write_an_entry(writer, filePath, dirents[i]->d_name);
+            }
+        }
+
+        free(dirents[i]);
+    }
+
+    free(dirents);
+
+    return ret;
+}
+
+int seekable_bundle_create(const char * inputDir, const char * outputFilePath, const bool verbose) {
+    SeekableBundleWriter * writer = (SeekableBundleWriter*)calloc(1, sizeof(SeekableBundleWriter));
+
+    if (writer == NULL) {
+        perror(NULL);
+        return -1;
+    }
+
+    writer->verbose = verbose;
+
+    writer->outputFile = fopen(outputFilePath, "wb");
+
+    if (writer->outputFile == NULL) {
+        perror(outputFilePath);
+        free(writer);
+        return -1;
+    }
+
+    char * indexBuf = NULL;
+    size_t indexBufSize = 0U;
+
+    writer->indexFile = open_memstream(&indexBuf, &indexBufSize);
+
+    if (writer->indexFile == NULL) {
+        perror(NULL);
+        fclose(writer->outputFile);
+        free(writer);
+        return -1;
+    }
+
+    int ret = write_the_children_of_the_root(writer, inputDir);
+
+    if (fclose(writer->indexFile) != 0) {
+        perror(NULL);
+        ret = -1;
+    }
+
+    if (ret == 0) {
+        uint64_t indexFrameSize;
+        uint64_t indexSize;
+
+        ret = write_a_frame(writer, -1, (const unsigned char *)indexBuf, indexBufSize, &indexFrameSize, &indexSize, NULL);
+
+        if (ret == 0) {
+            unsigned char trailer[SEEKABLE_BUNDLE_TRAILER_SIZE];
+
+            memcpy(trailer, SEEKABLE_BUNDLE_MAGIC, 8);
+
+            uint64_to_le(trailer +  8, writer->offset);
+            uint64_to_le(trailer + 16, indexFrameSize);
+            uint64_to_le(trailer + 24, indexSize);
+
+            if (fwrite(trailer, 1, SEEKABLE_BUNDLE_TRAILER_SIZE, writer->outputFile) != SEEKABLE_BUNDLE_TRAILER_SIZE) {
+                perror(outputFilePath);
+                ret = -1;
+            }
+        }
+    }
+
+    if (fclose(writer->outputFile) != 0) {
+        perror(outputFilePath);
+        ret = -1;
+    }
+
+    free(indexBuf);
+    free(writer);
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    char     type;
+    mode_t   mode;
+    uint64_t offset;
+    uint64_t frameSize;
+    uint64_t size;
+    char *   sha256sum;
+    char *   path;
+    char *   linkTarget;
+} SeekableBundleEntry;
+
+typedef struct {
+    int fd;
+
+    const char * filePath;
+
+    // the uncompressed index, the fields of entryArray point into it
+    char * indexBuf;
+
+    SeekableBundleEntry * entryArray;
+    size_t                entryArraySize;
+} SeekableBundleReader;
+
+static void seekable_bundle_reader_close(SeekableBundleReader * reader) {
+    if (reader->fd != -1) {
+        close(reader->fd);
+    }
+
+    free(reader->indexBuf);
+    free(reader->entryArray);
+}
+
+static int parse_an_index_line(char * line, SeekableBundleEntry * entry) {
+    char * fields[8] = {0};
+
+    int n = 0;
+
+    for (char * p = line; n < 8; ) {
+        fields[n++] = p;
+
+        char * q = strchr(p, '\t');
+
+        if (q == NULL) {
+            break;
+        }
+
+        *q = '\0';
+        p = q + 1;
+    }
+
+    if (n < 7 || fields[0][0] == '\0' || fields[0][1] != '\0') {
+        return -1;
+    }
+
+    entry->type       = fields[0][0];
+    entry->mode       = (mode_t)strtoul(fields[1], NULL, 8);
+    entry->offset     = strtoull(fields[2], NULL, 10);
+    entry->frameSize  = strtoull(fields[3], NULL, 10);
+    entry->size       = strtoull(fields[4], NULL, 10);
+    entry->sha256sum  = fields[5];
+    entry->path       = fields[6];
+    entry->linkTarget = fields[7];
+
+    if (entry->type == 'l' && entry->linkTarget == NULL) {
+        return -1;
+    }
+
+    // never write outside of the output directory, the last component is the name of the entry in its parent directory
+    if (entry->path[0] == '/' || entry->path[0] == '\0' || entry->path[strlen(entry->path) - 1U] == '/') {
+        return -1;
+    }
+
+    for (const char * p = entry->path; p != NULL; ) {
+        if (p[0] == '.' && p[1] == '.' && (p[2] == '/' || p[2] == '\0')) {
+            return -1;
+        }
+
+        p = strchr(p, '/');
+
+        if (p != NULL) {
+            p++;
+        }
+    }
+
+    return 0;
+}
+
+static int seekable_bundle_reader_open(SeekableBundleReader * reader, const char * filePath) {
+    memset(reader, 0, sizeof(SeekableBundleReader));
+
+    reader->filePath = filePath;
+
+    reader->fd = open(filePath, O_RDONLY);
+
+    if (reader->fd == -1) {
+        perror(filePath);
+        return -1;
+    }
+
+    struct stat st;
+
+    if (fstat(reader->fd, &st) != 0) {
+        perror(filePath);
+        return -1;
+    }
+
+    unsigned char trailer[SEEKABLE_BUNDLE_TRAILER_SIZE];
+
+    if (st.st_size < (off_t)SEEKABLE_BUNDLE_TRAILER_SIZE || pread(reader->fd, trailer, SEEKABLE_BUNDLE_TRAILER_SIZE, st.st_size - SEEKABLE_BUNDLE_TRAILER_SIZE) != SEEKABLE_BUNDLE_TRAILER_SIZE || memcmp(trailer, SEEKABLE_BUNDLE_MAGIC, 8) != 0) {
+        fprintf(stderr, "not a seekable bundle: %s\n", filePath);
+        return -1;
+    }
+
+    uint64_t indexOffset    = uint64_from_le(trailer +  8);
+    uint64_t indexFrameSize = uint64_from_le(trailer + 16);
+    uint64_t indexSize      = uint64_from_le(trailer + 24);
+
+    // the trailer is untrusted, the sums are checked without overflowing, the index is never larger than what its frame is able to hold
+    uint64_t framesSize = (uint64_t)st.st_size - SEEKABLE_BUNDLE_TRAILER_SIZE;
+
+    if (indexOffset > framesSize || indexFrameSize != framesSize - indexOffset || indexSize / DEFLATE_MAX_RATIO > indexFrameSize || indexSize >= (uint64_t)SIZE_MAX) {
+        fprintf(stderr, "corrupted seekable bundle: %s\n", filePath);
+        return -1;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    unsigned char * indexFrame = (unsigned char *)malloc(indexFrameSize == 0U ? 1U : indexFrameSize);
+
+    reader->indexBuf = (char*)malloc((size_t)indexSize + 1U);
+
+    if (indexFrame == NULL || reader->indexBuf == NULL) {
+        perror(NULL);
+        free(indexFrame);
+        return -1;
+    }
+
+    if (pread(reader->fd, indexFrame, indexFrameSize, (off_t)indexOffset) != (ssize_t)indexFrameSize) {
+        perror(filePath);
+        free(indexFrame);
+        return -1;
+    }
+
+    uLongf n = (uLongf)indexSize;
+
+    int ret = uncompress((unsigned char *)reader->indexBuf, &n, indexFrame, (uLong)indexFrameSize);
+
+    free(indexFrame);
+
+    if (ret != Z_OK || n != indexSize) {
+        fprintf(stderr, "corrupted seekable bundle: %s\n", filePath);
+        return -1;
+    }
+
+    reader->indexBuf[indexSize] = '\0';
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t lineCount = 0U;
+
+    for (size_t i = 0U; i < indexSize; i++) {
+        if (reader->indexBuf[i] == '\n') {
+            lineCount++;
+        }
+    }
+
+    reader->entryArray = (SeekableBundleEntry*)calloc(lineCount == 0U ? 1U : lineCount, sizeof(SeekableBundleEntry));
+
+    if (reader->entryArray == NULL) {
+        perror(NULL);
+        return -1;
+    }
+
+    for (char * line = reader->indexBuf; reader->entryArraySize < lineCount; ) {
+        char * p = strchr(line, '\n');
+
+        *p = '\0';
+
+        SeekableBundleEntry * entry = &reader->entryArray[reader->entryArraySize];
+
+        // every frame lies before the index frame
+        if (parse_an_index_line(line, entry) != 0 || entry->offset > indexOffset || entry->frameSize > indexOffset - entry->offset) {
+            fprintf(stderr, "corrupted seekable bundle: %s\n", filePath);
+            return -1;
+        }
+
+        reader->entryArraySize++;
+
+        line = p + 1;
+    }
+
+    return 0;
+}
+
+int seekable_bundle_list(const char * inputFilePath) {
+    SeekableBundleReader reader;
+
+    int ret = seekable_bundle_reader_open(&reader, inputFilePath);
+
+    if (ret == 0) {
+        for (size_t i = 0U; i < reader.entryArraySize; i++) {
+            printf("%s\n", reader.entryArray[i].path);
+        }
+    }
+
+    seekable_bundle_reader_close(&reader);
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// mkdir -p the parent directory of the given path, it is only used for the output directory itself, the entries are resolved by openat_beneath()
+static int make_parent_dirs(char * path) {
+    for (char * p = path + 1; *p != '\0'; p++) {
+        if (*p != '/') {
+            continue;
+        }
+
+        *p = '\0';
+
+        if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+            perror(path);
+            *p = '/';
+            return -1;
+        }
+
+        *p = '/';
+    }
+
+    return 0;
+}
+
+static int extract_a_file(const SeekableBundleReader * reader, const SeekableBundleEntry * entry, const int dirFD, const char * name) {
+    const char * outputFilePath = entry->path;
+
+    // an existing file is replaced rather than written through, it might be a symlink to elsewhere
+    if (unlinkat(dirFD, name, 0) != 0 && errno != ENOENT) {
+        perror(outputFilePath);
+        return -1;
+    }
+
+    int ofd = openat(dirFD, name, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+
+    if (ofd == -1) {
+        perror(outputFilePath);
+        return -1;
+    }
+
+    z_stream zStream;
+    zStream.zalloc   = Z_NULL;
+    zStream.zfree    = Z_NULL;
+    zStream.opaque   = Z_NULL;
+    zStream.avail_in = 0;
+    zStream.next_in  = Z_NULL;
+
+    if (inflateInit(&zStream) != Z_OK) {
+        fprintf(stderr, "inflateInit() failed.\n");
+        close(ofd);
+        return -1;
+    }
+
+    EVP_MD_CTX * ctx = EVP_MD_CTX_new();
+
+    if (ctx == NULL || EVP_DigestInit_ex(ctx, EVP_sha256(), NULL) != 1) {
+        fprintf(stderr, "EVP_DigestInit_ex() failed.\n");
+        EVP_MD_CTX_free(ctx);
+        inflateEnd(&zStream);
+        close(ofd);
+        return -1;
+    }
+
+    unsigned char * inBuf  = (unsigned char *)malloc(CHUNK);
+    unsigned char * outBuf = (unsigned char *)malloc(CHUNK);
+
+    int ret = (inBuf == NULL || outBuf == NULL) ? -1 : 0;
+
+    uint64_t consumed = 0U;
+    uint64_t produced = 0U;
+
+    int zret = Z_OK;
+
+    while (ret == 0 && zret != Z_STREAM_END) {
+        if (zStream.avail_in == 0U) {
+            if (consumed == entry->frameSize) {
+                ret = -1;
+                break;
+            }
+
+            size_t n = (entry->frameSize - consumed) < CHUNK ? (size_t)(entry->frameSize - consumed) : CHUNK;
+
+            if (pread(reader->fd, inBuf, n, (off_t)(entry->offset + consumed)) != (ssize_t)n) {
+                ret = -1;
+                break;
+            }
+
+            consumed += n;
+
+            zStream.next_in  = inBuf;
+            zStream.avail_in = (uInt)n;
+        }
+
+        zStream.next_out  = outBuf;
+        zStream.avail_out = CHUNK;
+
+        zret = inflate(&zStream, Z_NO_FLUSH);
+
+        if (zret != Z_OK && zret != Z_STREAM_END) {
+            ret = -1;
+            break;
+        }
+
+        size_t have = CHUNK - zStream.avail_out;
+
+        EVP_DigestUpdate(ctx, outBuf, have);
+
+        for (size_t written = 0U; written < have; ) {
+            ssize_t n = write(ofd, outBuf + written, have - written);
+
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                perror(outputFilePath);
+                ret = -1;
+                break;
+            }
+
+            written += (size_t)n;
+        }
+
+        produced += have;
+    }
+
+    inflateEnd(&zStream);
+
+    free(inBuf);
+    free(outBuf);
+
+    unsigned char md[EVP_MAX_MD_SIZE];
+
+    char sha256sum[65];
+
+    if (ret == 0 && EVP_DigestFinal_ex(ctx, md, NULL) == 1) {
+        sha256_to_hex(md, sha256sum);
+
+        if (produced != entry->size || strcmp(sha256sum, entry->sha256sum) != 0) {
+            ret = -1;
+        }
+    } else {
+        ret = -1;
+    }
+
+    EVP_MD_CTX_free(ctx);
+
+    if (ret != 0) {
+        fprintf(stderr, "corrupted entry in %s: %s\n", reader->filePath, entry->path);
+    }
+
+    if (fchmod(ofd, entry->mode) != 0) {
+        perror(outputFilePath);
+        ret = -1;
+    }
+
+    if (close(ofd) != 0) {
+        perror(outputFilePath);
+        ret = -1;
+    }
+
+    // never leave a partial file behind
+    if (ret != 0) {
+        unlinkat(dirFD, name, 0);
+    }
+
+    return ret;
+}
+
+static int extract_an_entry(const SeekableBundleReader * reader, const SeekableBundleEntry * entry, const int rootDirFD, const bool verbose) {
+    if (verbose) {
+        printf("x %s\n", entry->path);
+    }
+
+    char parentDIR[PATH_MAX];
+
+    const char * slash = strrchr(entry->path, '/');
+
+    const char * name = (slash == NULL) ? entry->path : slash + 1;
+
+    size_t parentDIRLength = (slash == NULL) ? 0U : (size_t)(slash - entry->path);
+
+    if (parentDIRLength >= PATH_MAX) {
+        fprintf(stderr, "path is too long: %s\n", entry->path);
+        return -1;
+    }
+
+    memcpy(parentDIR, entry->path, parentDIRLength);
+    parentDIR[parentDIRLength] = '\0';
+
+    // a symlink extracted earlier must not lead the entries below it out of the output directory
+    int dirFD = openat_beneath(rootDirFD, parentDIR, true);
+
+    if (dirFD == -1) {
+        if (errno == ELOOP) {
+            fprintf(stderr, "the parent directory is a symlink, refused: %s\n", entry->path);
+        } else {
+            perror(entry->path);
+        }
+
+        return -1;
+    }
+
+    int ret = 0;
+
+    switch (entry->type) {
+        case 'd':
+            // the mode is applied after all of its contents have been extracted, a read-only directory would reject them otherwise
+            if (mkdirat(dirFD, name, 0755) != 0 && errno != EEXIST) {
+                perror(entry->path);
+                ret = -1;
+            }
+
+            break;
+        case 'l':
+            if (unlinkat(dirFD, name, 0) != 0 && errno != ENOENT) {
+                perror(entry->path);
+                ret = -1;
+            } else if (symlinkat(entry->linkTarget, dirFD, name) != 0) {
+                perror(entry->path);
+                ret = -1;
+            }
+
+            break;
+        case 'f':
+            ret = extract_a_file(reader, entry, dirFD, name);
+            break;
+        default:
+            fprintf(stderr, "unknown entry type '%c' in %s: %s\n", entry->type, reader->filePath, entry->path);
+            ret = -1;
+    }
+
+    close(dirFD);
+
+    return ret;
+}
+
+// a path matches itself and everything under it, an empty path or no paths at all match everything
+static bool entry_is_requested(const SeekableBundleEntry * entry, char * const paths[], const size_t pathLengths[], bool pathFounds[], const size_t pathsCount) {
+    bool requested = (pathsCount == 0U);
+
+    for (size_t j = 0U; j < pathsCount; j++) {
+        const char * path = paths[j];
+
+        if (path[0] == '.' && path[1] == '/') {
+            path += 2;
+        }
+
+        size_t len = pathLengths[j];
+
+        if (len == 0U || (strncmp(entry->path, path, len) == 0 && (entry->path[len] == '\0' || entry->path[len] == '/'))) {
+            pathFounds[j] = true;
+            requested = true;
+        }
+    }
+
+    return requested;
+}
+
+int seekable_bundle_extract(const char * inputFilePath, const char * outputDir, char * const paths[], const size_t pathsCount, const bool verbose) {
+    if (outputDir == NULL || outputDir[0] == '\0') {
+        outputDir = ".";
+    }
+
+    SeekableBundleReader reader;
+
+    int ret = seekable_bundle_reader_open(&reader, inputFilePath);
+
+    if (ret != 0) {
+        seekable_bundle_reader_close(&reader);
+        return ret;
+    }
+
+    char outputDirSlash[PATH_MAX];
+
+    if (snprintf(outputDirSlash, PATH_MAX, "%s/", outputDir) < 0) {
+        perror(NULL);
+        seekable_bundle_reader_close(&reader);
+        return -1;
+    }
+
+    int rootDirFD = -1;
+
+    if (make_parent_dirs(outputDirSlash) == 0) {
+        rootDirFD = open(outputDir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+        if (rootDirFD == -1) {
+            perror(outputDir);
+        }
+    }
+
+    if (rootDirFD == -1) {
+        seekable_bundle_reader_close(&reader);
+        return -1;
+    }
+
+    size_t pathLengths[pathsCount + 1U];
+    bool   pathFounds [pathsCount + 1U];
+
+    for (size_t j = 0U; j < pathsCount; j++) {
+        const char * path = paths[j];
+
+        if (path[0] == '.' && path[1] == '/') {
+            path += 2;
+        }
+
+        size_t len = strlen(path);
+
+        while (len > 0U && path[len - 1U] == '/') {
+            len--;
+        }
+
+        pathLengths[j] = len;
+        pathFounds[j] = false;
+    }
+
+    for (size_t i = 0U; i < reader.entryArraySize; i++) {
+        const SeekableBundleEntry * entry = &reader.entryArray[i];
+
+        if (entry_is_requested(entry, paths, pathLengths, pathFounds, pathsCount)) {
+            ret = extract_an_entry(&reader, entry, rootDirFD, verbose);
+
+            if (ret != 0) {
+                break;
+            }
+        }
+    }
+
+    // deepest first
+    for (size_t i = reader.entryArraySize; ret == 0 && i > 0U; i--) {
+        const SeekableBundleEntry * entry = &reader.entryArray[i - 1U];
+
+        if (entry->type == 'd' && entry_is_requested(entry, paths, pathLengths, pathFounds, pathsCount)) {
+            // the entry might be an existing symlink, mkdirat() failed with EEXIST then, what it points to must not be changed
+            int fd = openat_beneath(rootDirFD, entry->path, false);
+
+            if (fd == -1) {
+                if (errno == ELOOP) {
+                    fprintf(stderr, "the directory is a symlink, refused: %s\n", entry->path);
+                } else {
+                    perror(entry->path);
+                }
+
+                ret = -1;
+            } else {
+                if (fchmod(fd, entry->mode) != 0) {
+                    perror(entry->path);
+                    ret = -1;
+                }
+
+                close(fd);
+            }
+        }
+    }
+
+    close(rootDirFD);
+
+    seekable_bundle_reader_close(&reader);
+
+    if (ret != 0) {
+        return ret;
+    }
+
+    for (size_t j = 0U; j < pathsCount; j++) {
+        if (!pathFounds[j]) {
+            fprintf(stderr, "not found in %s: %s\n", inputFilePath, paths[j]);
+            ret = 1;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,50 @@
+#ifndef _SEEKABLE_BUNDLE_H
+#define _SEEKABLE_BUNDLE_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ *  a seekable bundle is laid out as following:
+ *
+ *  [frame 0][frame 1]...[frame N-1][index frame][trailer]
+ *
+ *  every regular file is compressed into its own zlib frame, so it can be decompressed without touching the others.
+ *
+ *  the index frame is a zlib compressed text, one line per entry, fields are separated by tab:
+ *
+ *  <f|d|l> <mode in octal> <frame offset> <frame size> <uncompressed size> <sha256sum of uncompressed data> <path> [<symlink target>]
+ *
+ *  paths are relative to the bundled directory, entries are sorted by path, a directory always comes before its contents.
+ *
+ *  the trailer is 32 bytes: the magic XCPKGSB1, then the offset, the compressed size and the uncompressed size of the index frame, each of them is a little-endian uint64.
+ */
+#define SEEKABLE_BUNDLE_MAGIC "XCPKGSB1"
+
+#define SEEKABLE_BUNDLE_TRAILER_SIZE 32U
+
+/** bundle every entry under inputDir into outputFilePath.
+ *
+ *  inputDir itself might be a symlink, the symlinks under it are bundled as symlinks.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int seekable_bundle_create(const char * inputDir, const char * outputFilePath, const bool verbose);
+
+/** print the path of every entry in the given bundle.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int seekable_bundle_list(const char * inputFilePath);
+
+/** extract the given paths from the given bundle into outputDir, a directory path extracts everything under it, no paths extract everything.
+ *
+ *  only the frames of the matched entries are read and decompressed, every extracted file is verified with its sha256sum.
+ *
+ *  On success, 0 is returned.
+ *  If some of the given paths are not in the bundle, 1 is returned, the others have been extracted.
+ *  On error, -1 is returned and the error message has been printed.
+ */
+int seekable_bundle_extract(const char * inputFilePath, const char * outputDir, char * const paths[], const size_t pathsCount, const bool verbose);
+
+#endif
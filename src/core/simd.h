@@ -0,0 +1,42 @@
+#ifndef XCPKG_SIMD_H
+#define XCPKG_SIMD_H
+
+#include <stdbool.h>
+
+/**
+ *  the vector kernels are compiled for their own instruction set with the target attribute, and selected at runtime.
+ *
+ *  the scalar code is always there, it handles the tails and the cpus which have none of these instruction sets.
+ *
+ *  defining XCPKG_SIMD_DISABLED leaves only the scalar code, the tests compare the vector kernels against it.
+ */
+
+#if defined (XCPKG_SIMD_DISABLED)
+
+#elif defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+
+#define SIMD_X86 1
+
+#include <immintrin.h>
+
+#define SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define SIMD_TARGET_AVX2  __attribute__((target("avx2")))
+
+static inline bool simd_has_ssse3() {
+    return __builtin_cpu_supports("ssse3");
+}
+
+static inline bool simd_has_avx2() {
+    return __builtin_cpu_supports("avx2");
+}
+
+#elif defined (__aarch64__) && defined (__ARM_NEON)
+
+// NEON is mandatory on arm64
+#define SIMD_NEON 1
+
+#include <arm_neon.h>
+
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "string-map.h"
+
+static inline __attribute__((always_inline)) size_t hash_of_string(const char * s, const size_t n) {
+    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+    uint64_t h = 14695981039346656037ULL;
+
+    for (size_t i = 0U; i < n; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+
+    return (size_t)h;
+}
+
+bool string_map_find(const StringMap * map, const char * key, const size_t keyLength, size_t * index) {
+    if (map->slotArraySize == 0U) {
+        return false;
+    }
+
+    size_t mask = map->slotArraySize - 1U;
+
+    for (size_t i = hash_of_string(key, keyLength) & mask; ; i = (i + 1U) & mask) {
+        size_t v = map->slotArray[i];
+
+        if (v == 0U) {
+            return false;
+        }
+
+        const StringMapEntry * entry = &map->entryArray[v - 1U];
+
+        if (entry->keyLength == keyLength && memcmp(entry->key, key, keyLength) == 0) {
+            (*index) = v - 1U;
+            return true;
+        }
+    }
+}
+
+static void string_map_slot_insert(size_t slotArray[], const size_t slotArraySize, const StringMapEntry * entry, const size_t index) {
+    size_t mask = slotArraySize - 1U;
+
+    size_t j = hash_of_string(entry->key, entry->keyLength) & mask;
+
+    while (slotArray[j] != 0U) {
+        j = (j + 1U) & mask;
+    }
+
+    slotArray[j] = index + 1U;
+}
+
+static int string_map_rehash(StringMap * map, const size_t newSlotArraySize) {
+    size_t * slotArray = (size_t*)calloc(newSlotArraySize, sizeof(size_t));
+
+    if (slotArray == NULL) {
+        return -1;
+    }
+
+    for (size_t i = 0U; i < map->entryArraySize; i++) {
+        string_map_slot_insert(slotArray, newSlotArraySize, &map->entryArray[i], i);
+    }
+
+    free(map->slotArray);
+
+    map->slotArray = slotArray;
+    map->slotArraySize = newSlotArraySize;
+
+    return 0;
+}
+
+int string_map_add(StringMap * map, const char * key, const size_t keyLength, size_t * index, bool * added) {
+    if (string_map_find(map, key, keyLength, index)) {
+        (*added) = false;
+        return 0;
+    }
+
+    // keep the load factor below 0.5
+    if (((map->entryArraySize + 1U) << 1) > map->slotArraySize) {
+        if (string_map_rehash(map, map->slotArraySize == 0U ? 64U : (map->slotArraySize << 1)) != 0) {
+            return -1;
+        }
+    }
+
+    if (map->entryArraySize == map->entryArrayCapacity) {
+        size_t newCapacity = map->entryArrayCapacity == 0U ? 16U : (map->entryArrayCapacity << 1);
+
+        StringMapEntry * p = (StringMapEntry*)realloc(map->entryArray, newCapacity * sizeof(StringMapEntry));
+
+        if (p == NULL) {
+            return -1;
+        }
+
+        map->entryArray = p;
+        map->entryArrayCapacity = newCapacity;
+    }
+
+    char * s = (char*)malloc(keyLength + 1U);
+
+    if (s == NULL) {
+        return -1;
+    }
+
+    memcpy(s, key, keyLength);
+
+    s[keyLength] = '\0';
+
+    size_t i = map->entryArraySize;
+
+    StringMapEntry * entry = &map->entryArray[i];
+
+    entry->key = s;
+    entry->keyLength = keyLength;
+
+    map->entryArraySize++;
+
+    string_map_slot_insert(map->slotArray, map->slotArraySize, entry, i);
+
+    (*index) = i;
+    (*added) = true;
+
+    return 0;
+}
+
+void string_map_free(StringMap * map) {
+    for (size_t i = 0U; i < map->entryArraySize; i++) {
+        free(map->entryArray[i].key);
+    }
+
+    free(map->entryArray);
+    free(map->slotArray);
+
+    map->entryArray = NULL;
+    map->entryArraySize = 0U;
+    map->entryArrayCapacity = 0U;
+
+    map->slotArray = NULL;
+    map->slotArraySize = 0U;
+}
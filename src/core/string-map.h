@@ -0,0 +1,42 @@
+#ifndef _STRING_MAP_H
+#define _STRING_MAP_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+typedef struct {
+    char * key;
+    size_t keyLength;
+} StringMapEntry;
+
+/** a set of strings, each of which is numbered by the order it was added in, so it maps a string to an index of an array the caller keeps.
+ *
+ *  it is an open addressing hash table, the zero value is an empty map.
+ */
+typedef struct {
+    // entryArray[index] is the string numbered index
+    StringMapEntry * entryArray;
+    size_t           entryArraySize;
+    size_t           entryArrayCapacity;
+
+    // slot value is index + 1, 0 means empty slot
+    size_t * slotArray;
+    size_t   slotArraySize;
+} StringMap;
+
+/** look up the string which is the first keyLength bytes of key
+ *
+ *  on found, true is returned and index will be set.
+ */
+bool string_map_find(const StringMap * map, const char * key, const size_t keyLength, size_t * index);
+
+/** add the string which is the first keyLength bytes of key if it is not in the map yet, it is copied.
+ *
+ *  On success,  0 is returned, index will be set and added tells whether it is newly added, its index is then the former entryArraySize.
+ *  On error,   -1 is returned and errno is set to indicate the error.
+ */
+int  string_map_add(StringMap * map, const char * key, const size_t keyLength, size_t * index, bool * added);
+
+void string_map_free(StringMap * map);
+
+#endif
@@ -1,12 +1,22 @@
+// fallocate() is hidden by glibc without it
+#if defined (__linux__) && !defined (_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <time.h>
 #include <errno.h>
 #include <string.h>
 
 #include <locale.h>
 #include <fcntl.h>
-#include <dirent.h>
+#include <limits.h>
+#include <unistd.h>
+#include <pthread.h>
 #include <sys/stat.h>
 
 #include "tar.h"
+#include "sysinfo.h"
+#include "openat-beneath.h"
 
 int tar_list(const char * inputFilePath, const int flags) {
 	if ((inputFilePath != NULL) && (strcmp(inputFilePath, "-") == 0)) {
@@ -57,7 +67,8 @@ finalize:
     return ret;
 }
 
-int tar_extract(const char * outputDir, const char * inputFilePath, const int flags, const bool verbose, const size_t stripComponentsNumber) {
+// the general path, every entry is resolved from the root by archive_write_disk
+static int tar_extract_via_write_disk(const char * outputDir, const char * inputFilePath, const int flags, const bool verbose, const size_t stripComponentsNumber) {
     if ((inputFilePath != NULL) && (strcmp(inputFilePath, "-") == 0)) {
 		inputFilePath = NULL;
     }
@@ -219,131 +230,969 @@ finalize:
     return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+// a file larger than this is written by the reading thread directly, instead of being buffered for the writers
+#define TAR_EXTRACT_BUFFERED_FILE_MAX_SIZE 4194304
+
+// the most bytes buffered for the writers, the reading thread waits if exceeded
+#define TAR_EXTRACT_PENDING_BYTES_MAX 67108864
+
+// a file smaller than this is not preallocated, it would save nothing
+#define TAR_EXTRACT_PREALLOCATE_MIN_SIZE 1048576
+
+#define TAR_EXTRACT_WRITER_MAX_COUNT 4
+
+#define TAR_EXTRACT_DIR_FD_CACHE_SIZE 16
+
 typedef struct {
-    char ** array;
-    size_t  size;
-    size_t  capacity;
-} StringArrayList;
+    // the ownership of fd and data is taken by the writer
+    int    fd;
+    char * data;
+    size_t dataSize;
 
-int list_files(const char * dirPath, const bool verbose, StringArrayList * stringArrayList) {
-    if ((dirPath == NULL) || (dirPath[0] == '\0')) {
-        return -1;
+    mode_t mode;
+    bool   setMode;
+
+    struct timespec times[2];
+    bool   setTimes;
+} FileWriteJob;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t  notEmpty;
+    pthread_cond_t  notFull;
+
+    FileWriteJob jobArray[256];
+    size_t       jobArrayHead;
+    size_t       jobArraySize;
+
+    size_t pendingBytes;
+
+    bool   closed;
+
+    // the first error occurred in writers
+    int    ret;
+
+    pthread_t threads[TAR_EXTRACT_WRITER_MAX_COUNT];
+    unsigned int threadCount;
+} FileWriterPool;
+
+static int finish_a_file(const FileWriteJob * job) {
+    for (size_t written = 0U; written < job->dataSize; ) {
+        ssize_t n = write(job->fd, job->data + written, job->dataSize - written);
+
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return -1;
+        }
+
+        written += (size_t)n;
     }
 
-    DIR * dir = opendir(dirPath);
+    if (job->setMode && fchmod(job->fd, job->mode) != 0) {
+        return -1;
+    }
 
-    if (dir == NULL) {
-        perror(dirPath);
-        return -2;
+    if (job->setTimes && futimens(job->fd, job->times) != 0) {
+        return -1;
     }
 
-    int ret = 0;
+    return 0;
+}
 
-    struct stat st;
+static void * file_writer_routine(void * arg) {
+    FileWriterPool * pool = (FileWriterPool*)arg;
 
     for (;;) {
-        errno = 0;
+        pthread_mutex_lock(&pool->mutex);
+
+        while (pool->jobArraySize == 0U && !pool->closed) {
+            pthread_cond_wait(&pool->notEmpty, &pool->mutex);
+        }
+
+        if (pool->jobArraySize == 0U) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+
+        FileWriteJob job = pool->jobArray[pool->jobArrayHead];
+
+        pool->jobArrayHead = (pool->jobArrayHead + 1U) % 256U;
+        pool->jobArraySize--;
+
+        pthread_mutex_unlock(&pool->mutex);
+
+        int ret = finish_a_file(&job);
+
+        if (ret != 0) {
+            perror(NULL);
+        }
+
+        if (close(job.fd) != 0) {
+            perror(NULL);
+            ret = -1;
+        }
+
+        free(job.data);
+
+        pthread_mutex_lock(&pool->mutex);
+
+        if (ret != 0 && pool->ret == 0) {
+            pool->ret = ARCHIVE_FATAL;
+        }
+
+        pool->pendingBytes -= job.dataSize;
+
+        pthread_cond_signal(&pool->notFull);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+static int file_writer_pool_submit(FileWriterPool * pool, const FileWriteJob * job) {
+    if (pool->threadCount == 0U) {
+        int ret = finish_a_file(job);
+
+        if (ret != 0) {
+            perror(NULL);
+        }
+
+        if (close(job->fd) != 0) {
+            perror(NULL);
+            ret = -1;
+        }
 
-        struct dirent * dir_entry = readdir(dir);
+        free(job->data);
 
-        if (dir_entry == NULL) {
-            if (errno == 0) {
-                closedir(dir);
+        return ret == 0 ? ARCHIVE_OK : ARCHIVE_FATAL;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (pool->jobArraySize == 256U || (pool->pendingBytes != 0U && pool->pendingBytes + job->dataSize > TAR_EXTRACT_PENDING_BYTES_MAX)) {
+        pthread_cond_wait(&pool->notFull, &pool->mutex);
+    }
+
+    pool->jobArray[(pool->jobArrayHead + pool->jobArraySize) % 256U] = *job;
+    pool->jobArraySize++;
+
+    pool->pendingBytes += job->dataSize;
+
+    int ret = pool->ret;
+
+    pthread_cond_signal(&pool->notEmpty);
+    pthread_mutex_unlock(&pool->mutex);
+
+    return ret;
+}
+
+static void file_writer_pool_start(FileWriterPool * pool) {
+    memset(pool, 0, sizeof(FileWriterPool));
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->notEmpty, NULL);
+    pthread_cond_init(&pool->notFull, NULL);
+
+    int ncpu = sysinfo_ncpu();
+
+    unsigned int n = (ncpu > TAR_EXTRACT_WRITER_MAX_COUNT) ? TAR_EXTRACT_WRITER_MAX_COUNT : (ncpu > 1 ? (unsigned int)ncpu : 0U);
+
+    for (unsigned int i = 0U; i < n; i++) {
+        // if no thread could be created, files are written by the reading thread
+        if (pthread_create(&pool->threads[i], NULL, file_writer_routine, pool) != 0) {
+            break;
+        }
+
+        pool->threadCount++;
+    }
+}
+
+// wait for all the submitted files to be written
+static int file_writer_pool_stop(FileWriterPool * pool) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->closed = true;
+    pthread_cond_broadcast(&pool->notEmpty);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (unsigned int i = 0U; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->notFull);
+    pthread_cond_destroy(&pool->notEmpty);
+    pthread_mutex_destroy(&pool->mutex);
+
+    return pool->ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    char * path;
+    mode_t mode;
+    struct timespec times[2];
+} DeferredDir;
+
+typedef struct {
+    int rootDirFD;
+
+    int flags;
+
+    mode_t umask;
+
+    // the parent directories used recently, entries of the same directory are usually adjacent in a tarball
+    struct {
+        char * path;
+        int    fd;
+    } dirFDCache[TAR_EXTRACT_DIR_FD_CACHE_SIZE];
+
+    unsigned int dirFDCacheNext;
+
+    // the modes and mtimes of directories are applied at last, otherwise they would be changed by their contents
+    DeferredDir * deferredDirArray;
+    size_t        deferredDirArraySize;
+    size_t        deferredDirArrayCapacity;
+
+    FileWriterPool pool;
+} TarExtractor;
+
+// mkdir -p relative to dirFD
+static int mkdir_p_at(int dirFD, char * path) {
+    for (char * p = path; ; p++) {
+        if (*p == '/' || *p == '\0') {
+            char c = *p;
+
+            *p = '\0';
+
+            int ret = (path[0] == '\0') ? 0 : mkdirat(dirFD, path, 0755);
+
+            *p = c;
+
+            if (ret != 0 && errno != EEXIST) {
+                return -1;
+            }
+
+            if (c == '\0') {
                 return 0;
-            } else {
-                perror(dirPath);
-                closedir(dir);
-                return -3;
             }
         }
+    }
+}
 
-        if ((strcmp(dir_entry->d_name, ".") == 0) || (strcmp(dir_entry->d_name, "..") == 0)) {
-            continue;
+// return the fd of the parent directory of the given path, and the name of the given path in its parent
+static int get_parent_dir_fd(TarExtractor * extractor, char * path, const char ** name) {
+    char * slash = strrchr(path, '/');
+
+    if (slash == NULL) {
+        *name = path;
+        return extractor->rootDirFD;
+    }
+
+    *name = slash + 1;
+
+    *slash = '\0';
+
+    for (int i = 0; i < TAR_EXTRACT_DIR_FD_CACHE_SIZE; i++) {
+        if (extractor->dirFDCache[i].path != NULL && strcmp(extractor->dirFDCache[i].path, path) == 0) {
+            *slash = '/';
+            return extractor->dirFDCache[i].fd;
         }
+    }
 
-        size_t filePathLength = strlen(dirPath) + strlen(dir_entry->d_name) + 2U;
-        char   filePath[filePathLength];
+    // a symlink extracted earlier must not lead the entries below it out of the output directory
+    int fd = openat_beneath(extractor->rootDirFD, path, true);
 
-        ret = snprintf(filePath, filePathLength, "%s/%s", dirPath, dir_entry->d_name);
+    if (fd == -1) {
+        if (errno == ELOOP) {
+            fprintf(stderr, "the parent directory is a symlink, refused: %s\n", path);
+        } else {
+            perror(path);
+        }
 
-        if (ret < 0) {
-            perror(NULL);
-            closedir(dir);
+        *slash = '/';
+        return -1;
+    }
+
+    char * p = strdup(path);
+
+    *slash = '/';
+
+    if (p == NULL) {
+        close(fd);
+        return -1;
+    }
+
+    unsigned int i = extractor->dirFDCacheNext;
+
+    extractor->dirFDCacheNext = (i + 1U) % TAR_EXTRACT_DIR_FD_CACHE_SIZE;
+
+    if (extractor->dirFDCache[i].path != NULL) {
+        free(extractor->dirFDCache[i].path);
+        close(extractor->dirFDCache[i].fd);
+    }
+
+    extractor->dirFDCache[i].path = p;
+    extractor->dirFDCache[i].fd   = fd;
+
+    return fd;
+}
+
+// strip the leading n components, NULL is returned if nothing is left
+static const char * strip_components(const char * path, size_t n) {
+    while (path[0] == '/') path++;
+
+    for (; n > 0U; n--) {
+        const char * p = strchr(path, '/');
+
+        if (p == NULL) {
+            return NULL;
+        }
+
+        path = p + 1;
+
+        while (path[0] == '/') path++;
+    }
+
+    return path[0] == '\0' ? NULL : path;
+}
+
+static bool has_dotdot_component(const char * path) {
+    for (const char * p = path; p != NULL; ) {
+        if (p[0] == '.' && p[1] == '.' && (p[2] == '/' || p[2] == '\0')) {
+            return true;
+        }
+
+        p = strchr(p, '/');
+
+        if (p != NULL) {
+            p++;
+        }
+    }
+
+    return false;
+}
+
+// it is only a hint, the failure is ignored. posix_fallocate() is not used, glibc emulates it by writing every block on the filesystems which do not support it.
+static void preallocate(int fd, off_t size) {
+#if defined (__linux__)
+    fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, size);
+#elif defined (__APPLE__)
+    fstore_t fstore = { .fst_flags = F_ALLOCATEALL, .fst_posmode = F_PEOFPOSMODE, .fst_offset = 0, .fst_length = size };
+    fcntl(fd, F_PREALLOCATE, &fstore);
+#else
+    (void)fd;
+    (void)size;
+#endif
+}
+
+// create a new file, replace it if already exists
+static int create_a_file(int dirFD, const char * name, mode_t mode) {
+    for (int i = 0; ; i++) {
+        int fd = openat(dirFD, name, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+
+        if (fd != -1 || errno != EEXIST || i > 0) {
+            return fd;
+        }
+
+        if (unlinkat(dirFD, name, 0) != 0) {
             return -1;
         }
+    }
+}
+
+static int extract_a_regular_file(TarExtractor * extractor, struct archive * ar, struct archive_entry * entry, int dirFD, const char * name, const char * path) {
+    mode_t mode = archive_entry_perm(entry);
+
+    int fd = create_a_file(dirFD, name, mode);
+
+    if (fd == -1) {
+        perror(path);
+        return ARCHIVE_FATAL;
+    }
+
+    la_int64_t size = archive_entry_size(entry);
+
+    FileWriteJob job = { .fd = fd };
+
+    if (extractor->flags & ARCHIVE_EXTRACT_PERM) {
+        job.mode = mode;
+        job.setMode = true;
+    }
+
+    if (extractor->flags & ARCHIVE_EXTRACT_TIME) {
+        job.times[0].tv_sec  = archive_entry_atime(entry);
+        job.times[0].tv_nsec = archive_entry_atime_nsec(entry);
+        job.times[1].tv_sec  = archive_entry_mtime(entry);
+        job.times[1].tv_nsec = archive_entry_mtime_nsec(entry);
+
+        if (!archive_entry_atime_is_set(entry)) {
+            job.times[0] = job.times[1];
+        }
+
+        job.setTimes = true;
+    }
+
+    if (size >= TAR_EXTRACT_PREALLOCATE_MIN_SIZE) {
+        preallocate(fd, (off_t)size);
+    }
+
+    const void * dataBuff;
+    size_t       dataSize;
+    la_int64_t   offset;
+
+    // the data of small files is buffered and written by the writers, while the next entries are being decompressed
+    if (size > 0 && size <= TAR_EXTRACT_BUFFERED_FILE_MAX_SIZE) {
+        job.data = (char*)malloc((size_t)size);
+
+        if (job.data == NULL) {
+            close(fd);
+            return ARCHIVE_FATAL;
+        }
+
+        job.dataSize = (size_t)size;
+
+        size_t filled = 0U;
+
+        for (;;) {
+            int ret = archive_read_data_block(ar, &dataBuff, &dataSize, &offset);
+
+            if (ret == ARCHIVE_EOF) {
+                break;
+            }
+
+            if (ret != ARCHIVE_OK || offset < 0 || (size_t)offset + dataSize > job.dataSize) {
+                free(job.data);
+                close(fd);
+                return ret == ARCHIVE_OK ? ARCHIVE_FATAL : ret;
+            }
 
-        //if (verbose) printf("%s\n", filePath);
+            // holes of sparse files
+            if ((size_t)offset > filled) {
+                memset(job.data + filled, 0, (size_t)offset - filled);
+            }
 
-        if (stat(filePath, &st) == 0) {
-            if (S_ISDIR(st.st_mode)) {
-                ret = list_files(filePath, verbose, stringArrayList);
+            memcpy(job.data + offset, dataBuff, dataSize);
 
-                if (ret != 0) {
-                    return ret;
+            filled = (size_t)offset + dataSize;
+        }
+
+        if (filled < job.dataSize) {
+            memset(job.data + filled, 0, job.dataSize - filled);
+        }
+
+        return file_writer_pool_submit(&extractor->pool, &job);
+    }
+
+    for (;;) {
+        int ret = archive_read_data_block(ar, &dataBuff, &dataSize, &offset);
+
+        if (ret == ARCHIVE_EOF) {
+            break;
+        }
+
+        if (ret != ARCHIVE_OK) {
+            close(fd);
+            return ret;
+        }
+
+        for (size_t written = 0U; written < dataSize; ) {
+            ssize_t n = pwrite(fd, (const char *)dataBuff + written, dataSize - written, (off_t)offset + written);
+
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
                 }
+
+                perror(path);
+                close(fd);
+                return ARCHIVE_FATAL;
+            }
+
+            written += (size_t)n;
+        }
+    }
+
+    // a file ends with a hole
+    if (size > 0 && ftruncate(fd, (off_t)size) != 0) {
+        perror(path);
+        close(fd);
+        return ARCHIVE_FATAL;
+    }
+
+    return file_writer_pool_submit(&extractor->pool, &job);
+}
+
+static int defer_a_dir(TarExtractor * extractor, struct archive_entry * entry, const char * path) {
+    if (extractor->deferredDirArraySize == extractor->deferredDirArrayCapacity) {
+        size_t newCapacity = extractor->deferredDirArrayCapacity == 0U ? 64U : (extractor->deferredDirArrayCapacity << 1);
+
+        DeferredDir * p = (DeferredDir*)realloc(extractor->deferredDirArray, newCapacity * sizeof(DeferredDir));
+
+        if (p == NULL) {
+            return ARCHIVE_FATAL;
+        }
+
+        extractor->deferredDirArray = p;
+        extractor->deferredDirArrayCapacity = newCapacity;
+    }
+
+    DeferredDir * dir = &extractor->deferredDirArray[extractor->deferredDirArraySize];
+
+    dir->path = strdup(path);
+
+    if (dir->path == NULL) {
+        return ARCHIVE_FATAL;
+    }
+
+    dir->mode = archive_entry_perm(entry);
+
+    dir->times[0].tv_sec  = archive_entry_mtime(entry);
+    dir->times[0].tv_nsec = archive_entry_mtime_nsec(entry);
+    dir->times[1] = dir->times[0];
+
+    extractor->deferredDirArraySize++;
+
+    return ARCHIVE_OK;
+}
+
+static int apply_the_deferred_dirs(TarExtractor * extractor) {
+    int ret = ARCHIVE_OK;
+
+    // deepest first, so the mtime of a parent is not changed by its children
+    for (size_t i = extractor->deferredDirArraySize; i > 0U; i--) {
+        DeferredDir * dir = &extractor->deferredDirArray[i - 1U];
+
+        mode_t mode = (extractor->flags & ARCHIVE_EXTRACT_PERM) ? dir->mode : (dir->mode & ~extractor->umask);
+
+        // the entry might be an existing symlink, mkdirat() failed with EEXIST then, what it points to must not be changed
+        int fd = openat_beneath(extractor->rootDirFD, dir->path, false);
+
+        if (fd == -1) {
+            if (errno == ELOOP) {
+                fprintf(stderr, "the directory is a symlink, refused: %s\n", dir->path);
             } else {
-                if (stringArrayList->size == stringArrayList->capacity) {
-                    size_t  newCapacity = stringArrayList->capacity + 10U;
-                    char ** p = (char**)realloc(stringArrayList->array, newCapacity * sizeof(char*));
-
-                    if (p == NULL) {
-                        if (stringArrayList->array != NULL) {
-                            for (size_t i = 0; i < stringArrayList->size; i++) {
-                                free(stringArrayList->array[i]);
-                                stringArrayList->array[i] = NULL;
-                            }
-
-                            free(stringArrayList->array);
-                            stringArrayList->array = NULL;
-                        }
-
-                        return -4;
-                    }
+                perror(dir->path);
+            }
 
-                    if (stringArrayList->array != NULL) {
-                        memset(p + stringArrayList->size, 0, 10);
-                    }
+            ret = ARCHIVE_FATAL;
+            continue;
+        }
 
-                    stringArrayList->array   = p;
-                    stringArrayList->capacity = newCapacity;
-                }
+        if (fchmod(fd, mode) != 0) {
+            perror(dir->path);
+            ret = ARCHIVE_FATAL;
+        }
 
-                char * p2 = strdup(filePath);
+        if (extractor->flags & ARCHIVE_EXTRACT_TIME) {
+            if (futimens(fd, dir->times) != 0) {
+                perror(dir->path);
+                ret = ARCHIVE_FATAL;
+            }
+        }
 
-                if (p2 == NULL) {
-                    for (size_t i = 0; i < stringArrayList->size; i++) {
-                        free(stringArrayList->array[i]);
-                        stringArrayList->array[i] = NULL;
-                    }
+        close(fd);
+    }
 
-                    free(stringArrayList->array);
-                    stringArrayList->array = NULL;
+    return ret;
+}
+
+static int extract_an_entry(TarExtractor * extractor, struct archive * ar, struct archive_entry * entry, const size_t stripComponentsNumber, const bool verbose) {
+    const char * entryPath = strip_components(archive_entry_pathname(entry), stripComponentsNumber);
+
+    if (entryPath == NULL) {
+        return ARCHIVE_OK;
+    }
+
+    if (has_dotdot_component(entryPath)) {
+        fprintf(stderr, "path contains '..', skipped: %s\n", entryPath);
+        return ARCHIVE_OK;
+    }
 
-                    return -4;
+    if (verbose) {
+        printf("x %s\n", entryPath);
+    }
+
+    char path[PATH_MAX];
+
+    size_t pathLength = strlen(entryPath);
+
+    if (pathLength >= PATH_MAX) {
+        fprintf(stderr, "path is too long: %s\n", entryPath);
+        return ARCHIVE_FATAL;
+    }
+
+    memcpy(path, entryPath, pathLength + 1U);
+
+    while (pathLength > 1U && path[pathLength - 1U] == '/') {
+        path[--pathLength] = '\0';
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    const char * name;
+
+    int dirFD = get_parent_dir_fd(extractor, path, &name);
+
+    if (dirFD == -1) {
+        return ARCHIVE_FATAL;
+    }
+
+    const char * hardlink = archive_entry_hardlink(entry);
+
+    if (hardlink != NULL) {
+        const char * target = strip_components(hardlink, stripComponentsNumber);
+
+        if (target == NULL || has_dotdot_component(target)) {
+            fprintf(stderr, "invalid hardlink target, skipped: %s\n", entryPath);
+            return ARCHIVE_OK;
+        }
+
+        // the directory of the target is resolved the same way as the one of an entry
+        const char * slash = strrchr(target, '/');
+
+        const char * targetName = (slash == NULL) ? target : slash + 1;
+
+        size_t targetDIRLength = (slash == NULL) ? 0U : (size_t)(slash - target);
+
+        if (targetDIRLength >= PATH_MAX) {
+            fprintf(stderr, "path is too long: %s\n", target);
+            return ARCHIVE_FATAL;
+        }
+
+        char targetDIR[PATH_MAX];
+
+        memcpy(targetDIR, target, targetDIRLength);
+        targetDIR[targetDIRLength] = '\0';
+
+        int targetDIRFD = openat_beneath(extractor->rootDirFD, targetDIR, false);
+
+        if (targetDIRFD == -1) {
+            if (errno == ELOOP) {
+                fprintf(stderr, "the directory of the hardlink target is a symlink, refused: %s\n", entryPath);
+            } else {
+                perror(target);
+            }
+
+            return ARCHIVE_FATAL;
+        }
+
+        for (int i = 0; ; i++) {
+            if (linkat(targetDIRFD, targetName, dirFD, name, 0) == 0) {
+                close(targetDIRFD);
+                return ARCHIVE_OK;
+            }
+
+            if (errno != EEXIST || i > 0 || unlinkat(dirFD, name, 0) != 0) {
+                perror(entryPath);
+                close(targetDIRFD);
+                return ARCHIVE_FATAL;
+            }
+        }
+    }
+
+    switch (archive_entry_filetype(entry)) {
+        case AE_IFREG:
+            return extract_a_regular_file(extractor, ar, entry, dirFD, name, entryPath);
+        case AE_IFDIR:
+            if (mkdirat(dirFD, name, 0700) != 0 && errno != EEXIST) {
+                perror(entryPath);
+                return ARCHIVE_FATAL;
+            }
+
+            return defer_a_dir(extractor, entry, path);
+        case AE_IFLNK:
+            for (int i = 0; ; i++) {
+                if (symlinkat(archive_entry_symlink(entry), dirFD, name) == 0) {
+                    break;
                 }
 
-                stringArrayList->array[stringArrayList->size] = p2;
-                stringArrayList->size += 1U;
+                if (errno != EEXIST || i > 0 || unlinkat(dirFD, name, 0) != 0) {
+                    perror(entryPath);
+                    return ARCHIVE_FATAL;
+                }
+            }
+
+            if (extractor->flags & ARCHIVE_EXTRACT_TIME) {
+                struct timespec times[2];
+
+                times[0].tv_sec  = archive_entry_mtime(entry);
+                times[0].tv_nsec = archive_entry_mtime_nsec(entry);
+                times[1] = times[0];
+
+                utimensat(dirFD, name, times, AT_SYMLINK_NOFOLLOW);
+            }
+
+            return ARCHIVE_OK;
+        default:
+            fprintf(stderr, "neither a regular file nor a directory nor a symlink, skipped: %s\n", entryPath);
+            return ARCHIVE_OK;
+    }
+}
+
+// umask() can only be read by setting it, which is not safe while archives are being extracted in the other threads, so it is read only once
+static mode_t processUmask;
+
+static void tar_extract_init() {
+    setlocale(LC_ALL, "");
+
+    processUmask = umask(0);
+    umask(processUmask);
+}
+
+// the fast path, paths are resolved relative to a cached parent directory fd, file data is written by a small pool of writers while the reading thread keeps decompressing
+static int tar_extract_via_dir_fd(const char * outputDir, const char * inputFilePath, const int flags, const bool verbose, const size_t stripComponentsNumber) {
+    if ((inputFilePath != NULL) && (strcmp(inputFilePath, "-") == 0)) {
+		inputFilePath = NULL;
+    }
+
+    if ((outputDir == NULL) || (outputDir[0] == '\0')) {
+        outputDir = ".";
+    }
+
+    // https://github.com/libarchive/libarchive/issues/459
+    // setlocale() is not thread-safe, archives might be extracted in several threads at the same time
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, tar_extract_init);
+
+    TarExtractor * extractor = (TarExtractor*)calloc(1, sizeof(TarExtractor));
+
+    if (extractor == NULL) {
+        perror(NULL);
+        return ARCHIVE_FATAL;
+    }
+
+    extractor->flags = flags;
+
+    extractor->umask = processUmask;
+
+    extractor->rootDirFD = open(outputDir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (extractor->rootDirFD == -1 && errno == ENOENT) {
+        char buf[PATH_MAX];
+
+        if (strlen(outputDir) < PATH_MAX) {
+            strcpy(buf, outputDir);
+
+            if (mkdir_p_at(AT_FDCWD, buf) == 0) {
+                extractor->rootDirFD = open(outputDir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
             }
-        } else {
-            return -5;
         }
     }
+
+    if (extractor->rootDirFD == -1) {
+        perror(outputDir);
+        free(extractor);
+        return ARCHIVE_FATAL;
+    }
+
+    struct archive * ar = archive_read_new();
+
+    archive_read_support_format_all(ar);
+    archive_read_support_filter_all(ar);
+
+    file_writer_pool_start(&extractor->pool);
+
+    int ret = archive_read_open_filename(ar, inputFilePath, 65536);
+
+    if (ret == ARCHIVE_OK) {
+        for (;;) {
+            struct archive_entry * entry = NULL;
+
+            ret = archive_read_next_header(ar, &entry);
+
+            if (ret == ARCHIVE_EOF) {
+                ret = ARCHIVE_OK;
+                break;
+            }
+
+            if (ret == ARCHIVE_WARN) {
+                fprintf(stderr, "%s\n", archive_error_string(ar));
+            } else if (ret != ARCHIVE_OK) {
+                break;
+            }
+
+            ret = extract_an_entry(extractor, ar, entry, stripComponentsNumber, verbose);
+
+            if (ret != ARCHIVE_OK) {
+                break;
+            }
+        }
+    }
+
+    if (ret != ARCHIVE_OK && archive_errno(ar) != 0) {
+        fprintf(stderr, "%s\n", archive_error_string(ar));
+    }
+
+    int ret2 = file_writer_pool_stop(&extractor->pool);
+
+    if (ret == ARCHIVE_OK) {
+        ret = ret2;
+    }
+
+    if (ret == ARCHIVE_OK) {
+        ret = apply_the_deferred_dirs(extractor);
+    }
+
+    archive_read_close(ar);
+    archive_read_free(ar);
+
+    for (int i = 0; i < TAR_EXTRACT_DIR_FD_CACHE_SIZE; i++) {
+        if (extractor->dirFDCache[i].path != NULL) {
+            free(extractor->dirFDCache[i].path);
+            close(extractor->dirFDCache[i].fd);
+        }
+    }
+
+    for (size_t i = 0U; i < extractor->deferredDirArraySize; i++) {
+        free(extractor->deferredDirArray[i].path);
+    }
+
+    free(extractor->deferredDirArray);
+
+    close(extractor->rootDirFD);
+
+    free(extractor);
+
+    return ret;
 }
 
-int tar_create(const char * inputDir, const char * outputFilePath, const ArchiveType type, const bool verbose) {
-    StringArrayList stringArrayList = {0};
+int tar_extract(const char * outputDir, const char * inputFilePath, const int flags, const bool verbose, const size_t stripComponentsNumber) {
+    // owners, acls, xattrs, file flags and the secure options are only supported by archive_write_disk
+    if ((flags & ~(ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM)) == 0) {
+        return tar_extract_via_dir_fd(outputDir, inputFilePath, flags, verbose, stripComponentsNumber);
+    } else {
+        return tar_extract_via_write_disk(outputDir, inputFilePath, flags, verbose, stripComponentsNumber);
+    }
+}
+
+typedef struct {
+    struct archive_entry ** array;
+    size_t                  size;
+    size_t                  capacity;
+} ArchiveEntryList;
+
+static void archive_entry_list_free(ArchiveEntryList * list) {
+    for (size_t i = 0U; i < list->size; i++) {
+        archive_entry_free(list->array[i]);
+    }
+
+    free(list->array);
+
+    list->array = NULL;
+    list->size = 0U;
+    list->capacity = 0U;
+}
 
-    int ret = list_files(inputDir, verbose, &stringArrayList);
+static int archive_entry_compare_by_pathname(const void * a, const void * b) {
+    struct archive_entry * x = *((struct archive_entry **)a);
+    struct archive_entry * y = *((struct archive_entry **)b);
 
-    if (ret != 0) {
+    return strcmp(archive_entry_pathname(x), archive_entry_pathname(y));
+}
+
+// walk inputDir in one pass, only the metadata of every entry is kept, the file data is read later while writing
+static int list_entries(struct archive * ar, const char * inputDir, ArchiveEntryList * list) {
+    int ret = archive_read_disk_open(ar, inputDir);
+
+    if (ret != ARCHIVE_OK) {
         return ret;
     }
 
-    if (stringArrayList.size == 0U) {
-        return 1;
+    for (;;) {
+        struct archive_entry * entry = archive_entry_new();
+
+        if (entry == NULL) {
+            return ARCHIVE_FATAL;
+        }
+
+        ret = archive_read_next_header2(ar, entry);
+
+        if (ret == ARCHIVE_EOF) {
+            archive_entry_free(entry);
+            return ARCHIVE_OK;
+        }
+
+        if (ret == ARCHIVE_WARN) {
+            fprintf(stderr, "%s\n", archive_error_string(ar));
+        } else if (ret != ARCHIVE_OK) {
+            archive_entry_free(entry);
+            return ret;
+        }
+
+        archive_read_disk_descend(ar);
+
+        if (list->size == list->capacity) {
+            size_t newCapacity = list->capacity == 0U ? 256U : (list->capacity << 1);
+
+            struct archive_entry ** p = (struct archive_entry **)realloc(list->array, newCapacity * sizeof(struct archive_entry *));
+
+            if (p == NULL) {
+                archive_entry_free(entry);
+                return ARCHIVE_FATAL;
+            }
+
+            list->array = p;
+            list->capacity = newCapacity;
+        }
+
+        list->array[list->size] = entry;
+        list->size++;
+    }
+}
+
+// the same input always produces the same output, no matter when, where and by whom it is bundled
+static void normalize_entry(struct archive_entry * entry, const time_t mtime) {
+    archive_entry_set_uid(entry, 0);
+    archive_entry_set_gid(entry, 0);
+    archive_entry_set_uname(entry, NULL);
+    archive_entry_set_gname(entry, NULL);
+
+    archive_entry_set_mtime(entry, mtime, 0);
+    archive_entry_unset_atime(entry);
+    archive_entry_unset_ctime(entry);
+    archive_entry_unset_birthtime(entry);
+}
+
+static int write_entry_data(struct archive * aw, struct archive_entry * entry, char * buf, const size_t bufSize) {
+    const char * filePath = archive_entry_sourcepath(entry);
+
+    int fd = open(filePath, O_RDONLY);
+
+    if (fd == -1) {
+        perror(filePath);
+        return ARCHIVE_FATAL;
     }
 
+    for (;;) {
+        ssize_t readSize = read(fd, buf, bufSize);
+
+        if (readSize == 0) {
+            close(fd);
+            return ARCHIVE_OK;
+        }
+
+        if (readSize < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            perror(filePath);
+            close(fd);
+            return ARCHIVE_FATAL;
+        }
+
+        if (archive_write_data(aw, buf, (size_t)readSize) < 0) {
+            close(fd);
+            return ARCHIVE_FATAL;
+        }
+    }
+}
+
+int tar_create(const char * inputDir, const char * outputFilePath, const ArchiveType type, const bool verbose) {
     if (outputFilePath != NULL && outputFilePath[0] == '-' && outputFilePath[1] == '\0') {
 		outputFilePath = NULL;
     }
@@ -351,23 +1200,83 @@ int tar_create(const char * inputDir, const char * outputFilePath, const Archive
     // https://github.com/libarchive/libarchive/issues/459
     setlocale(LC_ALL, "");
 
-	struct archive *aw = archive_write_new();
+    // https://reproducible-builds.org/docs/source-date-epoch/
+    time_t mtime = 0;
+
+    const char * sourceDateEpoch = getenv("SOURCE_DATE_EPOCH");
+
+    if (sourceDateEpoch != NULL && sourceDateEpoch[0] != '\0') {
+        mtime = (time_t)strtoll(sourceDateEpoch, NULL, 10);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    struct archive * ar = archive_read_disk_new();
+    struct archive * aw = archive_write_new();
+
+    // inputDir itself might be a symlink, the symlinks under it are archived as symlinks
+    archive_read_disk_set_symlink_hybrid(ar);
+    archive_read_disk_set_standard_lookup(ar);
+
+    // owners, xattrs, acls and file flags of the building machine are meaningless to the consumers
+#if ARCHIVE_VERSION_NUMBER >= 3003003
+    archive_read_disk_set_behavior(ar, ARCHIVE_READDISK_NO_XATTR | ARCHIVE_READDISK_NO_ACL | ARCHIVE_READDISK_NO_FFLAGS);
+#else
+    archive_read_disk_set_behavior(ar, ARCHIVE_READDISK_NO_XATTR);
+#endif
+
+    ArchiveEntryList list = {0};
+
+    char * buf = NULL;
+
+    int ret = list_entries(ar, inputDir, &list);
+
+    if (ret != ARCHIVE_OK) {
+        fprintf(stderr, "%s\n", archive_error_string(ar));
+        goto finalize;
+    }
+
+    if (list.size == 0U) {
+        ret = 1;
+        goto finalize;
+    }
+
+    // the order of readdir() is up to the filesystem
+    qsort(list.array, list.size, sizeof(struct archive_entry *), archive_entry_compare_by_pathname);
+
+    //////////////////////////////////////////////////////////////////////////////
 
     switch (type) {
         case ArchiveType_tar_gz:
-            archive_write_set_format_ustar(aw);
+            archive_write_set_format_pax_restricted(aw);
             archive_write_add_filter_gzip(aw);
+            // do not store the current time in the gzip header
+            archive_write_set_filter_option(aw, "gzip", "timestamp", NULL);
             break;
         case ArchiveType_tar_lz:
-            archive_write_set_format_ustar(aw);
+            archive_write_set_format_pax_restricted(aw);
             archive_write_add_filter_lzip(aw);
             break;
         case ArchiveType_tar_xz:
-            archive_write_set_format_ustar(aw);
+            archive_write_set_format_pax_restricted(aw);
             archive_write_add_filter_xz(aw);
+            // 0 means as many threads as cpus, liblzma built without threads just ignores it
+            archive_write_set_filter_option(aw, "xz", "threads", "0");
             break;
+        case ArchiveType_tar_zst:
+#if ARCHIVE_VERSION_NUMBER >= 3003003
+            archive_write_set_format_pax_restricted(aw);
+            archive_write_add_filter_zstd(aw);
+            // 0 means as many threads as cpus, this option was introduced in libarchive-3.6.0
+            archive_write_set_filter_option(aw, "zstd", "threads", "0");
+            break;
+#else
+            fprintf(stderr, "zstd is not supported by libarchive-%s\n", ARCHIVE_VERSION_ONLY_STRING);
+            ret = ARCHIVE_FATAL;
+            goto finalize;
+#endif
         case ArchiveType_tar_bz2:
-            archive_write_set_format_ustar(aw);
+            archive_write_set_format_pax_restricted(aw);
             archive_write_add_filter_bzip2(aw);
             break;
         case ArchiveType_zip:
@@ -376,96 +1285,75 @@ int tar_create(const char * inputDir, const char * outputFilePath, const Archive
         case ArchiveType_7z:
             archive_write_set_format_7zip(aw);
             break;
+        case ArchiveType_seekable:
+            fprintf(stderr, "seekable bundles are created by seekable_bundle_create()\n");
+            ret = ARCHIVE_FATAL;
+            goto finalize;
     }
 
-    archive_write_open_filename(aw, outputFilePath);
-
-    struct archive       *ar    = NULL;
-	struct archive_entry *entry = NULL;
+    ret = archive_write_open_filename(aw, outputFilePath);
 
-    int fd;
+    if (ret != ARCHIVE_OK) {
+        fprintf(stderr, "%s\n", archive_error_string(aw));
+        goto finalize;
+    }
 
-    for (size_t i = 0; i < stringArrayList.size; i++) {
-        ar = archive_read_disk_new();
+    //////////////////////////////////////////////////////////////////////////////
 
-        ret = archive_read_disk_open(ar, stringArrayList.array[i]);
+    const size_t bufSize = 1048576U;
 
-        if (ret != ARCHIVE_OK) {
-            goto finalize;
-        }
+    buf = (char*)malloc(bufSize);
 
-        for (;;) {
-            entry = archive_entry_new();
+    if (buf == NULL) {
+        ret = ARCHIVE_FATAL;
+        goto finalize;
+    }
 
-            ret = archive_read_next_header2(ar, entry);
+    for (size_t i = 0U; i < list.size; i++) {
+        struct archive_entry * entry = list.array[i];
 
-            if (ret == ARCHIVE_EOF) {
-                ret =  ARCHIVE_OK;
-                archive_entry_free(entry);
-                break;
-            }
+        if (verbose) {
+            fprintf(stderr, "a %s\n", archive_entry_pathname(entry));
+        }
 
-            if (ret != ARCHIVE_OK) {
-                archive_entry_free(entry);
-                goto finalize;
-            }
+        normalize_entry(entry, mtime);
 
-            archive_read_disk_descend(ar);
+        ret = archive_write_header(aw, entry);
 
-            if (verbose) {
-                fprintf(stderr, "a %s\n", archive_entry_pathname(entry));
-            }
+        if ((ret == ARCHIVE_RETRY) || (ret == ARCHIVE_WARN)) {
+            ret =  ARCHIVE_OK;
+        }
 
-            ret = archive_write_header(aw, entry);
+        if (ret != ARCHIVE_OK) {
+            fprintf(stderr, "%s\n", archive_error_string(aw));
+            goto finalize;
+        }
 
-            if ((ret == ARCHIVE_RETRY) || (ret == ARCHIVE_WARN)) {
-                ret =  ARCHIVE_OK;
-            }
+        if (archive_entry_filetype(entry) == AE_IFREG && archive_entry_size(entry) > 0) {
+            ret = write_entry_data(aw, entry, buf, bufSize);
 
             if (ret != ARCHIVE_OK) {
-                archive_entry_free(entry);
+                fprintf(stderr, "%s\n", archive_error_string(aw));
                 goto finalize;
             }
-
-            fd = open(archive_entry_sourcepath(entry), O_RDONLY);
-
-            char buff[16384];
-            size_t len;
-
-            len = read(fd, buff, sizeof(buff));
-
-            while (len > 0U) {
-                archive_write_data(aw, buff, len);
-                len = read(fd, buff, sizeof(buff));
-            }
-
-            close(fd);
-
-            archive_entry_free(entry);
         }
-
-        archive_read_close(ar);
-        archive_read_free(ar);
     }
 
-finalize:
+    ret = archive_write_close(aw);
+
     if (ret != ARCHIVE_OK) {
-        fprintf(stderr, "%s\n", archive_error_string(ar));
-        archive_read_close(ar);
-        archive_read_free(ar);
+        fprintf(stderr, "%s\n", archive_error_string(aw));
     }
 
-	archive_write_close(aw);
-  	archive_write_free(aw);
+finalize:
+    free(buf);
 
-    if (stringArrayList.size > 0U) {
-        for (size_t i = 0; i < stringArrayList.size; i++) {
-            free(stringArrayList.array[i]);
-            stringArrayList.array[i] = NULL;
-        }
-        free(stringArrayList.array);
-        stringArrayList.array = NULL;
-    }
+    archive_entry_list_free(&list);
+
+	archive_read_close(ar);
+	archive_read_free(ar);
+
+  	archive_write_free(aw);
 
     return ret;
 }
@@ -12,8 +12,11 @@ typedef enum {
     ArchiveType_tar_xz,
     ArchiveType_tar_lz,
     ArchiveType_tar_bz2,
+    ArchiveType_tar_zst,
     ArchiveType_zip,
     ArchiveType_7z,
+    // see seekable-bundle.h
+    ArchiveType_seekable,
 } ArchiveType;
 
 int tar_list(const char * inputFilePath, const int flags);
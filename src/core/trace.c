@@ -0,0 +1,217 @@
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <unistd.h>
+#include <pthread.h>
+
+#include "trace.h"
+
+#define TRACE_MAX_COUNTERS 512U
+
+typedef struct {
+    char     category[16];
+    char     name[64];
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t ns;
+} TraceCounter;
+
+static pthread_mutex_t traceMutex = PTHREAD_MUTEX_INITIALIZER;
+
+bool traceEnabled;
+
+// the children created by fork() inherit the atexit handler, only the process which enabled trace prints
+static pid_t tracePid;
+
+static uint64_t traceStartTime;
+
+static TraceCounter traceCounters[TRACE_MAX_COUNTERS];
+static size_t       traceCounterCount;
+static uint64_t     traceDroppedCount;
+
+static uint64_t monotonic_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void json_print_string(FILE * file, const char * s) {
+    fputc('"', file);
+
+    for (; s[0] != '\0'; s++) {
+        unsigned char c = (unsigned char)s[0];
+
+        if (c == '"' || c == '\\') {
+            fputc('\\', file);
+            fputc(c, file);
+        } else if (c < 0x20U) {
+            fprintf(file, "\\u%04x", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+
+    fputc('"', file);
+}
+
+static int compare_counters(const void * a, const void * b) {
+    const TraceCounter * x = (const TraceCounter *)a;
+    const TraceCounter * y = (const TraceCounter *)b;
+
+    int ret = strcmp(x->category, y->category);
+
+    if (ret != 0) {
+        return ret;
+    }
+
+    // the most expensive ones first
+    if (x->ns != y->ns) {
+        return x->ns < y->ns ? 1 : -1;
+    }
+
+    return strcmp(x->name, y->name);
+}
+
+static void trace_dump() {
+    if (getpid() != tracePid) {
+        return;
+    }
+
+    pthread_mutex_lock(&traceMutex);
+
+    uint64_t elapsed = monotonic_ns() - traceStartTime;
+
+    qsort(traceCounters, traceCounterCount, sizeof(TraceCounter), compare_counters);
+
+    fprintf(stderr, "\nxcpkg trace summary, %.3f ms elapsed:\n", elapsed / 1e6);
+    fprintf(stderr, "%-10s %-40s %10s %16s %14s\n", "category", "name", "calls", "bytes", "time(ms)");
+
+    for (size_t i = 0U; i < traceCounterCount; i++) {
+        const TraceCounter * c = &traceCounters[i];
+        fprintf(stderr, "%-10s %-40s %10llu %16llu %14.3f\n", c->category, c->name, (unsigned long long)c->calls, (unsigned long long)c->bytes, c->ns / 1e6);
+    }
+
+    if (traceDroppedCount != 0U) {
+        fprintf(stderr, "%llu records were dropped because there are more than %u counters.\n", (unsigned long long)traceDroppedCount, TRACE_MAX_COUNTERS);
+    }
+
+    const char * jsonFilePath = getenv("XCPKG_TRACE_JSON");
+
+    if (jsonFilePath != NULL && jsonFilePath[0] != '\0') {
+        FILE * file = fopen(jsonFilePath, "w");
+
+        if (file == NULL) {
+            perror(jsonFilePath);
+        } else {
+            fprintf(file, "{\n  \"elapsed_ns\": %llu,\n  \"dropped\": %llu,\n  \"counters\": [", (unsigned long long)elapsed, (unsigned long long)traceDroppedCount);
+
+            for (size_t i = 0U; i < traceCounterCount; i++) {
+                const TraceCounter * c = &traceCounters[i];
+
+                fprintf(file, "%s\n    {\"category\": ", i == 0U ? "" : ",");
+                json_print_string(file, c->category);
+                fprintf(file, ", \"name\": ");
+                json_print_string(file, c->name);
+                fprintf(file, ", \"calls\": %llu, \"bytes\": %llu, \"ns\": %llu}", (unsigned long long)c->calls, (unsigned long long)c->bytes, (unsigned long long)c->ns);
+            }
+
+            fprintf(file, "\n  ]\n}\n");
+
+            if (fclose(file) != 0) {
+                perror(jsonFilePath);
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&traceMutex);
+}
+
+void trace_init() {
+    if (traceEnabled) {
+        return;
+    }
+
+    const char * value = getenv("XCPKG_TRACE");
+
+    if (value == NULL || strcmp(value, "1") != 0) {
+        return;
+    }
+
+    tracePid = getpid();
+    traceStartTime = monotonic_ns();
+
+    if (atexit(trace_dump) != 0) {
+        perror(NULL);
+        return;
+    }
+
+    traceEnabled = true;
+}
+
+uint64_t trace_now() {
+    return trace_enabled() ? monotonic_ns() : 0U;
+}
+
+void trace_record(const char * category, const char * name, const uint64_t calls, const uint64_t bytes, const uint64_t startTime) {
+    if (!trace_enabled()) {
+        return;
+    }
+
+    uint64_t ns = startTime == 0U ? 0U : monotonic_ns() - startTime;
+
+    pthread_mutex_lock(&traceMutex);
+
+    TraceCounter * c = NULL;
+
+    // there are tens of counters, a linear search is fast enough
+    for (size_t i = 0U; i < traceCounterCount; i++) {
+        if (strncmp(traceCounters[i].name, name, 63U) == 0 && strcmp(traceCounters[i].category, category) == 0) {
+            c = &traceCounters[i];
+            break;
+        }
+    }
+
+    if (c == NULL) {
+        if (traceCounterCount == TRACE_MAX_COUNTERS) {
+            traceDroppedCount++;
+            pthread_mutex_unlock(&traceMutex);
+            return;
+        }
+
+        c = &traceCounters[traceCounterCount++];
+
+        strncpy(c->category, category, 15U);
+        strncpy(c->name,     name,     63U);
+    }
+
+    c->calls += calls;
+    c->bytes += bytes;
+    c->ns    += ns;
+
+    pthread_mutex_unlock(&traceMutex);
+}
+
+char * trace_strdup(const char * name, const char * s) {
+    if (traceEnabled) {
+        trace_record("alloc", name, 1U, strlen(s) + 1U, 0U);
+    }
+
+    return strdup(s);
+}
+
+void * trace_malloc(const char * name, const size_t size) {
+    if (traceEnabled) {
+        trace_record("alloc", name, 1U, size, 0U);
+    }
+
+    return malloc(size);
+}
+
+void * trace_calloc(const char * name, const size_t count, const size_t size) {
+    if (traceEnabled) {
+        trace_record("alloc", name, 1U, count * size, 0U);
+    }
+
+    return calloc(count, size);
+}
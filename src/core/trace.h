@@ -0,0 +1,47 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ *  a lightweight instrumentation layer, it is always compiled in, and enabled by setting the environment variable XCPKG_TRACE to 1.
+ *
+ *  a counter is identified by a category and a name, it accumulates the count of calls, the bytes moved and the time spent.
+ *
+ *  at exit, a summary table of every counter is printed to stderr, and written as JSON to the file XCPKG_TRACE_JSON points to if it is set.
+ *
+ *  it stays disabled until trace_init() is called, then every function below starts with a test of a plain global flag,
+ *  so the instrumented code costs a load and a branch when it is disabled.
+ */
+
+/** read XCPKG_TRACE, the elapsed time is counted from here.
+ *
+ *  it is called by main() before any thread is created, the flag is never written after that, so reading it needs no lock.
+ */
+void trace_init();
+
+extern bool traceEnabled;
+
+static inline bool trace_enabled() {
+    return traceEnabled;
+}
+
+/** the monotonic clock in nanoseconds, 0 is returned if trace is disabled.
+ */
+uint64_t trace_now();
+
+/** add calls and bytes to the counter category/name, and the time elapsed since startTime which was returned by trace_now().
+ *
+ *  startTime 0 means it is not timed. name is copied, it might be truncated to 63 characters.
+ */
+void trace_record(const char * category, const char * name, const uint64_t calls, const uint64_t bytes, const uint64_t startTime);
+
+/** same as strdup(), malloc() and calloc(), the requested bytes are added to the counter alloc/name.
+ */
+char * trace_strdup(const char * name, const char * s);
+void * trace_malloc(const char * name, const size_t size);
+void * trace_calloc(const char * name, const size_t count, const size_t size);
+
+#endif
@@ -1,12 +1,27 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <pthread.h>
+
 #include <zlib.h>
 
+#include "sysinfo.h"
+#include "parallel.h"
 #include "zlib-flate.h"
 
 #define CHUNK 16384
 
+// the input is compressed in blocks of this size, every block is primed with the last 32K of its previous block, so the compression ratio is almost the same as a single stream
+#define ZLIB_PARALLEL_BLOCK_SIZE 131072U
+#define ZLIB_PARALLEL_DICT_SIZE  32768U
+
+// how many blocks are read and compressed at a time for every thread
+#define ZLIB_PARALLEL_BLOCKS_PER_THREAD 4U
+
+// the inflated data is handed over to the thread which verifies the check value and writes it out
+#define ZLIB_INFLATE_BUFFER_SIZE  262144U
+#define ZLIB_INFLATE_BUFFER_COUNT 4U
+
 // this source file was modified from https://www.zlib.net/zpipe.c
 
 // compress
@@ -15,10 +30,6 @@ int zlib_deflate_string_to_file(const char * inputBuf, size_t inputBufSizeInByte
         inputBufSizeInBytes = strlen(inputBuf);
     }
 
-    if (level == 0) {
-        level = 1;
-    }
-
     z_stream zStream;
     zStream.zalloc = Z_NULL;
     zStream.zfree  = Z_NULL;
@@ -111,63 +122,652 @@ int zlib_deflate_file_to_file(FILE * inputFile, FILE * outputFile, int level) {
     return Z_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    const unsigned char * input;
+    size_t                inputSize;
+
+    // the preceding data of this block
+    const unsigned char * dict;
+    size_t                dictSize;
+
+    unsigned char * output;
+    size_t          outputSize;
+    size_t          outputCapacity;
+
+    // adler32 or crc32 of the input of this block
+    uLong check;
+
+    int ret;
+} DeflateBlock;
+
+typedef struct {
+    DeflateBlock * blocks;
+    int  level;
+    bool gzip;
+} DeflateBatch;
+
+static int deflate_a_block(size_t index, void * arg) {
+    DeflateBatch * batch = (DeflateBatch*)arg;
+    DeflateBlock * block = &batch->blocks[index];
+
+    z_stream zStream;
+    zStream.zalloc = Z_NULL;
+    zStream.zfree  = Z_NULL;
+    zStream.opaque = Z_NULL;
+
+    // raw deflate, the header and the trailer are written by the caller
+    block->ret = deflateInit2(&zStream, batch->level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+
+    if (block->ret != Z_OK) {
+        return block->ret;
+    }
+
+    if (block->dictSize != 0U) {
+        block->ret = deflateSetDictionary(&zStream, block->dict, (uInt)block->dictSize);
+
+        if (block->ret != Z_OK) {
+            (void)deflateEnd(&zStream);
+            return block->ret;
+        }
+    }
+
+    size_t bound = deflateBound(&zStream, (uLong)block->inputSize) + 16U;
+
+    if (block->outputCapacity < bound) {
+        unsigned char * p = (unsigned char *)realloc(block->output, bound);
+
+        if (p == NULL) {
+            (void)deflateEnd(&zStream);
+            block->ret = Z_MEM_ERROR;
+            return block->ret;
+        }
+
+        block->output = p;
+        block->outputCapacity = bound;
+    }
+
+    zStream.next_in  = (unsigned char *)block->input;
+    zStream.avail_in = (uInt)block->inputSize;
+
+    block->outputSize = 0U;
+
+    // every block ends on a byte boundary without the last-block bit, so that the blocks can be concatenated
+    for (;;) {
+        zStream.next_out  = block->output + block->outputSize;
+        zStream.avail_out = (uInt)(block->outputCapacity - block->outputSize);
+
+        block->ret = deflate(&zStream, Z_SYNC_FLUSH);
+
+        block->outputSize = block->outputCapacity - zStream.avail_out;
+
+        if (block->ret != Z_OK && block->ret != Z_BUF_ERROR) {
+            (void)deflateEnd(&zStream);
+            return block->ret;
+        }
+
+        if (zStream.avail_out != 0U) {
+            break;
+        }
+
+        size_t newCapacity = block->outputCapacity << 1;
+
+        unsigned char * p = (unsigned char *)realloc(block->output, newCapacity);
+
+        if (p == NULL) {
+            (void)deflateEnd(&zStream);
+            block->ret = Z_MEM_ERROR;
+            return block->ret;
+        }
+
+        block->output = p;
+        block->outputCapacity = newCapacity;
+    }
+
+    (void)deflateEnd(&zStream);
+
+    if (batch->gzip) {
+        block->check = crc32(crc32(0L, Z_NULL, 0), block->input, (uInt)block->inputSize);
+    } else {
+        block->check = adler32(adler32(0L, Z_NULL, 0), block->input, (uInt)block->inputSize);
+    }
+
+    block->ret = Z_OK;
+
+    return Z_OK;
+}
+
+static int write_the_header(FILE * outputFile, int level, const bool gzip) {
+    unsigned char header[10];
+
+    size_t size;
+
+    if (gzip) {
+        // no file name, no mtime, the os is unix
+        header[0] = 0x1F;
+        header[1] = 0x8B;
+        header[2] = 8;
+        header[3] = 0;
+        header[4] = 0;
+        header[5] = 0;
+        header[6] = 0;
+        header[7] = 0;
+        header[8] = level == 9 ? 2 : (level == 1 ? 4 : 0);
+        header[9] = 3;
+
+        size = 10U;
+    } else {
+        if (level == Z_DEFAULT_COMPRESSION) {
+            level = 6;
+        }
+
+        unsigned int flevel = level < 2 ? 0U : (level < 6 ? 1U : (level == 6 ? 2U : 3U));
+
+        unsigned int x = (0x78U << 8) | (flevel << 6);
+
+        x += 31U - x % 31U;
+
+        header[0] = (unsigned char)(x >> 8);
+        header[1] = (unsigned char)(x & 0xFF);
+
+        size = 2U;
+    }
+
+    if ((fwrite(header, 1, size, outputFile) != size) || ferror(outputFile)) {
+        return Z_ERRNO;
+    }
+
+    return Z_OK;
+}
+
+int zlib_deflate_file_to_file_parallel(FILE * inputFile, FILE * outputFile, int level, const bool gzip, unsigned int nthreads) {
+    if (level < Z_DEFAULT_COMPRESSION || level > 9) {
+        return Z_STREAM_ERROR;
+    }
+
+    int ret = write_the_header(outputFile, level, gzip);
+
+    if (ret != Z_OK) {
+        return ret;
+    }
+
+    if (nthreads == 0U) {
+        int ncpu = sysinfo_ncpu();
+
+        nthreads = ncpu > 0 ? (unsigned int)ncpu : 1U;
+    }
+
+    size_t blockCount = nthreads * ZLIB_PARALLEL_BLOCKS_PER_THREAD;
+
+    // the last 32K of the previous batch is kept in front of the buffer
+    size_t bufCapacity = ZLIB_PARALLEL_DICT_SIZE + blockCount * ZLIB_PARALLEL_BLOCK_SIZE;
+
+    unsigned char * buf = (unsigned char *)malloc(bufCapacity);
+
+    if (buf == NULL) {
+        return Z_MEM_ERROR;
+    }
+
+    DeflateBlock * blocks = (DeflateBlock*)calloc(blockCount, sizeof(DeflateBlock));
+
+    if (blocks == NULL) {
+        free(buf);
+        return Z_MEM_ERROR;
+    }
+
+    DeflateBatch batch = { blocks, level, gzip };
+
+    uLong check = gzip ? crc32(0L, Z_NULL, 0) : adler32(0L, Z_NULL, 0);
+
+    unsigned long long totalSize = 0U;
+
+    size_t dictSize = 0U;
+
+    for (;;) {
+        unsigned char * input = buf + ZLIB_PARALLEL_DICT_SIZE;
+
+        size_t inputSize = fread(input, 1, blockCount * ZLIB_PARALLEL_BLOCK_SIZE, inputFile);
+
+        if (ferror(inputFile)) {
+            ret = Z_ERRNO;
+            goto finalize;
+        }
+
+        if (inputSize == 0U) {
+            break;
+        }
+
+        size_t n = (inputSize + ZLIB_PARALLEL_BLOCK_SIZE - 1U) / ZLIB_PARALLEL_BLOCK_SIZE;
+
+        for (size_t i = 0U; i < n; i++) {
+            DeflateBlock * block = &blocks[i];
+
+            size_t offset = i * ZLIB_PARALLEL_BLOCK_SIZE;
+
+            block->input     = input + offset;
+            block->inputSize = (inputSize - offset) < ZLIB_PARALLEL_BLOCK_SIZE ? (inputSize - offset) : ZLIB_PARALLEL_BLOCK_SIZE;
+
+            block->dictSize = i == 0U ? dictSize : ZLIB_PARALLEL_DICT_SIZE;
+            block->dict     = block->input - block->dictSize;
+        }
+
+        if (parallel_for(n, nthreads, deflate_a_block, &batch) != 0) {
+            ret = Z_ERRNO;
+            goto finalize;
+        }
+
+        for (size_t i = 0U; i < n; i++) {
+            DeflateBlock * block = &blocks[i];
+
+            if (block->ret != Z_OK) {
+                ret = block->ret;
+                goto finalize;
+            }
+
+            if ((fwrite(block->output, 1, block->outputSize, outputFile) != block->outputSize) || ferror(outputFile)) {
+                ret = Z_ERRNO;
+                goto finalize;
+            }
+
+            if (gzip) {
+                check = crc32_combine(check, block->check, (z_off_t)block->inputSize);
+            } else {
+                check = adler32_combine(check, block->check, (z_off_t)block->inputSize);
+            }
+        }
+
+        totalSize += inputSize;
+
+        // the dictionary of the next batch
+        dictSize = inputSize < ZLIB_PARALLEL_DICT_SIZE ? inputSize : ZLIB_PARALLEL_DICT_SIZE;
+
+        memmove(buf + ZLIB_PARALLEL_DICT_SIZE - dictSize, input + inputSize - dictSize, dictSize);
+
+        if (feof(inputFile)) {
+            break;
+        }
+    }
+
+    {
+        // an empty fixed huffman block with the last-block bit set, then the trailer
+        unsigned char trailer[10] = { 0x03, 0x00 };
+
+        size_t size;
+
+        if (gzip) {
+            for (int i = 0; i < 4; i++) {
+                trailer[2 + i] = (unsigned char)((check >> (8 * i)) & 0xFF);
+                trailer[6 + i] = (unsigned char)((totalSize >> (8 * i)) & 0xFF);
+            }
+
+            size = 10U;
+        } else {
+            for (int i = 0; i < 4; i++) {
+                trailer[2 + i] = (unsigned char)((check >> (24 - 8 * i)) & 0xFF);
+            }
+
+            size = 6U;
+        }
+
+        if ((fwrite(trailer, 1, size, outputFile) != size) || ferror(outputFile)) {
+            ret = Z_ERRNO;
+            goto finalize;
+        }
+    }
+
+    ret = Z_OK;
+
+finalize:
+    for (size_t i = 0U; i < blockCount; i++) {
+        free(blocks[i].output);
+    }
+
+    free(blocks);
+    free(buf);
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    unsigned char * bufs[ZLIB_INFLATE_BUFFER_COUNT];
+    size_t          sizes[ZLIB_INFLATE_BUFFER_COUNT];
+
+    // the buffers in [head, tail) are waiting to be written
+    size_t head;
+    size_t tail;
+
+    bool finished;
+
+    int ret;
+
+    FILE * outputFile;
+
+    bool  gzip;
+    uLong check;
+    unsigned long long totalSize;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+} InflateWriter;
+
+// the check value is computed while the next buffer is being inflated
+static void* inflate_writer_run(void * arg) {
+    InflateWriter * writer = (InflateWriter*)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&writer->mutex);
+
+        while (writer->head == writer->tail && !writer->finished) {
+            pthread_cond_wait(&writer->cond, &writer->mutex);
+        }
+
+        if (writer->head == writer->tail) {
+            pthread_mutex_unlock(&writer->mutex);
+            return NULL;
+        }
+
+        size_t k = writer->head % ZLIB_INFLATE_BUFFER_COUNT;
+
+        pthread_mutex_unlock(&writer->mutex);
+
+        const unsigned char * buf  = writer->bufs[k];
+        const size_t          size = writer->sizes[k];
+
+        if (writer->gzip) {
+            writer->check = crc32(writer->check, buf, (uInt)size);
+        } else {
+            writer->check = adler32(writer->check, buf, (uInt)size);
+        }
+
+        writer->totalSize += size;
+
+        int ret = Z_OK;
+
+        if ((fwrite(buf, 1, size, writer->outputFile) != size) || ferror(writer->outputFile)) {
+            ret = Z_ERRNO;
+        }
+
+        pthread_mutex_lock(&writer->mutex);
+
+        writer->head++;
+
+        if (ret != Z_OK) {
+            writer->ret = ret;
+            writer->finished = true;
+            writer->head = writer->tail;
+        }
+
+        pthread_cond_signal(&writer->cond);
+        pthread_mutex_unlock(&writer->mutex);
+
+        if (ret != Z_OK) {
+            return NULL;
+        }
+    }
+}
+
+// returns the buffer which is to be filled, NULL if the writer has failed
+static unsigned char * inflate_writer_acquire(InflateWriter * writer) {
+    pthread_mutex_lock(&writer->mutex);
+
+    while (writer->tail - writer->head == ZLIB_INFLATE_BUFFER_COUNT && writer->ret == Z_OK) {
+        pthread_cond_wait(&writer->cond, &writer->mutex);
+    }
+
+    unsigned char * buf = writer->ret == Z_OK ? writer->bufs[writer->tail % ZLIB_INFLATE_BUFFER_COUNT] : NULL;
+
+    pthread_mutex_unlock(&writer->mutex);
+
+    return buf;
+}
+
+static void inflate_writer_submit(InflateWriter * writer, size_t size) {
+    pthread_mutex_lock(&writer->mutex);
+
+    if (writer->ret == Z_OK) {
+        writer->sizes[writer->tail % ZLIB_INFLATE_BUFFER_COUNT] = size;
+        writer->tail++;
+    }
+
+    pthread_cond_signal(&writer->cond);
+    pthread_mutex_unlock(&writer->mutex);
+}
+
+// parse the zlib or gzip header at the beginning of buf, on success, the size of the header is returned
+static int parse_the_header(const unsigned char * buf, size_t size, bool * gzip, size_t * headerSize) {
+    if (size >= 2U && buf[0] == 0x1F && buf[1] == 0x8B) {
+        if (size < 10U || buf[2] != 8) {
+            return Z_DATA_ERROR;
+        }
+
+        unsigned char flags = buf[3];
+
+        size_t i = 10U;
+
+        // FEXTRA
+        if (flags & 0x04) {
+            if (i + 2U > size) {
+                return Z_DATA_ERROR;
+            }
+
+            i += 2U + (buf[i] | ((size_t)buf[i + 1U] << 8));
+        }
+
+        // FNAME and FCOMMENT, both are zero-terminated
+        for (unsigned char bit = 0x08; bit <= 0x10; bit <<= 1) {
+            if (flags & bit) {
+                while (i < size && buf[i] != '\0') {
+                    i++;
+                }
+
+                i++;
+            }
+        }
+
+        // FHCRC
+        if (flags & 0x02) {
+            i += 2U;
+        }
+
+        if (i > size) {
+            return Z_DATA_ERROR;
+        }
+
+        *gzip = true;
+        *headerSize = i;
+
+        return Z_OK;
+    }
+
+    // deflate with a 32K window at most, no preset dictionary
+    if (size >= 2U && (buf[0] & 0x0F) == 8 && (buf[0] >> 4) <= 7 && ((buf[0] << 8) | buf[1]) % 31 == 0 && (buf[1] & 0x20) == 0) {
+        *gzip = false;
+        *headerSize = 2U;
+        return Z_OK;
+    }
+
+    return Z_DATA_ERROR;
+}
+
 int zlib_inflate_file_to_file(FILE * inputFile, FILE * outputFile) {
+    unsigned char * inputBuf = (unsigned char *)malloc(ZLIB_INFLATE_BUFFER_SIZE * (ZLIB_INFLATE_BUFFER_COUNT + 1U));
+
+    if (inputBuf == NULL) {
+        return Z_MEM_ERROR;
+    }
+
+    InflateWriter writer = {0};
+
+    writer.outputFile = outputFile;
+
+    for (size_t i = 0U; i < ZLIB_INFLATE_BUFFER_COUNT; i++) {
+        writer.bufs[i] = inputBuf + ZLIB_INFLATE_BUFFER_SIZE * (i + 1U);
+    }
+
+    size_t inputSize = fread(inputBuf, 1, ZLIB_INFLATE_BUFFER_SIZE, inputFile);
+
+    if (ferror(inputFile)) {
+        free(inputBuf);
+        return Z_ERRNO;
+    }
+
+    size_t headerSize;
+
+    int ret = parse_the_header(inputBuf, inputSize, &writer.gzip, &headerSize);
+
+    if (ret != Z_OK) {
+        free(inputBuf);
+        return ret;
+    }
+
+    writer.check = writer.gzip ? crc32(0L, Z_NULL, 0) : adler32(0L, Z_NULL, 0);
+
     z_stream zStream;
     zStream.zalloc = Z_NULL;
     zStream.zfree = Z_NULL;
     zStream.opaque = Z_NULL;
-    zStream.avail_in = 0;
-    zStream.next_in = Z_NULL;
+    zStream.avail_in = (uInt)(inputSize - headerSize);
+    zStream.next_in = inputBuf + headerSize;
 
-    int ret = inflateInit(&zStream);
+    // raw inflate, the check value is verified by ourselves
+    ret = inflateInit2(&zStream, -15);
 
     if (ret != Z_OK) {
+        free(inputBuf);
         return ret;
     }
 
-    unsigned char  inputBuf[CHUNK];
-    unsigned char outputBuf[CHUNK];
+    pthread_t writerThread;
 
-    unsigned have;
+    if (pthread_mutex_init(&writer.mutex, NULL) != 0) {
+        (void)inflateEnd(&zStream);
+        free(inputBuf);
+        return Z_ERRNO;
+    }
 
-    do {
-        zStream.avail_in = fread(inputBuf, 1, CHUNK, inputFile);
+    if (pthread_cond_init(&writer.cond, NULL) != 0) {
+        pthread_mutex_destroy(&writer.mutex);
+        (void)inflateEnd(&zStream);
+        free(inputBuf);
+        return Z_ERRNO;
+    }
 
-        if (ferror(inputFile)) {
-            (void)inflateEnd(&zStream);
-            return Z_ERRNO;
+    if (pthread_create(&writerThread, NULL, inflate_writer_run, &writer) != 0) {
+        pthread_cond_destroy(&writer.cond);
+        pthread_mutex_destroy(&writer.mutex);
+        (void)inflateEnd(&zStream);
+        free(inputBuf);
+        return Z_ERRNO;
+    }
+
+    for (;;) {
+        if (zStream.avail_in == 0U) {
+            inputSize = fread(inputBuf, 1, ZLIB_INFLATE_BUFFER_SIZE, inputFile);
+
+            if (ferror(inputFile)) {
+                ret = Z_ERRNO;
+                break;
+            }
+
+            if (inputSize == 0U) {
+                // truncated
+                ret = Z_DATA_ERROR;
+                break;
+            }
+
+            zStream.next_in  = inputBuf;
+            zStream.avail_in = (uInt)inputSize;
         }
 
-        if (zStream.avail_in == 0) {
+        unsigned char * outputBuf = inflate_writer_acquire(&writer);
+
+        if (outputBuf == NULL) {
+            ret = Z_ERRNO;
             break;
         }
 
-        zStream.next_in = inputBuf;
+        zStream.next_out  = outputBuf;
+        zStream.avail_out = ZLIB_INFLATE_BUFFER_SIZE;
 
-        do {
-            zStream.avail_out = CHUNK;
-            zStream.next_out  = outputBuf;
+        ret = inflate(&zStream, Z_NO_FLUSH);
+
+        if (ret == Z_NEED_DICT) {
+            ret = Z_DATA_ERROR;
+        }
+
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+            break;
+        }
+
+        inflate_writer_submit(&writer, ZLIB_INFLATE_BUFFER_SIZE - zStream.avail_out);
+
+        if (ret == Z_STREAM_END) {
+            ret = Z_OK;
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&writer.mutex);
+    writer.finished = true;
+    pthread_cond_signal(&writer.cond);
+    pthread_mutex_unlock(&writer.mutex);
+
+    pthread_join(writerThread, NULL);
+
+    pthread_cond_destroy(&writer.cond);
+    pthread_mutex_destroy(&writer.mutex);
+
+    if (ret == Z_OK) {
+        ret = writer.ret;
+    }
+
+    if (ret == Z_OK) {
+        // the trailer: adler32 in big-endian for zlib, crc32 and the size in little-endian for gzip
+        unsigned char trailer[8];
 
-            ret = inflate(&zStream, Z_NO_FLUSH);
+        size_t trailerSize = writer.gzip ? 8U : 4U;
 
-            switch (ret) {
-            case Z_NEED_DICT:
+        size_t n = zStream.avail_in < trailerSize ? zStream.avail_in : trailerSize;
+
+        memcpy(trailer, zStream.next_in, n);
+
+        if (n < trailerSize) {
+            n += fread(trailer + n, 1, trailerSize - n, inputFile);
+        }
+
+        if (n != trailerSize) {
+            ret = Z_DATA_ERROR;
+        } else if (writer.gzip) {
+            uLong expectedCheck = 0U;
+            uLong expectedSize  = 0U;
+
+            for (int i = 3; i >= 0; i--) {
+                expectedCheck = (expectedCheck << 8) | trailer[i];
+                expectedSize  = (expectedSize  << 8) | trailer[4 + i];
+            }
+
+            if (expectedCheck != writer.check || expectedSize != (uLong)(writer.totalSize & 0xFFFFFFFFU)) {
                 ret = Z_DATA_ERROR;
-            case Z_DATA_ERROR:
-            case Z_MEM_ERROR:
-                (void)inflateEnd(&zStream);
-                return ret;
             }
+        } else {
+            uLong expectedCheck = 0U;
 
-            have = CHUNK - zStream.avail_out;
+            for (int i = 0; i < 4; i++) {
+                expectedCheck = (expectedCheck << 8) | trailer[i];
+            }
 
-            if ((fwrite(outputBuf, 1, have, outputFile) != have) || ferror(outputFile)) {
-                (void)inflateEnd(&zStream);
-                return Z_ERRNO;
+            if (expectedCheck != writer.check) {
+                ret = Z_DATA_ERROR;
             }
-        } while (zStream.avail_out == 0);
-    } while (ret != Z_STREAM_END);
+        }
+    }
 
     (void)inflateEnd(&zStream);
-    return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
+
+    free(inputBuf);
+
+    return ret;
 }
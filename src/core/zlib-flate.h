@@ -1,9 +1,29 @@
 #ifndef _ZLIB_FLATE_H
 #define _ZLIB_FLATE_H
 
+#include <stdio.h>
+#include <stdbool.h>
+
 int zlib_deflate_string_to_file(const char * inputBuf, size_t inputBufSizeInBytes, FILE * outputFile, int level);
 
 int zlib_deflate_file_to_file(FILE * inputFile, FILE * outputFile, int level);
+
+/** compress inputFile into a zlib stream, or a gzip stream if gzip is true, with nthreads threads, 0 means as many threads as cpus.
+ *
+ *  the input is split into 128K blocks which are compressed concurrently, every block is primed with the last 32K of its previous block.
+ *
+ *  the output is a single standard stream, any zlib or gzip implementation is able to decompress it.
+ *
+ *  the return value is a zlib error code, Z_OK on success.
+ */
+int zlib_deflate_file_to_file_parallel(FILE * inputFile, FILE * outputFile, int level, const bool gzip, unsigned int nthreads);
+
+/** decompress a zlib stream or a gzip stream from inputFile into outputFile.
+ *
+ *  the check value in the trailer is computed on another thread while the next chunk is being decompressed, a mismatch results in Z_DATA_ERROR.
+ *
+ *  the return value is a zlib error code, Z_OK on success.
+ */
 int zlib_inflate_file_to_file(FILE * inputFile, FILE * outputFile);
 
 #endif
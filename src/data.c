@@ -0,0 +1,20 @@
+#include<stdlib.h>
+
+size_t XCPKG_WRAPPER_NATIVE_CC_C_SOURCE_STRING_LENGTH = 6339;
+char XCPKG_WRAPPER_NATIVE_CC_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x43, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_WRAPPER_NATIVE_CXX_C_SOURCE_STRING_LENGTH = 6343;
+char XCPKG_WRAPPER_NATIVE_CXX_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_WRAPPER_NATIVE_OBJC_C_SOURCE_STRING_LENGTH = 6347;
+char XCPKG_WRAPPER_NATIVE_OBJC_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_WRAPPER_TARGET_CC_C_SOURCE_STRING_LENGTH = 7843;
+char XCPKG_WRAPPER_TARGET_CC_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x43, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4D, 0x53, 0x4C, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2F, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x2D, 0x31, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x6A, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2E, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x20, 0x2D, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x3D, 0x20, 0x36, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x26, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x2C, 0x20, 0x22, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x61, 0x27, 0x20, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x20, 0x73, 0x74, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x26, 0x73, 0x74, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x53, 0x5F, 0x49, 0x53, 0x52, 0x45, 0x47, 0x28, 0x73, 0x74, 0x2E, 0x73, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x64, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x79, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_WRAPPER_TARGET_CXX_C_SOURCE_STRING_LENGTH = 7847;
+char XCPKG_WRAPPER_TARGET_CXX_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x58, 0x58, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4D, 0x53, 0x4C, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2F, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x2D, 0x31, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x6A, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2E, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x20, 0x2D, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x3D, 0x20, 0x36, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x26, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x2C, 0x20, 0x22, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x61, 0x27, 0x20, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x20, 0x73, 0x74, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x26, 0x73, 0x74, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x53, 0x5F, 0x49, 0x53, 0x52, 0x45, 0x47, 0x28, 0x73, 0x74, 0x2E, 0x73, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x64, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x79, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_WRAPPER_TARGET_OBJC_C_SOURCE_STRING_LENGTH = 7851;
+char XCPKG_WRAPPER_TARGET_OBJC_C_SOURCE_STRING[] = {0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6F, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x75, 0x6E, 0x69, 0x73, 0x74, 0x64, 0x2E, 0x68, 0x3E, 0x0A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x79, 0x73, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x2E, 0x68, 0x3E, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x34, 0x0A, 0x0A, 0x69, 0x6E, 0x74, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x72, 0x67, 0x63, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x5D, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x5C, 0x6E, 0x22, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x45, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x45, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x53, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x53, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x63, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x22, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x31, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4F, 0x42, 0x4A, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x32, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x74, 0x20, 0x6E, 0x33, 0x20, 0x3D, 0x20, 0x30, 0x55, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x33, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x20, 0x2B, 0x20, 0x6E, 0x31, 0x20, 0x2B, 0x20, 0x6E, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x33, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4D, 0x53, 0x4C, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x6D, 0x73, 0x6C, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2F, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x2D, 0x31, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x6A, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x2E, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x6A, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6C, 0x65, 0x6E, 0x20, 0x2D, 0x20, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x3D, 0x20, 0x36, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x26, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x2C, 0x20, 0x22, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x61, 0x27, 0x20, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x20, 0x73, 0x74, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x28, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x26, 0x73, 0x74, 0x29, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x7C, 0x7C, 0x20, 0x21, 0x53, 0x5F, 0x49, 0x53, 0x52, 0x45, 0x47, 0x28, 0x73, 0x74, 0x2E, 0x73, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x64, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x5B, 0x64, 0x6F, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x79, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x76, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x31, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x41, 0x72, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x32, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x33, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x55, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x21, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x3B, 0x3B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x27, 0x5C, 0x30, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x2B, 0x2B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x63, 0x68, 0x61, 0x72, 0x2A, 0x29, 0x22, 0x2D, 0x66, 0x50, 0x49, 0x43, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x61, 0x72, 0x67, 0x63, 0x2B, 0x2B, 0x5D, 0x20, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x21, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x20, 0x26, 0x26, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x2C, 0x20, 0x22, 0x31, 0x22, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x4E, 0x55, 0x4C, 0x4C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2C, 0x20, 0x22, 0x25, 0x73, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x76, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 0x35, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x00};
+size_t XCPKG_INSTALL_SHELL_SCRIPT_STRING_LENGTH = 58749;
+char XCPKG_INSTALL_SHELL_SCRIPT_STRING[] = {0x23, 0x21, 0x2F, 0x62, 0x69, 0x6E, 0x2F, 0x73, 0x68, 0x0A, 0x0A, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x51, 0x55, 0x49, 0x45, 0x54, 0x3D, 0x30, 0x0A, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x4E, 0x4F, 0x52, 0x4D, 0x41, 0x4C, 0x3D, 0x31, 0x0A, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x3D, 0x32, 0x0A, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x59, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x3D, 0x33, 0x0A, 0x0A, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x52, 0x45, 0x44, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x52, 0x65, 0x64, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x47, 0x52, 0x45, 0x45, 0x4E, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6E, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x59, 0x45, 0x4C, 0x4C, 0x4F, 0x57, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x3B, 0x33, 0x33, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x59, 0x65, 0x6C, 0x6C, 0x6F, 0x77, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x42, 0x4C, 0x55, 0x45, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x42, 0x6C, 0x75, 0x65, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x50, 0x55, 0x52, 0x50, 0x4C, 0x45, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x3B, 0x33, 0x35, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x50, 0x75, 0x72, 0x70, 0x6C, 0x65, 0x0A, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x3D, 0x27, 0x5C, 0x30, 0x33, 0x33, 0x5B, 0x30, 0x6D, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x52, 0x65, 0x73, 0x65, 0x74, 0x0A, 0x0A, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x27, 0x20, 0x22, 0x24, 0x2A, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x65, 0x63, 0x68, 0x6F, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x2A, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x6E, 0x6F, 0x74, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x59, 0x45, 0x4C, 0x4C, 0x4F, 0x57, 0x7D, 0xF0, 0x9F, 0x94, 0x94, 0x20, 0x20, 0x24, 0x2A, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x20, 0x3E, 0x26, 0x32, 0x0A, 0x7D, 0x0A, 0x0A, 0x77, 0x61, 0x72, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x59, 0x45, 0x4C, 0x4C, 0x4F, 0x57, 0x7D, 0xF0, 0x9F, 0x94, 0xA5, 0x20, 0x20, 0x24, 0x2A, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x20, 0x3E, 0x26, 0x32, 0x0A, 0x7D, 0x0A, 0x0A, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x47, 0x52, 0x45, 0x45, 0x4E, 0x7D, 0x5B, 0xE2, 0x9C, 0x94, 0x5D, 0x20, 0x24, 0x2A, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x20, 0x3E, 0x26, 0x32, 0x0A, 0x7D, 0x0A, 0x0A, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x52, 0x45, 0x44, 0x7D, 0xF0, 0x9F, 0x92, 0x94, 0x20, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x3A, 0x20, 0x24, 0x2A, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x20, 0x3E, 0x26, 0x32, 0x0A, 0x7D, 0x0A, 0x0A, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x49, 0x54, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x5F, 0x43, 0x4F, 0x44, 0x45, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x52, 0x45, 0x44, 0x7D, 0xF0, 0x9F, 0x92, 0x94, 0x20, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x3A, 0x20, 0x24, 0x2A, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x20, 0x3E, 0x26, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x22, 0x24, 0x45, 0x58, 0x49, 0x54, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x5F, 0x43, 0x4F, 0x44, 0x45, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x73, 0x74, 0x65, 0x70, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x53, 0x54, 0x45, 0x50, 0x5F, 0x4E, 0x55, 0x4D, 0x3D, 0x24, 0x28, 0x65, 0x78, 0x70, 0x72, 0x20, 0x24, 0x7B, 0x53, 0x54, 0x45, 0x50, 0x5F, 0x4E, 0x55, 0x4D, 0x2D, 0x30, 0x7D, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x53, 0x54, 0x45, 0x50, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x3D, 0x22, 0x24, 0x2A, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x5C, 0x6E, 0x25, 0x62, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x50, 0x55, 0x52, 0x50, 0x4C, 0x45, 0x7D, 0x3D, 0x3E, 0x3E, 0x20, 0x53, 0x54, 0x45, 0x50, 0x20, 0x24, 0x7B, 0x53, 0x54, 0x45, 0x50, 0x5F, 0x4E, 0x55, 0x4D, 0x7D, 0x20, 0x3A, 0x20, 0x24, 0x7B, 0x53, 0x54, 0x45, 0x50, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x7D, 0x20, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x72, 0x75, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x50, 0x55, 0x52, 0x50, 0x4C, 0x45, 0x7D, 0x3D, 0x3D, 0x3E, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x20, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x47, 0x52, 0x45, 0x45, 0x4E, 0x7D, 0x24, 0x40, 0x24, 0x7B, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4F, 0x46, 0x46, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x73, 0x49, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x5B, 0x2B, 0x2D, 0x5D, 0x7D, 0x22, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2A, 0x5B, 0x21, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5D, 0x2A, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x27, 0x27, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x2A, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x7D, 0x0A, 0x0A, 0x77, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x68, 0x74, 0x74, 0x70, 0x2D, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x67, 0x69, 0x74, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x6F, 0x75, 0x74, 0x20, 0x3C, 0x55, 0x52, 0x4C, 0x3E, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x66, 0x2D, 0x66, 0x72, 0x6F, 0x6D, 0x3D, 0x3C, 0x46, 0x52, 0x4F, 0x4D, 0x3E, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x66, 0x2D, 0x74, 0x6F, 0x3D, 0x3C, 0x54, 0x4F, 0x3E, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3D, 0x3C, 0x4E, 0x3E, 0x20, 0x2D, 0x42, 0x20, 0x3C, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x2D, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x2D, 0x43, 0x20, 0x3C, 0x57, 0x4F, 0x52, 0x4B, 0x44, 0x49, 0x52, 0x3E, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x0A, 0x67, 0x69, 0x74, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x6F, 0x75, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4F, 0x4C, 0x44, 0x43, 0x57, 0x44, 0x3D, 0x22, 0x24, 0x50, 0x57, 0x44, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x55, 0x52, 0x4C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x52, 0x45, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x44, 0x45, 0x50, 0x54, 0x48, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x52, 0x45, 0x43, 0x55, 0x52, 0x53, 0x49, 0x56, 0x45, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x50, 0x52, 0x4F, 0x58, 0x59, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x55, 0x52, 0x4C, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x55, 0x52, 0x4C, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x50, 0x52, 0x4F, 0x58, 0x59, 0x2F, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x55, 0x52, 0x4C, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x66, 0x2D, 0x66, 0x72, 0x6F, 0x6D, 0x3D, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x52, 0x45, 0x46, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x66, 0x2D, 0x74, 0x6F, 0x3D, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3D, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x42, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x43, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x52, 0x45, 0x43, 0x55, 0x52, 0x53, 0x49, 0x56, 0x45, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x44, 0x45, 0x50, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x44, 0x45, 0x50, 0x54, 0x48, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x52, 0x45, 0x46, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x52, 0x45, 0x46, 0x3D, 0x27, 0x48, 0x45, 0x41, 0x44, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x3D, 0x27, 0x72, 0x65, 0x66, 0x73, 0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x73, 0x2F, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x2F, 0x6D, 0x61, 0x73, 0x74, 0x65, 0x72, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x7B, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x23, 0x23, 0x2A, 0x2F, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x20, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x2D, 0x63, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x42, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x6D, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x61, 0x64, 0x64, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x55, 0x52, 0x4C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x2D, 0x63, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x32, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x44, 0x45, 0x50, 0x54, 0x48, 0x22, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x46, 0x52, 0x4F, 0x4D, 0x5F, 0x52, 0x45, 0x46, 0x3A, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x6F, 0x75, 0x74, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x2D, 0x42, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x5F, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x46, 0x45, 0x54, 0x43, 0x48, 0x5F, 0x54, 0x4F, 0x5F, 0x5F, 0x5F, 0x52, 0x45, 0x46, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x69, 0x74, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x4F, 0x4C, 0x44, 0x43, 0x57, 0x44, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x67, 0x69, 0x74, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x52, 0x45, 0x50, 0x4F, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x50, 0x57, 0x44, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x52, 0x45, 0x50, 0x4F, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x48, 0x41, 0x56, 0x45, 0x3D, 0x22, 0x24, 0x28, 0x63, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x52, 0x45, 0x50, 0x4F, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x26, 0x26, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2E, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x27, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x27, 0x20, 0x2D, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x2D, 0x71, 0x75, 0x69, 0x74, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x48, 0x41, 0x56, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x50, 0x52, 0x4F, 0x58, 0x59, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x3D, 0x22, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x52, 0x45, 0x50, 0x4F, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x27, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x27, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x22, 0x24, 0x7B, 0x66, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3B, 0x24, 0x7B, 0x66, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x22, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x5C, 0x3B, 0x2A, 0x29, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x7B, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x23, 0x23, 0x2A, 0x3B, 0x7D, 0x22, 0x20, 0x3B, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x22, 0x24, 0x7B, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x25, 0x3B, 0x2A, 0x7D, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x7B, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x7D, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x3D, 0x22, 0x24, 0x28, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x27, 0x2F, 0x5C, 0x5B, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x22, 0x2E, 0x2A, 0x22, 0x5C, 0x5D, 0x2F, 0x70, 0x27, 0x20, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x5C, 0x5B, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x22, 0x5C, 0x28, 0x2E, 0x2A, 0x5C, 0x29, 0x22, 0x5C, 0x5D, 0x7C, 0x5C, 0x31, 0x7C, 0x27, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x28, 0x67, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x2D, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x22, 0x29, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x3D, 0x22, 0x24, 0x28, 0x67, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x2D, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x2E, 0x75, 0x72, 0x6C, 0x22, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x50, 0x52, 0x4F, 0x58, 0x59, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x49, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x49, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x50, 0x52, 0x4F, 0x58, 0x59, 0x2F, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x49, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x74, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x55, 0x52, 0x49, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x69, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x3D, 0x22, 0x24, 0x28, 0x67, 0x69, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x5E, 0x20, 0x2A, 0x7C, 0x7C, 0x27, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x64, 0x20, 0x27, 0x20, 0x27, 0x20, 0x2D, 0x66, 0x32, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x3D, 0x22, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x27, 0x2E, 0x67, 0x69, 0x74, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x27, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4C, 0x49, 0x53, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x7B, 0x66, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x22, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3B, 0x24, 0x47, 0x49, 0x54, 0x5F, 0x53, 0x55, 0x42, 0x4D, 0x4F, 0x44, 0x55, 0x4C, 0x45, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x7B, 0x66, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x69, 0x6E, 0x63, 0x73, 0x20, 0x5B, 0x3A, 0x73, 0x75, 0x62, 0x2D, 0x64, 0x69, 0x72, 0x5D, 0x20, 0x3C, 0x46, 0x49, 0x4C, 0x45, 0x3E, 0x2E, 0x2E, 0x2E, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x69, 0x6E, 0x63, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x58, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x2A, 0x29, 0x20, 0x58, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x3A, 0x7D, 0x22, 0x3B, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x2F, 0x24, 0x58, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x2F, 0x24, 0x58, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6C, 0x69, 0x62, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x2E, 0x61, 0x29, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x37, 0x35, 0x35, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x70, 0x63, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x70, 0x6B, 0x67, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x70, 0x6B, 0x67, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2F, 0x24, 0x31, 0x2E, 0x70, 0x63, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x70, 0x63, 0x66, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x70, 0x6B, 0x67, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x70, 0x6B, 0x67, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x62, 0x69, 0x6E, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x62, 0x69, 0x6E, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x37, 0x35, 0x35, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x62, 0x69, 0x6E, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x65, 0x74, 0x63, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x65, 0x74, 0x63, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x65, 0x74, 0x63, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6D, 0x61, 0x6E, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x3D, 0x22, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x23, 0x23, 0x2A, 0x2E, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x31, 0x2D, 0x38, 0x5D, 0x29, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x3A, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x6E, 0x70, 0x61, 0x67, 0x65, 0x2E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x6D, 0x61, 0x6E, 0x2F, 0x6D, 0x61, 0x6E, 0x24, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x6D, 0x61, 0x6E, 0x2F, 0x6D, 0x61, 0x6E, 0x24, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3C, 0x66, 0x69, 0x73, 0x68, 0x7C, 0x62, 0x61, 0x73, 0x68, 0x7C, 0x7A, 0x73, 0x68, 0x3E, 0x20, 0x3C, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x4E, 0x44, 0x3E, 0x20, 0x3C, 0x46, 0x49, 0x4C, 0x45, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x0A, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x73, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x62, 0x61, 0x73, 0x68, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x33, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x62, 0x61, 0x73, 0x68, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2F, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x73, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x66, 0x69, 0x73, 0x68, 0x2F, 0x76, 0x65, 0x6E, 0x64, 0x6F, 0x72, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x64, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x33, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x66, 0x69, 0x73, 0x68, 0x2F, 0x76, 0x65, 0x6E, 0x64, 0x6F, 0x72, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x64, 0x2F, 0x24, 0x32, 0x2E, 0x66, 0x69, 0x73, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7A, 0x73, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x7A, 0x73, 0x68, 0x2F, 0x73, 0x69, 0x74, 0x65, 0x2D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x6D, 0x20, 0x36, 0x34, 0x34, 0x20, 0x22, 0x24, 0x33, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x7A, 0x73, 0x68, 0x2F, 0x73, 0x69, 0x74, 0x65, 0x2D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2F, 0x5F, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x3A, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x7D, 0x7D, 0x7D, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x20, 0x7B, 0x7B, 0x7B, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x5F, 0x76, 0x32, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x74, 0x68, 0x65, 0x64, 0x6F, 0x63, 0x73, 0x2E, 0x69, 0x6F, 0x2F, 0x65, 0x6E, 0x2F, 0x33, 0x2E, 0x31, 0x34, 0x2F, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2D, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x2D, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x5F, 0x76, 0x32, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3D, 0x22, 0x24, 0x28, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x27, 0x2F, 0x5E, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3A, 0x20, 0x67, 0x68, 0x63, 0x2D, 0x2F, 0x70, 0x27, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3D, 0x22, 0x24, 0x7B, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x23, 0x27, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x3A, 0x20, 0x67, 0x68, 0x63, 0x2D, 0x27, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3D, 0x22, 0x24, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x47, 0x48, 0x43, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3D, 0x27, 0x39, 0x2E, 0x38, 0x2E, 0x32, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3D, 0x27, 0x33, 0x2E, 0x31, 0x34, 0x2E, 0x31, 0x2E, 0x31, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x4E, 0x4F, 0x4E, 0x49, 0x4E, 0x54, 0x45, 0x52, 0x41, 0x43, 0x54, 0x49, 0x56, 0x45, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x4E, 0x4F, 0x5F, 0x53, 0x54, 0x41, 0x43, 0x4B, 0x3D, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x48, 0x4C, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x58, 0x44, 0x47, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x44, 0x4F, 0x57, 0x4E, 0x4C, 0x4F, 0x41, 0x44, 0x45, 0x52, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x41, 0x44, 0x4A, 0x55, 0x53, 0x54, 0x5F, 0x42, 0x41, 0x53, 0x48, 0x52, 0x43, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x42, 0x4F, 0x4F, 0x54, 0x53, 0x54, 0x52, 0x41, 0x50, 0x5F, 0x48, 0x41, 0x53, 0x4B, 0x45, 0x4C, 0x4C, 0x5F, 0x4D, 0x49, 0x4E, 0x49, 0x4D, 0x41, 0x4C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x47, 0x48, 0x43, 0x55, 0x50, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x58, 0x44, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x20, 0x47, 0x48, 0x43, 0x55, 0x50, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x5F, 0x55, 0x52, 0x4C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x47, 0x48, 0x43, 0x55, 0x50, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x27, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x65, 0x74, 0x2D, 0x67, 0x68, 0x63, 0x75, 0x70, 0x2E, 0x68, 0x61, 0x73, 0x6B, 0x65, 0x6C, 0x6C, 0x2E, 0x6F, 0x72, 0x67, 0x27, 0x20, 0x2D, 0x6F, 0x20, 0x67, 0x68, 0x63, 0x75, 0x70, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x73, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x2F, 0x47, 0x48, 0x43, 0x55, 0x50, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3A, 0x3D, 0x2F, 0x64, 0x27, 0x20, 0x20, 0x67, 0x68, 0x63, 0x75, 0x70, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x73, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x73, 0x68, 0x20, 0x67, 0x68, 0x63, 0x75, 0x70, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x73, 0x68, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x4C, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x6C, 0x69, 0x62, 0x6E, 0x63, 0x75, 0x72, 0x73, 0x65, 0x73, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x3A, 0x24, 0x6C, 0x69, 0x62, 0x67, 0x6D, 0x70, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x47, 0x48, 0x43, 0x55, 0x50, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x42, 0x41, 0x53, 0x45, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x2F, 0x2E, 0x67, 0x68, 0x63, 0x75, 0x70, 0x2F, 0x62, 0x69, 0x6E, 0x3A, 0x24, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x45, 0x50, 0x5F, 0x50, 0x4B, 0x47, 0x5F, 0x52, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x45, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x2F, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x2C, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x2C, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x21, 0x20, 0x2D, 0x66, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x3A, 0x20, 0x2E, 0x2F, 0x2A, 0x2E, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x3E, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x0A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x2A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x2D, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x2D, 0x64, 0x69, 0x72, 0x73, 0x3A, 0x20, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x2D, 0x6C, 0x69, 0x62, 0x2D, 0x64, 0x69, 0x72, 0x73, 0x3A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x53, 0x0A, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x32, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x33, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x52, 0x49, 0x50, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x3D, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x29, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x63, 0x61, 0x62, 0x61, 0x6C, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x22, 0x20, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x22, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x41, 0x42, 0x41, 0x4C, 0x22, 0x20, 0x76, 0x32, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x22, 0x2D, 0x2D, 0x6A, 0x6F, 0x62, 0x73, 0x3D, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x2D, 0x2D, 0x6D, 0x61, 0x78, 0x2D, 0x62, 0x61, 0x63, 0x6B, 0x6A, 0x75, 0x6D, 0x70, 0x73, 0x3D, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x2D, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3D, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x22, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x64, 0x69, 0x72, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x62, 0x69, 0x6E, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x7D, 0x7D, 0x7D, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x20, 0x7B, 0x7B, 0x7B, 0x20, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x5F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x0A, 0x0A, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x5F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x6C, 0x69, 0x62, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x4E, 0x53, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x22, 0x24, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x45, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x2F, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x5F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x6C, 0x69, 0x62, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x4E, 0x53, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x22, 0x24, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x45, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x2F, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x5F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2F, 0x6E, 0x65, 0x74, 0x73, 0x75, 0x72, 0x66, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x7D, 0x7D, 0x7D, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x20, 0x7B, 0x7B, 0x7B, 0x20, 0x77, 0x61, 0x66, 0x0A, 0x0A, 0x77, 0x61, 0x66, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x50, 0x59, 0x54, 0x48, 0x4F, 0x4E, 0x33, 0x3D, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x70, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x33, 0x29, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x70, 0x79, 0x74, 0x68, 0x6F, 0x6E, 0x33, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x50, 0x59, 0x54, 0x48, 0x4F, 0x4E, 0x33, 0x22, 0x20, 0x2E, 0x2F, 0x77, 0x61, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x20, 0x24, 0x40, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x50, 0x59, 0x54, 0x48, 0x4F, 0x4E, 0x33, 0x22, 0x20, 0x2E, 0x2F, 0x77, 0x61, 0x66, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x50, 0x59, 0x54, 0x48, 0x4F, 0x4E, 0x33, 0x22, 0x20, 0x2E, 0x2F, 0x77, 0x61, 0x66, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x7D, 0x7D, 0x7D, 0x0A, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x23, 0x20, 0x7B, 0x7B, 0x7B, 0x20, 0x7A, 0x69, 0x67, 0x0A, 0x0A, 0x7A, 0x69, 0x67, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x7A, 0x69, 0x67, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x65, 0x2F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2D, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5A, 0x49, 0x47, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x27, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34, 0x2D, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5A, 0x49, 0x47, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x22, 0x2D, 0x44, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x24, 0x5A, 0x49, 0x47, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x3D, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x22, 0x20, 0x2D, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x4E, 0x4F, 0x52, 0x4D, 0x41, 0x4C, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x7A, 0x69, 0x67, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x22, 0x2D, 0x6A, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x4F, 0x4E, 0x4C, 0x59, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3D, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x4F, 0x4E, 0x4C, 0x59, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x46, 0x4F, 0x52, 0x43, 0x45, 0x5F, 0x55, 0x4E, 0x53, 0x41, 0x46, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x3D, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x63, 0x5F, 0x63, 0x76, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x5F, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x30, 0x5F, 0x6E, 0x6F, 0x6E, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x79, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x63, 0x5F, 0x63, 0x76, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x30, 0x5F, 0x6E, 0x6F, 0x6E, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x79, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x63, 0x5F, 0x63, 0x76, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x5F, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x30, 0x5F, 0x6E, 0x6F, 0x6E, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x79, 0x65, 0x73, 0x0A, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x5C, 0x6E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x74, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x74, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x27, 0x20, 0x3D, 0x20, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4F, 0x53, 0x5F, 0x49, 0x4F, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x3D, 0x27, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x69, 0x6F, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x3D, 0x27, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x64, 0x61, 0x72, 0x77, 0x69, 0x6E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4F, 0x53, 0x5F, 0x49, 0x4F, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x69, 0x6F, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x64, 0x61, 0x72, 0x77, 0x69, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x3D, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3D, 0x79, 0x65, 0x73, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x31, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x3D, 0x6E, 0x6F, 0x29, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x3D, 0x30, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3D, 0x27, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x27, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x52, 0x4F, 0x53, 0x53, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x49, 0x4E, 0x47, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x3D, 0x27, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x54, 0x52, 0x49, 0x50, 0x4C, 0x45, 0x27, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4E, 0x4C, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6E, 0x6C, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x70, 0x61, 0x74, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x22, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x45, 0x4E, 0x56, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x45, 0x4E, 0x56, 0x53, 0x20, 0x2D, 0x2D, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x70, 0x69, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x43, 0x3D, 0x27, 0x24, 0x43, 0x43, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x27, 0x24, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x58, 0x58, 0x3D, 0x27, 0x24, 0x43, 0x58, 0x58, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x27, 0x24, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x50, 0x50, 0x3D, 0x27, 0x24, 0x43, 0x50, 0x50, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x27, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x27, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x52, 0x3D, 0x27, 0x24, 0x41, 0x52, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x41, 0x4E, 0x4C, 0x49, 0x42, 0x3D, 0x27, 0x24, 0x52, 0x41, 0x4E, 0x4C, 0x49, 0x42, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x3D, 0x27, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x27, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4C, 0x49, 0x42, 0x44, 0x49, 0x52, 0x3D, 0x27, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4C, 0x49, 0x42, 0x44, 0x49, 0x52, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x43, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x3D, 0x27, 0x24, 0x43, 0x43, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x27, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x52, 0x4F, 0x53, 0x53, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x49, 0x4E, 0x47, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x73, 0x2F, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x3D, 0x6E, 0x6F, 0x2F, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x3D, 0x79, 0x65, 0x73, 0x2F, 0x67, 0x27, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x20, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x24, 0x40, 0x20, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x45, 0x4E, 0x56, 0x53, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x63, 0x68, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x64, 0x6F, 0x63, 0x73, 0x2E, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x65, 0x6E, 0x2F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x2D, 0x77, 0x6F, 0x72, 0x6B, 0x66, 0x6C, 0x6F, 0x77, 0x73, 0x2F, 0x63, 0x68, 0x6F, 0x6F, 0x73, 0x69, 0x6E, 0x67, 0x2D, 0x77, 0x68, 0x61, 0x74, 0x2D, 0x79, 0x6F, 0x75, 0x72, 0x2D, 0x77, 0x6F, 0x72, 0x6B, 0x66, 0x6C, 0x6F, 0x77, 0x2D, 0x64, 0x6F, 0x65, 0x73, 0x2F, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x69, 0x6E, 0x2D, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x23, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2D, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2D, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x47, 0x49, 0x54, 0x48, 0x55, 0x42, 0x5F, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x74, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x74, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x6C, 0x6F, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x47, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x73, 0x7C, 0x5C, 0x74, 0x40, 0x7C, 0x5C, 0x74, 0x7C, 0x67, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x73, 0x7C, 0x40, 0x65, 0x63, 0x68, 0x6F, 0x7C, 0x65, 0x63, 0x68, 0x6F, 0x7C, 0x67, 0x27, 0x20, 0x22, 0x24, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x5F, 0x4F, 0x4E, 0x4C, 0x59, 0x22, 0x20, 0x21, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x47, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x47, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x56, 0x3D, 0x31, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x2D, 0x6A, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x20, 0x2D, 0x77, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4E, 0x49, 0x4E, 0x4A, 0x41, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x2D, 0x6A, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x20, 0x5B, 0x32, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 0x3D, 0x3C, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x2D, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x3D, 0x3C, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x2D, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x3E, 0x5D, 0x20, 0x5B, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5D, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x53, 0x45, 0x50, 0x41, 0x52, 0x41, 0x54, 0x45, 0x4C, 0x59, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3D, 0x20, 0x32, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x53, 0x45, 0x50, 0x41, 0x52, 0x41, 0x54, 0x45, 0x4C, 0x59, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x53, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3B, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x42, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3B, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 0x3D, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x49, 0x46, 0x53, 0x3D, 0x27, 0x2C, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x49, 0x46, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x3D, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x3D, 0x22, 0x24, 0x7B, 0x31, 0x23, 0x2A, 0x3D, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x49, 0x46, 0x53, 0x3D, 0x27, 0x2C, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x49, 0x46, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x53, 0x45, 0x50, 0x41, 0x52, 0x41, 0x54, 0x45, 0x4C, 0x59, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x49, 0x4E, 0x4A, 0x41, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x47, 0x45, 0x4E, 0x45, 0x52, 0x41, 0x54, 0x4F, 0x52, 0x3D, 0x27, 0x4E, 0x69, 0x6E, 0x6A, 0x61, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x47, 0x45, 0x4E, 0x45, 0x52, 0x41, 0x54, 0x4F, 0x52, 0x3D, 0x27, 0x55, 0x6E, 0x69, 0x78, 0x20, 0x4D, 0x61, 0x6B, 0x65, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x3D, 0x22, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x29, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x57, 0x6E, 0x6F, 0x2D, 0x64, 0x65, 0x76, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x47, 0x20, 0x22, 0x27, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x47, 0x45, 0x4E, 0x45, 0x52, 0x41, 0x54, 0x4F, 0x52, 0x27, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x53, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x42, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x52, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x3D, 0x4F, 0x46, 0x46, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x45, 0x53, 0x54, 0x49, 0x4E, 0x47, 0x3D, 0x4F, 0x46, 0x46, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x2D, 0x20, 0x22, 0x2D, 0x6A, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x3D, 0x41, 0x4C, 0x57, 0x41, 0x59, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x3D, 0x41, 0x4C, 0x57, 0x41, 0x59, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x4E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x46, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x44, 0x65, 0x62, 0x75, 0x67, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x52, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x45, 0x50, 0x5F, 0x50, 0x4B, 0x47, 0x5F, 0x52, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3B, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x45, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x2F, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x74, 0x6F, 0x6F, 0x6C, 0x63, 0x68, 0x61, 0x69, 0x6E, 0x2E, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x20, 0x20, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x50, 0x52, 0x4F, 0x43, 0x45, 0x53, 0x53, 0x4F, 0x52, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x52, 0x4F, 0x53, 0x53, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x49, 0x4E, 0x47, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x6D, 0x61, 0x6E, 0x75, 0x61, 0x6C, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x74, 0x6F, 0x6F, 0x6C, 0x63, 0x68, 0x61, 0x69, 0x6E, 0x73, 0x2E, 0x37, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x23, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x2D, 0x66, 0x6F, 0x72, 0x2D, 0x69, 0x6F, 0x73, 0x2D, 0x74, 0x76, 0x6F, 0x73, 0x2D, 0x6F, 0x72, 0x2D, 0x77, 0x61, 0x74, 0x63, 0x68, 0x6F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x7C, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x69, 0x4F, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x7C, 0x57, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x77, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x4F, 0x53, 0x7C, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x74, 0x76, 0x4F, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x44, 0x61, 0x72, 0x77, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x3E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x29, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x3E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x0A, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x20, 0x22, 0x43, 0x4D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x3A, 0x20, 0x5C, 0x24, 0x7B, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x4E, 0x44, 0x7D, 0x22, 0x29, 0x0A, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x20, 0x22, 0x43, 0x4D, 0x61, 0x6B, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x5C, 0x24, 0x7B, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x7D, 0x22, 0x29, 0x0A, 0x0A, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x20, 0x22, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3A, 0x20, 0x5C, 0x24, 0x7B, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x7D, 0x22, 0x29, 0x0A, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x20, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3A, 0x20, 0x5C, 0x24, 0x7B, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x7D, 0x22, 0x29, 0x0A, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x22, 0x5C, 0x24, 0x7B, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x7D, 0x22, 0x20, 0x53, 0x54, 0x52, 0x45, 0x51, 0x55, 0x41, 0x4C, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x28, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x20, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x28, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x20, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x52, 0x20, 0x22, 0x24, 0x43, 0x43, 0x22, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x22, 0x24, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x58, 0x58, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x52, 0x20, 0x22, 0x24, 0x43, 0x58, 0x58, 0x22, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x58, 0x58, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x22, 0x24, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x41, 0x53, 0x4D, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x52, 0x20, 0x22, 0x24, 0x43, 0x43, 0x22, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x41, 0x53, 0x4D, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x52, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x52, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x22, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x45, 0x58, 0x45, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x52, 0x5F, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x41, 0x52, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x41, 0x52, 0x22, 0x29, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x52, 0x41, 0x4E, 0x4C, 0x49, 0x42, 0x20, 0x22, 0x24, 0x52, 0x41, 0x4E, 0x4C, 0x49, 0x42, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x52, 0x20, 0x22, 0x24, 0x4C, 0x44, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4E, 0x4D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x4E, 0x4D, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x53, 0x54, 0x52, 0x49, 0x50, 0x20, 0x20, 0x22, 0x24, 0x53, 0x54, 0x52, 0x49, 0x50, 0x22, 0x29, 0x0A, 0x0A, 0x23, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4F, 0x53, 0x58, 0x5F, 0x53, 0x59, 0x53, 0x52, 0x4F, 0x4F, 0x54, 0x20, 0x22, 0x24, 0x53, 0x59, 0x53, 0x52, 0x4F, 0x4F, 0x54, 0x22, 0x29, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4F, 0x53, 0x58, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x53, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4F, 0x53, 0x58, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x49, 0x54, 0x45, 0x43, 0x54, 0x55, 0x52, 0x45, 0x53, 0x20, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x20, 0x43, 0x41, 0x43, 0x48, 0x45, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x47, 0x52, 0x41, 0x4D, 0x20, 0x4E, 0x45, 0x56, 0x45, 0x52, 0x29, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2F, 0x33, 0x36, 0x35, 0x32, 0x33, 0x39, 0x31, 0x31, 0x2F, 0x6F, 0x73, 0x78, 0x2D, 0x68, 0x6F, 0x6D, 0x65, 0x62, 0x72, 0x65, 0x77, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x6C, 0x69, 0x62, 0x70, 0x6E, 0x67, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2D, 0x6D, 0x69, 0x73, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2D, 0x69, 0x73, 0x73, 0x75, 0x65, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x57, 0x4F, 0x52, 0x4B, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x57, 0x4F, 0x52, 0x4B, 0x20, 0x4C, 0x41, 0x53, 0x54, 0x29, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4D, 0x41, 0x43, 0x4F, 0x53, 0x58, 0x5F, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x4B, 0x69, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2F, 0x43, 0x4D, 0x61, 0x6B, 0x65, 0x2F, 0x62, 0x6C, 0x6F, 0x62, 0x2F, 0x6D, 0x61, 0x73, 0x74, 0x65, 0x72, 0x2F, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x50, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2F, 0x44, 0x61, 0x72, 0x77, 0x69, 0x6E, 0x2E, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x4E, 0x4F, 0x54, 0x20, 0x44, 0x45, 0x46, 0x49, 0x4E, 0x45, 0x44, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4D, 0x41, 0x43, 0x4F, 0x53, 0x58, 0x5F, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x4D, 0x41, 0x43, 0x4F, 0x53, 0x58, 0x5F, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x20, 0x4F, 0x46, 0x46, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x28, 0x29, 0x0A, 0x0A, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x29, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x62, 0x61, 0x74, 0x20, 0x2D, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x2D, 0x2D, 0x70, 0x61, 0x67, 0x69, 0x6E, 0x67, 0x3D, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x2D, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x5F, 0x4D, 0x4F, 0x53, 0x54, 0x4C, 0x59, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x41, 0x4C, 0x4C, 0x59, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x44, 0x5F, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x2D, 0x61, 0x66, 0x74, 0x65, 0x72, 0x2E, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x2F, 0x68, 0x65, 0x6C, 0x70, 0x2F, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2F, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x53, 0x55, 0x46, 0x46, 0x49, 0x58, 0x45, 0x53, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x53, 0x55, 0x46, 0x46, 0x49, 0x58, 0x45, 0x53, 0x20, 0x22, 0x2E, 0x61, 0x22, 0x20, 0x22, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x29, 0x5C, 0x6E, 0x27, 0x20, 0x3E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x62, 0x61, 0x74, 0x20, 0x2D, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x2D, 0x2D, 0x70, 0x61, 0x67, 0x69, 0x6E, 0x67, 0x3D, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x2D, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x43, 0x4D, 0x61, 0x6B, 0x65, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x74, 0x78, 0x74, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6D, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x43, 0x4D, 0x61, 0x6B, 0x65, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x74, 0x78, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x5F, 0x49, 0x53, 0x5F, 0x53, 0x50, 0x45, 0x43, 0x49, 0x46, 0x49, 0x45, 0x44, 0x3D, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x4F, 0x50, 0x54, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x4F, 0x50, 0x54, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x3D, 0x2A, 0x29, 0x20, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x53, 0x5F, 0x49, 0x53, 0x5F, 0x53, 0x50, 0x45, 0x43, 0x49, 0x46, 0x49, 0x45, 0x44, 0x3D, 0x31, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x3D, 0x22, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x3D, 0x27, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x52, 0x4F, 0x4A, 0x45, 0x43, 0x54, 0x5F, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x45, 0x27, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x3D, 0x22, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x29, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x57, 0x6E, 0x6F, 0x2D, 0x64, 0x65, 0x76, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x53, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x42, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x45, 0x53, 0x54, 0x49, 0x4E, 0x47, 0x3D, 0x4F, 0x46, 0x46, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x4F, 0x4E, 0x45, 0x4E, 0x54, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x20, 0x22, 0x24, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x43, 0x4C, 0x45, 0x41, 0x4E, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x76, 0x44, 0x3D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x63, 0x7C, 0x2D, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x29, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x43, 0x4C, 0x45, 0x41, 0x4E, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6D, 0x7C, 0x2D, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x3D, 0x2A, 0x29, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x76, 0x44, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x76, 0x44, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x76, 0x44, 0x22, 0x20, 0x5D, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x44, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x43, 0x4C, 0x45, 0x41, 0x4E, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x22, 0x2D, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x3D, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x3D, 0x22, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x29, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x22, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x69, 0x72, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x22, 0x2D, 0x2D, 0x6A, 0x6F, 0x62, 0x73, 0x3D, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x6F, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x3D, 0x22, 0x24, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x73, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x7C, 0x20, 0x74, 0x72, 0x20, 0x27, 0x41, 0x2D, 0x5A, 0x27, 0x20, 0x27, 0x61, 0x2D, 0x7A, 0x27, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x7C, 0x6F, 0x73, 0x7C, 0x27, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x64, 0x65, 0x76, 0x3D, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x27, 0x2D, 0x76, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x22, 0x2D, 0x2D, 0x61, 0x73, 0x3D, 0x24, 0x43, 0x43, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x6C, 0x64, 0x3D, 0x24, 0x43, 0x43, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x63, 0x63, 0x3D, 0x24, 0x43, 0x43, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x63, 0x78, 0x78, 0x3D, 0x24, 0x43, 0x58, 0x58, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x27, 0x24, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x63, 0x78, 0x78, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x27, 0x24, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x27, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x73, 0x68, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3D, 0x27, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x64, 0x69, 0x72, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x61, 0x72, 0x63, 0x68, 0x3D, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x70, 0x6C, 0x61, 0x74, 0x3D, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5F, 0x6D, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x3D, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x22, 0x2D, 0x2D, 0x6A, 0x6F, 0x62, 0x73, 0x3D, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x22, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x24, 0x58, 0x4D, 0x41, 0x4B, 0x45, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x6F, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x43, 0x72, 0x6F, 0x73, 0x73, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x6D, 0x76, 0x37, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x46, 0x41, 0x4D, 0x49, 0x4C, 0x59, 0x3D, 0x27, 0x61, 0x72, 0x6D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x2A, 0x7C, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x46, 0x41, 0x4D, 0x49, 0x4C, 0x59, 0x3D, 0x27, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x27, 0x61, 0x72, 0x6D, 0x76, 0x38, 0x61, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x33, 0x38, 0x36, 0x7C, 0x69, 0x36, 0x38, 0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x46, 0x41, 0x4D, 0x49, 0x4C, 0x59, 0x3D, 0x27, 0x78, 0x38, 0x36, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x46, 0x41, 0x4D, 0x49, 0x4C, 0x59, 0x3D, 0x27, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x69, 0x6E, 0x69, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x5B, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x69, 0x65, 0x73, 0x5D, 0x0A, 0x63, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x43, 0x43, 0x27, 0x0A, 0x63, 0x70, 0x70, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x43, 0x58, 0x58, 0x27, 0x0A, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x41, 0x52, 0x27, 0x0A, 0x73, 0x74, 0x72, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x53, 0x54, 0x52, 0x49, 0x50, 0x27, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x27, 0x0A, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x27, 0x0A, 0x0A, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x4D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x23, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x69, 0x6E, 0x2D, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x5B, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x2D, 0x69, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5D, 0x0A, 0x63, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x74, 0x6F, 0x5F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x24, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x29, 0x0A, 0x63, 0x5F, 0x6C, 0x69, 0x6E, 0x6B, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x74, 0x6F, 0x5F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x29, 0x0A, 0x63, 0x70, 0x70, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x74, 0x6F, 0x5F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x24, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x29, 0x0A, 0x63, 0x70, 0x70, 0x5F, 0x6C, 0x69, 0x6E, 0x6B, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x74, 0x6F, 0x5F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x24, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x29, 0x0A, 0x0A, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5D, 0x0A, 0x73, 0x79, 0x73, 0x5F, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x3D, 0x20, 0x27, 0x27, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x3E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x63, 0x68, 0x61, 0x69, 0x6E, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x27, 0x24, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x54, 0x4F, 0x4F, 0x4C, 0x43, 0x48, 0x41, 0x49, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x27, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x52, 0x4F, 0x53, 0x53, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x49, 0x4E, 0x47, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3E, 0x3E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x5B, 0x68, 0x6F, 0x73, 0x74, 0x5F, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x5D, 0x0A, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x27, 0x64, 0x61, 0x72, 0x77, 0x69, 0x6E, 0x27, 0x0A, 0x65, 0x6E, 0x64, 0x69, 0x61, 0x6E, 0x20, 0x3D, 0x20, 0x27, 0x6C, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x27, 0x0A, 0x63, 0x70, 0x75, 0x5F, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x46, 0x41, 0x4D, 0x49, 0x4C, 0x59, 0x27, 0x0A, 0x63, 0x70, 0x75, 0x20, 0x3D, 0x20, 0x27, 0x24, 0x48, 0x4F, 0x53, 0x54, 0x5F, 0x4D, 0x41, 0x43, 0x48, 0x49, 0x4E, 0x45, 0x5F, 0x43, 0x50, 0x55, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x27, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x22, 0x2D, 0x2D, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x22, 0x2D, 0x2D, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x5F, 0x4D, 0x4F, 0x53, 0x54, 0x4C, 0x59, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x41, 0x4C, 0x4C, 0x59, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x44, 0x5F, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x27, 0x2D, 0x76, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x3D, 0x22, 0x24, 0x28, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x76, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x29, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x22, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20, 0x22, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x6E, 0x64, 0x3D, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x22, 0x2D, 0x2D, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3D, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x2D, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3D, 0x24, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x22, 0x20, 0x2D, 0x44, 0x6C, 0x69, 0x62, 0x64, 0x69, 0x72, 0x3D, 0x6C, 0x69, 0x62, 0x20, 0x2D, 0x44, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x3D, 0x62, 0x6F, 0x74, 0x68, 0x20, 0x22, 0x24, 0x40, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x22, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x2D, 0x43, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x6A, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x49, 0x4C, 0x45, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x22, 0x20, 0x26, 0x26, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x24, 0x4D, 0x45, 0x53, 0x4F, 0x4E, 0x22, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x43, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x7D, 0x0A, 0x0A, 0x74, 0x6F, 0x5F, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x3D, 0x22, 0x5B, 0x27, 0x27, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x3D, 0x22, 0x24, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x2C, 0x20, 0x27, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x27, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x3D, 0x22, 0x24, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x5D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x73, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x22, 0x0A, 0x7D, 0x0A, 0x0A, 0x73, 0x77, 0x69, 0x66, 0x74, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x78, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x69, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x69, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x2D, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x76, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x76, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x2D, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x77, 0x61, 0x74, 0x63, 0x68, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x77, 0x61, 0x74, 0x63, 0x68, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x2D, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x52, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x78, 0x72, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x52, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x22, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2D, 0x78, 0x72, 0x6F, 0x73, 0x24, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x5F, 0x56, 0x45, 0x52, 0x53, 0x2D, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4B, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x27, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4B, 0x69, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x77, 0x69, 0x66, 0x74, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x53, 0x57, 0x49, 0x46, 0x54, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x2D, 0x76, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x73, 0x77, 0x69, 0x66, 0x74, 0x20, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x73, 0x77, 0x69, 0x66, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x2D, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x73, 0x61, 0x6E, 0x64, 0x62, 0x6F, 0x78, 0x20, 0x2D, 0x58, 0x73, 0x77, 0x69, 0x66, 0x74, 0x63, 0x20, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x2D, 0x58, 0x73, 0x77, 0x69, 0x66, 0x74, 0x63, 0x20, 0x22, 0x24, 0x53, 0x57, 0x49, 0x46, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x20, 0x2D, 0x6A, 0x20, 0x22, 0x24, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x4E, 0x4A, 0x4F, 0x42, 0x53, 0x22, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2F, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x28, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x26, 0x26, 0x20, 0x6C, 0x73, 0x20, 0x2D, 0x64, 0x20, 0x2A, 0x2E, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x25, 0x2E, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x62, 0x69, 0x6E, 0x73, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x61, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x43, 0x49, 0x22, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x72, 0x75, 0x73, 0x74, 0x75, 0x70, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x72, 0x75, 0x73, 0x74, 0x75, 0x70, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x72, 0x75, 0x73, 0x74, 0x75, 0x70, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x61, 0x64, 0x64, 0x20, 0x22, 0x24, 0x52, 0x55, 0x53, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x64, 0x6F, 0x63, 0x2E, 0x72, 0x75, 0x73, 0x74, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x64, 0x6F, 0x63, 0x2E, 0x72, 0x75, 0x73, 0x74, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2D, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x76, 0x76, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x24, 0x52, 0x55, 0x53, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x26, 0x26, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x64, 0x6F, 0x63, 0x2E, 0x72, 0x75, 0x73, 0x74, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x64, 0x6F, 0x63, 0x2E, 0x72, 0x75, 0x73, 0x74, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2F, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x6F, 0x6F, 0x74, 0x29, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x76, 0x76, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x24, 0x52, 0x55, 0x53, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x72, 0x6F, 0x6F, 0x74, 0x3D, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x26, 0x26, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x7C, 0x63, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x51, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x61, 0x72, 0x67, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x71, 0x7C, 0x2D, 0x2D, 0x71, 0x75, 0x69, 0x65, 0x74, 0x29, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x51, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x76, 0x7C, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x29, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x76, 0x76, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3D, 0x27, 0x73, 0x65, 0x74, 0x27, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x51, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x51, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x56, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x52, 0x45, 0x4C, 0x45, 0x41, 0x53, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x24, 0x52, 0x55, 0x53, 0x54, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x5F, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x24, 0x43, 0x41, 0x52, 0x47, 0x4F, 0x5F, 0x43, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x22, 0x24, 0x40, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x7D, 0x0A, 0x0A, 0x67, 0x6F, 0x77, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x22, 0x67, 0x6F, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x7C, 0x20, 0x62, 0x61, 0x74, 0x20, 0x2D, 0x2D, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3D, 0x62, 0x61, 0x73, 0x68, 0x20, 0x2D, 0x2D, 0x70, 0x61, 0x67, 0x69, 0x6E, 0x67, 0x3D, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x2D, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x70, 0x6B, 0x67, 0x2E, 0x67, 0x6F, 0x2E, 0x64, 0x65, 0x76, 0x2F, 0x63, 0x6D, 0x64, 0x2F, 0x67, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x70, 0x6B, 0x67, 0x2E, 0x67, 0x6F, 0x2E, 0x64, 0x65, 0x76, 0x2F, 0x63, 0x6D, 0x64, 0x2F, 0x6C, 0x69, 0x6E, 0x6B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x56, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x58, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4D, 0x4F, 0x44, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x54, 0x41, 0x47, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x76, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3B, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x56, 0x3D, 0x27, 0x2D, 0x76, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x78, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3B, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x58, 0x3D, 0x27, 0x2D, 0x78, 0x27, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6F, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3B, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4F, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3B, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x58, 0x29, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x2D, 0x58, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x2D, 0x58, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x31, 0x20, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x20, 0x24, 0x31, 0x22, 0x20, 0x3B, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x27, 0x2D, 0x74, 0x72, 0x69, 0x6D, 0x70, 0x61, 0x74, 0x68, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x56, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x76, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x58, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x47, 0x4F, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x78, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x78, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x52, 0x4F, 0x46, 0x49, 0x4C, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x2D, 0x73, 0x20, 0x2D, 0x77, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x27, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x27, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4F, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x6F, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x2D, 0x6F, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x56, 0x5F, 0x4F, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x20, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x5F, 0x45, 0x58, 0x54, 0x52, 0x41, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x3D, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x24, 0x47, 0x4F, 0x5F, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x41, 0x52, 0x47, 0x53, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x28, 0x6C, 0x73, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x2E, 0x61, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x29, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x62, 0x69, 0x6E, 0x73, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x5F, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x4F, 0x50, 0x41, 0x54, 0x43, 0x48, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x64, 0x6F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x57, 0x44, 0x22, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x57, 0x44, 0x22, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4D, 0x41, 0x53, 0x54, 0x45, 0x52, 0x3D, 0x22, 0x24, 0x7B, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x25, 0x25, 0x20, 0x2A, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x4D, 0x41, 0x53, 0x54, 0x45, 0x52, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x67, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x4E, 0x4F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x3D, 0x79, 0x65, 0x73, 0x20, 0x2E, 0x2F, 0x61, 0x75, 0x74, 0x6F, 0x67, 0x65, 0x6E, 0x2E, 0x73, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x74, 0x6F, 0x6F, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x72, 0x65, 0x63, 0x6F, 0x6E, 0x66, 0x20, 0x2D, 0x69, 0x76, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x41, 0x55, 0x54, 0x4F, 0x47, 0x45, 0x4E, 0x53, 0x48, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x41, 0x55, 0x54, 0x4F, 0x54, 0x4F, 0x4F, 0x4C, 0x53, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x55, 0x53, 0x45, 0x5F, 0x42, 0x53, 0x59, 0x53, 0x54, 0x45, 0x4D, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x55, 0x52, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x7B, 0x73, 0x75, 0x62, 0x2C, 0x67, 0x75, 0x65, 0x73, 0x73, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x75, 0x62, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x78, 0x65, 0x63, 0x20, 0x63, 0x70, 0x20, 0x2D, 0x76, 0x66, 0x20, 0x22, 0x24, 0x53, 0x45, 0x53, 0x53, 0x49, 0x4F, 0x4E, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x73, 0x75, 0x62, 0x22, 0x20, 0x20, 0x20, 0x7B, 0x7D, 0x20, 0x5C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x67, 0x75, 0x65, 0x73, 0x73, 0x20, 0x2D, 0x65, 0x78, 0x65, 0x63, 0x20, 0x63, 0x70, 0x20, 0x2D, 0x76, 0x66, 0x20, 0x22, 0x24, 0x53, 0x45, 0x53, 0x53, 0x49, 0x4F, 0x4E, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x67, 0x75, 0x65, 0x73, 0x73, 0x22, 0x20, 0x7B, 0x7D, 0x20, 0x5C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x50, 0x52, 0x45, 0x50, 0x41, 0x52, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x57, 0x44, 0x22, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x2D, 0x4C, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x57, 0x4F, 0x52, 0x4B, 0x49, 0x4E, 0x47, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x45, 0x50, 0x5F, 0x4C, 0x49, 0x42, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6C, 0x2A, 0x29, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x3D, 0x22, 0x24, 0x28, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x2D, 0x2D, 0x6C, 0x69, 0x62, 0x73, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x2D, 0x6C, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x29, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x3D, 0x22, 0x24, 0x28, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x2D, 0x2D, 0x6C, 0x69, 0x62, 0x73, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x2D, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x29, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x3D, 0x22, 0x24, 0x41, 0x20, 0x24, 0x42, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x5F, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x20, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x49, 0x4E, 0x42, 0x53, 0x54, 0x44, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x72, 0x6D, 0x20, 0x2D, 0x72, 0x66, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x44, 0x55, 0x4D, 0x50, 0x5F, 0x45, 0x4E, 0x56, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x5C, 0x6E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x20, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x28, 0x6C, 0x73, 0x29, 0x22, 0x20, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x4F, 0x54, 0x57, 0x45, 0x41, 0x4B, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x64, 0x6F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x5F, 0x70, 0x63, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x64, 0x6F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6D, 0x61, 0x63, 0x68, 0x5F, 0x6F, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x22, 0x73, 0x65, 0x74, 0x20, 0x72, 0x70, 0x61, 0x74, 0x68, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4B, 0x56, 0x73, 0x3D, 0x22, 0x24, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x73, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x7C, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x20, 0x7C, 0x20, 0x75, 0x6E, 0x69, 0x71, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x4B, 0x56, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x4B, 0x56, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4B, 0x3D, 0x22, 0x24, 0x7B, 0x4B, 0x56, 0x25, 0x7C, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x3D, 0x22, 0x24, 0x7B, 0x4B, 0x56, 0x23, 0x2A, 0x7C, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x56, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x56, 0x3D, 0x27, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2F, 0x6C, 0x69, 0x62, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x28, 0x72, 0x65, 0x61, 0x6C, 0x70, 0x61, 0x74, 0x68, 0x20, 0x2D, 0x6D, 0x20, 0x2D, 0x2D, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x74, 0x6F, 0x3D, 0x22, 0x24, 0x7B, 0x4B, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x20, 0x22, 0x24, 0x56, 0x22, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x61, 0x64, 0x64, 0x5F, 0x72, 0x70, 0x61, 0x74, 0x68, 0x20, 0x22, 0x40, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x24, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x4B, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6D, 0x61, 0x63, 0x68, 0x5F, 0x6F, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x64, 0x20, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x20, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x74, 0x6D, 0x70, 0x2F, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x74, 0x78, 0x74, 0x20, 0x2D, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x50, 0x5C, 0x6E, 0x27, 0x20, 0x3E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x74, 0x78, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x2D, 0x72, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x48, 0x45, 0x41, 0x44, 0x3D, 0x22, 0x24, 0x28, 0x68, 0x65, 0x78, 0x64, 0x75, 0x6D, 0x70, 0x20, 0x2D, 0x6E, 0x20, 0x31, 0x36, 0x20, 0x2D, 0x76, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x31, 0x2F, 0x31, 0x20, 0x22, 0x25, 0x30, 0x32, 0x58, 0x22, 0x20, 0x22, 0x22, 0x27, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x30, 0x20, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x31, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x32, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x61, 0x69, 0x64, 0x61, 0x6E, 0x73, 0x74, 0x65, 0x65, 0x6C, 0x65, 0x2F, 0x6F, 0x73, 0x78, 0x2D, 0x61, 0x62, 0x69, 0x2D, 0x6D, 0x61, 0x63, 0x68, 0x6F, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2D, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x48, 0x45, 0x41, 0x44, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x43, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x43, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x43, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x37, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x37, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x46, 0x41, 0x45, 0x44, 0x46, 0x45, 0x30, 0x37, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x3D, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x23, 0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x48, 0x45, 0x41, 0x44, 0x3A, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x3D, 0x24, 0x28, 0x6F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x6C, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x4C, 0x43, 0x5F, 0x49, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x20, 0x2D, 0x41, 0x32, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x5E, 0x5B, 0x5B, 0x3A, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3A, 0x5D, 0x5D, 0x2A, 0x7C, 0x7C, 0x27, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x64, 0x20, 0x27, 0x20, 0x27, 0x20, 0x2D, 0x66, 0x32, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x55, 0x4E, 0x50, 0x41, 0x54, 0x48, 0x73, 0x3D, 0x24, 0x28, 0x6F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x6C, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x4C, 0x43, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x41, 0x32, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x5E, 0x5B, 0x5B, 0x3A, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3A, 0x5D, 0x5D, 0x2A, 0x7C, 0x7C, 0x27, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x64, 0x20, 0x27, 0x20, 0x27, 0x20, 0x2D, 0x66, 0x32, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x22, 0x20, 0x2D, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x20, 0x3D, 0x20, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x20, 0x3D, 0x20, 0x24, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x0A, 0x52, 0x55, 0x4E, 0x50, 0x41, 0x54, 0x48, 0x73, 0x20, 0x3D, 0x20, 0x24, 0x52, 0x55, 0x4E, 0x50, 0x41, 0x54, 0x48, 0x73, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27, 0x29, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x2A, 0x29, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x4C, 0x43, 0x5F, 0x49, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x28, 0x24, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x69, 0x64, 0x20, 0x22, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x24, 0x7B, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x5F, 0x49, 0x44, 0x23, 0x23, 0x2A, 0x2F, 0x7D, 0x22, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x52, 0x50, 0x41, 0x54, 0x48, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x52, 0x55, 0x4E, 0x50, 0x41, 0x54, 0x48, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x52, 0x50, 0x41, 0x54, 0x48, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x4C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2F, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x29, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 0x72, 0x70, 0x61, 0x74, 0x68, 0x20, 0x22, 0x24, 0x52, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x59, 0x50, 0x45, 0x22, 0x20, 0x3D, 0x20, 0x32, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x61, 0x64, 0x64, 0x5F, 0x72, 0x70, 0x61, 0x74, 0x68, 0x20, 0x27, 0x40, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x27, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x3C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x74, 0x78, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x74, 0x78, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6D, 0x20, 0x2D, 0x72, 0x66, 0x20, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x74, 0x6D, 0x70, 0x2F, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x5F, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x3C, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x0A, 0x20, 0x20, 0x5F, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x6C, 0x69, 0x62, 0x2F, 0x24, 0x31, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2D, 0x4C, 0x20, 0x6C, 0x69, 0x62, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x2D, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x2D, 0x71, 0x75, 0x69, 0x74, 0x29, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x44, 0x45, 0x50, 0x5F, 0x50, 0x4B, 0x47, 0x5F, 0x52, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x45, 0x44, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x2F, 0x24, 0x44, 0x45, 0x50, 0x45, 0x4E, 0x44, 0x45, 0x4E, 0x54, 0x5F, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x2F, 0x6C, 0x69, 0x62, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x31, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x2D, 0x4C, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x52, 0x4F, 0x4F, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x2D, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x2D, 0x71, 0x75, 0x69, 0x74, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x3C, 0x4D, 0x41, 0x43, 0x48, 0x2D, 0x4F, 0x2D, 0x46, 0x49, 0x4C, 0x45, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x3C, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x2D, 0x42, 0x59, 0x2D, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x3E, 0x0A, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x58, 0x3D, 0x22, 0x24, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x27, 0x25, 0x73, 0x5C, 0x6E, 0x27, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x7C, 0x20, 0x74, 0x72, 0x20, 0x2F, 0x20, 0x5F, 0x29, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x59, 0x3D, 0x22, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x74, 0x6D, 0x70, 0x2F, 0x24, 0x58, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x59, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x22, 0x24, 0x59, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x24, 0x31, 0x20, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x53, 0x3D, 0x24, 0x28, 0x6F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x6C, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x4C, 0x43, 0x5F, 0x4C, 0x4F, 0x41, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x20, 0x2D, 0x41, 0x32, 0x20, 0x7C, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x5E, 0x5B, 0x5B, 0x3A, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3A, 0x5D, 0x5D, 0x2A, 0x7C, 0x7C, 0x27, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x64, 0x20, 0x27, 0x20, 0x27, 0x20, 0x2D, 0x66, 0x32, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x53, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x6E, 0x6F, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x22, 0x20, 0x2D, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4C, 0x4F, 0x47, 0x5F, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x74, 0x20, 0x3C, 0x3C, 0x45, 0x4F, 0x46, 0x0A, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x20, 0x3D, 0x20, 0x24, 0x31, 0x0A, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x53, 0x20, 0x20, 0x3D, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x53, 0x0A, 0x45, 0x4F, 0x46, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x44, 0x59, 0x4C, 0x49, 0x42, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6C, 0x69, 0x62, 0x2A, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x73, 0x77, 0x69, 0x66, 0x74, 0x2F, 0x6C, 0x69, 0x62, 0x2A, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x4C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2F, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2F, 0x4C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2F, 0x50, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x73, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x23, 0x23, 0x2A, 0x2F, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x20, 0x22, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x44, 0x49, 0x52, 0x23, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x24, 0x52, 0x45, 0x4C, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x50, 0x41, 0x54, 0x48, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x23, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x7D, 0x22, 0x20, 0x22, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x23, 0x23, 0x2A, 0x2F, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x20, 0x22, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x20, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x3D, 0x22, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x21, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x46, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x70, 0x20, 0x2D, 0x4C, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x20, 0x22, 0x24, 0x46, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x62, 0x2A, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x20, 0x22, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x20, 0x22, 0x24, 0x31, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x3D, 0x22, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x21, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x46, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x70, 0x20, 0x2D, 0x4C, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x46, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x69, 0x62, 0x63, 0x6C, 0x61, 0x6E, 0x67, 0x5F, 0x72, 0x74, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x72, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x3D, 0x22, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x23, 0x2A, 0x2F, 0x7D, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x3D, 0x22, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x2F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x21, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x46, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x70, 0x20, 0x2D, 0x4C, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x46, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x32, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x3D, 0x22, 0x24, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x53, 0x5F, 0x4E, 0x45, 0x45, 0x44, 0x5F, 0x54, 0x4F, 0x5F, 0x42, 0x45, 0x5F, 0x53, 0x45, 0x54, 0x5F, 0x52, 0x50, 0x41, 0x54, 0x48, 0x0A, 0x24, 0x32, 0x7C, 0x24, 0x7B, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x25, 0x2F, 0x2A, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x5F, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x73, 0x20, 0x22, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44, 0x5F, 0x4C, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x22, 0x20, 0x22, 0x24, 0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x2F, 0x2A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x2A, 0x29, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x3A, 0x20, 0x24, 0x4E, 0x45, 0x45, 0x44, 0x45, 0x44, 0x20, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x5F, 0x5F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x5F, 0x70, 0x63, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x20, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x6C, 0x69, 0x62, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x5F, 0x4C, 0x49, 0x56, 0x45, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x2F, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x2F, 0x70, 0x6B, 0x67, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x5F, 0x4C, 0x49, 0x56, 0x45, 0x44, 0x49, 0x52, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x73, 0x3D, 0x22, 0x24, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x22, 0x24, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x5F, 0x4C, 0x49, 0x56, 0x45, 0x44, 0x49, 0x52, 0x22, 0x20, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x20, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x27, 0x2A, 0x2E, 0x70, 0x63, 0x27, 0x29, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x66, 0x73, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x3D, 0x22, 0x24, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x20, 0x24, 0x66, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x67, 0x63, 0x63, 0x2E, 0x67, 0x6E, 0x75, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x6F, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x64, 0x6F, 0x63, 0x73, 0x2F, 0x67, 0x63, 0x63, 0x2F, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2D, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x24, 0x50, 0x43, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x7C, 0x5C, 0x24, 0x7B, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x64, 0x69, 0x72, 0x7D, 0x2F, 0x2E, 0x2E, 0x2F, 0x2E, 0x2E, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x49, 0x24, 0x7B, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x7D, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x4C, 0x24, 0x7B, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x7D, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x52, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x46, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x69, 0x64, 0x69, 0x72, 0x61, 0x66, 0x74, 0x65, 0x72, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x69, 0x73, 0x79, 0x73, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x61, 0x72, 0x63, 0x68, 0x20, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x73, 0x7C, 0x2D, 0x66, 0x6C, 0x74, 0x6F, 0x7C, 0x7C, 0x67, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x73, 0x7C, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x7C, 0x7C, 0x67, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x73, 0x7C, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x73, 0x5F, 0x66, 0x69, 0x72, 0x73, 0x74, 0x7C, 0x7C, 0x67, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x2D, 0x6D, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x78, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2D, 0x6D, 0x69, 0x6E, 0x3D, 0x5B, 0x5E, 0x27, 0x20, 0x5D, 0x2A, 0x7C, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x24, 0x7B, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x7D, 0x2F, 0x2E, 0x2A, 0x2F, 0x6C, 0x69, 0x62, 0x5C, 0x28, 0x2E, 0x2A, 0x5C, 0x29, 0x5C, 0x2E, 0x64, 0x79, 0x6C, 0x69, 0x62, 0x7C, 0x2D, 0x6C, 0x5C, 0x31, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x73, 0x7C, 0x24, 0x7B, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x7D, 0x2F, 0x2E, 0x2A, 0x2F, 0x6C, 0x69, 0x62, 0x5C, 0x28, 0x2E, 0x2A, 0x5C, 0x29, 0x5C, 0x2E, 0x61, 0x7C, 0x2D, 0x6C, 0x5C, 0x31, 0x7C, 0x67, 0x22, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x27, 0x4C, 0x69, 0x62, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x3E, 0x20, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x27, 0x4C, 0x69, 0x62, 0x73, 0x3A, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x3E, 0x20, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4C, 0x49, 0x42, 0x53, 0x5F, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x54, 0x45, 0x4E, 0x54, 0x3D, 0x24, 0x28, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x27, 0x2F, 0x4C, 0x69, 0x62, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x2F, 0x70, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x31, 0x34, 0x2D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x2F, 0x4C, 0x69, 0x62, 0x73, 0x3A, 0x2F, 0x73, 0x7C, 0x5C, 0x24, 0x7C, 0x24, 0x4C, 0x49, 0x42, 0x53, 0x5F, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x54, 0x45, 0x4E, 0x54, 0x7C, 0x22, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x2F, 0x4C, 0x69, 0x62, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x2F, 0x64, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x73, 0x7C, 0x4C, 0x69, 0x62, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x7C, 0x4C, 0x69, 0x62, 0x73, 0x3A, 0x7C, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x27, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x3E, 0x20, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x72, 0x65, 0x70, 0x20, 0x27, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x3A, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x3E, 0x20, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x51, 0x55, 0x49, 0x52, 0x45, 0x53, 0x5F, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x54, 0x45, 0x4E, 0x54, 0x3D, 0x24, 0x28, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x27, 0x2F, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x2F, 0x70, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x31, 0x38, 0x2D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x2D, 0x65, 0x20, 0x22, 0x2F, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x3A, 0x2F, 0x73, 0x7C, 0x5C, 0x24, 0x7C, 0x24, 0x52, 0x45, 0x51, 0x55, 0x49, 0x52, 0x45, 0x53, 0x5F, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0x5F, 0x43, 0x4F, 0x4E, 0x54, 0x45, 0x4E, 0x54, 0x7C, 0x22, 0x20, 0x2D, 0x65, 0x20, 0x27, 0x2F, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x2F, 0x64, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x69, 0x20, 0x27, 0x73, 0x7C, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x2E, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x3A, 0x7C, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x3A, 0x7C, 0x27, 0x20, 0x22, 0x24, 0x70, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x7D, 0x0A, 0x0A, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x5F, 0x4D, 0x4F, 0x53, 0x54, 0x4C, 0x59, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x41, 0x4C, 0x4C, 0x59, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x45, 0x44, 0x5F, 0x45, 0x58, 0x45, 0x43, 0x55, 0x54, 0x41, 0x42, 0x4C, 0x45, 0x3D, 0x22, 0x24, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x4D, 0x53, 0x4C, 0x45, 0x22, 0x0A, 0x0A, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x31, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x66, 0x65, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x66, 0x65, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x3D, 0x22, 0x24, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x5F, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x49, 0x4E, 0x42, 0x53, 0x54, 0x44, 0x22, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x63, 0x64, 0x20, 0x22, 0x24, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x5F, 0x42, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x5F, 0x44, 0x49, 0x52, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x3D, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x31, 0x32, 0x33, 0x34, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x55, 0x49, 0x4C, 0x44, 0x5F, 0x46, 0x4F, 0x52, 0x5F, 0x4E, 0x41, 0x54, 0x49, 0x56, 0x45, 0x3D, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x66, 0x6F, 0x72, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x31, 0x20, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x24, 0x31, 0x22, 0x0A, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x00};
+size_t XCPKG_HELP_STRING_LENGTH = 16609;
+char XCPKG_HELP_STRING[] = {0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x20, 0x20, 0x20, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x5F, 0x5F, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x20, 0x5F, 0x5F, 0x5F, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x5F, 0x20, 0x5F, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x5F, 0x5F, 0x20, 0x7C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x20, 0x7C, 0x20, 0x5F, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x5F, 0x5F, 0x20, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x39, 0x6D, 0x20, 0x0A, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x5C, 0x20, 0x5C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x2F, 0x20, 0x2F, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x5F, 0x5F, 0x7C, 0x20, 0x27, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x5F, 0x20, 0x5C, 0x7C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x20, 0x7C, 0x2F, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x2F, 0x20, 0x5F, 0x60, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x39, 0x6D, 0x7C, 0x0A, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x20, 0x3E, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x20, 0x3C, 0x20, 0x28, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x5F, 0x5F, 0x7C, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x7C, 0x5F, 0x29, 0x20, 0x7C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x20, 0x20, 0x20, 0x3C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x20, 0x28, 0x5F, 0x7C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x39, 0x6D, 0x20, 0x7C, 0x0A, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x2F, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x2F, 0x5C, 0x5F, 0x5C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x5F, 0x5F, 0x5F, 0x7C, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x2E, 0x5F, 0x5F, 0x2F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x7C, 0x5F, 0x7C, 0x5C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x5F, 0x5C, 0x5F, 0x5F, 0x2C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x39, 0x6D, 0x20, 0x7C, 0x0A, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x39, 0x39, 0x6D, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x33, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x36, 0x34, 0x6D, 0x20, 0x20, 0x20, 0x7C, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x38, 0x6D, 0x5F, 0x7C, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x31, 0x32, 0x39, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x33, 0x6D, 0x20, 0x7C, 0x5F, 0x5F, 0x1B, 0x5B, 0x33, 0x38, 0x3B, 0x35, 0x3B, 0x39, 0x39, 0x6D, 0x5F, 0x2F, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x41, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x65, 0x72, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x58, 0x63, 0x6F, 0x64, 0x65, 0x2E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x3C, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x3E, 0x20, 0x5B, 0x41, 0x52, 0x47, 0x55, 0x4D, 0x45, 0x4E, 0x54, 0x2E, 0x2E, 0x2E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x2D, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x2D, 0x68, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x2D, 0x56, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x73, 0x79, 0x73, 0x69, 0x6E, 0x66, 0x6F, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x78, 0x63, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x5B, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x2D, 0x44, 0x49, 0x52, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x58, 0x63, 0x6F, 0x64, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x2D, 0x44, 0x49, 0x52, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x68, 0x6F, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x69, 0x74, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x35, 0x6D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x2D, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x2D, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x7A, 0x73, 0x68, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x7A, 0x73, 0x68, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2D, 0x73, 0x65, 0x6C, 0x66, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x65, 0x64, 0x75, 0x70, 0x20, 0x5B, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x2D, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x64, 0x72, 0x79, 0x2D, 0x72, 0x75, 0x6E, 0x5D, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x28, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x3C, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x3E, 0x2F, 0x64, 0x65, 0x64, 0x75, 0x70, 0x2E, 0x69, 0x64, 0x78, 0x2C, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x68, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x55, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x65, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x63, 0x6C, 0x6F, 0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x41, 0x50, 0x46, 0x53, 0x2C, 0x20, 0x42, 0x74, 0x72, 0x66, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x58, 0x46, 0x53, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x64, 0x72, 0x79, 0x2D, 0x72, 0x75, 0x6E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x68, 0x6F, 0x77, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x6F, 0x77, 0x20, 0x6D, 0x75, 0x63, 0x68, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x62, 0x20, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x70, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x3C, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x3E, 0x2F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x64, 0x62, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x73, 0x77, 0x65, 0x72, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x69, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x6C, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x7C, 0x20, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x6C, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x6C, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x70, 0x65, 0x63, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x69, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x69, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x69, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x55, 0x52, 0x4C, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x56, 0x41, 0x4C, 0x55, 0x45, 0x20, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x2F, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x61, 0x64, 0x64, 0x20, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x55, 0x52, 0x4C, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x56, 0x41, 0x4C, 0x55, 0x45, 0x20, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x2F, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x64, 0x65, 0x6C, 0x20, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x52, 0x45, 0x50, 0x4F, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x75, 0x72, 0x6C, 0x3D, 0x56, 0x41, 0x4C, 0x55, 0x45, 0x20, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x56, 0x41, 0x4C, 0x55, 0x45, 0x20, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x2F, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x20, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x63, 0x61, 0x74, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x62, 0x61, 0x74, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x42, 0x41, 0x54, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x74, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x73, 0x65, 0x74, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x3C, 0x4B, 0x45, 0x59, 0x3E, 0x20, 0x3C, 0x56, 0x41, 0x4C, 0x55, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x65, 0x64, 0x69, 0x74, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x65, 0x64, 0x69, 0x74, 0x6F, 0x72, 0x3D, 0x3C, 0x45, 0x44, 0x49, 0x54, 0x4F, 0x52, 0x3E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x65, 0x64, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x64, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x46, 0x49, 0x4C, 0x45, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x7C, 0x20, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x20, 0x7C, 0x20, 0x3C, 0x4B, 0x45, 0x59, 0x3E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x3C, 0x52, 0x45, 0x47, 0x55, 0x4C, 0x41, 0x52, 0x2D, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x49, 0x4F, 0x4E, 0x2D, 0x50, 0x41, 0x54, 0x54, 0x45, 0x52, 0x4E, 0x3E, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3C, 0x57, 0x4F, 0x52, 0x44, 0x53, 0x3E, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x2C, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x77, 0x65, 0x62, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x6B, 0x65, 0x64, 0x2C, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x7C, 0x20, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x20, 0x7C, 0x20, 0x3C, 0x4B, 0x45, 0x59, 0x3E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x7C, 0x20, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x20, 0x7C, 0x20, 0x3C, 0x4B, 0x45, 0x59, 0x3E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x74, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x65, 0x20, 0x3C, 0x45, 0x4E, 0x47, 0x49, 0x4E, 0x45, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x6F, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x32, 0x20, 0x64, 0x6F, 0x74, 0x20, 0x62, 0x6F, 0x78, 0x20, 0x73, 0x76, 0x67, 0x20, 0x70, 0x6E, 0x67, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x45, 0x4E, 0x47, 0x49, 0x4E, 0x45, 0x3E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x32, 0x20, 0x64, 0x6F, 0x74, 0x2E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x45, 0x4E, 0x47, 0x49, 0x4E, 0x45, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x73, 0x76, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x6E, 0x67, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x65, 0x20, 0x3C, 0x45, 0x4E, 0x47, 0x49, 0x4E, 0x45, 0x3E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x64, 0x6F, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x2E, 0x20, 0x2E, 0x2E, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x28, 0x2F, 0x29, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x2F, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x2D, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65, 0x73, 0x2E, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x6F, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x74, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x2E, 0x64, 0x32, 0x20, 0x2E, 0x64, 0x6F, 0x74, 0x20, 0x2E, 0x62, 0x6F, 0x78, 0x20, 0x2E, 0x73, 0x76, 0x67, 0x20, 0x2E, 0x70, 0x6E, 0x67, 0x2C, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x62, 0x6F, 0x78, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x72, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x73, 0x77, 0x65, 0x72, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6B, 0x65, 0x70, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x71, 0x75, 0x65, 0x72, 0x69, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x2F, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x71, 0x75, 0x65, 0x72, 0x69, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x6E, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x7C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x2E, 0x2E, 0x2E, 0x20, 0x5B, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x5E, 0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x30, 0x2D, 0x39, 0x2B, 0x2D, 0x5F, 0x2E, 0x40, 0x5D, 0x7B, 0x31, 0x2C, 0x35, 0x30, 0x7D, 0x24, 0x20, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x2F, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x2D, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3E, 0x2D, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x41, 0x52, 0x43, 0x48, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x3A, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x4F, 0x53, 0x2C, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x2C, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4B, 0x69, 0x74, 0x2C, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x2C, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x2C, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x2C, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x2C, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3E, 0x20, 0x3A, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2E, 0x20, 0x49, 0x74, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x27, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x3F, 0x2E, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x5B, 0x30, 0x2D, 0x39, 0x5D, 0x3F, 0x27, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x31, 0x30, 0x2E, 0x31, 0x35, 0x2C, 0x20, 0x31, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x32, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x32, 0x2E, 0x36, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x41, 0x52, 0x43, 0x48, 0x3E, 0x20, 0x3A, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x2C, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x2C, 0x20, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x65, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x73, 0x3A, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x2D, 0x31, 0x30, 0x2E, 0x31, 0x35, 0x2D, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x2C, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x2D, 0x31, 0x33, 0x2E, 0x30, 0x2D, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x2C, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x2D, 0x31, 0x32, 0x2E, 0x30, 0x2D, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x3A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x68, 0x6F, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x3E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3D, 0x3C, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x58, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3D, 0x3C, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x31, 0x6D, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x68, 0x6F, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x44, 0x45, 0x56, 0x45, 0x4C, 0x4F, 0x50, 0x45, 0x52, 0x5F, 0x44, 0x49, 0x52, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x69, 0x74, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x35, 0x6D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x2D, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x2D, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x3C, 0x64, 0x65, 0x62, 0x75, 0x67, 0x7C, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x4F, 0x30, 0x20, 0x2D, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x4F, 0x30, 0x20, 0x2D, 0x67, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x3A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x4F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x58, 0x58, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x4F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x50, 0x50, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x44, 0x4E, 0x44, 0x45, 0x42, 0x55, 0x47, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4C, 0x44, 0x46, 0x4C, 0x41, 0x47, 0x53, 0x3A, 0x20, 0x2D, 0x66, 0x6C, 0x74, 0x6F, 0x20, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x53, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x6A, 0x20, 0x3C, 0x4E, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x49, 0x20, 0x3C, 0x46, 0x4F, 0x52, 0x4D, 0x55, 0x4C, 0x41, 0x2D, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x45, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x55, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x4B, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x3D, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x71, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x6E, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x78, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x65, 0x6E, 0x76, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x68, 0x74, 0x74, 0x70, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x74, 0x74, 0x70, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2F, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x67, 0x6F, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x75, 0x70, 0x70, 0x6D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x70, 0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x56, 0x3D, 0x31, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x4F, 0x4E, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x73, 0x68, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x78, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x63, 0x63, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x61, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x6C, 0x64, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x67, 0x6F, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x78, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x28, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x20, 0x4F, 0x4E, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x44, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x78, 0x2D, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x53, 0x50, 0x45, 0x57, 0x3D, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x2E, 0x2E, 0x2E, 0x20, 0x5B, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x2E, 0x2E, 0x2E, 0x20, 0x5B, 0x49, 0x4E, 0x53, 0x54, 0x41, 0x4C, 0x4C, 0x2D, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2C, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x2E, 0x2E, 0x2E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x64, 0x69, 0x72, 0x73, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x7C, 0x20, 0x2D, 0x4C, 0x20, 0x4E, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x74, 0x72, 0x65, 0x65, 0x2D, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6C, 0x61, 0x75, 0x6E, 0x63, 0x68, 0x20, 0x66, 0x7A, 0x66, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x45, 0x53, 0x43, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x71, 0x75, 0x69, 0x74, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x53, 0x50, 0x45, 0x43, 0x3E, 0x20, 0x5B, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x5D, 0x5B, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x2D, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3E, 0x5D, 0x3C, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x2D, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x4B, 0x5D, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x46, 0x49, 0x4C, 0x45, 0x4E, 0x41, 0x4D, 0x45, 0x2D, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x66, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x2D, 0x3C, 0x50, 0x41, 0x43, 0x4B, 0x41, 0x47, 0x45, 0x2D, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3E, 0x2D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x2D, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x2D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x2D, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3E, 0x2D, 0x3C, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x2D, 0x50, 0x4C, 0x41, 0x54, 0x46, 0x4F, 0x52, 0x4D, 0x2D, 0x41, 0x52, 0x43, 0x48, 0x3E, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x3C, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x2D, 0x54, 0x59, 0x50, 0x45, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x67, 0x7A, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x78, 0x7A, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x6C, 0x7A, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x62, 0x7A, 0x32, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x7A, 0x73, 0x74, 0x20, 0x2E, 0x7A, 0x69, 0x70, 0x20, 0x2E, 0x78, 0x73, 0x62, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x78, 0x73, 0x62, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6F, 0x77, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x78, 0x7A, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2E, 0x74, 0x61, 0x72, 0x2E, 0x7A, 0x73, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x73, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x73, 0x20, 0x63, 0x70, 0x75, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x24, 0x53, 0x4F, 0x55, 0x52, 0x43, 0x45, 0x5F, 0x44, 0x41, 0x54, 0x45, 0x5F, 0x45, 0x50, 0x4F, 0x43, 0x48, 0x20, 0x28, 0x30, 0x20, 0x69, 0x66, 0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x29, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x2D, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x4B, 0x1B, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x2E, 0x0A, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x3C, 0x42, 0x55, 0x4E, 0x44, 0x4C, 0x45, 0x2D, 0x46, 0x49, 0x4C, 0x45, 0x3E, 0x20, 0x5B, 0x3C, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x2E, 0x2E, 0x2E, 0x5D, 0x20, 0x5B, 0x2D, 0x43, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x6C, 0x5D, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x28, 0x2E, 0x78, 0x73, 0x62, 0x29, 0x2C, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x73, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x69, 0x74, 0x2C, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x2C, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x2F, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x69, 0x62, 0x2F, 0x6C, 0x69, 0x62, 0x7A, 0x2E, 0x61, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x43, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x44, 0x49, 0x52, 0x3E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x6C, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x30, 0x3B, 0x39, 0x34, 0x6D, 0x2D, 0x76, 0x5B, 0x30, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x65, 0x64, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x0A, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x2D, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x2D, 0x4C, 0x20, 0x3C, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x3E, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x20, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x20, 0x3E, 0x3D, 0x20, 0x31, 0x20, 0x26, 0x26, 0x20, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x20, 0x3C, 0x3D, 0x20, 0x39, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4C, 0x45, 0x56, 0x45, 0x4C, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x2D, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x20, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x53, 0x54, 0x52, 0x3E, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x53, 0x54, 0x52, 0x3E, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x42, 0x41, 0x53, 0x45, 0x31, 0x36, 0x2D, 0x45, 0x4E, 0x43, 0x4F, 0x44, 0x45, 0x44, 0x2D, 0x53, 0x54, 0x52, 0x3E, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x42, 0x41, 0x53, 0x45, 0x31, 0x36, 0x2D, 0x45, 0x4E, 0x43, 0x4F, 0x44, 0x45, 0x44, 0x2D, 0x53, 0x54, 0x52, 0x3E, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x53, 0x54, 0x52, 0x3E, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x53, 0x54, 0x52, 0x3E, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x42, 0x41, 0x53, 0x45, 0x36, 0x34, 0x2D, 0x45, 0x4E, 0x43, 0x4F, 0x44, 0x45, 0x44, 0x2D, 0x53, 0x54, 0x52, 0x3E, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x42, 0x41, 0x53, 0x45, 0x36, 0x34, 0x2D, 0x45, 0x4E, 0x43, 0x4F, 0x44, 0x45, 0x44, 0x2D, 0x53, 0x54, 0x52, 0x3E, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x3E, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x3C, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x4E, 0x44, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x5B, 0x2D, 0x61, 0x5D, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x3C, 0x43, 0x4F, 0x4D, 0x4D, 0x41, 0x4E, 0x44, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x20, 0x69, 0x6E, 0x20, 0x50, 0x41, 0x54, 0x48, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x76, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x68, 0x74, 0x74, 0x70, 0x2D, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x3C, 0x55, 0x52, 0x4C, 0x3E, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x75, 0x72, 0x69, 0x3D, 0x3C, 0x55, 0x52, 0x49, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x3D, 0x3C, 0x53, 0x48, 0x41, 0x32, 0x35, 0x36, 0x53, 0x55, 0x4D, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x6F, 0x20, 0x3C, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x5D, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x76, 0x69, 0x61, 0x20, 0x48, 0x54, 0x54, 0x50, 0x2F, 0x48, 0x54, 0x54, 0x50, 0x53, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x3C, 0x52, 0x45, 0x4D, 0x4F, 0x54, 0x45, 0x2D, 0x55, 0x52, 0x4C, 0x3E, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x20, 0x5B, 0x2D, 0x43, 0x20, 0x3C, 0x52, 0x45, 0x50, 0x4F, 0x53, 0x49, 0x54, 0x4F, 0x52, 0x59, 0x2D, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x72, 0x65, 0x66, 0x3D, 0x3C, 0x52, 0x45, 0x46, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3D, 0x3C, 0x4E, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x42, 0x20, 0x3C, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x4F, 0x55, 0x54, 0x2D, 0x42, 0x52, 0x41, 0x4E, 0x43, 0x48, 0x2D, 0x4E, 0x41, 0x4D, 0x45, 0x3E, 0x5D, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x67, 0x69, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x0A, 0x0A, 0x1B, 0x5B, 0x30, 0x3B, 0x33, 0x32, 0x6D, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x20, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x3C, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x41, 0x54, 0x48, 0x3E, 0x20, 0x5B, 0x2D, 0x76, 0x5D, 0x20, 0x5B, 0x2D, 0x43, 0x20, 0x3C, 0x44, 0x49, 0x52, 0x3E, 0x5D, 0x20, 0x5B, 0x2D, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x3D, 0x3C, 0x4E, 0x3E, 0x5D, 0x0A, 0x1B, 0x5B, 0x30, 0x6D, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0A, 0x0A, 0x00};
+size_t XCPKG_ZSH_COMPLETION_SCRIPT_STRING_LENGTH = 21550;
+char XCPKG_ZSH_COMPLETION_SCRIPT_STRING[] = {0x23, 0x63, 0x6F, 0x6D, 0x70, 0x64, 0x65, 0x66, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x0A, 0x0A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3D, 0x28, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x68, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x56, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x79, 0x73, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x78, 0x63, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x58, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x61, 0x62, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x7A, 0x73, 0x68, 0x2F, 0x62, 0x61, 0x73, 0x68, 0x2F, 0x66, 0x69, 0x73, 0x68, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x3A, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x64, 0x62, 0x3A, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x64, 0x65, 0x64, 0x75, 0x70, 0x3A, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x6C, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x6C, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x3A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x6C, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x3A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x69, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x69, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x3A, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x69, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x3A, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x3A, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x61, 0x64, 0x64, 0x3A, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x64, 0x65, 0x6C, 0x3A, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x79, 0x6E, 0x63, 0x3A, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x3A, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x3A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x73, 0x65, 0x74, 0x3A, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3A, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x68, 0x6F, 0x77, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x72, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x65, 0x74, 0x63, 0x68, 0x3A, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x3A, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x72, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x3A, 0x72, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x3A, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3A, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x3A, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2D, 0x73, 0x65, 0x6C, 0x66, 0x3A, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x74, 0x72, 0x65, 0x65, 0x3A, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x74, 0x72, 0x65, 0x65, 0x2D, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x6C, 0x6F, 0x67, 0x73, 0x3A, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x3A, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3A, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x74, 0x69, 0x6C, 0x3A, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x29, 0x0A, 0x0A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x75, 0x74, 0x69, 0x6C, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3D, 0x28, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x77, 0x68, 0x69, 0x63, 0x68, 0x3A, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x50, 0x41, 0x54, 0x48, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x76, 0x3A, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x68, 0x74, 0x74, 0x70, 0x2D, 0x66, 0x65, 0x74, 0x63, 0x68, 0x3A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x76, 0x69, 0x61, 0x20, 0x48, 0x54, 0x54, 0x50, 0x2F, 0x48, 0x54, 0x54, 0x50, 0x53, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x67, 0x69, 0x74, 0x2D, 0x73, 0x79, 0x6E, 0x63, 0x3A, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x3A, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x3A, 0x63, 0x61, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x7A, 0x6C, 0x69, 0x62, 0x2D, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x3A, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x20, 0x69, 0x6E, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x7A, 0x6C, 0x69, 0x62, 0x2D, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x3A, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x20, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x3A, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x3A, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x31, 0x36, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x3A, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x27, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2D, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x3A, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x20, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x2E, 0x27, 0x0A, 0x29, 0x0A, 0x0A, 0x23, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x2F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x2F, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x2E, 0x0A, 0x23, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2C, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x65, 0x64, 0x20, 0x75, 0x70, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x64, 0x2E, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x3D, 0x22, 0x24, 0x7B, 0x58, 0x43, 0x50, 0x4B, 0x47, 0x5F, 0x48, 0x4F, 0x4D, 0x45, 0x3A, 0x2D, 0x24, 0x48, 0x4F, 0x4D, 0x45, 0x2F, 0x2E, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x7D, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x24, 0x31, 0x2E, 0x74, 0x78, 0x74, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x43, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x43, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x3D, 0x28, 0x24, 0x7E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x28, 0x4E, 0x4C, 0x6B, 0x2D, 0x32, 0x35, 0x36, 0x29, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x5B, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x24, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x43, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x7C, 0x7C, 0x20, 0x28, 0x20, 0x2D, 0x66, 0x20, 0x22, 0x24, 0x63, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x22, 0x20, 0x26, 0x26, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x22, 0x20, 0x29, 0x20, 0x5D, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x3D, 0x28, 0x24, 0x7B, 0x28, 0x66, 0x29, 0x22, 0x24, 0x28, 0x3C, 0x24, 0x63, 0x61, 0x63, 0x68, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x29, 0x22, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x3D, 0x28, 0x24, 0x7B, 0x28, 0x66, 0x29, 0x22, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x5F, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x22, 0x24, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x22, 0x20, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x32, 0x3E, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x22, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x3D, 0x28, 0x24, 0x7B, 0x28, 0x66, 0x29, 0x22, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x5F, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x22, 0x24, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x22, 0x20, 0x32, 0x3E, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x22, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x27, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x3D, 0x28, 0x24, 0x7B, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x2F, 0x2F, 0x3A, 0x2F, 0x5C, 0x5C, 0x3A, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x27, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x79, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x3D, 0x28, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x6C, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x32, 0x3E, 0x2F, 0x64, 0x65, 0x76, 0x2F, 0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7C, 0x3A, 0x7C, 0x5C, 0x5C, 0x3A, 0x7C, 0x67, 0x27, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x27, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x3D, 0x28, 0x27, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x27, 0x20, 0x27, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4B, 0x69, 0x74, 0x27, 0x20, 0x27, 0x57, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x27, 0x20, 0x27, 0x57, 0x61, 0x74, 0x63, 0x68, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x27, 0x20, 0x27, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x27, 0x20, 0x27, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x27, 0x20, 0x27, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x4F, 0x53, 0x27, 0x20, 0x27, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x27, 0x20, 0x27, 0x58, 0x52, 0x4F, 0x53, 0x27, 0x20, 0x27, 0x58, 0x52, 0x53, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x27, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x2D, 0x7A, 0x20, 0x22, 0x24, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x64, 0x64, 0x20, 0x2D, 0x53, 0x20, 0x27, 0x2D, 0x27, 0x20, 0x2D, 0x61, 0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x3D, 0x28, 0x22, 0x24, 0x7B, 0x28, 0x73, 0x3A, 0x2D, 0x3A, 0x29, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x7D, 0x22, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x7B, 0x23, 0x70, 0x61, 0x72, 0x74, 0x73, 0x7D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x29, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x64, 0x64, 0x20, 0x2D, 0x53, 0x20, 0x2D, 0x20, 0x2D, 0x61, 0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x29, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x3D, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x28, 0x24, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x3D, 0x20, 0x22, 0x24, 0x7B, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5B, 0x31, 0x5D, 0x7D, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x22, 0x20, 0x3D, 0x20, 0x30, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x7B, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5B, 0x31, 0x5D, 0x7D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x3D, 0x28, 0x27, 0x31, 0x35, 0x2E, 0x34, 0x27, 0x20, 0x27, 0x31, 0x35, 0x2E, 0x33, 0x27, 0x20, 0x27, 0x31, 0x35, 0x2E, 0x32, 0x27, 0x20, 0x27, 0x31, 0x35, 0x2E, 0x31, 0x27, 0x20, 0x27, 0x31, 0x35, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x36, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x35, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x34, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x33, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x32, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x31, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x35, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x34, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x33, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x32, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x31, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x32, 0x2E, 0x34, 0x27, 0x20, 0x27, 0x31, 0x32, 0x2E, 0x33, 0x27, 0x20, 0x27, 0x31, 0x32, 0x2E, 0x32, 0x27, 0x20, 0x27, 0x31, 0x32, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x35, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x34, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x33, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x32, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x31, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x30, 0x2E, 0x31, 0x35, 0x27, 0x20, 0x27, 0x31, 0x30, 0x2E, 0x31, 0x34, 0x27, 0x20, 0x27, 0x31, 0x30, 0x2E, 0x31, 0x33, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x3D, 0x28, 0x27, 0x31, 0x30, 0x2E, 0x31, 0x35, 0x27, 0x20, 0x27, 0x31, 0x31, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x32, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x33, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x34, 0x2E, 0x30, 0x27, 0x20, 0x27, 0x31, 0x35, 0x2E, 0x30, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x64, 0x64, 0x20, 0x2D, 0x53, 0x20, 0x2D, 0x20, 0x2D, 0x50, 0x20, 0x22, 0x24, 0x7B, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x25, 0x2D, 0x2A, 0x7D, 0x2D, 0x22, 0x20, 0x2D, 0x61, 0x20, 0x2D, 0x2D, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x29, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x3D, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x28, 0x24, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x69, 0x74, 0x65, 0x6D, 0x22, 0x20, 0x3D, 0x20, 0x22, 0x24, 0x7B, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5B, 0x31, 0x5D, 0x7D, 0x22, 0x20, 0x5D, 0x20, 0x3B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x3D, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x69, 0x73, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x22, 0x20, 0x3D, 0x20, 0x30, 0x20, 0x5D, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x2D, 0x61, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x7B, 0x70, 0x61, 0x72, 0x74, 0x73, 0x5B, 0x31, 0x5D, 0x7D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x61, 0x63, 0x4F, 0x53, 0x58, 0x7C, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4B, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x3D, 0x28, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x27, 0x20, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x65, 0x27, 0x20, 0x27, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x50, 0x68, 0x6F, 0x6E, 0x65, 0x4F, 0x53, 0x7C, 0x58, 0x52, 0x4F, 0x53, 0x7C, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x54, 0x56, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x3D, 0x28, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x27, 0x20, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x4F, 0x53, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x3D, 0x28, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x27, 0x20, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x65, 0x27, 0x20, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x5F, 0x33, 0x32, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2A, 0x29, 0x20, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x3D, 0x28, 0x27, 0x61, 0x72, 0x6D, 0x36, 0x34, 0x27, 0x20, 0x27, 0x78, 0x38, 0x36, 0x5F, 0x36, 0x34, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x64, 0x64, 0x20, 0x2D, 0x50, 0x20, 0x22, 0x24, 0x7B, 0x50, 0x52, 0x45, 0x46, 0x49, 0x58, 0x25, 0x2D, 0x2A, 0x7D, 0x2D, 0x22, 0x20, 0x2D, 0x61, 0x20, 0x2D, 0x2D, 0x20, 0x61, 0x72, 0x63, 0x68, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x41, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x20, 0x3A, 0x7B, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x7D, 0x27, 0x20, 0x27, 0x2A, 0x3A, 0x3A, 0x20, 0x3A, 0x2D, 0x3E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x73, 0x74, 0x61, 0x74, 0x65, 0x22, 0x20, 0x3D, 0x20, 0x27, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x5B, 0x31, 0x5D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x73, 0x65, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x32, 0x3A, 0x6B, 0x65, 0x79, 0x3A, 0x28, 0x70, 0x6B, 0x67, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x77, 0x65, 0x62, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x72, 0x65, 0x66, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x6E, 0x74, 0x68, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x6F, 0x70, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x75, 0x70, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x69, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6C, 0x6D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x78, 0x78, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x70, 0x70, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x62, 0x73, 0x74, 0x64, 0x20, 0x62, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x6F, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x64, 0x6F, 0x31, 0x32, 0x33, 0x34, 0x35, 0x20, 0x64, 0x6F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x64, 0x6F, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x64, 0x6F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x63, 0x61, 0x76, 0x65, 0x61, 0x74, 0x73, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x72, 0x65, 0x73, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x33, 0x3A, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x28, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x61, 0x64, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x32, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x75, 0x72, 0x6C, 0x3A, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x2D, 0x5B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x70, 0x69, 0x6E, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x32, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x75, 0x72, 0x6C, 0x3A, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x2D, 0x5B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x70, 0x69, 0x6E, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x2F, 0x5E, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x2F, 0x70, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x37, 0x2D, 0x29, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x75, 0x72, 0x6C, 0x3D, 0x2D, 0x5B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x20, 0x75, 0x72, 0x6C, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x3D, 0x2D, 0x5B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x70, 0x69, 0x6E, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x79, 0x65, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x75, 0x6E, 0x70, 0x69, 0x6E, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x6F, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x79, 0x65, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x6F, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x64, 0x65, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x2F, 0x5E, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x2F, 0x70, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x37, 0x2D, 0x29, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x79, 0x6E, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x2F, 0x5E, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x2F, 0x70, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x37, 0x2D, 0x29, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x24, 0x28, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x2D, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7C, 0x20, 0x73, 0x65, 0x64, 0x20, 0x2D, 0x6E, 0x20, 0x22, 0x2F, 0x5E, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x2F, 0x70, 0x22, 0x20, 0x7C, 0x20, 0x63, 0x75, 0x74, 0x20, 0x2D, 0x63, 0x37, 0x2D, 0x29, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x32, 0x3A, 0x6B, 0x65, 0x79, 0x3A, 0x28, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x20, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x70, 0x6B, 0x67, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x77, 0x65, 0x62, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x72, 0x65, 0x66, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x6E, 0x74, 0x68, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x6F, 0x70, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x75, 0x70, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x69, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6C, 0x6D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x78, 0x78, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x70, 0x70, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x62, 0x73, 0x74, 0x64, 0x20, 0x62, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x6F, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x64, 0x6F, 0x31, 0x32, 0x33, 0x34, 0x35, 0x20, 0x64, 0x6F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x64, 0x6F, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x64, 0x6F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x63, 0x61, 0x76, 0x65, 0x61, 0x74, 0x73, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x72, 0x65, 0x73, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x32, 0x3A, 0x6B, 0x65, 0x79, 0x3A, 0x28, 0x2D, 0x2D, 0x79, 0x61, 0x6D, 0x6C, 0x20, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x70, 0x6B, 0x67, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x77, 0x65, 0x62, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x72, 0x65, 0x66, 0x20, 0x67, 0x69, 0x74, 0x2D, 0x6E, 0x74, 0x68, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x66, 0x69, 0x78, 0x2D, 0x6F, 0x70, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x75, 0x72, 0x69, 0x20, 0x72, 0x65, 0x73, 0x2D, 0x73, 0x68, 0x61, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6B, 0x67, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x75, 0x70, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x69, 0x70, 0x20, 0x64, 0x65, 0x70, 0x2D, 0x70, 0x6C, 0x6D, 0x20, 0x63, 0x63, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x78, 0x78, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x70, 0x70, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x6C, 0x64, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x62, 0x73, 0x74, 0x64, 0x20, 0x62, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x6F, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x64, 0x6F, 0x31, 0x32, 0x33, 0x34, 0x35, 0x20, 0x64, 0x6F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x64, 0x6F, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x64, 0x6F, 0x74, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x63, 0x61, 0x76, 0x65, 0x61, 0x74, 0x73, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x72, 0x65, 0x73, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x2D, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2D, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x62, 0x79, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x61, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x61, 0x74, 0x2D, 0x72, 0x66, 0x63, 0x2D, 0x33, 0x33, 0x33, 0x39, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x61, 0x74, 0x2D, 0x72, 0x66, 0x63, 0x2D, 0x33, 0x33, 0x33, 0x39, 0x2D, 0x75, 0x74, 0x63, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x61, 0x74, 0x2D, 0x69, 0x73, 0x6F, 0x2D, 0x38, 0x36, 0x30, 0x31, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x61, 0x74, 0x2D, 0x69, 0x73, 0x6F, 0x2D, 0x38, 0x36, 0x30, 0x31, 0x2D, 0x75, 0x74, 0x63, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x74, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5D, 0x3A, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x28, 0x64, 0x32, 0x20, 0x64, 0x6F, 0x74, 0x20, 0x62, 0x6F, 0x78, 0x20, 0x73, 0x76, 0x67, 0x20, 0x70, 0x6E, 0x67, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x6F, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5D, 0x3A, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x5B, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x2C, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x65, 0x62, 0x2D, 0x75, 0x72, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x64, 0x75, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x2D, 0x5B, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5D, 0x3A, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x5B, 0x75, 0x73, 0x65, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x72, 0x79, 0x2D, 0x72, 0x75, 0x6E, 0x5B, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x73, 0x75, 0x62, 0x2D, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x3A, 0x28, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5B, 0x71, 0x75, 0x65, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x5B, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3A, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x5D, 0x3A, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x4B, 0x5B, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2D, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x67, 0x20, 0x22, 0x2A, 0x2E, 0x78, 0x73, 0x62, 0x22, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2A, 0x3A, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x43, 0x5B, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5D, 0x3A, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x6C, 0x5B, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x65, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x61, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x72, 0x73, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5B, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x4C, 0x5B, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5D, 0x3A, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x3A, 0x28, 0x33, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x5D, 0x3A, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5D, 0x3A, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x5D, 0x3A, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x7B, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x7D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x6A, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x5D, 0x3A, 0x6A, 0x6F, 0x62, 0x73, 0x3A, 0x28, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20, 0x39, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x49, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5D, 0x3A, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x55, 0x5B, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x4B, 0x5B, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x3D, 0x2D, 0x5B, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x3A, 0x3A, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x28, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x45, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x65, 0x6E, 0x76, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x68, 0x74, 0x74, 0x70, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x74, 0x74, 0x70, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2F, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x75, 0x70, 0x70, 0x6D, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x70, 0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x56, 0x3D, 0x31, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x73, 0x68, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x78, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x63, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x61, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x6C, 0x64, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x78, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x4E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x44, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x53, 0x50, 0x45, 0x57, 0x3D, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x5B, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x78, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x71, 0x5B, 0x73, 0x69, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x5D, 0x3A, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5D, 0x3A, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x5D, 0x3A, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x7B, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x7D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x6A, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x5D, 0x3A, 0x6A, 0x6F, 0x62, 0x73, 0x3A, 0x28, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20, 0x39, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x49, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5D, 0x3A, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x55, 0x5B, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x4B, 0x5B, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x3D, 0x2D, 0x5B, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x3A, 0x3A, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x28, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x45, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x65, 0x6E, 0x76, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x68, 0x74, 0x74, 0x70, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x74, 0x74, 0x70, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2F, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x75, 0x70, 0x70, 0x6D, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x70, 0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x56, 0x3D, 0x31, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x73, 0x68, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x78, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x78, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x63, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x61, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x6C, 0x64, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x4E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x44, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x53, 0x50, 0x45, 0x57, 0x3D, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x5B, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x78, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x71, 0x5B, 0x73, 0x69, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x5D, 0x3A, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5D, 0x3A, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x3A, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3D, 0x2D, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x5D, 0x3A, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x7B, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x7D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x6A, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x5D, 0x3A, 0x6A, 0x6F, 0x62, 0x73, 0x3A, 0x28, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20, 0x39, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x49, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5D, 0x3A, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2D, 0x64, 0x69, 0x72, 0x3A, 0x5F, 0x70, 0x61, 0x74, 0x68, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x2D, 0x2F, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x55, 0x5B, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x4B, 0x5B, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x65, 0x64, 0x75, 0x70, 0x3D, 0x2D, 0x5B, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x66, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5D, 0x3A, 0x3A, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x28, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x45, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x2D, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x63, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x65, 0x6E, 0x76, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x68, 0x74, 0x74, 0x70, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x68, 0x74, 0x74, 0x70, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2F, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x78, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x5B, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x75, 0x6C, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x75, 0x70, 0x70, 0x6D, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x70, 0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6E, 0x6A, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x73, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x56, 0x3D, 0x31, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0x5F, 0x4D, 0x41, 0x4B, 0x45, 0x46, 0x49, 0x4C, 0x45, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x73, 0x68, 0x5B, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x78, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x63, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x61, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x6C, 0x64, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x57, 0x6C, 0x2C, 0x2D, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x78, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x76, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x72, 0x67, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x2D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x44, 0x43, 0x4D, 0x41, 0x4B, 0x45, 0x5F, 0x46, 0x49, 0x4E, 0x44, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x4D, 0x4F, 0x44, 0x45, 0x3D, 0x4F, 0x4E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x5B, 0x70, 0x61, 0x73, 0x73, 0x20, 0x2D, 0x76, 0x44, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x78, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x2D, 0x70, 0x6B, 0x67, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x50, 0x4B, 0x47, 0x5F, 0x43, 0x4F, 0x4E, 0x46, 0x49, 0x47, 0x5F, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5F, 0x53, 0x50, 0x45, 0x57, 0x3D, 0x31, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x27, 0x28, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x29, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x78, 0x5B, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x78, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x76, 0x2D, 0x2A, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x5D, 0x27, 0x20, 0x5C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x2D, 0x71, 0x5B, 0x73, 0x69, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x2A, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x73, 0x2D, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x73, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x73, 0x2D, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x6F, 0x75, 0x74, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x27, 0x20, 0x27, 0x2D, 0x76, 0x5B, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x5D, 0x27, 0x20, 0x27, 0x2D, 0x2D, 0x6A, 0x73, 0x6F, 0x6E, 0x5B, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x77, 0x68, 0x61, 0x74, 0x3A, 0x28, 0x7A, 0x73, 0x68, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x74, 0x69, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x20, 0x3A, 0x7B, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x75, 0x74, 0x69, 0x6C, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x5F, 0x78, 0x63, 0x70, 0x6B, 0x67, 0x5F, 0x75, 0x74, 0x69, 0x6C, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x7D, 0x27, 0x20, 0x27, 0x2A, 0x3A, 0x3A, 0x20, 0x3A, 0x2D, 0x3E, 0x75, 0x74, 0x69, 0x6C, 0x27, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x20, 0x22, 0x24, 0x73, 0x74, 0x61, 0x74, 0x65, 0x22, 0x20, 0x3D, 0x20, 0x27, 0x75, 0x74, 0x69, 0x6C, 0x27, 0x20, 0x5D, 0x20, 0x7C, 0x7C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x24, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x5B, 0x31, 0x5D, 0x20, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2D, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x77, 0x68, 0x69, 0x63, 0x68, 0x29, 0x27, 0x20, 0x27, 0x2D, 0x61, 0x5B, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x61, 0x6C, 0x6C, 0x5D, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x73, 0x75, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x31, 0x3A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7A, 0x6C, 0x69, 0x62, 0x2D, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x27, 0x2D, 0x4C, 0x5B, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5D, 0x3A, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x3A, 0x28, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20, 0x39, 0x29, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0A, 0x7D, 0x0A, 0x00};
@@ -0,0 +1,25 @@
+#include <stdio.h>
+
+#include "../core/seekable-bundle.h"
+
+#include "../xcpkg.h"
+
+int xcpkg_bundle_extract(const char * bundleFilePath, const char * outputDIR, char * const paths[], const size_t pathsCount, const bool list, const bool verbose) {
+    if (bundleFilePath == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (bundleFilePath[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    int ret;
+
+    if (list) {
+        ret = seekable_bundle_list(bundleFilePath);
+    } else {
+        ret = seekable_bundle_extract(bundleFilePath, outputDIR, paths, pathsCount, verbose);
+    }
+
+    return ret == 0 ? XCPKG_OK : XCPKG_ERROR;
+}
@@ -6,6 +6,7 @@
 
 #include "../core/log.h"
 #include "../core/tar.h"
+#include "../core/seekable-bundle.h"
 
 #include "../xcpkg.h"
 
@@ -58,8 +59,10 @@ int xcpkg_bundle(const char * packageName, const char * targetPlatformSpec, Arch
         case ArchiveType_tar_xz:  outputFileExt = ".tar.xz";  break;
         case ArchiveType_tar_lz:  outputFileExt = ".tar.lz";  break;
         case ArchiveType_tar_bz2: outputFileExt = ".tar.bz2"; break;
+        case ArchiveType_tar_zst: outputFileExt = ".tar.zst"; break;
         case ArchiveType_zip:     outputFileExt = ".zip";     break;
         case ArchiveType_7z:      outputFileExt = ".7z";      break;
+        case ArchiveType_seekable: outputFileExt = ".xsb";    break;
     }
 
     /////////////////////////////////////////////////////////////////////////////////
@@ -159,10 +162,16 @@ int xcpkg_bundle(const char * packageName, const char * targetPlatformSpec, Arch
         return XCPKG_ERROR;
     }
 
-    ret = tar_create(packingDIRName, tmpFilePath, outputType, verbose);
+    if (outputType == ArchiveType_seekable) {
+        if (seekable_bundle_create(packingDIRName, tmpFilePath, verbose) != 0) {
+            return XCPKG_ERROR;
+        }
+    } else {
+        ret = tar_create(packingDIRName, tmpFilePath, outputType, verbose);
 
-    if (ret != 0) {
-        return abs(ret) + XCPKG_ERROR_ARCHIVE_BASE;
+        if (ret != 0) {
+            return abs(ret) + XCPKG_ERROR_ARCHIVE_BASE;
+        }
     }
 
     ret = xcpkg_rename_or_copy_file(tmpFilePath, outputFilePath);
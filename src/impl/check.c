@@ -8,6 +8,8 @@
 
 #include "../xcpkg.h"
 
+#include "outdated.h"
+
 int xcpkg_check_if_the_given_argument_matches_package_name_pattern(const char * arg) {
     if (arg == NULL) {
         return XCPKG_ERROR_ARG_IS_NULL;
@@ -177,83 +179,43 @@ int xcpkg_check_if_the_given_package_is_installed(const char * packageName, cons
         return ret;
     }
 
-    struct stat st;
-
-    char packageInstalledDIR[PATH_MAX];
+    XCPKGInstalledDB db;
 
-    ret = snprintf(packageInstalledDIR, PATH_MAX, "%s/installed/%s/%s", getenv("XCPKG_HOME"), targetPlatformSpec, packageName);
+    ret = xcpkg_installed_db_load(&db);
 
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
+    if (ret != XCPKG_OK) {
+        return ret;
     }
 
-    if (lstat(packageInstalledDIR, &st) == 0) {
-        if (!S_ISLNK(st.st_mode)) {
-            return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
-        }
-    } else {
-        return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+    if (xcpkg_installed_db_find(&db, packageName, targetPlatformSpec) == NULL) {
+        ret = XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
     }
 
-    size_t receiptFilePathCapacity = ret + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 2U;
-    char   receiptFilePath[receiptFilePathCapacity];
+    xcpkg_installed_db_free(&db);
 
-    ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageInstalledDIR, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
-    if (lstat(receiptFilePath, &st) == 0) {
-        if (S_ISREG(st.st_mode)) {
-            return XCPKG_OK;
-        } else {
-            return XCPKG_ERROR_PACKAGE_IS_BROKEN;
-        }
-    } else {
-        return XCPKG_ERROR_PACKAGE_IS_BROKEN;
-    }
+    return ret;
 }
 
 int xcpkg_check_if_the_given_package_is_outdated(const char * packageName, const char * targetPlatformSpec) {
-    XCPKGFormula * formula = NULL;
-    XCPKGReceipt * receipt = NULL;
-
-    char targetPlatformName[51];
+    XCPKGFormulaRepoPathList list = {0};
 
-    for (int i = 0; i < 50; i++) {
-        if (targetPlatformSpec[i] == '\0') {
-            return XCPKG_ERROR_ARG_IS_INVALID;
-        }
-
-        if (targetPlatformSpec[i] == '-') {
-            targetPlatformName[i] = '\0';
-            break;
-        }
-
-        targetPlatformName[i] = targetPlatformSpec[i];
-    }
-
-    int ret = xcpkg_formula_load(packageName, targetPlatformName, NULL, &formula);
+    int ret = xcpkg_formula_repo_path_list_load(&list);
 
     if (ret != XCPKG_OK) {
-        goto finalize;
+        return ret;
     }
 
-    ret = xcpkg_receipt_parse(packageName, targetPlatformSpec, &receipt);
+    XCPKGOutdatedPackage package = {
+        .packageName = (char*)packageName,
+        .targetPlatformSpec = (char*)targetPlatformSpec
+    };
+
+    ret = xcpkg_outdated_package_check(&list, &package);
 
-    if (ret != XCPKG_OK) {
-        goto finalize;
-    }
+    free(package.installedVersion);
+    free(package.availableVersion);
 
-    if (strcmp(receipt->version, formula->version) == 0) {
-        ret = XCPKG_ERROR_PACKAGE_NOT_OUTDATED;
-    }
+    xcpkg_formula_repo_path_list_free(&list);
 
-finalize:
-    xcpkg_formula_free(formula);
-    xcpkg_receipt_free(receipt);
     return ret;
 }
@@ -0,0 +1,586 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "../xcpkg.h"
+
+// the completion cache is a text file with one name per line, sorted in byte order and without duplicates.
+//
+// for the available packages, the names are package names.
+// for the installed packages, the names are <TARGET-PLATFORM-SPEC>/<PACKAGE-NAME>, the same as what xcpkg ls-installed prints.
+//
+// shell completion scripts read the whole file at once, xcpkg __complete looks a prefix up with a binary search on it.
+
+typedef struct {
+    char * * nameArray;
+    size_t   nameArraySize;
+    size_t   nameArrayCapacity;
+} NameList;
+
+static void name_list_free(NameList * list) {
+    for (size_t i = 0U; i < list->nameArraySize; i++) {
+        free(list->nameArray[i]);
+    }
+
+    free(list->nameArray);
+
+    list->nameArray = NULL;
+    list->nameArraySize = 0U;
+    list->nameArrayCapacity = 0U;
+}
+
+static int name_list_add(NameList * list, const char * name, const size_t nameLength) {
+    if (list->nameArraySize == list->nameArrayCapacity) {
+        size_t newCapacity = list->nameArrayCapacity == 0U ? 256U : (list->nameArrayCapacity << 1);
+
+        char * * p = (char**)realloc(list->nameArray, newCapacity * sizeof(char*));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        list->nameArray = p;
+        list->nameArrayCapacity = newCapacity;
+    }
+
+    char * s = (char*)malloc(nameLength + 1U);
+
+    if (s == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    memcpy(s, name, nameLength);
+
+    s[nameLength] = '\0';
+
+    list->nameArray[list->nameArraySize] = s;
+    list->nameArraySize++;
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_completion_cache_path(const bool installed, char buf[]) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, true);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = snprintf(buf, PATH_MAX, "%s/completion-%s.txt", xcpkgHomeDIR, installed ? "installed" : "available");
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static int compare_name(const void * a, const void * b) {
+    return strcmp(*((const char * const *)a), *((const char * const *)b));
+}
+
+static int xcpkg_completion_cache_write(const bool installed, NameList * list) {
+    char cacheFilePath[PATH_MAX];
+
+    int ret = xcpkg_completion_cache_path(installed, cacheFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char tmpFilePath[PATH_MAX];
+
+    ret = snprintf(tmpFilePath, PATH_MAX, "%s.%d.tmp", cacheFilePath, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    qsort(list->nameArray, list->nameArraySize, sizeof(char*), compare_name);
+
+    FILE * file = fopen(tmpFilePath, "w");
+
+    if (file == NULL) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    for (size_t i = 0U; i < list->nameArraySize; i++) {
+        if (i > 0U && strcmp(list->nameArray[i - 1U], list->nameArray[i]) == 0) {
+            continue;
+        }
+
+        fprintf(file, "%s\n", list->nameArray[i]);
+    }
+
+    if (ferror(file)) {
+        perror(tmpFilePath);
+        fclose(file);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (fclose(file) != 0) {
+        perror(tmpFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    // readers see either the old cache or the new cache, never a partially written one
+    if (rename(tmpFilePath, cacheFilePath) != 0) {
+        perror(cacheFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_completion_cache_load(const bool installed, NameList * list) {
+    char cacheFilePath[PATH_MAX];
+
+    int ret = xcpkg_completion_cache_path(installed, cacheFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    FILE * file = fopen(cacheFilePath, "r");
+
+    if (file == NULL) {
+        if (errno == ENOENT) {
+            return XCPKG_ERROR_NOT_FOUND;
+        } else {
+            perror(cacheFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    char * line = NULL;
+    size_t lineCapacity = 0U;
+
+    ssize_t lineLength;
+
+    while ((lineLength = getline(&line, &lineCapacity, file)) > 0) {
+        if (line[lineLength - 1] == '\n') {
+            lineLength--;
+        }
+
+        if (lineLength == 0) {
+            continue;
+        }
+
+        ret = name_list_add(list, line, (size_t)lineLength);
+
+        if (ret != XCPKG_OK) {
+            break;
+        }
+    }
+
+    if (ret == XCPKG_OK && ferror(file)) {
+        perror(cacheFilePath);
+        ret = XCPKG_ERROR;
+    }
+
+    free(line);
+    fclose(file);
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int xcpkg_completion_cache_scan_the_installed_packages(NameList * list) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char packageInstalledRootDIR[PATH_MAX];
+
+    ret = snprintf(packageInstalledRootDIR, PATH_MAX, "%s/installed", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    DIR * dir = opendir(packageInstalledRootDIR);
+
+    if (dir == NULL) {
+        if (errno == ENOENT) {
+            return XCPKG_OK;
+        } else {
+            perror(packageInstalledRootDIR);
+            return XCPKG_ERROR;
+        }
+    }
+
+    struct stat st;
+
+    for (;;) {
+        errno = 0;
+
+        struct dirent * dir_entry = readdir(dir);
+
+        if (dir_entry == NULL) {
+            if (errno == 0) {
+                closedir(dir);
+                return XCPKG_OK;
+            } else {
+                perror(packageInstalledRootDIR);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+
+        const char * targetPlatformSpec = dir_entry->d_name;
+
+        if (xcpkg_check_if_the_given_argument_matches_platform_spec_pattern(targetPlatformSpec) != XCPKG_OK) {
+            continue;
+        }
+
+        int fd = openat(dirfd(dir), targetPlatformSpec, O_RDONLY | O_DIRECTORY);
+
+        if (fd == -1) {
+            continue;
+        }
+
+        DIR * dir2 = fdopendir(fd);
+
+        if (dir2 == NULL) {
+            perror(targetPlatformSpec);
+            close(fd);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        for (;;) {
+            errno = 0;
+
+            struct dirent * dir_entry2 = readdir(dir2);
+
+            if (dir_entry2 == NULL) {
+                if (errno == 0) {
+                    break;
+                } else {
+                    perror(targetPlatformSpec);
+                    closedir(dir2);
+                    closedir(dir);
+                    return XCPKG_ERROR;
+                }
+            }
+
+            const char * packageName = dir_entry2->d_name;
+
+            if (xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName) != XCPKG_OK) {
+                continue;
+            }
+
+            char buf[PATH_MAX];
+
+            ret = snprintf(buf, PATH_MAX, "%s/%s", packageName, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+            if (ret < 0) {
+                perror(NULL);
+                closedir(dir2);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+
+            if (fstatat(fd, buf, &st, 0) != 0 || !S_ISREG(st.st_mode)) {
+                continue;
+            }
+
+            ret = snprintf(buf, PATH_MAX, "%s/%s", targetPlatformSpec, packageName);
+
+            if (ret < 0) {
+                perror(NULL);
+                closedir(dir2);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+
+            ret = name_list_add(list, buf, (size_t)ret);
+
+            if (ret != XCPKG_OK) {
+                closedir(dir2);
+                closedir(dir);
+                return ret;
+            }
+        }
+
+        closedir(dir2);
+    }
+}
+
+static int available_package_callback(const char * targetPlatformName __attribute__((unused)), const char * packageName, const char * formulaFilePath __attribute__((unused)), const bool verbose __attribute__((unused)), const size_t index __attribute__((unused)), const void * p1 __attribute__((unused)), void * p2) {
+    return name_list_add((NameList*)p2, packageName, strlen(packageName));
+}
+
+static int xcpkg_completion_cache_rebuild_locked(const bool installed) {
+    NameList list = {0};
+
+    int ret;
+
+    if (installed) {
+        ret = xcpkg_completion_cache_scan_the_installed_packages(&list);
+    } else {
+        ret = xcpkg_scan_the_available_packages(NULL, false, available_package_callback, NULL, &list);
+    }
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_completion_cache_write(installed, &list);
+    }
+
+    name_list_free(&list);
+
+    return ret;
+}
+
+int xcpkg_completion_cache_rebuild(const bool installed) {
+    if (!installed) {
+        return xcpkg_completion_cache_rebuild_locked(false);
+    }
+
+    int lockFD;
+
+    int ret = xcpkg_lock_named("completion-installed", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_completion_cache_rebuild_locked(true);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
+int xcpkg_completion_cache_write_available(char * packageNameArray[], const size_t packageNameArraySize) {
+    NameList list = {
+        .nameArray = packageNameArray,
+        .nameArraySize = packageNameArraySize,
+        .nameArrayCapacity = packageNameArraySize
+    };
+
+    return xcpkg_completion_cache_write(false, &list);
+}
+
+static int xcpkg_completion_cache_update_locked(const char * packageName, const char * targetPlatformSpec, const bool installed) {
+    NameList list = {0};
+
+    int ret = xcpkg_completion_cache_load(true, &list);
+
+    if (ret == XCPKG_ERROR_NOT_FOUND) {
+        return xcpkg_completion_cache_rebuild_locked(true);
+    }
+
+    if (ret != XCPKG_OK) {
+        name_list_free(&list);
+        return ret;
+    }
+
+    char name[PATH_MAX];
+
+    ret = snprintf(name, PATH_MAX, "%s/%s", targetPlatformSpec, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        name_list_free(&list);
+        return XCPKG_ERROR;
+    }
+
+    size_t nameLength = (size_t)ret;
+
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < list.nameArraySize; i++) {
+        if (strcmp(list.nameArray[i], name) == 0) {
+            free(list.nameArray[i]);
+        } else {
+            list.nameArray[n++] = list.nameArray[i];
+        }
+    }
+
+    list.nameArraySize = n;
+
+    if (installed) {
+        ret = name_list_add(&list, name, nameLength);
+    } else {
+        ret = XCPKG_OK;
+    }
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_completion_cache_write(true, &list);
+    }
+
+    name_list_free(&list);
+
+    return ret;
+}
+
+// two updates at the same time would lose one of them
+int xcpkg_completion_cache_update(const char * packageName, const char * targetPlatformSpec, const bool installed) {
+    int lockFD;
+
+    int ret = xcpkg_lock_named("completion-installed", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_completion_cache_update_locked(packageName, targetPlatformSpec, installed);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the offset of the first byte of the line which contains offset
+static inline __attribute__((always_inline)) size_t line_begin(const char * data, size_t offset) {
+    while (offset > 0U && data[offset - 1U] != '\n') {
+        offset--;
+    }
+
+    return offset;
+}
+
+// compare the line at offset with the first prefixLength bytes of prefix
+static inline __attribute__((always_inline)) int compare_line_with_prefix(const char * data, const size_t size, const size_t offset, const char * prefix, const size_t prefixLength) {
+    for (size_t i = 0U; i < prefixLength; i++) {
+        if (offset + i == size || data[offset + i] == '\n') {
+            return -1;
+        }
+
+        unsigned char a = (unsigned char)data[offset + i];
+        unsigned char b = (unsigned char)prefix[i];
+
+        if (a != b) {
+            return a < b ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+int xcpkg_complete(const char * prefix, const bool installed) {
+    if (prefix == NULL) {
+        prefix = "";
+    }
+
+    char cacheFilePath[PATH_MAX];
+
+    int ret = xcpkg_completion_cache_path(installed, cacheFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    int fd = open(cacheFilePath, O_RDONLY);
+
+    if (fd == -1) {
+        if (errno != ENOENT) {
+            perror(cacheFilePath);
+            return XCPKG_ERROR;
+        }
+
+        ret = xcpkg_completion_cache_rebuild(installed);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        fd = open(cacheFilePath, O_RDONLY);
+
+        if (fd == -1) {
+            perror(cacheFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        perror(cacheFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    size_t size = (size_t)st.st_size;
+
+    if (size == 0U) {
+        close(fd);
+        return XCPKG_OK;
+    }
+
+    const char * data = (const char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        perror(cacheFilePath);
+        return XCPKG_ERROR;
+    }
+
+    size_t prefixLength = strlen(prefix);
+
+    // find the first line which is not less than prefix, lo and hi are always line beginnings
+    size_t lo = 0U;
+    size_t hi = size;
+
+    while (lo < hi) {
+        size_t mid = line_begin(data, lo + ((hi - lo) >> 1));
+
+        const char * p = memchr(data + mid, '\n', size - mid);
+
+        size_t next = (p == NULL) ? size : (size_t)(p - data) + 1U;
+
+        if (compare_line_with_prefix(data, size, mid, prefix, prefixLength) < 0) {
+            lo = next;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (size_t offset = lo; offset < size; ) {
+        if (compare_line_with_prefix(data, size, offset, prefix, prefixLength) != 0) {
+            break;
+        }
+
+        const char * p = memchr(data + offset, '\n', size - offset);
+
+        size_t next = (p == NULL) ? size : (size_t)(p - data) + 1U;
+
+        fwrite(data + offset, 1, next - offset, stdout);
+
+        if (p == NULL) {
+            fputc('\n', stdout);
+        }
+
+        offset = next;
+    }
+
+    munmap((void*)data, size);
+
+    return XCPKG_OK;
+}
@@ -0,0 +1,954 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#if defined (__linux__)
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#elif defined (__APPLE__)
+#include <sys/clonefile.h>
+#endif
+
+#include "../core/log.h"
+#include "../core/string-map.h"
+#include "../base/sha256sum.h"
+
+#include "../xcpkg.h"
+
+// the dedup index starts with the header line, then every line is a file which was processed:
+//
+// <SHA256SUM><TAB><DEV><TAB><INO><TAB><SIZE><TAB><MTIME-SEC>.<MTIME-NSEC><TAB><PATH-RELATIVE-TO-XCPKG_HOME>
+//
+// a file is hashed again only if its dev, ino, size or mtime changed.
+// the first still unchanged file of a sha256sum is the one which the other files of this sha256sum are replaced with.
+
+#define XCPKG_DEDUP_INDEX_HEADER "XCPKG-DEDUP-INDEX 1\n"
+
+typedef struct {
+    // relative to XCPKG_HOME
+    char * path;
+
+    char  sha256sum[65];
+
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    long  mtimeSec;
+    long  mtimeNsec;
+
+    // whether sha256sum is computed from the file identified by the above
+    bool  hashed;
+
+    // 0 means it is not checked in this run, 1 means it is unchanged, -1 means it is removed or changed
+    int   state;
+} DedupFile;
+
+typedef struct {
+    DedupFile * fileArray;
+    size_t      fileArraySize;
+    size_t      fileArrayCapacity;
+
+    // path -> the index in fileArray, they are added in the same order
+    StringMap pathIndex;
+} DedupIndex;
+
+typedef struct {
+    size_t * array;
+    size_t   size;
+    size_t   capacity;
+} IndexList;
+
+static int index_list_push(IndexList * list, const size_t value) {
+    if (list->size == list->capacity) {
+        size_t newCapacity = list->capacity == 0U ? 256U : (list->capacity << 1);
+
+        size_t * p = (size_t*)realloc(list->array, newCapacity * sizeof(size_t));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        list->array = p;
+        list->capacity = newCapacity;
+    }
+
+    list->array[list->size++] = value;
+
+    return XCPKG_OK;
+}
+
+static void get_times(const struct stat * st, struct timespec times[2]) {
+#if defined (__APPLE__)
+    times[0] = st->st_atimespec;
+    times[1] = st->st_mtimespec;
+#else
+    times[0] = st->st_atim;
+    times[1] = st->st_mtim;
+#endif
+}
+
+static bool dedup_file_matches(const DedupFile * file, const struct stat * st) {
+    struct timespec times[2];
+
+    get_times(st, times);
+
+    return file->dev == st->st_dev && file->ino == st->st_ino && file->size == st->st_size && file->mtimeSec == (long)times[1].tv_sec && file->mtimeNsec == (long)times[1].tv_nsec;
+}
+
+static void dedup_file_set(DedupFile * file, const struct stat * st) {
+    struct timespec times[2];
+
+    get_times(st, times);
+
+    file->dev  = st->st_dev;
+    file->ino  = st->st_ino;
+    file->size = st->st_size;
+    file->mtimeSec  = (long)times[1].tv_sec;
+    file->mtimeNsec = (long)times[1].tv_nsec;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int dedup_index_add(DedupIndex * index, const char * path, const size_t pathLength, size_t * i) {
+    bool added;
+
+    if (string_map_add(&index->pathIndex, path, pathLength, i, &added) != 0) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    if (!added) {
+        return XCPKG_OK;
+    }
+
+    if (index->fileArraySize == index->fileArrayCapacity) {
+        size_t newCapacity = index->fileArrayCapacity == 0U ? 256U : (index->fileArrayCapacity << 1);
+
+        DedupFile * p = (DedupFile*)realloc(index->fileArray, newCapacity * sizeof(DedupFile));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        index->fileArray = p;
+        index->fileArrayCapacity = newCapacity;
+    }
+
+    DedupFile * file = &index->fileArray[index->fileArraySize];
+
+    memset(file, 0, sizeof(DedupFile));
+
+    // the key copy owned by pathIndex
+    file->path = index->pathIndex.entryArray[*i].key;
+
+    index->fileArraySize++;
+
+    return XCPKG_OK;
+}
+
+static void dedup_index_free(DedupIndex * index) {
+    free(index->fileArray);
+
+    string_map_free(&index->pathIndex);
+
+    memset(index, 0, sizeof(DedupIndex));
+}
+
+// it is only a cache, a malformed line is ignored
+static int dedup_index_load(DedupIndex * index, const char * indexFilePath) {
+    FILE * file = fopen(indexFilePath, "r");
+
+    if (file == NULL) {
+        if (errno == ENOENT) {
+            return XCPKG_OK;
+        } else {
+            perror(indexFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    char * line = NULL;
+    size_t lineCapacity = 0U;
+
+    ssize_t n = getline(&line, &lineCapacity, file);
+
+    int ret = XCPKG_OK;
+
+    if (n > 0 && strcmp(line, XCPKG_DEDUP_INDEX_HEADER) == 0) {
+        while ((n = getline(&line, &lineCapacity, file)) > 0) {
+            if (line[n - 1] != '\n') {
+                break;
+            }
+
+            line[--n] = '\0';
+
+            char * fields[6];
+
+            char * p = line;
+
+            size_t fieldCount = 0U;
+
+            for (; fieldCount < 5U; fieldCount++) {
+                fields[fieldCount] = p;
+
+                p = strchr(p, '\t');
+
+                if (p == NULL) {
+                    break;
+                }
+
+                p[0] = '\0';
+                p++;
+            }
+
+            if (fieldCount != 5U || strlen(fields[0]) != 64U || p[0] == '\0') {
+                continue;
+            }
+
+            fields[5] = p;
+
+            char * q = strchr(fields[4], '.');
+
+            if (q == NULL) {
+                continue;
+            }
+
+            size_t i;
+
+            ret = dedup_index_add(index, fields[5], strlen(fields[5]), &i);
+
+            if (ret != XCPKG_OK) {
+                break;
+            }
+
+            DedupFile * f = &index->fileArray[i];
+
+            memcpy(f->sha256sum, fields[0], 65);
+
+            f->dev  = (dev_t)strtoull(fields[1], NULL, 10);
+            f->ino  = (ino_t)strtoull(fields[2], NULL, 10);
+            f->size = (off_t)strtoll (fields[3], NULL, 10);
+            f->mtimeSec  = strtol(fields[4], NULL, 10);
+            f->mtimeNsec = strtol(q + 1,     NULL, 10);
+            f->hashed = true;
+        }
+    }
+
+    free(line);
+    fclose(file);
+
+    return ret;
+}
+
+// the files which are not checked in this run are kept only if they are still there unchanged
+static int dedup_index_write(DedupIndex * index, const char * indexFilePath, const char * xcpkgHomeDIR) {
+    char tmpFilePath[PATH_MAX];
+
+    int ret = snprintf(tmpFilePath, PATH_MAX, "%s.%d.tmp", indexFilePath, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * file = fopen(tmpFilePath, "w");
+
+    if (file == NULL) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    fputs(XCPKG_DEDUP_INDEX_HEADER, file);
+
+    char filePath[PATH_MAX];
+
+    struct stat st;
+
+    for (size_t i = 0U; i < index->fileArraySize; i++) {
+        DedupFile * f = &index->fileArray[i];
+
+        if (!f->hashed) {
+            continue;
+        }
+
+        if (f->state == 0) {
+            ret = snprintf(filePath, PATH_MAX, "%s/%s", xcpkgHomeDIR, f->path);
+
+            if (ret < 0) {
+                perror(NULL);
+                fclose(file);
+                unlink(tmpFilePath);
+                return XCPKG_ERROR;
+            }
+
+            f->state = (lstat(filePath, &st) == 0 && dedup_file_matches(f, &st)) ? 1 : -1;
+        }
+
+        if (f->state == 1) {
+            fprintf(file, "%s\t%llu\t%llu\t%lld\t%ld.%09ld\t%s\n", f->sha256sum, (unsigned long long)f->dev, (unsigned long long)f->ino, (long long)f->size, f->mtimeSec, f->mtimeNsec, f->path);
+        }
+    }
+
+    if (fflush(file) != 0 || ferror(file)) {
+        perror(tmpFilePath);
+        fclose(file);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (fclose(file) != 0) {
+        perror(tmpFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (rename(tmpFilePath, indexFilePath) != 0) {
+        perror(indexFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the filesystem can not do it at all, so that it is not worth trying the other files
+#define DEDUP_UNSUPPORTED 1
+
+static bool is_unsupported(const int errnum) {
+    return errnum == EXDEV || errnum == EINVAL || errnum == ENOTTY || errnum == ENOSYS || errnum == EOPNOTSUPP
+#if defined (ENOTSUP) && ENOTSUP != EOPNOTSUPP
+        || errnum == ENOTSUP
+#endif
+    ;
+}
+
+// the new file is created at a temporary path then renamed to toFilePath, so that toFilePath is always complete
+static int reflink_a_file(const char * fromFilePath, const char * toFilePath, const char * tmpFilePath, const struct stat * st) {
+    struct timespec times[2];
+
+    get_times(st, times);
+
+    unlink(tmpFilePath);
+
+#if defined (__linux__)
+    int fromFD = open(fromFilePath, O_RDONLY | O_CLOEXEC);
+
+    if (fromFD == -1) {
+        perror(fromFilePath);
+        return XCPKG_ERROR;
+    }
+
+    int tmpFD = open(tmpFilePath, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+
+    if (tmpFD == -1) {
+        perror(tmpFilePath);
+        close(fromFD);
+        return XCPKG_ERROR;
+    }
+
+    if (ioctl(tmpFD, FICLONE, fromFD) != 0) {
+        int errnum = errno;
+
+        close(fromFD);
+        close(tmpFD);
+        unlink(tmpFilePath);
+
+        if (is_unsupported(errnum)) {
+            return DEDUP_UNSUPPORTED;
+        }
+
+        errno = errnum;
+        perror(toFilePath);
+        return XCPKG_ERROR;
+    }
+
+    close(fromFD);
+
+    if (fchmod(tmpFD, st->st_mode & 07777) != 0 || futimens(tmpFD, times) != 0) {
+        perror(tmpFilePath);
+        close(tmpFD);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    close(tmpFD);
+#elif defined (__APPLE__)
+    if (clonefile(fromFilePath, tmpFilePath, CLONE_NOFOLLOW | CLONE_NOOWNERCOPY) != 0) {
+        if (is_unsupported(errno)) {
+            return DEDUP_UNSUPPORTED;
+        }
+
+        perror(toFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (chmod(tmpFilePath, st->st_mode & 07777) != 0 || utimensat(AT_FDCWD, tmpFilePath, times, AT_SYMLINK_NOFOLLOW) != 0) {
+        perror(tmpFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+#else
+    (void)fromFilePath;
+    (void)times;
+    return DEDUP_UNSUPPORTED;
+#endif
+
+    if (rename(tmpFilePath, toFilePath) != 0) {
+        perror(toFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static int hardlink_a_file(const char * fromFilePath, const char * toFilePath, const char * tmpFilePath) {
+    unlink(tmpFilePath);
+
+    if (link(fromFilePath, tmpFilePath) != 0) {
+        if (errno == EXDEV || errno == EOPNOTSUPP) {
+            return DEDUP_UNSUPPORTED;
+        }
+
+        // EPERM is about this file only, such as fs.protected_hardlinks on a file owned by another user, it is skipped
+
+        perror(toFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (rename(tmpFilePath, toFilePath) != 0) {
+        perror(toFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// add the regular files listed in the manifest of the given installed package to the index
+static int dedup_scan_a_package(DedupIndex * index, const char * xcpkgHomeDIR, const XCPKGInstalledPackage * package, IndexList * candidateList, IndexList * unhashedList) {
+    char manifestFilePath[PATH_MAX];
+
+    int ret = snprintf(manifestFilePath, PATH_MAX, "%s/installed/%s/%s/%s", xcpkgHomeDIR, package->targetPlatformSpec, package->sha, XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * manifestFile = fopen(manifestFilePath, "r");
+
+    if (manifestFile == NULL) {
+        perror(manifestFilePath);
+        return XCPKG_ERROR_PACKAGE_IS_BROKEN;
+    }
+
+    char * line = NULL;
+    size_t lineCapacity = 0U;
+
+    ssize_t n;
+
+    char path[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    struct stat st;
+
+    ret = XCPKG_OK;
+
+    while ((n = getline(&line, &lineCapacity, manifestFile)) > 0) {
+        if (line[n - 1] == '\n') {
+            line[--n] = '\0';
+        }
+
+        if (line[0] != 'f' || line[1] != '|') {
+            continue;
+        }
+
+        // the receipt and the manifest belong to this installation only
+        if (strncmp(line + 2, ".xcpkg/", 7) == 0) {
+            continue;
+        }
+
+        int pathLength = snprintf(path, PATH_MAX, "installed/%s/%s/%s", package->targetPlatformSpec, package->sha, line + 2);
+
+        if (pathLength < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            break;
+        }
+
+        ret = snprintf(filePath, PATH_MAX, "%s/%s", xcpkgHomeDIR, path);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            break;
+        }
+
+        ret = XCPKG_OK;
+
+        if (lstat(filePath, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+            continue;
+        }
+
+        size_t i;
+
+        ret = dedup_index_add(index, path, (size_t)pathLength, &i);
+
+        if (ret != XCPKG_OK) {
+            break;
+        }
+
+        DedupFile * f = &index->fileArray[i];
+
+        // listed twice
+        if (f->state == 1) {
+            continue;
+        }
+
+        f->state = 1;
+
+        if (!(f->hashed && dedup_file_matches(f, &st))) {
+            dedup_file_set(f, &st);
+
+            f->hashed = false;
+
+            ret = index_list_push(unhashedList, i);
+
+            if (ret != XCPKG_OK) {
+                break;
+            }
+        }
+
+        ret = index_list_push(candidateList, i);
+
+        if (ret != XCPKG_OK) {
+            break;
+        }
+    }
+
+    free(line);
+    fclose(manifestFile);
+
+    return ret;
+}
+
+static int dedup_hash_the_files(DedupIndex * index, const char * xcpkgHomeDIR, const IndexList * unhashedList) {
+    size_t n = unhashedList->size;
+
+    if (n == 0U) {
+        return XCPKG_OK;
+    }
+
+    char * * filePaths = (char**)calloc(n, sizeof(char*));
+    char  (* outputBuffers)[65] = (char(*)[65])calloc(n, 65U);
+    int    * rets = (int*)calloc(n, sizeof(int));
+
+    int ret = XCPKG_OK;
+
+    if (filePaths == NULL || outputBuffers == NULL || rets == NULL) {
+        ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        goto finalize;
+    }
+
+    for (size_t i = 0U; i < n; i++) {
+        const DedupFile * f = &index->fileArray[unhashedList->array[i]];
+
+        size_t capacity = strlen(xcpkgHomeDIR) + strlen(f->path) + 2U;
+
+        filePaths[i] = (char*)malloc(capacity);
+
+        if (filePaths[i] == NULL) {
+            ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+            goto finalize;
+        }
+
+        snprintf(filePaths[i], capacity, "%s/%s", xcpkgHomeDIR, f->path);
+    }
+
+    // a file which can not be hashed is just not deduplicated
+    sha256sum_of_files(outputBuffers, rets, (const char * const *)filePaths, n, 0U);
+
+    for (size_t i = 0U; i < n; i++) {
+        DedupFile * f = &index->fileArray[unhashedList->array[i]];
+
+        if (rets[i] == XCPKG_OK) {
+            memcpy(f->sha256sum, outputBuffers[i], 65);
+            f->hashed = true;
+        } else {
+            f->state = -1;
+        }
+    }
+
+finalize:
+    if (filePaths != NULL) {
+        for (size_t i = 0U; i < n; i++) {
+            free(filePaths[i]);
+        }
+    }
+
+    free(filePaths);
+    free(outputBuffers);
+    free(rets);
+
+    return ret;
+}
+
+static int xcpkg_dedup_locked(const char * packageName, const char * targetPlatformSpec, const XCPKGDedupMode mode, const bool dryrun, const bool verbose) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, true);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char indexFilePath[PATH_MAX];
+
+    ret = snprintf(indexFilePath, PATH_MAX, "%s/dedup.idx", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    XCPKGInstalledDB db;
+
+    ret = xcpkg_installed_db_load(&db);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (packageName != NULL && xcpkg_installed_db_find(&db, packageName, targetPlatformSpec) == NULL) {
+        xcpkg_installed_db_free(&db);
+        return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+    }
+
+    DedupIndex index = {0};
+
+    IndexList candidateList = {0};
+    IndexList unhashedList = {0};
+
+    // candidatePackageList.array[k] is the index in db.packageArray of the package which candidateList.array[k] belongs to
+    IndexList candidatePackageList = {0};
+
+    // the lock of the package whose files are being replaced, -1 if it is being installed or uninstalled by another xcpkg process
+    size_t lockedPackageIndex = SIZE_MAX;
+    int    packageLockFD = -1;
+
+    // sha256sum -> the index in repArray, whose value is the index in index.fileArray of the file which the others are replaced with
+    StringMap shaIndex = {0};
+
+    size_t * repArray = NULL;
+
+    ret = dedup_index_load(&index, indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    for (size_t i = 0U; i < db.packageArraySize; i++) {
+        const XCPKGInstalledPackage * package = &db.packageArray[i];
+
+        if (targetPlatformSpec != NULL && strcmp(package->targetPlatformSpec, targetPlatformSpec) != 0) {
+            continue;
+        }
+
+        if (packageName != NULL && strcmp(package->packageName, packageName) != 0) {
+            continue;
+        }
+
+        size_t candidateCount = candidateList.size;
+
+        ret = dedup_scan_a_package(&index, xcpkgHomeDIR, package, &candidateList, &unhashedList);
+
+        if (ret == XCPKG_ERROR_PACKAGE_IS_BROKEN) {
+            continue;
+        }
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+
+        for (size_t k = candidateCount; k < candidateList.size; k++) {
+            ret = index_list_push(&candidatePackageList, i);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+    }
+
+    ret = dedup_hash_the_files(&index, xcpkgHomeDIR, &unhashedList);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    // the files recorded earlier come first, so that they are preferred to be kept
+    repArray = (size_t*)malloc((index.fileArraySize + 1U) * sizeof(size_t));
+
+    if (repArray == NULL) {
+        ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        goto finalize;
+    }
+
+    for (size_t i = 0U; i < index.fileArraySize; i++) {
+        const DedupFile * f = &index.fileArray[i];
+
+        if (!f->hashed || f->state == -1) {
+            continue;
+        }
+
+        size_t slot;
+        bool   added;
+
+        if (string_map_add(&shaIndex, f->sha256sum, 64U, &slot, &added) != 0) {
+            ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+            goto finalize;
+        }
+
+        if (added) {
+            repArray[slot] = i;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t replacedCount = 0U;
+    size_t sharedCount = 0U;
+    size_t skippedCount = 0U;
+
+    unsigned long long savedBytes = 0U;
+
+    char repFilePath[PATH_MAX];
+    char filePath[PATH_MAX];
+    char tmpFilePath[PATH_MAX];
+
+    struct stat repStat;
+    struct stat st;
+
+    for (size_t k = 0U; k < candidateList.size; k++) {
+        size_t i = candidateList.array[k];
+
+        DedupFile * f = &index.fileArray[i];
+
+        if (!f->hashed || f->state != 1) {
+            continue;
+        }
+
+        size_t slot;
+
+        if (!string_map_find(&shaIndex, f->sha256sum, 64U, &slot)) {
+            continue;
+        }
+
+        size_t r = repArray[slot];
+
+        if (r == i) {
+            continue;
+        }
+
+        DedupFile * rep = &index.fileArray[r];
+
+        ret = snprintf(repFilePath, PATH_MAX, "%s/%s", xcpkgHomeDIR, rep->path);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        // the package it belongs to might have been uninstalled, or it might have been modified
+        if (lstat(repFilePath, &repStat) != 0 || !S_ISREG(repStat.st_mode) || !dedup_file_matches(rep, &repStat)) {
+            rep->state = -1;
+            repArray[slot] = i;
+            continue;
+        }
+
+        rep->state = 1;
+
+        ret = snprintf(filePath, PATH_MAX, "%s/%s", xcpkgHomeDIR, f->path);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        if (lstat(filePath, &st) != 0 || !dedup_file_matches(f, &st)) {
+            f->state = -1;
+            continue;
+        }
+
+        if (st.st_dev == repStat.st_dev && st.st_ino == repStat.st_ino) {
+            sharedCount++;
+            continue;
+        }
+
+        if (st.st_dev != repStat.st_dev) {
+            skippedCount++;
+            continue;
+        }
+
+        // a hardlink has only one mode and owner
+        if (mode == XCPKGDedupMode_hardlink && (st.st_mode != repStat.st_mode || st.st_uid != repStat.st_uid || st.st_gid != repStat.st_gid)) {
+            skippedCount++;
+            continue;
+        }
+
+        // the data blocks of a file which has other hardlinks are not freed
+        unsigned long long size = (mode == XCPKGDedupMode_hardlink && st.st_nlink > 1) ? 0U : (unsigned long long)st.st_size;
+
+        if (dryrun) {
+            replacedCount++;
+            savedBytes += size;
+            continue;
+        }
+
+        // uninstall removes the directory which the temporary file is created in
+        size_t packageIndex = candidatePackageList.array[k];
+
+        if (packageIndex != lockedPackageIndex) {
+            const XCPKGInstalledPackage * package = &db.packageArray[packageIndex];
+
+            xcpkg_unlock(packageLockFD);
+
+            packageLockFD = -1;
+
+            lockedPackageIndex = packageIndex;
+
+            ret = xcpkg_trylock_the_installed_package(package->packageName, package->targetPlatformSpec, &packageLockFD);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+
+            if (packageLockFD == -1) {
+                fprintf(stderr, "package '%s' is being installed or uninstalled by another xcpkg process, its files are skipped.\n", package->packageName);
+            }
+        }
+
+        if (packageLockFD == -1) {
+            skippedCount++;
+            continue;
+        }
+
+        // it might have been replaced before the lock was taken
+        if (lstat(filePath, &st) != 0 || !dedup_file_matches(f, &st)) {
+            f->state = -1;
+            continue;
+        }
+
+        ret = snprintf(tmpFilePath, PATH_MAX, "%s.xcpkg-dedup", filePath);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        if (mode == XCPKGDedupMode_hardlink) {
+            ret = hardlink_a_file(repFilePath, filePath, tmpFilePath);
+        } else {
+            ret = reflink_a_file(repFilePath, filePath, tmpFilePath, &st);
+        }
+
+        if (ret == DEDUP_UNSUPPORTED) {
+            if (mode == XCPKGDedupMode_hardlink) {
+                fprintf(stderr, "hardlinks are not supported on the filesystem of %s\n", filePath);
+            } else {
+                fprintf(stderr, "reflinks are not supported on the filesystem of %s, try hardlinks instead.\n", filePath);
+            }
+
+            ret = XCPKG_OK;
+            break;
+        }
+
+        if (ret != XCPKG_OK) {
+            skippedCount++;
+            continue;
+        }
+
+        if (verbose) {
+            printf("%s => %s\n", filePath, repFilePath);
+        }
+
+        replacedCount++;
+        savedBytes += size;
+
+        if (lstat(filePath, &st) == 0) {
+            dedup_file_set(f, &st);
+        } else {
+            f->state = -1;
+        }
+    }
+
+    ret = dedup_index_write(&index, indexFilePath, xcpkgHomeDIR);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    printf("%zu files checked, %zu files %s %s, %zu files already shared, %zu files skipped, %.1f MiB %s.\n",
+            candidateList.size,
+            replacedCount,
+            dryrun ? "would be replaced with" : "replaced with",
+            mode == XCPKGDedupMode_hardlink ? "hardlinks" : "reflinks",
+            sharedCount,
+            skippedCount,
+            (double)savedBytes / 1048576.0,
+            dryrun ? "would be saved" : "saved");
+
+finalize:
+    xcpkg_unlock(packageLockFD);
+
+    xcpkg_installed_db_free(&db);
+
+    dedup_index_free(&index);
+
+    string_map_free(&shaIndex);
+
+    free(repArray);
+    free(candidateList.array);
+    free(candidatePackageList.array);
+    free(unhashedList.array);
+
+    return ret;
+}
+
+int xcpkg_dedup(const char * packageName, const char * targetPlatformSpec, const XCPKGDedupMode mode, const bool dryrun, const bool verbose) {
+    if (packageName != NULL && targetPlatformSpec == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    // one dedup at a time
+    int lockFD;
+
+    int ret = xcpkg_lock_named("dedup", "dedup.idx", &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_dedup_locked(packageName, targetPlatformSpec, mode, dryrun, verbose);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
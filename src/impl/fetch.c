@@ -10,31 +10,8 @@
 
 #include "../xcpkg.h"
 
-static int xcpkg_fetch_git(const char * packageName, XCPKGFormula * formula, const char * xcpkgDownloadsDIR, size_t xcpkgDownloadsDIRLength) {
-    size_t gitRepositoryDIRCapacity = xcpkgDownloadsDIRLength + strlen(packageName) + 6U;
-    char   gitRepositoryDIR[gitRepositoryDIRCapacity];
-
-    int ret = snprintf(gitRepositoryDIR, gitRepositoryDIRCapacity, "%s/%s.git", xcpkgDownloadsDIR, packageName);
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
-    struct stat st;
-
-    if (stat(gitRepositoryDIR, &st) == 0) {
-        if (!S_ISDIR(st.st_mode)) {
-            fprintf(stderr, "%s was expected to be a directory, but it was not.\n", gitRepositoryDIR);
-            return XCPKG_ERROR;
-        }
-    } else {
-        if (mkdir(gitRepositoryDIR, S_IRWXU) != 0) {
-            perror(gitRepositoryDIR);
-            return XCPKG_ERROR;
-        }
-    }
-
+// the objects are fetched into the mirror of git-url, from which the later builds check out the source without touching the network again
+static int xcpkg_fetch_git(XCPKGFormula * formula, const char * xcpkgDownloadsDIR) {
     const char * remoteRef;
 
     if (formula->git_sha == NULL) {
@@ -42,8 +19,8 @@ static int xcpkg_fetch_git(const char * packageName, XCPKGFormula * formula, con
     } else {
         remoteRef = formula->git_sha;
     }
-    
-    return xcpkg_git_sync(gitRepositoryDIR, formula->git_url, remoteRef, "refs/remotes/origin/master", "master", formula->git_nth);
+
+    return xcpkg_git_mirror_fetch(xcpkgDownloadsDIR, formula->git_url, remoteRef, formula->git_nth, NULL, NULL);
 }
 
 int xcpkg_fetch(const char * packageName, const char * targetPlatformName, const bool verbose) {
@@ -70,7 +47,7 @@ int xcpkg_fetch(const char * packageName, const char * targetPlatformName, const
     ///////////////////////////////////////////////////////////////
 
     if (formula->src_url == NULL) {
-        ret = xcpkg_fetch_git(packageName, formula, xcpkgDownloadsDIR, xcpkgDownloadsDIRCapacity);
+        ret = xcpkg_fetch_git(formula, xcpkgDownloadsDIR);
     } else {
         if (formula->src_is_dir) {
             fprintf(stderr, "src_url is point to local dir, so no need to fetch.\n");
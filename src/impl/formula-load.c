@@ -8,6 +8,8 @@
 
 #include <yaml.h>
 
+#include "../core/trace.h"
+
 #include "../xcpkg.h"
 
 static inline __attribute__((always_inline)) void string_buffer_append(char buf[], size_t * bufLengthP, const char * s) {
@@ -523,54 +525,54 @@ static inline int xcpkg_formula_set_value(XCPKGFormulaKeyCode keyCode, char * va
     }
 
     switch (keyCode) {
-        case FORMULA_KEY_CODE_summary: if (formula->summary != NULL) free(formula->summary); formula->summary = strdup(value); break;
-        case FORMULA_KEY_CODE_version: if (formula->version != NULL) free(formula->version); formula->version = strdup(value); break;
-        case FORMULA_KEY_CODE_license: if (formula->license != NULL) free(formula->license); formula->license = strdup(value); break;
-
-        case FORMULA_KEY_CODE_web_url: if (formula->web_url != NULL) free(formula->web_url); formula->web_url = strdup(value); break;
-
-        case FORMULA_KEY_CODE_git_url: if (formula->git_url != NULL) free(formula->git_url); formula->git_url = strdup(value); break;
-        case FORMULA_KEY_CODE_git_uri: if (formula->git_uri != NULL) free(formula->git_uri); formula->git_uri = strdup(value); break;
-        case FORMULA_KEY_CODE_git_sha: if (formula->git_sha != NULL) free(formula->git_sha); formula->git_sha = strdup(value); break;
-        case FORMULA_KEY_CODE_git_ref: if (formula->git_ref != NULL) free(formula->git_ref); formula->git_ref = strdup(value); break;
-
-        case FORMULA_KEY_CODE_src_url: if (formula->src_url != NULL) free(formula->src_url); formula->src_url = strdup(value); break;
-        case FORMULA_KEY_CODE_src_uri: if (formula->src_uri != NULL) free(formula->src_uri); formula->src_uri = strdup(value); break;
-        case FORMULA_KEY_CODE_src_sha: if (formula->src_sha != NULL) free(formula->src_sha); formula->src_sha = strdup(value); break;
-
-        case FORMULA_KEY_CODE_fix_url: if (formula->fix_url != NULL) free(formula->fix_url); formula->fix_url = strdup(value); break;
-        case FORMULA_KEY_CODE_fix_uri: if (formula->fix_uri != NULL) free(formula->fix_uri); formula->fix_uri = strdup(value); break;
-        case FORMULA_KEY_CODE_fix_sha: if (formula->fix_sha != NULL) free(formula->fix_sha); formula->fix_sha = strdup(value); break;
-        case FORMULA_KEY_CODE_fix_opt: if (formula->fix_opt != NULL) free(formula->fix_opt); formula->fix_opt = strdup(value); break;
-
-        case FORMULA_KEY_CODE_res_url: if (formula->res_url != NULL) free(formula->res_url); formula->res_url = strdup(value); break;
-        case FORMULA_KEY_CODE_res_uri: if (formula->res_uri != NULL) free(formula->res_uri); formula->res_uri = strdup(value); break;
-        case FORMULA_KEY_CODE_res_sha: if (formula->res_sha != NULL) free(formula->res_sha); formula->res_sha = strdup(value); break;
-
-        case FORMULA_KEY_CODE_dep_pkg: if (formula->dep_pkg != NULL) free(formula->dep_pkg); formula->dep_pkg = strdup(value); break;
-        case FORMULA_KEY_CODE_dep_lib: if (formula->dep_lib != NULL) free(formula->dep_lib); formula->dep_lib = strdup(value); break;
-        case FORMULA_KEY_CODE_dep_upp: if (formula->dep_upp != NULL) free(formula->dep_upp); formula->dep_upp = strdup(value); break;
-        case FORMULA_KEY_CODE_dep_pip: if (formula->dep_pip != NULL) free(formula->dep_pip); formula->dep_pip = strdup(value); break;
-        case FORMULA_KEY_CODE_dep_plm: if (formula->dep_plm != NULL) free(formula->dep_plm); formula->dep_plm = strdup(value); break;
-
-        case FORMULA_KEY_CODE_ppflags: if (formula->ppflags != NULL) free(formula->ppflags); formula->ppflags = strdup(value); break;
-        case FORMULA_KEY_CODE_ccflags: if (formula->ccflags != NULL) free(formula->ccflags); formula->ccflags = strdup(value); break;
-        case FORMULA_KEY_CODE_xxflags: if (formula->xxflags != NULL) free(formula->xxflags); formula->xxflags = strdup(value); break;
-        case FORMULA_KEY_CODE_ldflags: if (formula->ldflags != NULL) free(formula->ldflags); formula->ldflags = strdup(value); break;
-
-        case FORMULA_KEY_CODE_do12345: if (formula->do12345 != NULL) free(formula->do12345); formula->do12345 = strdup(value); break;
-        case FORMULA_KEY_CODE_dofetch: if (formula->dofetch != NULL) free(formula->dofetch); formula->dofetch = strdup(value); break;
-        case FORMULA_KEY_CODE_dopatch: if (formula->dopatch != NULL) free(formula->dopatch); formula->dopatch = strdup(value); break;
-        case FORMULA_KEY_CODE_prepare: if (formula->prepare != NULL) free(formula->prepare); formula->prepare = strdup(value); break;
-        case FORMULA_KEY_CODE_install: if (formula->install != NULL) free(formula->install); formula->install = strdup(value); break;
-        case FORMULA_KEY_CODE_dotweak: if (formula->dotweak != NULL) free(formula->dotweak); formula->dotweak = strdup(value); break;
-        case FORMULA_KEY_CODE_bindenv: if (formula->bindenv != NULL) free(formula->bindenv); formula->bindenv = strdup(value); break;
-        case FORMULA_KEY_CODE_caveats: if (formula->caveats != NULL) free(formula->caveats); formula->caveats = strdup(value); break;
-        case FORMULA_KEY_CODE_patches: if (formula->patches != NULL) free(formula->patches); formula->patches = strdup(value); break;
-        case FORMULA_KEY_CODE_reslist: if (formula->reslist != NULL) free(formula->reslist); formula->reslist = strdup(value); break;
-
-        case FORMULA_KEY_CODE_bsystem: if (formula->bsystem != NULL) free(formula->bsystem); formula->bsystem = strdup(value); break;
-        case FORMULA_KEY_CODE_bscript: if (formula->bscript != NULL) free(formula->bscript); formula->bscript = strdup(value); break;
+        case FORMULA_KEY_CODE_summary: if (formula->summary != NULL) free(formula->summary); formula->summary = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_version: if (formula->version != NULL) free(formula->version); formula->version = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_license: if (formula->license != NULL) free(formula->license); formula->license = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_web_url: if (formula->web_url != NULL) free(formula->web_url); formula->web_url = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_git_url: if (formula->git_url != NULL) free(formula->git_url); formula->git_url = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_git_uri: if (formula->git_uri != NULL) free(formula->git_uri); formula->git_uri = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_git_sha: if (formula->git_sha != NULL) free(formula->git_sha); formula->git_sha = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_git_ref: if (formula->git_ref != NULL) free(formula->git_ref); formula->git_ref = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_src_url: if (formula->src_url != NULL) free(formula->src_url); formula->src_url = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_src_uri: if (formula->src_uri != NULL) free(formula->src_uri); formula->src_uri = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_src_sha: if (formula->src_sha != NULL) free(formula->src_sha); formula->src_sha = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_fix_url: if (formula->fix_url != NULL) free(formula->fix_url); formula->fix_url = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_fix_uri: if (formula->fix_uri != NULL) free(formula->fix_uri); formula->fix_uri = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_fix_sha: if (formula->fix_sha != NULL) free(formula->fix_sha); formula->fix_sha = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_fix_opt: if (formula->fix_opt != NULL) free(formula->fix_opt); formula->fix_opt = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_res_url: if (formula->res_url != NULL) free(formula->res_url); formula->res_url = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_res_uri: if (formula->res_uri != NULL) free(formula->res_uri); formula->res_uri = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_res_sha: if (formula->res_sha != NULL) free(formula->res_sha); formula->res_sha = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_dep_pkg: if (formula->dep_pkg != NULL) free(formula->dep_pkg); formula->dep_pkg = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dep_lib: if (formula->dep_lib != NULL) free(formula->dep_lib); formula->dep_lib = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dep_upp: if (formula->dep_upp != NULL) free(formula->dep_upp); formula->dep_upp = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dep_pip: if (formula->dep_pip != NULL) free(formula->dep_pip); formula->dep_pip = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dep_plm: if (formula->dep_plm != NULL) free(formula->dep_plm); formula->dep_plm = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_ppflags: if (formula->ppflags != NULL) free(formula->ppflags); formula->ppflags = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_ccflags: if (formula->ccflags != NULL) free(formula->ccflags); formula->ccflags = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_xxflags: if (formula->xxflags != NULL) free(formula->xxflags); formula->xxflags = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_ldflags: if (formula->ldflags != NULL) free(formula->ldflags); formula->ldflags = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_do12345: if (formula->do12345 != NULL) free(formula->do12345); formula->do12345 = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dofetch: if (formula->dofetch != NULL) free(formula->dofetch); formula->dofetch = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dopatch: if (formula->dopatch != NULL) free(formula->dopatch); formula->dopatch = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_prepare: if (formula->prepare != NULL) free(formula->prepare); formula->prepare = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_install: if (formula->install != NULL) free(formula->install); formula->install = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_dotweak: if (formula->dotweak != NULL) free(formula->dotweak); formula->dotweak = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_bindenv: if (formula->bindenv != NULL) free(formula->bindenv); formula->bindenv = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_caveats: if (formula->caveats != NULL) free(formula->caveats); formula->caveats = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_patches: if (formula->patches != NULL) free(formula->patches); formula->patches = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_reslist: if (formula->reslist != NULL) free(formula->reslist); formula->reslist = trace_strdup("xcpkg_formula_load", value); break;
+
+        case FORMULA_KEY_CODE_bsystem: if (formula->bsystem != NULL) free(formula->bsystem); formula->bsystem = trace_strdup("xcpkg_formula_load", value); break;
+        case FORMULA_KEY_CODE_bscript: if (formula->bscript != NULL) free(formula->bscript); formula->bscript = trace_strdup("xcpkg_formula_load", value); break;
 
         case FORMULA_KEY_CODE_git_nth:
             for (int i = 0; ; i++) {
@@ -973,7 +975,7 @@ static int xcpkg_formula_amend_gnu_org(XCPKGFormula * formula, const char * form
         if (formula->web_url == NULL) {
             size_t n = 30U + i;
 
-            char * q = (char*)malloc(n);
+            char * q = (char*)trace_malloc("xcpkg_formula_load", n);
 
             if (q == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -994,7 +996,7 @@ static int xcpkg_formula_amend_gnu_org(XCPKGFormula * formula, const char * form
         if (formula->git_url == NULL) {
             size_t n = 38U + i;
 
-            char * q = (char*)malloc(n);
+            char * q = (char*)trace_malloc("xcpkg_formula_load", n);
 
             if (q == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1040,7 +1042,7 @@ static int xcpkg_formula_amend_gnome_org(XCPKGFormula * formula, const char * fo
         if (formula->git_url == NULL) {
             size_t n = 32U + i;
 
-            char * q = (char*)malloc(n);
+            char * q = (char*)trace_malloc("xcpkg_formula_load", n);
 
             if (q == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1061,7 +1063,7 @@ static int xcpkg_formula_amend_gnome_org(XCPKGFormula * formula, const char * fo
         if (formula->git_uri == NULL) {
             size_t n = 26U + i;
 
-            char * q = (char*)malloc(n);
+            char * q = (char*)trace_malloc("xcpkg_formula_load", n);
 
             if (q == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1114,7 +1116,7 @@ static int xcpkg_formula_amend_x_org(XCPKGFormula * formula, const char * formul
 
         size_t n = 37U + j;
 
-        char * q = (char*)malloc(n);
+        char * q = (char*)trace_malloc("xcpkg_formula_load", n);
 
         if (q == NULL) {
             return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1135,7 +1137,7 @@ static int xcpkg_formula_amend_x_org(XCPKGFormula * formula, const char * formul
     }
 
     if (formula->web_url == NULL) {
-        char * p = strdup("https://www.x.org/");
+        char * p = trace_strdup("xcpkg_formula_load", "https://www.x.org/");
 
         if (p == NULL) {
             return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1193,7 +1195,7 @@ static int xcpkg_formula_amend_prefix(XCPKGFormula * formula, const char * formu
     }
 
     if (formula->web_url == NULL) {
-        char * p = strdup(formula->git_url);
+        char * p = trace_strdup("xcpkg_formula_load", formula->git_url);
 
         if (p == NULL) {
             return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1269,7 +1271,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
             return XCPKG_ERROR_FORMULA_SCHEME;
         } else {
             formula->web_url_is_calculated = true;
-            formula->web_url = strdup(formula->git_url);
+            formula->web_url = trace_strdup("xcpkg_formula_load", formula->git_url);
 
             if (formula->web_url == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1347,7 +1349,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
                     fprintf(stderr, "Can't extract package version from src-url: '%s' in formula file: %s\n", formula->src_url, formulaFilePath);
                     return XCPKG_ERROR_FORMULA_SCHEME;
                 } else {
-                    formula->version = strdup(version);
+                    formula->version = trace_strdup("xcpkg_formula_load", version);
 
                     if (formula->version == NULL) {
                         return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1364,7 +1366,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
             }
 
             if (version[0] != '\0') {
-                formula->version = strdup(version);
+                formula->version = trace_strdup("xcpkg_formula_load", version);
 
                 if (formula->version == NULL) {
                     return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1391,7 +1393,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
         const char * bsystem = xcpkg_extract_bsystem_from_install_commands(formula);
 
         if (bsystem != NULL) {
-            char * p = strdup(bsystem);
+            char * p = trace_strdup("xcpkg_formula_load", bsystem);
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1413,7 +1415,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
                 return XCPKG_ERROR_FORMULA_SCHEME;
             }
 
-            char * p = strdup(dobuildActions);
+            char * p = trace_strdup("xcpkg_formula_load", dobuildActions);
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1473,7 +1475,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
 
     if (dep_upp_extra_buf[0] != '\0') {
         if (formula->dep_upp == NULL) {
-            char * p = strdup(dep_upp_extra_buf);
+            char * p = trace_strdup("xcpkg_formula_load", dep_upp_extra_buf);
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1484,7 +1486,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
             size_t oldLength = strlen(formula->dep_upp);
             size_t newLength = oldLength + dep_upp_extra_buf_len + 2U;
 
-            char * p = (char*)malloc(newLength * sizeof(char));
+            char * p = (char*)trace_malloc("xcpkg_formula_load", newLength * sizeof(char));
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1508,7 +1510,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
 
     if (formula->useBuildSystemMeson) {
         if (formula->dep_pip == NULL) {
-            char * p = strdup("meson");
+            char * p = trace_strdup("xcpkg_formula_load", "meson");
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1519,7 +1521,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
             size_t oldLength = strlen(formula->dep_pip);
             size_t newLength = oldLength + 7U;
 
-            char * p = (char*)malloc(newLength * sizeof(char));
+            char * p = (char*)trace_malloc("xcpkg_formula_load", newLength * sizeof(char));
 
             if (p == NULL) {
                 return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1542,7 +1544,7 @@ static inline int xcpkg_formula_check(XCPKGFormula * formula, const char * formu
     return XCPKG_OK;
 }
 
-int xcpkg_formula_load(const char * packageName, const char * targetPlatformName, const char * formulaFilePath, XCPKGFormula * * out) {
+static int xcpkg_formula_load_internal(const char * packageName, const char * targetPlatformName, const char * formulaFilePath, XCPKGFormula * * out) {
     char buf[PATH_MAX];
 
     if (formulaFilePath == NULL) {
@@ -1613,7 +1615,7 @@ int xcpkg_formula_load(const char * packageName, const char * targetPlatformName
                     formulaKeyCode = xcpkg_formula_key_code_from_key_name((char*)token.data.scalar.value);
                 } else if (lastTokenType == 2) {
                     if (formula == NULL) {
-                        formula = (XCPKGFormula*)calloc(1, sizeof(XCPKGFormula));
+                        formula = (XCPKGFormula*)trace_calloc("xcpkg_formula_load", 1, sizeof(XCPKGFormula));
 
                         if (formula == NULL) {
                             ret = XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1621,7 +1623,7 @@ int xcpkg_formula_load(const char * packageName, const char * targetPlatformName
                         }
 
                         formula->git_nth = 1;
-                        formula->path = strdup(formulaFilePath);
+                        formula->path = trace_strdup("xcpkg_formula_load", formulaFilePath);
 
                         if (formula->path == NULL) {
                             ret = XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -1748,3 +1750,13 @@ finalize:
     xcpkg_formula_free(formula);
     return ret;
 }
+
+int xcpkg_formula_load(const char * packageName, const char * targetPlatformName, const char * formulaFilePath, XCPKGFormula * * out) {
+    uint64_t startTime = trace_now();
+
+    int ret = xcpkg_formula_load_internal(packageName, targetPlatformName, formulaFilePath, out);
+
+    trace_record("formula", "xcpkg_formula_load", 1U, 0U, startTime);
+
+    return ret;
+}
@@ -1,33 +1,259 @@
+#include <stdio.h>
 #include <string.h>
 
+#include <limits.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include <git2.h>
+
+#include "../core/log.h"
+#include "../core/parallel.h"
+
+#include "uppm.h"
+
 #include "../xcpkg.h"
 
-static int xcpkg_formula_repo_scan_callback(XCPKGFormulaRepo * formulaRepo, const void * p1 __attribute__((unused)), void * p2) {
-    if (strcmp(formulaRepo->name, "official-core") == 0) {
-        (*((int*)p2)) = 1;
+typedef struct {
+    // NULL means the official-core formula repository of uppm
+    char * formulaRepoName;
+
+    int    ret;
+} Job;
+
+typedef struct {
+    Job *  jobArray;
+    size_t jobArraySize;
+    size_t jobArrayCapacity;
+
+    // the log of a job is printed as a whole once it is finished, so the outputs of the concurrent jobs are never interleaved
+    pthread_mutex_t outputMutex;
+} Payload;
+
+static int add_a_job(Payload * payload, const char * formulaRepoName) {
+    if (payload->jobArraySize == payload->jobArrayCapacity) {
+        size_t newCapacity = payload->jobArrayCapacity + 8U;
+
+        Job * p = (Job*)realloc(payload->jobArray, newCapacity * sizeof(Job));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        payload->jobArray = p;
+        payload->jobArrayCapacity = newCapacity;
     }
 
-    int ret = xcpkg_formula_repo_sync(formulaRepo);
+    Job * job = &payload->jobArray[payload->jobArraySize];
 
-    if (ret != XCPKG_OK) {
-        return ret;
+    job->ret = XCPKG_OK;
+    job->formulaRepoName = NULL;
+
+    if (formulaRepoName != NULL) {
+        job->formulaRepoName = strdup(formulaRepoName);
+
+        if (job->formulaRepoName == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
     }
 
+    payload->jobArraySize++;
+
     return XCPKG_OK;
 }
 
+static int xcpkg_formula_repo_scan_callback(XCPKGFormulaRepo * formulaRepo, const void * p1 __attribute__((unused)), void * p2) {
+    return add_a_job((Payload*)p2, formulaRepo->name);
+}
+
+static void print_the_log_of_a_job(Payload * payload, const Job * job, FILE * logFile) {
+    pthread_mutex_lock(&payload->outputMutex);
+
+    const char * name = job->formulaRepoName == NULL ? "uppm official-core" : job->formulaRepoName;
+
+    if (isatty(STDOUT_FILENO)) {
+        printf("%s==> Updating formula repo: %s%s\n", COLOR_PURPLE, name, COLOR_OFF);
+    } else {
+        printf("=== Updating formula repo: %s\n", name);
+    }
+
+    if (logFile != NULL) {
+        rewind(logFile);
+
+        char buf[4096];
+
+        for (;;) {
+            size_t n = fread(buf, 1, 4096, logFile);
+
+            if (n == 0U) {
+                break;
+            }
+
+            fwrite(buf, 1, n, stdout);
+        }
+    }
+
+    fflush(stdout);
+
+    pthread_mutex_unlock(&payload->outputMutex);
+}
+
+static int run_a_job(size_t index, void * arg) {
+    Payload * payload = (Payload*)arg;
+
+    Job * job = &payload->jobArray[index];
+
+    FILE * logFile = tmpfile();
+
+    if (logFile == NULL) {
+        perror(NULL);
+        job->ret = XCPKG_ERROR;
+        return job->ret;
+    }
+
+    if (job->formulaRepoName == NULL) {
+        const char * const uppmHomeDIR = getenv("UPPM_HOME");
+
+        job->ret = uppm_formula_repo_sync_official_core_with_log(uppmHomeDIR, strlen(uppmHomeDIR), logFile);
+    } else {
+        XCPKGFormulaRepo * formulaRepo = NULL;
+
+        job->ret = xcpkg_formula_repo_lookup(job->formulaRepoName, &formulaRepo);
+
+        if (job->ret == XCPKG_OK) {
+            job->ret = xcpkg_formula_repo_sync_with_log(formulaRepo, logFile);
+        }
+
+        xcpkg_formula_repo_free(formulaRepo);
+    }
+
+    print_the_log_of_a_job(payload, job, logFile);
+
+    fclose(logFile);
+
+    return job->ret;
+}
+
 int xcpkg_formula_repo_list_update() {
-    int officialCoreIsThere = 0;
+    Payload payload = {0};
 
-    int ret = xcpkg_formula_repo_scan(xcpkg_formula_repo_scan_callback, NULL, &officialCoreIsThere);
+    int ret = xcpkg_formula_repo_scan(xcpkg_formula_repo_scan_callback, NULL, &payload);
 
     if (ret != XCPKG_OK) {
-        return ret;
+        goto finalize;
+    }
+
+    bool officialCoreIsThere = false;
+
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        if (strcmp(payload.jobArray[i].formulaRepoName, "official-core") == 0) {
+            officialCoreIsThere = true;
+            break;
+        }
+    }
+
+    // the official-core formula repository of uppm is synced on demand, refresh it only if it has been synced before
+    const char * const uppmHomeDIR = getenv("UPPM_HOME");
+
+    if (uppmHomeDIR != NULL && uppmHomeDIR[0] != '\0') {
+        char uppmFormulaRepoDIR[PATH_MAX];
+
+        ret = snprintf(uppmFormulaRepoDIR, PATH_MAX, "%s/repos.d/official-core", uppmHomeDIR);
+
+        if (ret < 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            goto finalize;
+        }
+
+        struct stat st;
+
+        if (stat(uppmFormulaRepoDIR, &st) == 0 && S_ISDIR(st.st_mode)) {
+            ret = add_a_job(&payload, NULL);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
     }
 
-    if (officialCoreIsThere == 1) {
-        return XCPKG_OK;
+    //////////////////////////////////////////////////////////////////////////////
+
+    ret = pthread_mutex_init(&payload.outputMutex, NULL);
+
+    if (ret != 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+        goto finalize;
     }
 
-    return xcpkg_formula_repo_add("official-core", "https://github.com/leleliu008/xcpkg-formula-repository-official-core", "master", false, true);
+    // keep libgit2 initialized during all the jobs, so that the git_libgit2_init() and git_libgit2_shutdown() of every job do not set up and tear down it again and again
+    git_libgit2_init();
+
+    // a slow or failed job does not block the others, every job reports its own result
+    if (parallel_for(payload.jobArraySize, parallel_network_jobs(), run_a_job, &payload) != 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+    }
+
+    git_libgit2_shutdown();
+
+    pthread_mutex_destroy(&payload.outputMutex);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t failedCount = 0U;
+
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        const Job * job = &payload.jobArray[i];
+
+        if (job->ret != XCPKG_OK) {
+            if (failedCount == 0U) {
+                ret = job->ret;
+            }
+
+            failedCount++;
+
+            fprintf(stderr, "%sfailed to update formula repo: %s%s\n", COLOR_RED, job->formulaRepoName == NULL ? "uppm official-core" : job->formulaRepoName, COLOR_OFF);
+        }
+    }
+
+    if (payload.jobArraySize != 0U) {
+        printf("%zu formula repos updated, %zu failed.\n", payload.jobArraySize - failedCount, failedCount);
+    }
+
+    if (!officialCoreIsThere) {
+        int ret2 = xcpkg_formula_repo_add("official-core", "https://github.com/leleliu008/xcpkg-formula-repository-official-core", "master", false, true);
+
+        if (ret2 != XCPKG_OK) {
+            if (ret == XCPKG_OK) {
+                ret = ret2;
+            }
+
+            goto finalize;
+        }
+    }
+
+    // the indexes are rebuilt for the formula repos which have been updated, even if some others failed
+    {
+        int ret2 = xcpkg_available_index_rebuild();
+
+        if (ret == XCPKG_OK) {
+            ret = ret2;
+        }
+    }
+
+finalize:
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        free(payload.jobArray[i].formulaRepoName);
+    }
+
+    free(payload.jobArray);
+
+    return ret;
 }
@@ -6,9 +6,11 @@
 #include <dirent.h>
 #include <sys/stat.h>
 
+#include "../core/trace.h"
+
 #include "../xcpkg.h"
 
-int xcpkg_formula_repo_scan(XCPKGFormulaRepoScanCallback callback, const void * p1, void * p2) {
+static int xcpkg_formula_repo_scan_internal(XCPKGFormulaRepoScanCallback callback, const void * p1, void * p2) {
     const char * xcpkgHomeDIR;
     size_t xcpkgHomeDIRLength;
 
@@ -133,3 +135,13 @@ loop:
     closedir(dir);
     return ret;
 }
+
+int xcpkg_formula_repo_scan(XCPKGFormulaRepoScanCallback callback, const void * p1, void * p2) {
+    uint64_t startTime = trace_now();
+
+    int ret = xcpkg_formula_repo_scan_internal(callback, p1, p2);
+
+    trace_record("formula", "xcpkg_formula_repo_scan", 1U, 0U, startTime);
+
+    return ret;
+}
@@ -19,27 +19,30 @@ int xcpkg_formula_repo_sync_(const char * formulaRepoName) {
 
     xcpkg_formula_repo_free(formulaRepo);
 
-    return ret;
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    return xcpkg_available_index_rebuild();
 }
 
 int xcpkg_formula_repo_sync(XCPKGFormulaRepo * formulaRepo) {
-    if (formulaRepo == NULL) {
-        return XCPKG_ERROR_ARG_IS_NULL;
-    }
+    return xcpkg_formula_repo_sync_with_log(formulaRepo, NULL);
+}
 
-    if (formulaRepo->pinned) {
-        fprintf(stderr, "'%s' formula repo was pinned, skipped.\n", formulaRepo->name);
-        return XCPKG_OK;
-    }
+static int xcpkg_formula_repo_sync_locked(XCPKGFormulaRepo * formulaRepo, FILE * logFile) {
+    if (logFile == NULL) {
+        if (isatty(STDOUT_FILENO)) {
+            printf("%s%s%s\n", COLOR_PURPLE, "==> Updating formula repo", COLOR_OFF);
+        } else {
+            printf("=== Updating formula repo\n");
+        }
 
-    if (isatty(STDOUT_FILENO)) {
-        printf("%s%s%s\n", COLOR_PURPLE, "==> Updating formula repo", COLOR_OFF);
+        xcpkg_formula_repo_info(formulaRepo);
     } else {
-        printf("=== Updating formula repo\n");
+        fprintf(logFile, "url: %s\nbranch: %s\npath: %s\n", formulaRepo->url, formulaRepo->branch, formulaRepo->path);
     }
 
-    xcpkg_formula_repo_info(formulaRepo);
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const char * branchName = formulaRepo->branch;
@@ -65,7 +68,7 @@ int xcpkg_formula_repo_sync(XCPKGFormulaRepo * formulaRepo) {
         return XCPKG_ERROR;
     }
 
-    ret = xcpkg_git_sync(formulaRepo->path, formulaRepo->url, remoteRefPath, remoteTrackingRefPath, branchName, 0);
+    ret = xcpkg_git_sync_with_log(formulaRepo->path, formulaRepo->url, remoteRefPath, remoteTrackingRefPath, branchName, 0, logFile);
 
     if (ret != XCPKG_OK) {
         return ret;
@@ -84,3 +87,59 @@ int xcpkg_formula_repo_sync(XCPKGFormulaRepo * formulaRepo) {
 
     return xcpkg_formula_repo_config_write(formulaRepo->path, formulaRepo->url, formulaRepo->branch, formulaRepo->pinned, formulaRepo->enabled, formulaRepo->createdAt, ts);
 }
+
+int xcpkg_formula_repo_sync_with_log(XCPKGFormulaRepo * formulaRepo, FILE * logFile) {
+    if (formulaRepo == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (formulaRepo->pinned) {
+        fprintf(logFile == NULL ? stderr : logFile, "'%s' formula repo was pinned, skipped.\n", formulaRepo->name);
+        return XCPKG_OK;
+    }
+
+    size_t lockNameCapacity = strlen(formulaRepo->name) + 14U;
+    char   lockName[lockNameCapacity];
+
+    int ret = snprintf(lockName, lockNameCapacity, "formula-repo-%s", formulaRepo->name);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    int  lockFD;
+    bool waited;
+
+    ret = xcpkg_lock_named(lockName, formulaRepo->path, &lockFD, &waited);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    // the process we waited for has synced it if its updated timestamp has changed
+    if (waited) {
+        XCPKGFormulaRepo * current = NULL;
+
+        if (xcpkg_formula_repo_lookup(formulaRepo->name, &current) == XCPKG_OK) {
+            const char * a = formulaRepo->updatedAt == NULL ? "" : formulaRepo->updatedAt;
+            const char * b = current->updatedAt     == NULL ? "" : current->updatedAt;
+
+            waited = strcmp(a, b) != 0;
+        } else {
+            waited = false;
+        }
+
+        xcpkg_formula_repo_free(current);
+    }
+
+    if (waited) {
+        fprintf(logFile == NULL ? stderr : logFile, "'%s' formula repo was synced by another xcpkg process, skipped.\n", formulaRepo->name);
+    } else {
+        ret = xcpkg_formula_repo_sync_locked(formulaRepo, logFile);
+    }
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
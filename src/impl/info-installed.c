@@ -29,65 +29,102 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         key = "--yaml";
     }
 
-    if (strcmp(key, "--prefix") == 0) {
-        const char * xcpkgHomeDIR;
-        size_t xcpkgHomeDIRLength;
+    XCPKGInstalledDB db;
 
-        int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
+    int ret = xcpkg_installed_db_load(&db);
 
-        /////////////////////////////////////////////////////////////////////
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
 
-        size_t packageInstalledDIRLength = xcpkgHomeDIRLength + strlen(targetPlatformSpec) + strlen(packageName) + 15U;
-        char   packageInstalledDIR[packageInstalledDIRLength];
+    const XCPKGInstalledPackage * installedPackage = xcpkg_installed_db_find(&db, packageName, targetPlatformSpec);
 
-        ret = snprintf(packageInstalledDIR, packageInstalledDIRLength, "%s/installed/%s/%s", xcpkgHomeDIR, targetPlatformSpec, packageName);
+    if (installedPackage == NULL) {
+        xcpkg_installed_db_free(&db);
+        return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+    }
 
-        if (ret < 0) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
+    // these are answered by the installed-package database, without reading the receipt.
+    {
+        bool answered = true;
 
-        /////////////////////////////////////////////////////////////////////
+        if (strcmp(key, "--prefix") == 0) {
+            const char * xcpkgHomeDIR;
+            size_t xcpkgHomeDIRLength;
 
-        struct stat st;
+            ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
 
-        if (stat(packageInstalledDIR, &st) == 0) {
-            if (!S_ISDIR(st.st_mode)) {
-                return XCPKG_ERROR_PACKAGE_IS_BROKEN;
+            if (ret == XCPKG_OK) {
+                printf("%s/installed/%s/%s\n", xcpkgHomeDIR, targetPlatformSpec, packageName);
             }
-        } else {
-            return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
-        }
+        } else if (strcmp(key, "version") == 0) {
+            printf("%s\n", installedPackage->version);
+        } else if (strcmp(key, "dep-pkg") == 0) {
+            if (installedPackage->dep_pkg[0] != '\0') {
+                printf("%s\n", installedPackage->dep_pkg);
+            }
+        } else if (strcmp(key, "builtat") == 0) {
+            printf("%lld\n", (long long)installedPackage->installedAt);
+        } else if (strcmp(key, "builtat-rfc-3339") == 0) {
+            time_t tt = installedPackage->installedAt;
+            struct tm *tms = localtime(&tt);
 
-        size_t receiptFilePathCapacity = packageInstalledDIRLength + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
-        char   receiptFilePath[receiptFilePathCapacity];
+            char buff[26] = {0};
+            strftime(buff, 26, "%Y-%m-%d %H:%M:%S%z", tms);
 
-        ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageInstalledDIR, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+            buff[24] = buff[23];
+            buff[23] = buff[22];
+            buff[22] = ':';
 
-        if (ret < 0) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
+            printf("%s\n", buff);
+        } else if (strcmp(key, "builtat-rfc-3339-utc") == 0) {
+            time_t tt = installedPackage->installedAt;
+            struct tm *tms = gmtime(&tt);
 
-        if (stat(receiptFilePath, &st) == 0) {
-            if (S_ISREG(st.st_mode)) {
-                printf("%s\n", packageInstalledDIR);
-                return XCPKG_OK;
-            } else {
-                return XCPKG_ERROR_PACKAGE_IS_BROKEN;
-            }
+            char buff[26] = {0};
+            strftime(buff, 26, "%Y-%m-%d %H:%M:%S%z", tms);
+
+            buff[24] = buff[23];
+            buff[23] = buff[22];
+            buff[22] = ':';
+
+            printf("%s\n", buff);
+        } else if (strcmp(key, "builtat-iso-8601") == 0) {
+            time_t tt = installedPackage->installedAt;
+            struct tm *tms = localtime(&tt);
+
+            char buff[26] = {0};
+            strftime(buff, 26, "%Y-%m-%dT%H:%M:%S%z", tms);
+
+            buff[24] = buff[23];
+            buff[23] = buff[22];
+            buff[22] = ':';
+
+            printf("%s\n", buff);
+        } else if (strcmp(key, "builtat-iso-8601-utc") == 0) {
+            time_t tt = installedPackage->installedAt;
+            struct tm *tms = gmtime(&tt);
+
+            char buff[21] = {0};
+            strftime(buff, 21, "%Y-%m-%dT%H:%M:%SZ", tms);
+
+            printf("%s\n", buff);
         } else {
-            return XCPKG_ERROR_PACKAGE_IS_BROKEN;
+            answered = false;
         }
-    } else if (strcmp(key, "--files") == 0) {
+
+        xcpkg_installed_db_free(&db);
+
+        if (answered) {
+            return ret;
+        }
+    }
+
+    if (strcmp(key, "--files") == 0) {
         const char * xcpkgHomeDIR;
         size_t xcpkgHomeDIRLength;
 
-        int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+        ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -186,7 +223,7 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         const char * xcpkgHomeDIR;
         size_t xcpkgHomeDIRLength;
 
-        int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+        ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -240,7 +277,7 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         const char * xcpkgHomeDIR;
         size_t xcpkgHomeDIRLength;
 
-        int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+        ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -321,7 +358,7 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
 
     XCPKGReceipt * receipt = NULL;
 
-    int ret = xcpkg_receipt_parse(packageName, targetPlatformSpec, &receipt);
+    ret = xcpkg_receipt_parse(packageName, targetPlatformSpec, &receipt);
 
     if (ret != XCPKG_OK) {
         return ret;
@@ -423,8 +460,6 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         printf("%s\n", pkgtype);
     } else if (strcmp(key, "summary") == 0) {
         printf("%s\n", receipt->summary);
-    } else if (strcmp(key, "version") == 0) {
-        printf("%s\n", receipt->version);
     } else if (strcmp(key, "license") == 0) {
         if (receipt->license != NULL) {
             printf("%s\n", receipt->license);
@@ -487,10 +522,6 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         if (receipt->res_sha != NULL) {
             printf("%s\n", receipt->res_sha);
         }
-    } else if (strcmp(key, "dep-pkg") == 0) {
-        if (receipt->dep_pkg != NULL) {
-            printf("%s\n", receipt->dep_pkg);
-        }
     } else if (strcmp(key, "dep-lib") == 0) {
         if (receipt->dep_lib != NULL) {
             printf("%s\n", receipt->dep_lib);
@@ -553,52 +584,6 @@ int xcpkg_show_installed_info(const char * packageName, const char * targetPlatf
         printf("%s\n", receipt->builtFor);
     } else if (strcmp(key, "builtby") == 0) {
         printf("%s\n", receipt->builtBy);
-    } else if (strcmp(key, "builtat") == 0) {
-        printf("%s\n", receipt->builtAt);
-    } else if (strcmp(key, "builtat-rfc-3339") == 0) {
-        time_t tt = (time_t)atol(receipt->builtAt);
-        struct tm *tms = localtime(&tt);
-
-        char buff[26] = {0};
-        strftime(buff, 26, "%Y-%m-%d %H:%M:%S%z", tms);
-
-        buff[24] = buff[23];
-        buff[23] = buff[22];
-        buff[22] = ':';
-
-        printf("%s\n", buff);
-    } else if (strcmp(key, "builtat-rfc-3339-utc") == 0) {
-        time_t tt = (time_t)atol(receipt->builtAt);
-        struct tm *tms = gmtime(&tt);
-
-        char buff[26] = {0};
-        strftime(buff, 26, "%Y-%m-%d %H:%M:%S%z", tms);
-
-        buff[24] = buff[23];
-        buff[23] = buff[22];
-        buff[22] = ':';
-
-        printf("%s\n", buff);
-    } else if (strcmp(key, "builtat-iso-8601") == 0) {
-        time_t tt = (time_t)atol(receipt->builtAt);
-        struct tm *tms = localtime(&tt);
-
-        char buff[26] = {0};
-        strftime(buff, 26, "%Y-%m-%dT%H:%M:%S%z", tms);
-
-        buff[24] = buff[23];
-        buff[23] = buff[22];
-        buff[22] = ':';
-
-        printf("%s\n", buff);
-    } else if (strcmp(key, "builtat-iso-8601-utc") == 0) {
-        time_t tt = (time_t)atol(receipt->builtAt);
-        struct tm *tms = gmtime(&tt);
-
-        char buff[21] = {0};
-        strftime(buff, 21, "%Y-%m-%dT%H:%M:%SZ", tms);
-
-        printf("%s\n", buff);
     } else {
         ret = XCPKG_ERROR_ARG_IS_UNKNOWN;
     }
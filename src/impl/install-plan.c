@@ -0,0 +1,403 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "install-plan.h"
+
+static inline __attribute__((always_inline)) size_t hash_of_package_name(const char * packageName, const size_t packageNameLength) {
+    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+    uint64_t h = 14695981039346656037ULL;
+
+    for (size_t i = 0U; i < packageNameLength; i++) {
+        h ^= (unsigned char)packageName[i];
+        h *= 1099511628211ULL;
+    }
+
+    return (size_t)h;
+}
+
+bool xcpkg_install_plan_find(const XCPKGInstallPlan * plan, const char * packageName, const size_t packageNameLength, size_t * index) {
+    if (plan->slotArraySize == 0U) {
+        return false;
+    }
+
+    size_t mask = plan->slotArraySize - 1U;
+
+    for (size_t i = hash_of_package_name(packageName, packageNameLength) & mask; ; i = (i + 1U) & mask) {
+        size_t v = plan->slotArray[i];
+
+        if (v == 0U) {
+            return false;
+        }
+
+        const XCPKGPackage * package = &plan->packageArray[v - 1U];
+
+        if (package->packageNameLength == packageNameLength && strncmp(package->packageName, packageName, packageNameLength) == 0) {
+            (*index) = v - 1U;
+            return true;
+        }
+    }
+}
+
+static int xcpkg_install_plan_rehash(XCPKGInstallPlan * plan, const size_t newSlotArraySize) {
+    size_t * slotArray = (size_t*)calloc(newSlotArraySize, sizeof(size_t));
+
+    if (slotArray == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    size_t mask = newSlotArraySize - 1U;
+
+    for (size_t i = 0U; i < plan->packageArraySize; i++) {
+        const XCPKGPackage * package = &plan->packageArray[i];
+
+        size_t j = hash_of_package_name(package->packageName, package->packageNameLength) & mask;
+
+        while (slotArray[j] != 0U) {
+            j = (j + 1U) & mask;
+        }
+
+        slotArray[j] = i + 1U;
+    }
+
+    free(plan->slotArray);
+
+    plan->slotArray = slotArray;
+    plan->slotArraySize = newSlotArraySize;
+
+    return XCPKG_OK;
+}
+
+int xcpkg_install_plan_add(XCPKGInstallPlan * plan, const char * packageName, const size_t packageNameLength, size_t * index, bool * added) {
+    if (xcpkg_install_plan_find(plan, packageName, packageNameLength, index)) {
+        (*added) = false;
+        return XCPKG_OK;
+    }
+
+    // keep the load factor below 0.5
+    if (((plan->packageArraySize + 1U) << 1) > plan->slotArraySize) {
+        int ret = xcpkg_install_plan_rehash(plan, plan->slotArraySize == 0U ? 64U : (plan->slotArraySize << 1));
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    if (plan->packageArraySize == plan->packageArrayCapacity) {
+        size_t newCapacity = plan->packageArrayCapacity == 0U ? 16U : (plan->packageArrayCapacity << 1);
+
+        XCPKGPackage * p = (XCPKGPackage*)realloc(plan->packageArray, newCapacity * sizeof(XCPKGPackage));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        plan->packageArray = p;
+        plan->packageArrayCapacity = newCapacity;
+    }
+
+    char * s = (char*)malloc(packageNameLength + 1U);
+
+    if (s == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    memcpy(s, packageName, packageNameLength);
+
+    s[packageNameLength] = '\0';
+
+    size_t i = plan->packageArraySize;
+
+    XCPKGPackage * package = &plan->packageArray[i];
+
+    memset(package, 0, sizeof(XCPKGPackage));
+
+    package->packageName = s;
+    package->packageNameLength = packageNameLength;
+
+    plan->packageArraySize++;
+
+    size_t mask = plan->slotArraySize - 1U;
+
+    size_t j = hash_of_package_name(s, packageNameLength) & mask;
+
+    while (plan->slotArray[j] != 0U) {
+        j = (j + 1U) & mask;
+    }
+
+    plan->slotArray[j] = i + 1U;
+
+    (*index) = i;
+    (*added) = true;
+
+    return XCPKG_OK;
+}
+
+int xcpkg_install_plan_add_edge(XCPKGInstallPlan * plan, const size_t index, const size_t depIndex) {
+    XCPKGPackage * package = &plan->packageArray[index];
+
+    for (size_t i = 0U; i < package->depIndexArraySize; i++) {
+        if (package->depIndexArray[i] == depIndex) {
+            return XCPKG_OK;
+        }
+    }
+
+    if (package->depIndexArraySize == package->depIndexArrayCapacity) {
+        size_t newCapacity = package->depIndexArrayCapacity + 8U;
+
+        size_t * p = (size_t*)realloc(package->depIndexArray, newCapacity * sizeof(size_t));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        package->depIndexArray = p;
+        package->depIndexArrayCapacity = newCapacity;
+    }
+
+    package->depIndexArray[package->depIndexArraySize] = depIndex;
+    package->depIndexArraySize++;
+
+    return XCPKG_OK;
+}
+
+static void report_the_cycle(const XCPKGInstallPlan * plan, const size_t * remaining, size_t * path, size_t * positions) {
+    size_t n = plan->packageArraySize;
+
+    size_t start = n;
+
+    for (size_t i = 0U; i < n; i++) {
+        positions[i] = SIZE_MAX;
+
+        if (start == n && remaining[i] != 0U) {
+            start = i;
+        }
+    }
+
+    // every unsorted package has at least one unsorted dependency, so following them must finally revisit a package
+    size_t pathLength = 0U;
+
+    size_t cur = start;
+
+    while (positions[cur] == SIZE_MAX) {
+        positions[cur] = pathLength;
+        path[pathLength++] = cur;
+
+        const XCPKGPackage * package = &plan->packageArray[cur];
+
+        for (size_t i = 0U; i < package->depIndexArraySize; i++) {
+            if (remaining[package->depIndexArray[i]] != 0U) {
+                cur = package->depIndexArray[i];
+                break;
+            }
+        }
+    }
+
+    fprintf(stderr, "circular dependencies detected:");
+
+    for (size_t i = positions[cur]; i < pathLength; i++) {
+        fprintf(stderr, " %s ->", plan->packageArray[path[i]].packageName);
+    }
+
+    fprintf(stderr, " %s\n", plan->packageArray[cur].packageName);
+}
+
+int xcpkg_install_plan_sort(XCPKGInstallPlan * plan) {
+    size_t n = plan->packageArraySize;
+
+    free(plan->order);
+    plan->order = NULL;
+
+    free(plan->levelOffsetArray);
+    plan->levelOffsetArray = NULL;
+
+    plan->levelCount = 0U;
+
+    if (n == 0U) {
+        return XCPKG_OK;
+    }
+
+    size_t edgeCount = 0U;
+
+    for (size_t i = 0U; i < n; i++) {
+        edgeCount += plan->packageArray[i].depIndexArraySize;
+    }
+
+    // remaining[i] is the count of not yet sorted dependencies of the package at i
+    size_t * remaining = (size_t*)malloc(n * sizeof(size_t));
+
+    // the reverse edges in compressed sparse row format, dependents of i are dependents[offsets[i] .. offsets[i + 1])
+    size_t * offsets = (size_t*)calloc(n + 1U, sizeof(size_t));
+    size_t * cursors = (size_t*)malloc(n * sizeof(size_t));
+    size_t * dependents = (size_t*)malloc((edgeCount + 1U) * sizeof(size_t));
+
+    size_t * order = (size_t*)malloc(n * sizeof(size_t));
+    size_t * levelOffsetArray = (size_t*)malloc((n + 1U) * sizeof(size_t));
+
+    if (remaining == NULL || offsets == NULL || cursors == NULL || dependents == NULL || order == NULL || levelOffsetArray == NULL) {
+        free(remaining);
+        free(offsets);
+        free(cursors);
+        free(dependents);
+        free(order);
+        free(levelOffsetArray);
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    for (size_t i = 0U; i < n; i++) {
+        const XCPKGPackage * package = &plan->packageArray[i];
+
+        remaining[i] = package->depIndexArraySize;
+
+        for (size_t j = 0U; j < package->depIndexArraySize; j++) {
+            offsets[package->depIndexArray[j] + 1U]++;
+        }
+    }
+
+    for (size_t i = 0U; i < n; i++) {
+        offsets[i + 1U] += offsets[i];
+        cursors[i] = offsets[i];
+    }
+
+    for (size_t i = 0U; i < n; i++) {
+        const XCPKGPackage * package = &plan->packageArray[i];
+
+        for (size_t j = 0U; j < package->depIndexArraySize; j++) {
+            dependents[cursors[package->depIndexArray[j]]++] = i;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t head = 0U;
+    size_t tail = 0U;
+
+    for (size_t i = 0U; i < n; i++) {
+        if (remaining[i] == 0U) {
+            plan->packageArray[i].level = 0U;
+            order[tail++] = i;
+        }
+    }
+
+    size_t levelCount = 0U;
+
+    while (head < tail) {
+        levelOffsetArray[levelCount++] = head;
+
+        size_t levelEnd = tail;
+
+        while (head < levelEnd) {
+            size_t i = order[head++];
+
+            for (size_t j = offsets[i]; j < offsets[i + 1U]; j++) {
+                size_t k = dependents[j];
+
+                if (--remaining[k] == 0U) {
+                    plan->packageArray[k].level = levelCount;
+                    order[tail++] = k;
+                }
+            }
+        }
+    }
+
+    levelOffsetArray[levelCount] = tail;
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    free(offsets);
+    free(dependents);
+
+    if (tail != n) {
+        // reuse the buffers which are no longer needed
+        report_the_cycle(plan, remaining, cursors, order);
+
+        free(remaining);
+        free(cursors);
+        free(order);
+        free(levelOffsetArray);
+
+        return XCPKG_ERROR;
+    }
+
+    free(remaining);
+    free(cursors);
+
+    plan->order = order;
+    plan->levelOffsetArray = levelOffsetArray;
+    plan->levelCount = levelCount;
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t wordCount = (n + 63U) >> 6;
+
+    uint64_t * closureBitArray = (uint64_t*)calloc(n * wordCount, sizeof(uint64_t));
+
+    if (closureBitArray == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    // dependencies come first in order, so their closures are complete when they are merged into their dependents
+    for (size_t i = 0U; i < n; i++) {
+        size_t index = order[i];
+
+        uint64_t * bits = closureBitArray + index * wordCount;
+
+        bits[index >> 6] |= ((uint64_t)1U) << (index & 63U);
+
+        const XCPKGPackage * package = &plan->packageArray[index];
+
+        for (size_t j = 0U; j < package->depIndexArraySize; j++) {
+            const uint64_t * depBits = closureBitArray + package->depIndexArray[j] * wordCount;
+
+            for (size_t k = 0U; k < wordCount; k++) {
+                bits[k] |= depBits[k];
+            }
+        }
+    }
+
+    free(plan->closureBitArray);
+
+    plan->closureBitArray = closureBitArray;
+    plan->closureWordCount = wordCount;
+
+    return XCPKG_OK;
+}
+
+size_t xcpkg_install_plan_closure(const XCPKGInstallPlan * plan, const size_t index, size_t indexArray[]) {
+    size_t count = 0U;
+
+    for (size_t i = plan->packageArraySize; i > 0U; i--) {
+        size_t depIndex = plan->order[i - 1U];
+
+        if (xcpkg_install_plan_closure_has(plan, index, depIndex)) {
+            indexArray[count++] = depIndex;
+        }
+    }
+
+    return count;
+}
+
+void xcpkg_install_plan_free(XCPKGInstallPlan * plan) {
+    for (size_t i = 0U; i < plan->packageArraySize; i++) {
+        XCPKGPackage * package = &plan->packageArray[i];
+
+        free(package->packageName);
+        package->packageName = NULL;
+
+        free(package->depIndexArray);
+        package->depIndexArray = NULL;
+
+        if (package->formula != NULL) {
+            xcpkg_formula_free(package->formula);
+            package->formula = NULL;
+        }
+    }
+
+    free(plan->packageArray);
+    free(plan->slotArray);
+    free(plan->order);
+    free(plan->levelOffsetArray);
+    free(plan->closureBitArray);
+
+    memset(plan, 0, sizeof(XCPKGInstallPlan));
+}
@@ -0,0 +1,98 @@
+#ifndef _INSTALL_PLAN_H
+#define _INSTALL_PLAN_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../xcpkg.h"
+
+typedef struct {
+    char * packageName;
+    size_t packageNameLength;
+
+    XCPKGFormula * formula;
+
+    // indexes of the direct dependencies of this package
+    size_t * depIndexArray;
+    size_t   depIndexArraySize;
+    size_t   depIndexArrayCapacity;
+
+    // 0 means this package has no dependencies, otherwise 1 + the max level of its dependencies
+    size_t level;
+} XCPKGPackage;
+
+/**
+ *  a dependency graph of packages, indexed by package name via an open addressing hash table.
+ *
+ *  after xcpkg_install_plan_sort() succeeded:
+ *
+ *  order[0 .. packageArraySize) lists the indexes of all the packages, every package comes after all of its dependencies.
+ *
+ *  the packages in order[levelOffsetArray[i] .. levelOffsetArray[i + 1]) only depend on the packages in lower levels,
+ *  so the packages in one level can be installed concurrently.
+ *
+ *  the transitive closure of every package (itself and all of its recursive dependencies) is kept as a bitset,
+ *  the bitset of the package at i is closureBitArray[i * closureWordCount .. (i + 1) * closureWordCount).
+ */
+typedef struct {
+    XCPKGPackage * packageArray;
+    size_t         packageArraySize;
+    size_t         packageArrayCapacity;
+
+    // slot value is index + 1, 0 means empty slot
+    size_t * slotArray;
+    size_t   slotArraySize;
+
+    size_t * order;
+
+    size_t * levelOffsetArray;
+    size_t   levelCount;
+
+    uint64_t * closureBitArray;
+    size_t     closureWordCount;
+} XCPKGInstallPlan;
+
+/** look up the package whose name is the first packageNameLength bytes of packageName
+ *
+ *  on found, true is returned and index will be set.
+ */
+bool xcpkg_install_plan_find(const XCPKGInstallPlan * plan, const char * packageName, const size_t packageNameLength, size_t * index);
+
+/** add a package to the plan if it is not in the plan yet
+ *
+ *  packageName does not need to be null-terminated, only the first packageNameLength bytes are used.
+ *
+ *  on success, XCPKG_OK is returned, index will be set and added tells whether it is newly added.
+ */
+int  xcpkg_install_plan_add(XCPKGInstallPlan * plan, const char * packageName, const size_t packageNameLength, size_t * index, bool * added);
+
+/** record that the package at index depends on the package at depIndex, duplicated edges are ignored.
+ */
+int  xcpkg_install_plan_add_edge(XCPKGInstallPlan * plan, const size_t index, const size_t depIndex);
+
+/** sort the plan with Kahn's algorithm, fill order, levelOffsetArray, closureBitArray and the level of every package.
+ *
+ *  if there are circular dependencies, the full cycle path is reported and XCPKG_ERROR is returned.
+ */
+int  xcpkg_install_plan_sort(XCPKGInstallPlan * plan);
+
+/** check if the package at depIndex is in the transitive closure of the package at index
+ *
+ *  only valid after xcpkg_install_plan_sort() succeeded.
+ */
+static inline __attribute__((always_inline)) bool xcpkg_install_plan_closure_has(const XCPKGInstallPlan * plan, const size_t index, const size_t depIndex) {
+    return (plan->closureBitArray[index * plan->closureWordCount + (depIndex >> 6)] >> (depIndex & 63U)) & 1U;
+}
+
+/** fill indexArray with the transitive closure of the package at index, the capacity of indexArray must be plan->packageArraySize
+ *
+ *  the package itself comes first, every package comes before all of its dependencies.
+ *
+ *  only valid after xcpkg_install_plan_sort() succeeded, the count of filled indexes is returned.
+ */
+size_t xcpkg_install_plan_closure(const XCPKGInstallPlan * plan, const size_t index, size_t indexArray[]);
+
+void xcpkg_install_plan_free(XCPKGInstallPlan * plan);
+
+#endif
@@ -24,6 +24,8 @@
 #include "../xcpkg.h"
 
 #include "native-package.h"
+#include "manifest.h"
+#include "install-plan.h"
 #include "uppm.h"
 
 typedef struct {
@@ -158,6 +160,58 @@ finally:
     return XCPKG_OK;
 }
 
+// the downloaded files which are already there are verified concurrently up front, the later xcpkg_http_fetch_then_unpack() calls reuse these results instead of reading them one by one
+static int prehash_the_downloaded_files(const XCPKGFormula * formula, const char * xcpkgDownloadsDIR) {
+    const char * urls[3] = { formula->src_is_dir ? NULL : formula->src_url, formula->fix_url, formula->res_url };
+    const char * shas[3] = { formula->src_sha, formula->fix_sha, formula->res_sha };
+
+    char filePathBufs[3][PATH_MAX];
+
+    const char * filePaths[3];
+
+    size_t n = 0U;
+
+    for (int i = 0; i < 3; i++) {
+        if (urls[i] == NULL || shas[i] == NULL) {
+            continue;
+        }
+
+        char fileType[XCPKG_FILE_EXTENSION_MAX_CAPACITY] = {0};
+
+        int ret = xcpkg_extract_filetype_from_url(urls[i], fileType, XCPKG_FILE_EXTENSION_MAX_CAPACITY);
+
+        if (ret != XCPKG_OK) {
+            continue;
+        }
+
+        ret = snprintf(filePathBufs[n], PATH_MAX, "%s/%s%s", xcpkgDownloadsDIR, shas[i], fileType);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        struct stat st;
+
+        if (stat(filePathBufs[n], &st) == 0 && S_ISREG(st.st_mode)) {
+            filePaths[n] = filePathBufs[n];
+            n++;
+        }
+    }
+
+    if (n < 2U) {
+        return XCPKG_OK;
+    }
+
+    char outputBufs[3][65];
+    int  rets[3];
+
+    // a mismatched or unreadable file is reported and handled later by xcpkg_http_fetch_then_unpack()
+    sha256sum_of_files(outputBufs, rets, filePaths, n, (unsigned int)n);
+
+    return XCPKG_OK;
+}
+
 static int fetch_fixlist(const char * fixlist, const char * xcpkgDownloadsDIR, const size_t xcpkgDownloadsDIRCapacity, bool verbose) {
     size_t  bufCapacity = strlen(fixlist) + 1U;
     char    buf[bufCapacity];
@@ -1035,7 +1089,40 @@ static int install_native_packages_via_uppm(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    fprintf(stderr, "uppm packages to be installed in order: %s\n", uppmPackageNames);
+    fprintf(stderr, "uppm packages to be installed: %s\n", uppmPackageNames);
+
+    size_t uppmPackageNamesLength = strlen(uppmPackageNames);
+
+    char uppmPackageNamesCopy[uppmPackageNamesLength + 1U];
+
+    memcpy(uppmPackageNamesCopy, uppmPackageNames, uppmPackageNamesLength + 1U);
+
+    const char * uppmPackageNameArray[uppmPackageNamesLength / 2U + 1U];
+    size_t       uppmPackageNameArraySize = 0U;
+
+    for (char * q = uppmPackageNamesCopy; ; ) {
+        while (q[0] == ' ') {
+            q[0] = '\0';
+            q++;
+        }
+
+        if (q[0] == '\0') {
+            break;
+        }
+
+        uppmPackageNameArray[uppmPackageNameArraySize++] = q;
+
+        while (q[0] != ' ' && q[0] != '\0') q++;
+    }
+
+    // the packages which do not depend on each other are installed concurrently
+    ret = uppm_install_the_given_packages(uppmHomeDIR, uppmHomeDIRLength, uppmPackageNameArray, uppmPackageNameArraySize, verbose, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
 
     const char * p = uppmPackageNames;
 
@@ -1068,12 +1155,6 @@ loop:
 
     //////////////////////////////////////////////////////////////////////////////
 
-    ret = uppm_install(uppmHomeDIR, uppmHomeDIRLength, uppmPackageName, verbose, false);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
     size_t uppmPackageInstalledDIRCapacity = uppmPackageInstalledRootDIRCapacity + strlen(uppmPackageName) + 2U;
     char   uppmPackageInstalledDIR[uppmPackageInstalledDIRCapacity];
 
@@ -1454,7 +1535,7 @@ static int install_native_packages_via_uppm_or_build(
 
     char key[20];
 
-    for (i = 0U; i < nativePackageIDArraySize; i++) {
+    if (nativePackageIDArraySize != 0U) {
         for (int j = 0U; ; j++) {
             const char * name  = flagsForNativeBuild[j].name;
             const char * value = flagsForNativeBuild[j].value;
@@ -1499,15 +1580,10 @@ static int install_native_packages_via_uppm_or_build(
                 }
             }
         }
-
-        ret = install_native_package(nativePackageIDArray[i], xcpkgDownloadsDIR, xcpkgDownloadsDIRCapacity, sessionDIR, sessionDIRLength + 1, nativePackageInstalledRootDIR, nativePackageInstalledRootDIRCapacity, njobs, installOptions, native_package_installed_callback);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
     }
 
-    return XCPKG_OK;
+    // the packages which do not depend on each other are built concurrently, they share njobs
+    return install_native_packages(nativePackageIDArray, nativePackageIDArraySize, xcpkgDownloadsDIR, xcpkgDownloadsDIRCapacity, sessionDIR, sessionDIRLength + 1, nativePackageInstalledRootDIR, nativePackageInstalledRootDIRCapacity, njobs, installOptions, native_package_installed_callback);
 }
 
 static int setenv_rustflags(const char * rustTarget, const size_t rustTargetLength, const char * cc, const char * ldflags, const char * libDIR, const size_t libDIRCapacity) {
@@ -1933,270 +2009,680 @@ static int copy_dependent_libraries(
     }
 }
 
-static inline int setenvs_for_target(const char * recursiveDependentPackageNames, const char * packageInstalledRootDIR, const size_t packageInstalledRootDIRCapacity, const char * nativePackageInstalledRootDIR, const size_t nativePackageInstalledRootDIRCapacity, const char * packageWorkingTopDIR, const size_t packageWorkingTopDIRCapacity, const bool needToCopyStaticLibs, const bool isCrossBuild) {
-    size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + 52U;
-    char   packageInstalledDIR[packageInstalledDIRCapacity];
-
-    size_t i;
+typedef struct {
+    char * ptr;
+    size_t length;
+    size_t capacity;
+} StringBuf;
 
-    char * m;
+static inline __attribute__((always_inline)) int string_buffer_append(StringBuf * const stringBuf, const char * s, const size_t n) {
+    if (stringBuf->length + n + 1U > stringBuf->capacity) {
+        size_t newCapacity = stringBuf->length + n + 1024U;
 
-    for (i = 0U; ; i++) {
-        packageInstalledDIR[i] = packageInstalledRootDIR[i];
+        char * p = (char*)realloc(stringBuf->ptr, newCapacity);
 
-        if (packageInstalledDIR[i] == '\0') {
-            packageInstalledDIR[i] = '/';
-            m = packageInstalledDIR + i + 1;
-            break;
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
         }
+
+        stringBuf->ptr = p;
+        stringBuf->capacity = newCapacity;
     }
 
-    //////////////////////////////////////
+    memcpy(stringBuf->ptr + stringBuf->length, s, n);
 
-    size_t nativePkgInstalledDIRCapacity = nativePackageInstalledRootDIRCapacity + 52U;
-    char   nativePkgInstalledDIR[nativePkgInstalledDIRCapacity];
+    stringBuf->length += n;
+    stringBuf->ptr[stringBuf->length] = '\0';
 
-    char * n;
+    return XCPKG_OK;
+}
 
-    for (i = 0U; ; i++) {
-        nativePkgInstalledDIR[i] = nativePackageInstalledRootDIR[i];
+// append separator (if stringBuf is not empty) + prefix + rootDIR + '/' + packageName + suffix
+static int string_buffer_append_path(StringBuf * const stringBuf, const char separator, const char * prefix, const char * rootDIR, const char * packageName, const char * suffix) {
+    int ret;
 
-        if (nativePkgInstalledDIR[i] == '\0') {
-            nativePkgInstalledDIR[i] = '/';
-            n = nativePkgInstalledDIR + i + 1;
-            break;
+    if (stringBuf->length != 0U) {
+        ret = string_buffer_append(stringBuf, &separator, 1U);
+
+        if (ret != XCPKG_OK) {
+            return ret;
         }
     }
 
-    //////////////////////////////////////
+    const char * a[5] = { prefix, rootDIR, "/", packageName, suffix };
 
-    const char * p = recursiveDependentPackageNames;
+    for (int i = 0; i < 5; i++) {
+        ret = string_buffer_append(stringBuf, a[i], strlen(a[i]));
 
-    setenv_fn fns[5] = { setenv_CPPFLAGS, setenv_LDFLAGS, setenv_PKG_CONFIG_PATH, setenv_ACLOCAL_PATH, setenv_XDG_DATA_DIRS };
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
 
-    int ret;
+    return XCPKG_OK;
+}
 
-loop:
-    if (p[0] == '\0') {
-        return XCPKG_OK;
+//////////////////////////////////////////////////////////////////////////////
+
+#define DEP_ENV_CPPFLAGS        0
+#define DEP_ENV_LDFLAGS         1
+#define DEP_ENV_PKG_CONFIG_PATH 2
+#define DEP_ENV_ACLOCAL_PATH    3
+#define DEP_ENV_XDG_DATA_DIRS   4
+#define DEP_ENV_PATH            5
+#define DEP_ENV_COUNT           6
+
+typedef struct {
+    const char * name;
+    const char   separator;
+    // true: the dependency part is put before the inherited value, false: after
+    const bool   prepend;
+} DepEnv;
+
+static const DepEnv depEnvs[DEP_ENV_COUNT] = {
+    { "CPPFLAGS",        ' ', true  },
+    { "LDFLAGS",         ' ', false },
+    { "PKG_CONFIG_PATH", ':', false },
+    { "ACLOCAL_PATH",    ':', true  },
+    { "XDG_DATA_DIRS",   ':', true  },
+    { "PATH",            ':', true  },
+};
+
+#define PROBE_INCLUDE     (1U << 0)
+#define PROBE_LIB         (1U << 1)
+#define PROBE_LIB_PC      (1U << 2)
+#define PROBE_SHARE_PC    (1U << 3)
+#define PROBE_ACLOCAL     (1U << 4)
+#define PROBE_GIR_OR_MIME (1U << 5)
+#define PROBE_BIN         (1U << 6)
+#define PROBE_SBIN        (1U << 7)
+
+#define PROBE_NATIVE_SHIFT 8
+
+/**
+ * open the given installed directory once and probe all of its sub-directories relative to it.
+ *
+ * the returned bitmask is made of PROBE_* of the sub-directories that exist.
+ */
+static unsigned int probe_installed_dir(const char * rootDIR, const char * packageName, const bool forTarget) {
+    size_t dirPathCapacity = strlen(rootDIR) + strlen(packageName) + 2U;
+    char   dirPath[dirPathCapacity];
+
+    int ret = snprintf(dirPath, dirPathCapacity, "%s/%s", rootDIR, packageName);
+
+    if (ret < 0) {
+        return 0U;
     }
 
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
+    int dirFD = open(dirPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (dirFD == -1) {
+        return 0U;
     }
 
-    //////////////////////////////////////
+    const char * subDIRs[9] = { "include", "lib", "lib/pkgconfig", "share/pkgconfig", "share/aclocal", "share/gir-1.0", "share/mime", "bin", "sbin" };
+    unsigned int probes[9]  = { PROBE_INCLUDE, PROBE_LIB, PROBE_LIB_PC, PROBE_SHARE_PC, PROBE_ACLOCAL, PROBE_GIR_OR_MIME, PROBE_GIR_OR_MIME, PROBE_BIN, PROBE_SBIN };
 
-    for (i = 0U; ; i++) {
-        m[i] = p[i];
-        n[i] = p[i];
+    unsigned int mask = 0U;
 
-        if (p[i] == '\0') {
-            break;
-        }
+    struct stat st;
 
-        if (p[i] == ' ') {
-            m[i] = '\0';
-            n[i] = '\0';
-            break;
+    // for native packages, only bin and sbin are used
+    for (int i = forTarget ? 0 : 7; i < 9; i++) {
+        if ((mask & probes[i]) == 0U && fstatat(dirFD, subDIRs[i], &st, 0) == 0 && S_ISDIR(st.st_mode)) {
+            mask |= probes[i];
         }
     }
 
-    fprintf(stderr, "packageInstalledDIR=%s\n", packageInstalledDIR);
-    fprintf(stderr, "nativePkgInstalledDIR=%s\n", nativePkgInstalledDIR);
+    close(dirFD);
 
-    //////////////////////////////////////
+    return mask;
+}
 
-    for (size_t j = 0U; j < 5U; j++) {
-        ret = fns[j](packageInstalledDIR, packageInstalledDIRCapacity);
+/**
+ * the signature of the given closure is made of the installed directories that the installed symlinks of its dependencies point to,
+ * those directories are unique for every installation, so an unchanged signature means an unchanged layout.
+ */
+static int signature_of_the_closure(const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize, const char * packageInstalledRootDIR, const char * nativePackageInstalledRootDIR, StringBuf * signature) {
+    const char * rootDIRs[2] = { packageInstalledRootDIR, nativePackageInstalledRootDIR };
 
-        if (ret != XCPKG_OK) {
-            return ret;
+    char target[PATH_MAX];
+
+    for (size_t k = 1U; k < closureSize; k++) {
+        const char * packageName = plan->packageArray[closure[k]].packageName;
+
+        int ret;
+
+        if (signature->length != 0U) {
+            ret = string_buffer_append(signature, " ", 1U);
+
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
         }
-    }
 
-    if (needToCopyStaticLibs) {
-        ret = copy_dependent_libraries(packageInstalledDIR, packageInstalledDIRCapacity, packageWorkingTopDIR, packageWorkingTopDIRCapacity);
+        ret = string_buffer_append(signature, packageName, strlen(packageName));
 
         if (ret != XCPKG_OK) {
             return ret;
         }
-    }
-
-    ret = setenv_PATH(nativePkgInstalledDIR, nativePkgInstalledDIRCapacity);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
 
-    if (!isCrossBuild) {
-        ret = setenv_PATH(packageInstalledDIR, packageInstalledDIRCapacity);
+        ret = string_buffer_append(signature, "=", 1U);
 
         if (ret != XCPKG_OK) {
             return ret;
         }
-    }
 
-    //////////////////////////////////////
+        for (int i = 0; i < 2; i++) {
+            size_t linkPathCapacity = strlen(rootDIRs[i]) + strlen(packageName) + 2U;
+            char   linkPath[linkPathCapacity];
 
-    p += i;
+            ret = snprintf(linkPath, linkPathCapacity, "%s/%s", rootDIRs[i], packageName);
 
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
-    }
+            if (ret < 0) {
+                perror(NULL);
+                return XCPKG_ERROR;
+            }
 
-    return XCPKG_OK;
-}
+            ssize_t n = readlink(linkPath, target, PATH_MAX);
 
-static inline int write_shell_script_file(const int fd, const char * recursiveDependentPackageNames, const char * packageInstalledRootDIR, const size_t packageInstalledRootDIRCapacity) {
-    size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + 52U;
-    char   packageInstalledDIR[packageInstalledDIRCapacity];
+            if (n < 0) {
+                target[0] = '-';
+                n = 1;
+            }
 
-    size_t i;
+            if (i == 1) {
+                ret = string_buffer_append(signature, ",", 1U);
 
-    char * q;
+                if (ret != XCPKG_OK) {
+                    return ret;
+                }
+            }
 
-    for (i = 0U; ; i++) {
-        packageInstalledDIR[i] = packageInstalledRootDIR[i];
+            ret = string_buffer_append(signature, target, (size_t)n);
 
-        if (packageInstalledDIR[i] == '\0') {
-            packageInstalledDIR[i] = '/';
-            q = packageInstalledDIR + i + 1;
-            break;
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
         }
     }
 
-    //////////////////////////////////////
-
-    const char * p = recursiveDependentPackageNames;
+    return XCPKG_OK;
+}
 
-    char packageName[51];
+/**
+ * load the dependency part of the environment variables from the snapshot which was written by the last installation of this package.
+ *
+ * on success, true is returned, a snapshot whose signature differs from the given one is ignored.
+ */
+static bool load_dependencies_env_snapshot(const char * filePath, const StringBuf * signature, StringBuf bufs[]) {
+    FILE * file = fopen(filePath, "r");
 
-loop:
-    if (p[0] == '\0') {
-        return XCPKG_OK;
+    if (file == NULL) {
+        return false;
     }
 
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
-    }
+    bool matched = false;
 
-    //////////////////////////////////////
+    char * line = NULL;
+    size_t lineCapacity = 0U;
 
-    for (i = 0U; ; i++) {
-        q[i] = p[i];
+    ssize_t n = getline(&line, &lineCapacity, file);
 
-        if (p[i] == '@' || p[i] == '+' || p[i] == '-' || p[i] == '.') {
-            packageName[i] = '_';
-        } else {
-            packageName[i] = p[i];
+    if (n > 2 && line[0] == '#' && line[1] == ' ' && (size_t)(n - 3) == signature->length && strncmp(line + 2, signature->ptr == NULL ? "" : signature->ptr, signature->length) == 0) {
+        matched = true;
+
+        while ((n = getline(&line, &lineCapacity, file)) > 0) {
+            if (line[n - 1] == '\n') {
+                line[--n] = '\0';
+            }
+
+            for (int i = 0; i < DEP_ENV_COUNT; i++) {
+                size_t nameLength = strlen(depEnvs[i].name);
+
+                if (strncmp(line, depEnvs[i].name, nameLength) == 0 && line[nameLength] == '=') {
+                    if (string_buffer_append(&bufs[i], line + nameLength + 1U, (size_t)n - nameLength - 1U) != XCPKG_OK) {
+                        matched = false;
+                    }
+
+                    break;
+                }
+            }
         }
 
-        if (p[i] == '\0') {
-            break;
+        if (ferror(file)) {
+            matched = false;
         }
+    }
 
-        if (p[i] == ' ') {
-            q[i] = '\0';
-            packageName[i] = '\0';
-            break;
+    free(line);
+    fclose(file);
+
+    if (!matched) {
+        for (int i = 0; i < DEP_ENV_COUNT; i++) {
+            bufs[i].length = 0U;
         }
     }
 
-    //////////////////////////////////////
+    return matched;
+}
 
-    int ret = dprintf(fd, "\n%s_INSTALL_DIR='%s'\n", packageName, packageInstalledDIR);
+static int write_dependencies_env_snapshot(const char * filePath, const StringBuf * signature, const StringBuf bufs[]) {
+    FILE * file = fopen(filePath, "w");
 
-    if (ret < 0) {
-        perror(NULL);
+    if (file == NULL) {
+        perror(filePath);
         return XCPKG_ERROR;
     }
 
-    ret = dprintf(fd, "%s_INCLUDE_DIR='%s/include'\n", packageName, packageInstalledDIR);
+    fprintf(file, "# %s\n", signature->ptr == NULL ? "" : signature->ptr);
 
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
+    for (int i = 0; i < DEP_ENV_COUNT; i++) {
+        fprintf(file, "%s=%s\n", depEnvs[i].name, bufs[i].ptr == NULL ? "" : bufs[i].ptr);
     }
 
-    ret = dprintf(fd, "%s_LIBRARY_DIR='%s/lib'\n", packageName, packageInstalledDIR);
-
-    if (ret < 0) {
-        perror(NULL);
+    if (ferror(file)) {
+        perror(filePath);
+        fclose(file);
         return XCPKG_ERROR;
     }
 
-    //////////////////////////////////////
-
-    p += i;
-
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
+    if (fclose(file) != 0) {
+        perror(filePath);
+        return XCPKG_ERROR;
     }
 
     return XCPKG_OK;
 }
 
-static int generate_shell_script_file(
-        const char * shellScriptFileName,
-        const char * packageName,
-        const XCPKGFormula * formula,
-        const XCPKGInstallOptions * installOptions,
-        const SysInfo * sysinfo,
-        const char * uppmPackageInstalledRootDIR,
-        const char * nativePackageInstalledRootDIR,
-        const char * xcpkgExeFilePath,
-        const time_t ts,
-        const size_t njobs,
-        const bool isCrossBuild,
-        const char * targetPlatformSpec,
-        const char * targetPlatformName,
-        const char * targetPlatformVers,
-        const char * targetPlatformArch,
-        const char * xcpkgHomeDIR,
-        const char * xcpkgCoreDIR,
-        const char * xcpkgDownloadsDIR,
-        const char * sessionDIR,
-        const char * packageWorkingTopDIR,
-        const char * packageInstalledRootDIR,
-        const size_t packageInstalledRootDIRCapacity,
-        const char * packageInstalledDIR,
-
-        const char * recursiveDependentPackageNames) {
-    int fd = open(shellScriptFileName, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+static int probe_dependencies_env(const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize, const char * packageInstalledRootDIR, const char * nativePackageInstalledRootDIR, const bool isCrossBuild, StringBuf bufs[]) {
+    unsigned int * masks = (unsigned int*)malloc(closureSize * sizeof(unsigned int));
 
-    if (fd == -1) {
-        perror(shellScriptFileName);
-        return XCPKG_ERROR;
+    if (masks == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
     }
 
-    int ret;
+    for (size_t k = 1U; k < closureSize; k++) {
+        const char * packageName = plan->packageArray[closure[k]].packageName;
 
-    if (installOptions->xtrace) {
-        ret = dprintf(fd, "set -x\n\n");
+        masks[k] = probe_installed_dir(packageInstalledRootDIR, packageName, true) | (probe_installed_dir(nativePackageInstalledRootDIR, packageName, false) << PROBE_NATIVE_SHIFT);
 
-        if (ret < 0) {
-            close(fd);
-            return XCPKG_ERROR;
+        if (isCrossBuild) {
+            masks[k] &= ~(PROBE_BIN | PROBE_SBIN);
         }
     }
 
-    ret = dprintf(fd, "set -e\n\nunset IFS\n\n");
+    //////////////////////////////////////////////////////////////////////////////
 
-    if (ret < 0) {
-        close(fd);
-        return XCPKG_ERROR;
-    }
+    int ret = XCPKG_OK;
 
-    //////////////////////////////////////////////////////////////////////////////
+    // the dependency parts that come after the inherited value are in closure order
+    for (size_t k = 1U; k < closureSize; k++) {
+        const char * packageName = plan->packageArray[closure[k]].packageName;
 
-    KV kvs1[] = {
-        {"NATIVE_PLATFORM_ARCH", sysinfo->arch },
-        {"NATIVE_PLATFORM_VERS", sysinfo->vers },
+        unsigned int mask = masks[k];
+
+        if (mask & PROBE_LIB) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_LDFLAGS], ' ', "-L", packageInstalledRootDIR, packageName, "/lib");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+
+            ret = string_buffer_append_path(&bufs[DEP_ENV_LDFLAGS], ' ', "-Wl,-rpath,", packageInstalledRootDIR, packageName, "/lib");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+
+        if (mask & PROBE_LIB_PC) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_PKG_CONFIG_PATH], ':', "", packageInstalledRootDIR, packageName, "/lib/pkgconfig");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+
+        if (mask & PROBE_SHARE_PC) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_PKG_CONFIG_PATH], ':', "", packageInstalledRootDIR, packageName, "/share/pkgconfig");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+    }
+
+    // the dependency parts that come before the inherited value are in reverse closure order, the same as prepending them one by one
+    for (size_t k = closureSize - 1U; k > 0U; k--) {
+        const char * packageName = plan->packageArray[closure[k]].packageName;
+
+        unsigned int mask = masks[k];
+
+        if (mask & PROBE_INCLUDE) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_CPPFLAGS], ' ', "-I", packageInstalledRootDIR, packageName, "/include");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+
+        if (mask & PROBE_ACLOCAL) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_ACLOCAL_PATH], ':', "", packageInstalledRootDIR, packageName, "/share/aclocal");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+
+        if (mask & PROBE_GIR_OR_MIME) {
+            ret = string_buffer_append_path(&bufs[DEP_ENV_XDG_DATA_DIRS], ':', "", packageInstalledRootDIR, packageName, "/share");
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+        }
+
+        const char * rootDIRs[2] = { packageInstalledRootDIR, nativePackageInstalledRootDIR };
+        unsigned int shifts[2] = { 0U, PROBE_NATIVE_SHIFT };
+
+        for (int i = 0; i < 2; i++) {
+            if (mask & (PROBE_BIN << shifts[i])) {
+                ret = string_buffer_append_path(&bufs[DEP_ENV_PATH], ':', "", rootDIRs[i], packageName, "/bin");
+
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
+            }
+
+            if (mask & (PROBE_SBIN << shifts[i])) {
+                ret = string_buffer_append_path(&bufs[DEP_ENV_PATH], ':', "", rootDIRs[i], packageName, "/sbin");
+
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
+            }
+        }
+    }
+
+finalize:
+    free(masks);
+    return ret;
+}
+
+static int apply_dependencies_env(const StringBuf bufs[]) {
+    for (int i = 0; i < DEP_ENV_COUNT; i++) {
+        const StringBuf * buf = &bufs[i];
+
+        if (buf->length == 0U) {
+            continue;
+        }
+
+        const char * name = depEnvs[i].name;
+
+        const char * const oldValue = getenv(name);
+
+        if (oldValue == NULL || oldValue[0] == '\0') {
+            if (i == DEP_ENV_PATH) {
+                return XCPKG_ERROR_ENV_PATH_NOT_SET;
+            }
+
+            if (setenv(name, buf->ptr, 1) != 0) {
+                perror(name);
+                return XCPKG_ERROR;
+            }
+
+            continue;
+        }
+
+        size_t oldValueLength = strlen(oldValue);
+
+        size_t newValueCapacity = oldValueLength + buf->length + 2U;
+        char * newValue = (char*)malloc(newValueCapacity);
+
+        if (newValue == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        const char * a = depEnvs[i].prepend ? buf->ptr : oldValue;
+        const char * b = depEnvs[i].prepend ? oldValue : buf->ptr;
+
+        size_t aLength = depEnvs[i].prepend ? buf->length : oldValueLength;
+        size_t bLength = depEnvs[i].prepend ? oldValueLength : buf->length;
+
+        memcpy(newValue, a, aLength);
+        newValue[aLength] = depEnvs[i].separator;
+        memcpy(newValue + aLength + 1U, b, bLength);
+        newValue[aLength + 1U + bLength] = '\0';
+
+        int ret = setenv(name, newValue, 1);
+
+        free(newValue);
+
+        if (ret != 0) {
+            perror(name);
+            return XCPKG_ERROR;
+        }
+    }
+
+    return XCPKG_OK;
+}
+
+/**
+ * set the environment variables for the dependencies of the package at closure[0].
+ *
+ * all the dependency directories are probed in one pass, then every variable is assembled in its own buffer and set once.
+ * the dependency parts are written to packageWorkingTopDIR/dependencies.env, which is kept in the installed .xcpkg directory,
+ * a later reinstall reuses it as long as none of the dependencies has been reinstalled since then.
+ */
+static int setenvs_for_target(const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize, const char * packageInstalledRootDIR, const size_t packageInstalledRootDIRCapacity, const char * nativePackageInstalledRootDIR, const char * packageWorkingTopDIR, const size_t packageWorkingTopDIRCapacity, const bool needToCopyStaticLibs, const bool isCrossBuild) {
+    int ret;
+
+    if (needToCopyStaticLibs) {
+        size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + 52U;
+        char   packageInstalledDIR[packageInstalledDIRCapacity];
+
+        for (size_t k = 1U; k < closureSize; k++) {
+            ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, plan->packageArray[closure[k]].packageName);
+
+            if (ret < 0) {
+                perror(NULL);
+                return XCPKG_ERROR;
+            }
+
+            ret = copy_dependent_libraries(packageInstalledDIR, packageInstalledDIRCapacity, packageWorkingTopDIR, packageWorkingTopDIRCapacity);
+
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    StringBuf signature = {0};
+
+    StringBuf bufs[DEP_ENV_COUNT] = {0};
+
+    ret = signature_of_the_closure(plan, closure, closureSize, packageInstalledRootDIR, nativePackageInstalledRootDIR, &signature);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    char snapshotFilePath[PATH_MAX];
+
+    ret = snprintf(snapshotFilePath, PATH_MAX, "%s/%s/" XCPKG_METADATA_DIRNAME "/dependencies.env", packageInstalledRootDIR, plan->packageArray[closure[0]].packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+        goto finalize;
+    }
+
+    if (!load_dependencies_env_snapshot(snapshotFilePath, &signature, bufs)) {
+        ret = probe_dependencies_env(plan, closure, closureSize, packageInstalledRootDIR, nativePackageInstalledRootDIR, isCrossBuild, bufs);
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+    }
+
+    ret = apply_dependencies_env(bufs);
+
+    if (ret != XCPKG_OK) {
+        goto finalize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    char newSnapshotFilePath[PATH_MAX];
+
+    ret = snprintf(newSnapshotFilePath, PATH_MAX, "%s/dependencies.env", packageWorkingTopDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+        goto finalize;
+    }
+
+    ret = write_dependencies_env_snapshot(newSnapshotFilePath, &signature, bufs);
+
+finalize:
+    free(signature.ptr);
+
+    for (int i = 0; i < DEP_ENV_COUNT; i++) {
+        free(bufs[i].ptr);
+    }
+
+    return ret;
+}
+
+static inline int write_shell_script_file(const int fd, const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize, const char * packageInstalledRootDIR) {
+    int ret = dprintf(fd, "PACKAGE_DEP_PKG_R='");
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    // closure[0] is the package being built, it is not a dependency of itself
+    for (size_t k = 1U; k < closureSize; k++) {
+        ret = dprintf(fd, k == 1U ? "%s" : " %s", plan->packageArray[closure[k]].packageName);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+    }
+
+    ret = dprintf(fd, "'\n");
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////
+
+    char packageName[51];
+
+    for (size_t k = 1U; k < closureSize; k++) {
+        const XCPKGPackage * package = &plan->packageArray[closure[k]];
+
+        for (size_t i = 0U; i <= package->packageNameLength; i++) {
+            char c = package->packageName[i];
+
+            if (c == '@' || c == '+' || c == '-' || c == '.') {
+                packageName[i] = '_';
+            } else {
+                packageName[i] = c;
+            }
+        }
+
+        //////////////////////////////////////
+
+        ret = dprintf(fd, "\n%s_INSTALL_DIR='%s/%s'\n", packageName, packageInstalledRootDIR, package->packageName);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        ret = dprintf(fd, "%s_INCLUDE_DIR='%s/%s/include'\n", packageName, packageInstalledRootDIR, package->packageName);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        ret = dprintf(fd, "%s_LIBRARY_DIR='%s/%s/lib'\n", packageName, packageInstalledRootDIR, package->packageName);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+    }
+
+    return XCPKG_OK;
+}
+
+static int generate_shell_script_file(
+        const char * shellScriptFileName,
+        const char * packageName,
+        const XCPKGFormula * formula,
+        const XCPKGInstallOptions * installOptions,
+        const SysInfo * sysinfo,
+        const char * uppmPackageInstalledRootDIR,
+        const char * nativePackageInstalledRootDIR,
+        const char * xcpkgExeFilePath,
+        const time_t ts,
+        const size_t njobs,
+        const bool isCrossBuild,
+        const char * targetPlatformSpec,
+        const char * targetPlatformName,
+        const char * targetPlatformVers,
+        const char * targetPlatformArch,
+        const char * xcpkgHomeDIR,
+        const char * xcpkgCoreDIR,
+        const char * sessionDIR,
+        const char * packageWorkingTopDIR,
+        const char * packageInstalledRootDIR,
+        const char * packageInstalledDIR,
+
+        const XCPKGInstallPlan * plan,
+        const size_t * closure,
+        const size_t closureSize) {
+    int fd = open(shellScriptFileName, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+
+    if (fd == -1) {
+        perror(shellScriptFileName);
+        return XCPKG_ERROR;
+    }
+
+    int ret;
+
+    if (installOptions->xtrace) {
+        ret = dprintf(fd, "set -x\n\n");
+
+        if (ret < 0) {
+            close(fd);
+            return XCPKG_ERROR;
+        }
+    }
+
+    ret = dprintf(fd, "set -e\n\nunset IFS\n\n");
+
+    if (ret < 0) {
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    KV kvs1[] = {
+        {"NATIVE_PLATFORM_ARCH", sysinfo->arch },
+        {"NATIVE_PLATFORM_VERS", sysinfo->vers },
         {NULL, NULL }
     };
 
@@ -2514,7 +3000,6 @@ static int generate_shell_script_file(
 
         {"PACKAGE_DEP_LIB", formula->dep_lib},
         {"PACKAGE_DEP_PKG", formula->dep_pkg},
-        {"PACKAGE_DEP_PKG_R", recursiveDependentPackageNames},
         {"PACKAGE_DEP_UPP", formula->dep_upp},
         {"PACKAGE_DEP_PYM", formula->dep_pip},
         {"PACKAGE_DEP_PLM", formula->dep_plm},
@@ -2674,13 +3159,11 @@ static int generate_shell_script_file(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    if (recursiveDependentPackageNames != NULL && recursiveDependentPackageNames[0] != '\0') {
-        ret = write_shell_script_file(fd, recursiveDependentPackageNames, packageInstalledRootDIR, packageInstalledRootDIRCapacity);
+    ret = write_shell_script_file(fd, plan, closure, closureSize, packageInstalledRootDIR);
 
-        if (ret != XCPKG_OK) {
-            close(fd);
-            return ret;
-        }
+    if (ret != XCPKG_OK) {
+        close(fd);
+        return ret;
     }
 
     //////////////////////////////////////////////////////////////////////////////
@@ -2873,11 +3356,7 @@ static int adjust_pc_files(const char * packageInstalledDIR, const size_t packag
     }
 }
 
-static int adjust_macho_files(const char * packageInstalledDIR, const size_t packageInstalledDIRCapacity) {
-    return XCPKG_OK;
-}
-
-static int backup_formulas(const char * sessionDIR, const size_t sessionDIRLength, const char * recursiveDependentPackageNames) {
+static int backup_formulas(const char * sessionDIR, const size_t sessionDIRLength, const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize) {
     const char * p = "dependencies";
 
     if (mkdir(p, S_IRWXU) != 0) {
@@ -2924,172 +3403,102 @@ static int backup_formulas(const char * sessionDIR, const size_t sessionDIRLengt
 
     ///////////////////////////////////////
 
-    p = recursiveDependentPackageNames;
+    for (size_t k = 0U; k < closureSize; k++) {
+        const char * q = plan->packageArray[closure[k]].packageName;
 
-loop:
-    if (p[0] == '\0') {
-        return XCPKG_OK;
-    }
-
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
-    }
-
-    /////////////////////////////
-
-    char * x = m;
-    char * y = n;
-
-    for (;;) {
-        x[0] = p[0];
-        y[0] = p[0];
-
-        if (p[0] == ' ' || p[0] == '\0') break;
-
-        x++;
-        y++;
-        p++;
-    }
-
-    const char * s = ".yml";
-
-    for (;;) {
-        x[0] = s[0];
-        y[0] = s[0];
-
-        if (s[0] == '\0') break;
-
-        x++;
-        y++;
-        s++;
-    }
-
-    fprintf(stderr, "copy %s => %s\n", fromFilePath, toFilePath);
-
-    int ret = xcpkg_copy_file(fromFilePath, toFilePath);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
-    }
-
-    return XCPKG_OK;
-}
-
-static int generate_manifest_r(const char * dirPath, const size_t offset, FILE * installedManifestFile) {
-    if (dirPath == NULL) {
-        return XCPKG_ERROR_ARG_IS_NULL;
-    }
-
-    if (dirPath[0] == '\0') {
-        return XCPKG_ERROR_ARG_IS_EMPTY;
-    }
-
-    DIR * dir = opendir(dirPath);
-
-    if (dir == NULL) {
-        perror(dirPath);
-        return XCPKG_ERROR;
-    }
+        char * x = m;
+        char * y = n;
 
-    size_t dirPathLength = strlen(dirPath);
+        for (;;) {
+            x[0] = q[0];
+            y[0] = q[0];
 
-    int ret = XCPKG_OK;
-
-    struct stat st;
-
-    for (;;) {
-        errno = 0;
+            if (q[0] == '\0') break;
 
-        struct dirent * dir_entry = readdir(dir);
-
-        if (dir_entry == NULL) {
-            if (errno == 0) {
-                closedir(dir);
-                return XCPKG_OK;
-            } else {
-                perror(dirPath);
-                closedir(dir);
-                return XCPKG_ERROR;
-            }
-        }
-
-        if ((strcmp(dir_entry->d_name, ".") == 0) || (strcmp(dir_entry->d_name, "..") == 0)) {
-            continue;
+            x++;
+            y++;
+            q++;
         }
 
-        size_t filePathCapacity = dirPathLength + strlen(dir_entry->d_name) + 2U;
-        char   filePath[filePathCapacity];
+        const char * s = ".yml";
 
-        ret = snprintf(filePath, filePathCapacity, "%s/%s", dirPath, dir_entry->d_name);
+        for (;;) {
+            x[0] = s[0];
+            y[0] = s[0];
 
-        if (ret < 0) {
-            perror(NULL);
-            closedir(dir);
-            return XCPKG_ERROR;
-        }
+            if (s[0] == '\0') break;
 
-        if (stat(filePath, &st) != 0) {
-            perror(filePath);
-            closedir(dir);
-            return XCPKG_ERROR;
+            x++;
+            y++;
+            s++;
         }
 
-        if (S_ISDIR(st.st_mode)) {
-            ret = fprintf(installedManifestFile, "d|%s/\n", &filePath[offset]);
-
-            if (ret < 0) {
-                perror(NULL);
-                closedir(dir);
-                return XCPKG_ERROR;
-            }
-
-            ret = generate_manifest_r(filePath, offset, installedManifestFile);
+        int ret = xcpkg_copy_file(fromFilePath, toFilePath);
 
-            if (ret != XCPKG_OK) {
-                closedir(dir);
-                return ret;
-            }
-        } else {
-            ret = fprintf(installedManifestFile, "f|%s\n", &filePath[offset]);
-
-            if (ret < 0) {
-                perror(NULL);
-                closedir(dir);
-                return XCPKG_ERROR;
-            }
+        if (ret != XCPKG_OK) {
+            return ret;
         }
     }
+
+    return XCPKG_OK;
 }
 
-int generate_manifest(const char * installedDIRPath) {
-    size_t installedDIRLength = strlen(installedDIRPath);
+/**
+ * write dependencies.dot and dependencies.d2 in the current working directory from the edges among the given closure.
+ */
+static int write_dependencies_graph(const XCPKGInstallPlan * plan, const size_t * closure, const size_t closureSize) {
+    FILE * dotFile = fopen("dependencies.dot", "w");
 
-    size_t installedManifestFilePathLength = installedDIRLength + sizeof(XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
-    char   installedManifestFilePath[installedManifestFilePathLength];
+    if (dotFile == NULL) {
+        perror("dependencies.dot");
+        return XCPKG_ERROR;
+    }
 
-    int ret = snprintf(installedManifestFilePath, installedManifestFilePathLength, "%s/%s", installedDIRPath, XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+    FILE * d2File = fopen("dependencies.d2", "w");
 
-    if (ret < 0) {
-        perror(NULL);
+    if (d2File == NULL) {
+        perror("dependencies.d2");
+        fclose(dotFile);
         return XCPKG_ERROR;
     }
 
-    FILE * installedManifestFile = fopen(installedManifestFilePath, "w");
+    fprintf(dotFile, "digraph G {\n");
 
-    if (installedManifestFile == NULL) {
-        perror(installedManifestFilePath);
-        return XCPKG_ERROR;
+    for (size_t k = 0U; k < closureSize; k++) {
+        const XCPKGPackage * package = &plan->packageArray[closure[k]];
+
+        if (package->depIndexArraySize == 0U) continue;
+
+        fprintf(dotFile, "    \"%s\" -> {", package->packageName);
+
+        for (size_t i = 0U; i < package->depIndexArraySize; i++) {
+            const char * depPackageName = plan->packageArray[package->depIndexArray[i]].packageName;
+
+            fprintf(dotFile, " \"%s\"", depPackageName);
+            fprintf(d2File, "\"%s\" -> \"%s\"\n", package->packageName, depPackageName);
+        }
+
+        fprintf(dotFile, " }\n");
+    }
+
+    fprintf(dotFile, "}\n");
+
+    int ret = XCPKG_OK;
+
+    if (ferror(dotFile) || ferror(d2File)) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
     }
 
-    ret = generate_manifest_r(installedDIRPath, installedDIRLength + 1, installedManifestFile);
+    if (fclose(dotFile) != 0) {
+        perror("dependencies.dot");
+        ret = XCPKG_ERROR;
+    }
 
-    fclose(installedManifestFile);
+    if (fclose(d2File) != 0) {
+        perror("dependencies.d2");
+        ret = XCPKG_ERROR;
+    }
 
     return ret;
 }
@@ -3385,308 +3794,6 @@ static int xcpkg_build_for_native(
     return XCPKG_OK;
 }
 
-typedef struct {
-    char * packageName;
-    XCPKGFormula * formula;
-} XCPKGPackage;
-
-static inline __attribute__((always_inline)) bool is_a_in_b(const char * a, const char * b) {
-loop:
-    if (b[0] == '\0') return false;
-
-    if (b[0] == ' ') {
-        b++;
-        goto loop;
-    }
-
-    for (;;) {
-        if (a[0] == '\0') {
-            return (b[0] == ' ' || b[0] == '\0');
-        }
-
-        if (b[0] == '\0') {
-            return (a[0] == '\0');
-        }
-
-        if (a[0] == b[0]) {
-            a++;
-            b++;
-        } else {
-            if (b[0] == ' ') {
-                b++;
-                goto loop;
-            } else {
-                for (;;) {
-                    b++;
-
-                    if (b[0] == '\0') {
-                        return false;
-                    }
-
-                    if (b[0] == ' ') {
-                        b++;
-                        goto loop;
-                    }
-                }
-            }
-        }
-    }
-}
-
-typedef struct {
-    char * ptr;
-    size_t length;
-    size_t capacity;
-} StringBuf;
-
-static inline __attribute__((always_inline)) int string_buffer_append(StringBuf * const stringBuf, const char * s) {
-    char * p;
-
-    size_t m = stringBuf->length;
-    size_t n = strlen(s);
-
-    size_t oldCapacity = stringBuf->capacity;
-    size_t newCapacity = m + n + 1U;
-
-    if (newCapacity > oldCapacity) {
-        newCapacity += 1024U;
-
-        p = (char*)realloc(stringBuf->ptr, newCapacity * sizeof(char));
-
-        if (p == NULL) {
-            return XCPKG_ERROR_MEMORY_ALLOCATE;
-        } else {
-            stringBuf->ptr = p;
-            stringBuf->capacity = newCapacity;
-        }
-    }
-
-    p = stringBuf->ptr + m;
-
-    for (size_t i = 0U; i <= n; i++) {
-        p[i] = s[i];
-    }
-
-    stringBuf->length = m + n;
-
-    return XCPKG_OK;
-}
-
-static int generate_dependencies_graph(const char * packageName, XCPKGPackage ** packageSet, size_t packageSetSize, StringBuf * txt, StringBuf * dot, StringBuf * d2) {
-    int ret = XCPKG_OK;
-
-    char * p;
-    size_t i;
-
-    size_t  packageNameStackCapacity = 1U;
-    size_t  packageNameStackSize     = 1U;
-    char ** packageNameStack = (char**)malloc(sizeof(char*));
-
-    if (packageNameStack == NULL) {
-        return XCPKG_ERROR_MEMORY_ALLOCATE;
-    }
-
-    packageNameStack[0] = (char*)packageName;
-
-    while (packageNameStackSize != 0U) {
-        char * packageName = packageNameStack[--packageNameStackSize];
-        packageNameStack[packageNameStackSize] = NULL;
-
-        ////////////////////////////////////////////////////////////////
-
-        if (txt->ptr != NULL) {
-            if (is_a_in_b(packageName, txt->ptr)) {
-                continue;
-            }
-
-            ret = string_buffer_append(txt, " ");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-        }
-
-        ret = string_buffer_append(txt, packageName);
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-
-        ////////////////////////////////////////////////////////////////
-
-        p = NULL;
-
-        for (i = 0U; i < packageSetSize; i++) {
-            if (strcmp(packageSet[i]->packageName, packageName) == 0) {
-                p = packageSet[i]->formula->dep_pkg;
-                break;
-            }
-        }
-
-        ////////////////////////////////////////////////////////////////
-
-        if (p == NULL || p[0] == '\0') continue;
-
-        for(;;) {
-            if (p[0] == '\0') break;
-
-            if (p[0] == '\n' || p[0] == ' ') {
-                p++;
-                continue;
-            } else {
-                break;
-            }
-        }
-
-        if (p[0] == '\0') continue;
-
-        ////////////////////////////////////////////////////////////////
-
-        if (dot->ptr == NULL) {
-            ret = string_buffer_append(dot, "digraph G {\n");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-        }
-
-        ret = string_buffer_append(dot, "    \"");
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-
-        ret = string_buffer_append(dot, packageName);
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-
-        ret = string_buffer_append(dot, "\" -> {");
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-
-        ////////////////////////////////////////////////////////////////
-
-        while (p[0] != '\0') {
-            if (p[0] == ' ' || p[0] == '\n') {
-                p++;
-                continue;
-            }
-
-            for (i = 0U; ; i++) {
-                if (p[i] == ' ' || p[i] == '\n' || p[i] == '\0') {
-                    break;
-                }
-            }
-
-            //////////////////////////////////////
-
-            char * depPackageName = NULL;
-
-            for (size_t j = 0U; j < packageSetSize; j++) {
-                if (_str_equal(p, packageSet[j]->packageName)) {
-                    depPackageName = packageSet[j]->packageName;
-                    break;
-                }
-            }
-
-            //////////////////////////////////////
-
-            if (packageNameStackSize == packageNameStackCapacity) {
-                char ** q = (char**)realloc(packageNameStack, (packageNameStackCapacity + 8U) * sizeof(char*));
-
-                if (q == NULL) {
-                    free(packageNameStack);
-                    return XCPKG_ERROR_MEMORY_ALLOCATE;
-                }
-
-                packageNameStack = q;
-                packageNameStackCapacity += 8U;
-            }
-
-            packageNameStack[packageNameStackSize] = depPackageName;
-            packageNameStackSize++;
-
-            //////////////////////////////////////
-
-            ret = string_buffer_append(dot, " \"");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(dot, depPackageName);
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(dot, "\"");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            //////////////////////////////////////
-
-            ret = string_buffer_append(d2, "\"");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(d2, packageName);
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(d2, "\" -> \"");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(d2, depPackageName);
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            ret = string_buffer_append(d2, "\"\n");
-
-            if (ret != XCPKG_OK) {
-                goto finalize;
-            }
-
-            //////////////////////////////////////
-
-            p += i;
-        }
-
-        ret = string_buffer_append(dot, " }\n");
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-    }
-
-    if (dot->ptr != NULL) {
-        ret = string_buffer_append(dot, "}\n");
-
-        if (ret != XCPKG_OK) {
-            goto finalize;
-        }
-    }
-
-finalize:
-    free(packageNameStack);
-    return ret;
-}
-
 static int xcpkg_install_package(
         const char * packageName,
         const char * targetPlatformSpec,
@@ -3697,6 +3804,7 @@ static int xcpkg_install_package(
         const XCPKGToolChain * toolchainForNativeBuild,
         const XCPKGToolChain * toolchainForTargetBuild,
         const SysInfo * sysinfo,
+        const char * sysrootForTargetBuild,
 
         const char * uppmHomeDIR,
         const size_t uppmHomeDIRLength,
@@ -3714,9 +3822,9 @@ static int xcpkg_install_package(
         const char * sessionDIR,
         const size_t sessionDIRLength,
 
-        const StringBuf * txt,
-        const StringBuf * dot,
-        const StringBuf * d2) {
+        const XCPKGInstallPlan * plan,
+        const size_t * closure,
+        const size_t closureSize) {
     fprintf(stderr, "%s=============== Installing%s %s%s/%s%s %s===============%s\n", COLOR_PURPLE, COLOR_OFF, COLOR_GREEN, targetPlatformSpec, packageName, COLOR_OFF, COLOR_PURPLE, COLOR_OFF);
 
     const time_t ts = time(NULL);
@@ -4107,7 +4215,7 @@ static int xcpkg_install_package(
 
     const bool isCrossBuild = !((strcmp("MacOSX", targetPlatformName) == 0) && (strcmp(sysinfo->arch, targetPlatformArch) == 0));
 
-    ret = generate_shell_script_file(shellScriptFileName, packageName, formula, installOptions, sysinfo, uppmPackageInstalledRootDIR, nativePackageInstalledRootDIR, xcpkgExeFilePath, ts, njobs, isCrossBuild, targetPlatformSpec, targetPlatformName, targetPlatformVers, targetPlatformArch, xcpkgHomeDIR, xcpkgCoreDIR, xcpkgDownloadsDIR, sessionDIR, packageWorkingTopDIR, packageInstalledRootDIR, packageInstalledRootDIRCapacity, packageInstalledDIR, txt->ptr);
+    ret = generate_shell_script_file(shellScriptFileName, packageName, formula, installOptions, sysinfo, uppmPackageInstalledRootDIR, nativePackageInstalledRootDIR, xcpkgExeFilePath, ts, njobs, isCrossBuild, targetPlatformSpec, targetPlatformName, targetPlatformVers, targetPlatformArch, xcpkgHomeDIR, xcpkgCoreDIR, sessionDIR, packageWorkingTopDIR, packageInstalledRootDIR, packageInstalledDIR, plan, closure, closureSize);
 
     if (ret != XCPKG_OK) {
         return ret;
@@ -4125,6 +4233,12 @@ static int xcpkg_install_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
+    ret = prehash_the_downloaded_files(formula, xcpkgDownloadsDIR);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
     if (formula->src_url == NULL) {
         if (formula->git_url != NULL) {
             const char * remoteRef;
@@ -4135,7 +4249,7 @@ static int xcpkg_install_package(
                 remoteRef = formula->git_sha;
             }
 
-            ret = xcpkg_git_sync("src", formula->git_url, remoteRef, "refs/remotes/origin/master", "master", formula->git_nth);
+            ret = xcpkg_git_sync_via_mirror("src", xcpkgDownloadsDIR, formula->git_url, remoteRef, "refs/remotes/origin/master", "master", formula->git_nth);
 
             if (ret != XCPKG_OK) {
                 return ret;
@@ -4280,19 +4394,6 @@ static int xcpkg_install_package(
         }
     }
 
-    char sysrootForTargetBuild[PATH_MAX]; sysrootForTargetBuild[0] = '\0';
-
-    ret = xcpkg_sdk_path(sdkName, sysrootForTargetBuild);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
-    if (sysrootForTargetBuild[0] == '\0') {
-        fprintf(stderr, "Can not locate %s sdk path.\n", targetPlatformName);
-        return XCPKG_ERROR;
-    }
-
     //////////////////////////////////////////////////////////////////////////////
 
     size_t commonflagsCapacity = strlen(sysrootForTargetBuild) + 80U;
@@ -4518,8 +4619,8 @@ static int xcpkg_install_package(
         }
     }
 
-    if (txt->ptr != NULL) {
-        ret = setenvs_for_target(txt->ptr, packageInstalledRootDIR, packageInstalledRootDIRCapacity, nativePackageInstalledRootDIR, nativePackageInstalledRootDIRCapacity, packageWorkingTopDIR, packageWorkingTopDIRCapacity, needToCopyStaticLibs, isCrossBuild);
+    if (closureSize > 1U) {
+        ret = setenvs_for_target(plan, closure, closureSize, packageInstalledRootDIR, packageInstalledRootDIRCapacity, nativePackageInstalledRootDIR, packageWorkingTopDIR, packageWorkingTopDIRCapacity, needToCopyStaticLibs, isCrossBuild);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -4879,20 +4980,30 @@ static int xcpkg_install_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    if (txt->ptr != NULL) {
-        ret = backup_formulas(sessionDIR, sessionDIRLength, txt->ptr);
+    if (closureSize > 1U) {
+        ret = backup_formulas(sessionDIR, sessionDIRLength, plan, closure, closureSize);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        ret = write_dependencies_graph(plan, closure, closureSize);
 
         if (ret != XCPKG_OK) {
             return ret;
         }
 
-        ret = xcpkg_write_file("dependencies.dot", dot->ptr, dot->length);
+        size_t dependenciesEnvFilePathCapacity = packageWorkingTopDIRCapacity + 18U;
+        char   dependenciesEnvFilePath[dependenciesEnvFilePathCapacity];
 
-        if (ret != XCPKG_OK) {
-            return ret;
+        ret = snprintf(dependenciesEnvFilePath, dependenciesEnvFilePathCapacity, "%s/dependencies.env", packageWorkingTopDIR);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
         }
 
-        ret = xcpkg_write_file("dependencies.d2", d2->ptr, d2->length);
+        ret = xcpkg_copy_file(dependenciesEnvFilePath, "dependencies.env");
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -5017,7 +5128,9 @@ static int xcpkg_install_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    ret = generate_manifest(packageInstalledDIR);
+    size_t installedSize = 0U;
+
+    ret = generate_manifest(packageInstalledDIR, &installedSize);
 
     if (ret != XCPKG_OK) {
         return ret;
@@ -5085,228 +5198,225 @@ static int xcpkg_install_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    if (installOptions->keepSessionDIR) {
-        return XCPKG_OK;
-    } else {
-        return xcpkg_rm_rf(packageWorkingTopDIR, false, installOptions->logLevel >= XCPKGLogLevel_verbose);
-    }
-}
+    // the modification time of the receipt, which is what xcpkg_installed_db_rebuild() recovers it from
+    time_t installedAt = ts;
 
-static int check_and_read_formula_in_cache(const char * packageName, const char * targetPlatformName, const char * sessionDIR, XCPKGPackage *** ppackageSet, size_t * ppackageSetSize, size_t * ppackageSetCapacity) {
-    size_t          packageSetCapacity = (*ppackageSetCapacity);
-    size_t          packageSetSize     = (*ppackageSetSize);
-    XCPKGPackage ** packageSet         = (*ppackageSet);
+    size_t receiptFilePathCapacity = strlen(packageName) + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
+    char   receiptFilePath[receiptFilePathCapacity];
 
-    size_t   packageNameStackCapacity = 10U;
-    size_t   packageNameStackSize    = 0U;
-    char * * packageNameStack = (char**)malloc(10 * sizeof(char*));
+    ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageName, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
 
-    if (packageNameStack == NULL) {
-        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
     }
 
-    packageNameStack[0] = strdup(packageName);
-
-    if (packageNameStack[0] == NULL) {
-        free(packageNameStack);
-        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    if (stat(receiptFilePath, &st) == 0) {
+        installedAt = st.st_mtime;
     }
 
-    packageNameStackSize = 1U;
+    char installedVersion[11];
 
-    int ret = XCPKG_OK;
+    if (formula->version == NULL) {
+        struct tm * tms = gmtime(&ts);
 
-    ////////////////////////////////////////////////////////////////
+        strftime(installedVersion, 11, "%Y.%m.%d", tms);
+    }
 
-    while (packageNameStackSize > 0U) {
-        size_t topIndex = packageNameStackSize - 1U;
-        char * packageName = packageNameStack[topIndex];
-        packageNameStack[topIndex] = NULL;
-        packageNameStackSize--;
+    XCPKGInstalledPackage installedPackage = {
+        .targetPlatformSpec = (char*)targetPlatformSpec,
+        .packageName = (char*)packageName,
+        .sha = packageInstalledSHA,
+        .version = formula->version == NULL ? installedVersion : formula->version,
+        .dep_pkg = formula->dep_pkg,
+        .installedAt = installedAt,
+        .installedSize = installedSize
+    };
 
-        XCPKGFormula * formula = NULL;
+    ret = xcpkg_installed_db_add(&installedPackage);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
 
-        for (size_t i = 0U; i < packageSetSize; i++) {
-            if (strcmp(packageSet[i]->packageName, packageName) == 0) {
-                free(packageName);
+    ret = xcpkg_rdepends_index_update(packageName, targetPlatformSpec, formula->dep_pkg == NULL ? "" : formula->dep_pkg);
 
-                packageName = packageSet[i]->packageName;
-                formula = packageSet[i]->formula;
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
 
-                size_t lastIndex = packageSetSize - 1U;
+    ret = xcpkg_completion_cache_update(packageName, targetPlatformSpec, true);
 
-                if (i != lastIndex) {
-                    XCPKGPackage * package = packageSet[i];
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
 
-                    for (size_t j = i + 1U; j < packageSetSize; j++) {
-                        packageSet[j - 1] = packageSet[j];
-                    }
+    //////////////////////////////////////////////////////////////////////////////
 
-                    packageSet[lastIndex] = package;
-                }
+    if (installOptions->keepSessionDIR) {
+        return XCPKG_OK;
+    } else {
+        return xcpkg_rm_rf(packageWorkingTopDIR, false, installOptions->logLevel >= XCPKGLogLevel_verbose);
+    }
+}
 
-                break;
-            }
-        }
+static int check_and_read_formula_in_cache(const char * packageName, const char * targetPlatformName, const char * sessionDIR, XCPKGInstallPlan * plan) {
+    size_t rootIndex;
+    bool   added;
 
-        if (formula == NULL) {
-            char formulaFilePath[PATH_MAX];
+    int ret = xcpkg_install_plan_add(plan, packageName, strlen(packageName), &rootIndex, &added);
 
-            ret = xcpkg_formula_path(packageName, targetPlatformName, formulaFilePath);
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
 
-            if (ret != XCPKG_OK) {
-                free(packageName);
-                goto finalize;
-            }
+    // this package and its recursive dependencies have already been loaded
+    if (!added) {
+        return XCPKG_OK;
+    }
 
-            size_t formulaFilePath2Capacity = strlen(sessionDIR) + strlen(packageName) + 6U;
-            char   formulaFilePath2[formulaFilePath2Capacity];
+    ////////////////////////////////////////////////////////////////
 
-            ret = snprintf(formulaFilePath2, formulaFilePath2Capacity, "%s/%s.yml", sessionDIR, packageName);
+    // packages are appended to the plan, so the packages after rootIndex are exactly the ones whose formula is not loaded yet
+    for (size_t index = rootIndex; index < plan->packageArraySize; index++) {
+        const char * packageName = plan->packageArray[index].packageName;
 
-            if (ret < 0) {
-                perror(NULL);
-                free(packageName);
-                return XCPKG_ERROR;
-            }
+        char formulaFilePath[PATH_MAX];
 
-            ret = xcpkg_copy_file(formulaFilePath, formulaFilePath2);
+        ret = xcpkg_formula_path(packageName, targetPlatformName, formulaFilePath);
 
-            if (ret != XCPKG_OK) {
-                free(packageName);
-                goto finalize;
+        if (ret != XCPKG_OK) {
+            if (ret == XCPKG_ERROR_PACKAGE_NOT_AVAILABLE) {
+                fprintf(stderr, "package '%s' is not available.\n", packageName);
             }
 
-            ret = xcpkg_formula_load(packageName, targetPlatformName, formulaFilePath2, &formula);
+            return ret;
+        }
 
-            if (ret != XCPKG_OK) {
-                free(packageName);
-                goto finalize;
-            }
+        size_t formulaFilePath2Capacity = strlen(sessionDIR) + plan->packageArray[index].packageNameLength + 6U;
+        char   formulaFilePath2[formulaFilePath2Capacity];
 
-            if (packageSetSize == packageSetCapacity) {
-                XCPKGPackage ** p = (XCPKGPackage**)realloc(packageSet, (packageSetCapacity + 10U) * sizeof(XCPKGPackage*));
+        ret = snprintf(formulaFilePath2, formulaFilePath2Capacity, "%s/%s.yml", sessionDIR, packageName);
 
-                if (p == NULL) {
-                    free(packageName);
-                    xcpkg_formula_free(formula);
-                    ret = XCPKG_ERROR_MEMORY_ALLOCATE;
-                    goto finalize;
-                }
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
 
-                packageSet = p;
-                packageSetCapacity += 10U;
-            }
+        ret = xcpkg_copy_file(formulaFilePath, formulaFilePath2);
 
-            XCPKGPackage * package = (XCPKGPackage*)malloc(sizeof(XCPKGPackage));
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
 
-            if (package == NULL) {
-                free(packageName);
-                xcpkg_formula_free(formula);
-                ret = XCPKG_ERROR_MEMORY_ALLOCATE;
-                goto finalize;
-            }
+        XCPKGFormula * formula = NULL;
 
-            package->formula = formula;
-            package->packageName = packageName;
+        ret = xcpkg_formula_load(packageName, targetPlatformName, formulaFilePath2, &formula);
 
-            packageSet[packageSetSize] = package;
-            packageSetSize++;
+        if (ret != XCPKG_OK) {
+            return ret;
         }
 
-        if (formula->dep_pkg == NULL) {
-            continue;
-        }
+        plan->packageArray[index].formula = formula;
 
-        const char * p = formula->dep_pkg;
+        ////////////////////////////////////////////////////////////////
 
-        size_t i;
+        const char * p = formula->dep_pkg;
 
-        loop:
-            if (p[0] == '\0') continue;
+        if (p == NULL) {
+            continue;
+        }
 
-            if (p[0] == ' ') {
+        while (p[0] != '\0') {
+            if (p[0] == ' ' || p[0] == '\n') {
                 p++;
-                goto loop;
+                continue;
             }
 
-            ///////////////////////////////////////////
+            size_t i;
 
             for (i = 0U; ; i++) {
-                if (p[i] == ' ' || p[i] == '\0') break;
+                if (p[i] == ' ' || p[i] == '\n' || p[i] == '\0') break;
             }
 
-            ///////////////////////////////////////////
+            size_t depIndex;
 
-            if (_str_equal(p, packageName)) {
-                fprintf(stderr, "package '%s' depends itself.\n", packageName);
-                ret = XCPKG_ERROR;
-                goto finalize;
-            }
-
-            ///////////////////////////////////////////
+            ret = xcpkg_install_plan_add(plan, p, i, &depIndex, &added);
 
-            if (packageNameStackSize == packageNameStackCapacity) {
-                char ** q = (char**)realloc(packageNameStack, (packageNameStackCapacity + 10U) * sizeof(char*));
-
-                if (q == NULL) {
-                    ret = XCPKG_ERROR_MEMORY_ALLOCATE;
-                    goto finalize;
-                }
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
 
-                packageNameStack = q;
-                packageNameStackCapacity += 10U;
+            if (depIndex == index) {
+                fprintf(stderr, "package '%s' depends itself.\n", plan->packageArray[index].packageName);
+                return XCPKG_ERROR;
             }
 
-            char * q = (char*)malloc(i + 1);
+            ret = xcpkg_install_plan_add_edge(plan, index, depIndex);
 
-            if (q == NULL) {
-                ret = XCPKG_ERROR_MEMORY_ALLOCATE;
-                goto finalize;
+            if (ret != XCPKG_OK) {
+                return ret;
             }
 
-            for (size_t j = 0U; j < i; j++) {
-                q[j] = p[j];
-            }
+            p += i;
+        }
+    }
 
-            q[i] = '\0';
+    return XCPKG_OK;
+}
 
-            packageNameStack[packageNameStackSize] = q;
-            packageNameStackSize++;
+/**
+ * mark the given package and all of its recursive dependencies in the given plan.
+ *
+ * marks is indexed the same way as plan->packageArray, n is increased by the count of newly marked packages.
+ */
+static int mark_the_needed_packages(const char * packageName, const XCPKGInstallPlan * plan, bool marks[], size_t * n) {
+    size_t index;
 
-            if (p[i] == ' ') {
-                p += i + 1;
-                goto loop;
-            }
+    if (!xcpkg_install_plan_find(plan, packageName, strlen(packageName), &index)) {
+        return XCPKG_ERROR_PACKAGE_NOT_AVAILABLE;
     }
 
-finalize:
-    for (size_t i = 0U; i < packageNameStackSize; i++) {
-        free(packageNameStack[i]);
-        packageNameStack[i] = NULL;
+    for (size_t i = 0U; i < plan->packageArraySize; i++) {
+        if (!marks[i] && xcpkg_install_plan_closure_has(plan, index, i)) {
+            marks[i] = true;
+            (*n)++;
+        }
     }
 
-    free(packageNameStack);
-    packageNameStack = NULL;
+    return XCPKG_OK;
+}
 
-    if (ret == XCPKG_OK) {
-        (*ppackageSet) = packageSet;
-        (*ppackageSetSize) = packageSetSize;
-        (*ppackageSetCapacity) = packageSetCapacity;
-    } else {
-        for (size_t i = 0U; i < packageSetSize; i++) {
-            free(packageSet[i]->packageName);
-            xcpkg_formula_free(packageSet[i]->formula);
+static int lookup_the_sysroot_for_target(const char * targetPlatformSpec, char sysroot[]) {
+    char sdkName[20];
 
-            packageSet[i]->formula = NULL;
-            packageSet[i]->packageName = NULL;
+    for (int i = 0; i < 19; i++) {
+        if (targetPlatformSpec[i] >= 'A' && targetPlatformSpec[i] <= 'Z') {
+            sdkName[i] = targetPlatformSpec[i] + 32;
+        } else {
+            sdkName[i] = targetPlatformSpec[i];
+        }
 
-            free(packageSet[i]);
-            packageSet[i] = NULL;
+        if (targetPlatformSpec[i] == '-' || targetPlatformSpec[i] == '\0') {
+            sdkName[i] = '\0';
+            break;
         }
     }
 
-    return ret;
+    sdkName[19] = '\0';
+
+    int ret = xcpkg_sdk_path(sdkName, sysroot);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (sysroot[0] == '\0') {
+        fprintf(stderr, "Can not locate %s sdk path.\n", sdkName);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
 }
 
 static int check_if_compiler_support_Wno_error_unused_command_line_argument(const char * sessionDIR, const size_t sessionDIRLength, const char * compiler, const bool iscxx, const char * ccflags, const char * ldflags) {
@@ -5528,7 +5638,42 @@ static int setup_core_tools(const char * sessionDIR, const size_t sessionDIRLeng
     }
 }
 
-int xcpkg_install(const char * packageName, const char * targetPlatformSpec, const XCPKGInstallOptions * installOptions) {
+// the installed record of the given package as a string, it changes whenever the package is installed again, an empty string if it is not installed.
+static int get_the_installed_stamp(const char * packageName, const char * targetPlatformSpec, char stamp[], const size_t stampCapacity) {
+    XCPKGInstalledDB db;
+
+    int ret = xcpkg_installed_db_load(&db);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    const XCPKGInstalledPackage * package = xcpkg_installed_db_find(&db, packageName, targetPlatformSpec);
+
+    if (package == NULL) {
+        stamp[0] = '\0';
+    } else {
+        ret = snprintf(stamp, stampCapacity, "%s %lld", package->sha, (long long)package->installedAt);
+
+        if (ret < 0) {
+            perror(NULL);
+            xcpkg_installed_db_free(&db);
+            return XCPKG_ERROR;
+        }
+
+        ret = XCPKG_OK;
+    }
+
+    xcpkg_installed_db_free(&db);
+
+    return ret;
+}
+
+int xcpkg_install_packages(const size_t packageCount, const char * packageNames[], const char * targetPlatformSpecs[], const XCPKGInstallOptions * installOptions) {
+    if (packageCount == 0U) {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
     // redirect all stdout and stderr to /dev/null
     if (installOptions->logLevel == XCPKGLogLevel_silent) {
         int fd = open("/dev/null", O_CREAT | O_TRUNC | O_WRONLY, 0666);
@@ -5894,11 +6039,22 @@ int xcpkg_install(const char * packageName, const char * targetPlatformSpec, con
 
     //////////////////////////////////////////////////////////////////////////////
 
-    size_t          packageSetCapacity = 0U;
-    size_t          packageSetSize     = 0U;
-    XCPKGPackage ** packageSet         = NULL;
+    XCPKGInstallPlan plan = {0};
+
+    bool * marks = NULL;
 
-    ret = check_and_read_formula_in_cache(packageName, NULL, sessionDIR, &packageSet, &packageSetSize, &packageSetCapacity);
+    size_t * closure = NULL;
+
+    // all the requested packages share one plan, so every formula is only loaded once in this session
+    for (size_t i = 0U; i < packageCount; i++) {
+        ret = check_and_read_formula_in_cache(packageNames[i], NULL, sessionDIR, &plan);
+
+        if (ret != XCPKG_OK) {
+            goto finalize;
+        }
+    }
+
+    ret = xcpkg_install_plan_sort(&plan);
 
     if (ret != XCPKG_OK) {
         goto finalize;
@@ -5906,86 +6062,175 @@ int xcpkg_install(const char * packageName, const char * targetPlatformSpec, con
 
     //////////////////////////////////////////////////////////////////////////////
 
-    if (packageSetSize > 1) {
-        printf("install packages in order:");
-
-        for (int i = packageSetSize - 1; i >= 0; i--) {
-            printf(" %s", packageSet[i]->packageName);
-        }
+    marks = (bool*)malloc(plan.packageArraySize * sizeof(bool));
+    closure = (size_t*)malloc(plan.packageArraySize * sizeof(size_t));
 
-        printf("\n");
+    if (marks == NULL || closure == NULL) {
+        ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        goto finalize;
     }
 
     //////////////////////////////////////////////////////////////////////////////
 
-    for (int i = packageSetSize - 1; i >= 0; i--) {
-        XCPKGPackage * package = packageSet[i];
-        char * packageName = package->packageName;
+    for (size_t i = 0U; i < packageCount; i++) {
+        const char * targetPlatformSpec = targetPlatformSpecs[i];
 
-        if (!installOptions->force) {
-            ret = xcpkg_check_if_the_given_package_is_installed(packageName, targetPlatformSpec);
+        bool handled = false;
 
-            if (ret == XCPKG_OK) {
-                fprintf(stderr, "package already has been installed : %s\n", packageName);
-                continue;
+        for (size_t j = 0U; j < i; j++) {
+            if (strcmp(targetPlatformSpecs[j], targetPlatformSpec) == 0) {
+                handled = true;
+                break;
             }
         }
 
-        if (setenv("PATH", PATH, 1) != 0) {
-            perror("PATH");
-            goto finalize;
+        if (handled) {
+            continue;
         }
 
-        if (installOptions->verbose_formula) {
-            xcpkg_formula_dump(package->formula);
+        //////////////////////////////////////////////////////////////////////////
+
+        // mark all the packages that are needed by the requested packages which are built for this target
+        for (size_t j = 0U; j < plan.packageArraySize; j++) {
+            marks[j] = false;
         }
 
-        StringBuf txt = {0};
-        StringBuf dot = {0};
-        StringBuf d2  = {0};
+        size_t n = 0U;
 
-        if (package->formula->dep_pkg != NULL) {
-            ret = generate_dependencies_graph(packageName, packageSet, packageSetSize, &txt, &dot, &d2);
+        for (size_t j = i; j < packageCount; j++) {
+            if (strcmp(targetPlatformSpecs[j], targetPlatformSpec) == 0) {
+                ret = mark_the_needed_packages(packageNames[j], &plan, marks, &n);
 
-            if (ret != XCPKG_OK) {
-                free(txt.ptr);
-                free(dot.ptr);
-                free(d2.ptr);
-                goto finalize;
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
             }
         }
 
-        fprintf(stderr, "txt=%s\n", txt.ptr);
-        fprintf(stderr, "dot=%s\n", dot.ptr);
-        fprintf(stderr, "d2=%s\n", d2.ptr);
+        //////////////////////////////////////////////////////////////////////////
 
-        ret = xcpkg_install_package(packageName, targetPlatformSpec, package->formula, installOptions, &toolchain, &toolchainForNativeBuild, &toolchainForTargetBuild, &sysinfo, uppmHomeDIR, uppmHomeDIRLength, uppmPackageInstalledRootDIR, uppmPackageInstalledRootDIRCapacity, xcpkgExeFilePath, xcpkgHomeDIR, xcpkgHomeDIRLength, xcpkgCoreDIR, xcpkgCoreDIRCapacity, xcpkgDownloadsDIR, xcpkgDownloadsDIRCapacity, sessionDIR, sessionDIRLength, &txt, &dot, &d2);
+        char sysrootForTargetBuild[PATH_MAX]; sysrootForTargetBuild[0] = '\0';
 
-        free(txt.ptr);
-        free(dot.ptr);
-        free(d2.ptr);
+        ret = lookup_the_sysroot_for_target(targetPlatformSpec, sysrootForTargetBuild);
 
         if (ret != XCPKG_OK) {
             goto finalize;
         }
-    }
 
-finalize:
-    xcpkg_toolchain_free(&toolchain);
+        //////////////////////////////////////////////////////////////////////////
+
+        if (n > 1U) {
+            printf("install packages for %s in order:", targetPlatformSpec);
 
-    for (size_t i = 0; i < packageSetSize; i++) {
-        free(packageSet[i]->packageName);
-        xcpkg_formula_free(packageSet[i]->formula);
+            for (size_t j = 0U; j < plan.packageArraySize; j++) {
+                if (marks[plan.order[j]]) {
+                    printf(" %s", plan.packageArray[plan.order[j]].packageName);
+                }
+            }
+
+            printf("\n");
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+
+        for (size_t j = 0U; j < plan.packageArraySize; j++) {
+            size_t index = plan.order[j];
+
+            if (!marks[index]) {
+                continue;
+            }
+
+            XCPKGPackage * package = &plan.packageArray[index];
+            char * packageName = package->packageName;
+
+            // with --force, only what the process we might wait for installs is reused, see xcpkg_lock()
+            char stampBefore[96] = {0};
+
+            if (installOptions->force) {
+                ret = get_the_installed_stamp(packageName, targetPlatformSpec, stampBefore, 96);
+
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
+            }
+
+            int  lockFD;
+            bool waited;
+
+            ret = xcpkg_lock_the_installed_package(packageName, targetPlatformSpec, &lockFD, &waited);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+
+            bool installed = false;
+
+            if (!installOptions->force) {
+                installed = xcpkg_check_if_the_given_package_is_installed(packageName, targetPlatformSpec) == XCPKG_OK;
+            } else if (waited) {
+                char stampAfter[96];
+
+                ret = get_the_installed_stamp(packageName, targetPlatformSpec, stampAfter, 96);
+
+                if (ret != XCPKG_OK) {
+                    xcpkg_unlock(lockFD);
+                    goto finalize;
+                }
+
+                installed = stampAfter[0] != '\0' && strcmp(stampBefore, stampAfter) != 0;
+            }
 
-        packageSet[i]->formula = NULL;
-        packageSet[i]->packageName = NULL;
+            if (installed) {
+                xcpkg_unlock(lockFD);
 
-        free(packageSet[i]);
-        packageSet[i] = NULL;
+                if (waited) {
+                    fprintf(stderr, "package has been installed by another xcpkg process : %s\n", packageName);
+                } else {
+                    fprintf(stderr, "package already has been installed : %s\n", packageName);
+                }
+
+                continue;
+            }
+
+            if (setenv("PATH", PATH, 1) != 0) {
+                perror("PATH");
+                xcpkg_unlock(lockFD);
+                ret = XCPKG_ERROR;
+                goto finalize;
+            }
+
+            if (installOptions->verbose_formula) {
+                xcpkg_formula_dump(package->formula);
+            }
+
+            size_t closureSize = xcpkg_install_plan_closure(&plan, index, closure);
+
+            ret = xcpkg_install_package(packageName, targetPlatformSpec, package->formula, installOptions, &toolchain, &toolchainForNativeBuild, &toolchainForTargetBuild, &sysinfo, sysrootForTargetBuild, uppmHomeDIR, uppmHomeDIRLength, uppmPackageInstalledRootDIR, uppmPackageInstalledRootDIRCapacity, xcpkgExeFilePath, xcpkgHomeDIR, xcpkgHomeDIRLength, xcpkgCoreDIR, xcpkgCoreDIRCapacity, xcpkgDownloadsDIR, xcpkgDownloadsDIRCapacity, sessionDIR, sessionDIRLength, &plan, closure, closureSize);
+
+            xcpkg_unlock(lockFD);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+
+            // dedup takes the lock of every package whose files it replaces, so it runs after the lock of this package has been released
+            if (installOptions->dedup) {
+                ret = xcpkg_dedup(packageName, targetPlatformSpec, installOptions->dedupMode, false, installOptions->logLevel >= XCPKGLogLevel_verbose);
+
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
+            }
+        }
     }
 
-    free(packageSet);
-    packageSet = NULL;
+finalize:
+    xcpkg_toolchain_free(&toolchain);
+
+    free(marks);
+    free(closure);
+
+    xcpkg_install_plan_free(&plan);
 
     if (ret == XCPKG_OK) {
         if (!installOptions->keepSessionDIR) {
@@ -5995,3 +6240,7 @@ finalize:
 
     return ret;
 }
+
+int xcpkg_install(const char * packageName, const char * targetPlatformSpec, const XCPKGInstallOptions * installOptions) {
+    return xcpkg_install_packages(1U, &packageName, &targetPlatformSpec, installOptions);
+}
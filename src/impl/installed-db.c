@@ -0,0 +1,850 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../xcpkg.h"
+
+#include "../core/string-map.h"
+
+// the installed-package database is an append-only text log, it starts with the header line, then every line is a record:
+//
+// +<TAB><TARGET-PLATFORM-SPEC><TAB><PACKAGE-NAME><TAB><SHA><TAB><INSTALLED-AT><TAB><INSTALLED-SIZE><TAB><VERSION><TAB><DEP-PKG>
+// -<TAB><TARGET-PLATFORM-SPEC><TAB><PACKAGE-NAME>
+//
+// a + record is written on install, a - record is written on uninstall, a later record supersedes the former records of the same package.
+//
+// every record is appended by one write(2) then synced, a line which does not end with a newline is a torn append and is ignored.
+//
+// when the superseded records outnumber the live ones, the live ones are written to a new file which then replaces the database.
+
+#define XCPKG_INSTALLED_DB_HEADER "XCPKG-INSTALLED-DB 1\n"
+
+#define XCPKG_INSTALLED_DB_HEADER_LENGTH (sizeof(XCPKG_INSTALLED_DB_HEADER) - 1U)
+
+static int xcpkg_installed_db_path(char buf[]) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, true);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = snprintf(buf, PATH_MAX, "%s/installed.db", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static void xcpkg_installed_package_free(XCPKGInstalledPackage * package) {
+    free(package->buf);
+    memset(package, 0, sizeof(XCPKGInstalledPackage));
+}
+
+static int compare_installed_packages(const void * a, const void * b) {
+    const XCPKGInstalledPackage * x = (const XCPKGInstalledPackage *)a;
+    const XCPKGInstalledPackage * y = (const XCPKGInstalledPackage *)b;
+
+    int ret = strcmp(x->targetPlatformSpec, y->targetPlatformSpec);
+
+    if (ret != 0) {
+        return ret;
+    }
+
+    return strcmp(x->packageName, y->packageName);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// split a record line of n bytes into fields, on success, true is returned and package refers to a copy of the line.
+static bool xcpkg_installed_db_parse_record(const char * line, const size_t n, char * op, XCPKGInstalledPackage * package) {
+    if (n < 2U || line[1] != '\t' || (line[0] != '+' && line[0] != '-')) {
+        return false;
+    }
+
+    char * buf = (char*)malloc(n - 1U);
+
+    if (buf == NULL) {
+        return false;
+    }
+
+    memcpy(buf, line + 2, n - 2U);
+
+    buf[n - 2U] = '\0';
+
+    char * fields[7] = {0};
+
+    size_t fieldCount = 0U;
+
+    for (char * p = buf; fieldCount < 7U;) {
+        fields[fieldCount++] = p;
+
+        p = strchr(p, '\t');
+
+        if (p == NULL) {
+            break;
+        }
+
+        p[0] = '\0';
+        p++;
+    }
+
+    if ((line[0] == '+' && fieldCount != 7U) || (line[0] == '-' && fieldCount != 2U)) {
+        free(buf);
+        return false;
+    }
+
+    memset(package, 0, sizeof(XCPKGInstalledPackage));
+
+    package->buf = buf;
+    package->targetPlatformSpec = fields[0];
+    package->packageName = fields[1];
+
+    if (line[0] == '+') {
+        if (strlen(fields[2]) != 64U) {
+            free(buf);
+            return false;
+        }
+
+        package->sha = fields[2];
+        package->installedAt = (time_t)strtoll(fields[3], NULL, 10);
+        package->installedSize = (size_t)strtoull(fields[4], NULL, 10);
+        package->version = fields[5];
+        package->dep_pkg = fields[6];
+    }
+
+    (*op) = line[0];
+
+    return true;
+}
+
+static int xcpkg_installed_db_replay(const char * dbFilePath, const char * data, const size_t dataLength, XCPKGInstalledDB * db) {
+    if (dataLength < XCPKG_INSTALLED_DB_HEADER_LENGTH || memcmp(data, XCPKG_INSTALLED_DB_HEADER, XCPKG_INSTALLED_DB_HEADER_LENGTH) != 0) {
+        fprintf(stderr, "%s: not a valid installed-package database, run 'xcpkg db rebuild' to recreate it.\n", dbFilePath);
+        return XCPKG_ERROR;
+    }
+
+    // <TARGET-PLATFORM-SPEC>/<PACKAGE-NAME> -> the index in slotArray, whose buf is NULL if the package was uninstalled
+    StringMap index = {0};
+
+    XCPKGInstalledPackage * slotArray = NULL;
+    size_t                  slotArrayCapacity = 0U;
+
+    int ret = XCPKG_OK;
+
+    size_t recordCount = 0U;
+
+    const char * p = data + XCPKG_INSTALLED_DB_HEADER_LENGTH;
+    const char * end = data + dataLength;
+
+    while (p < end) {
+        const char * q = (const char *)memchr(p, '\n', (size_t)(end - p));
+
+        // a torn append
+        if (q == NULL) {
+            break;
+        }
+
+        char op;
+
+        XCPKGInstalledPackage package;
+
+        if (xcpkg_installed_db_parse_record(p, (size_t)(q - p), &op, &package)) {
+            recordCount++;
+
+            char key[PATH_MAX];
+
+            int n = snprintf(key, PATH_MAX, "%s/%s", package.targetPlatformSpec, package.packageName);
+
+            if (n < 0) {
+                perror(NULL);
+                xcpkg_installed_package_free(&package);
+                ret = XCPKG_ERROR;
+                goto finalize;
+            }
+
+            size_t i;
+            bool   added;
+
+            if (string_map_add(&index, key, (size_t)n, &i, &added) != 0) {
+                xcpkg_installed_package_free(&package);
+                ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+                goto finalize;
+            }
+
+            if (added) {
+                if (i == slotArrayCapacity) {
+                    size_t newCapacity = slotArrayCapacity == 0U ? 64U : (slotArrayCapacity << 1);
+
+                    XCPKGInstalledPackage * x = (XCPKGInstalledPackage*)realloc(slotArray, newCapacity * sizeof(XCPKGInstalledPackage));
+
+                    if (x == NULL) {
+                        xcpkg_installed_package_free(&package);
+                        ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+                        goto finalize;
+                    }
+
+                    slotArray = x;
+                    slotArrayCapacity = newCapacity;
+                }
+            } else {
+                xcpkg_installed_package_free(&slotArray[i]);
+            }
+
+            if (op == '+') {
+                slotArray[i] = package;
+            } else {
+                xcpkg_installed_package_free(&package);
+                memset(&slotArray[i], 0, sizeof(XCPKGInstalledPackage));
+            }
+        }
+
+        p = q + 1;
+    }
+
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < index.entryArraySize; i++) {
+        if (slotArray[i].buf != NULL) {
+            slotArray[n++] = slotArray[i];
+        }
+    }
+
+    qsort(slotArray, n, sizeof(XCPKGInstalledPackage), compare_installed_packages);
+
+    db->packageArray = slotArray;
+    db->packageArraySize = n;
+    db->recordCount = recordCount;
+
+    slotArray = NULL;
+
+finalize:
+    if (slotArray != NULL) {
+        for (size_t i = 0U; i < index.entryArraySize; i++) {
+            xcpkg_installed_package_free(&slotArray[i]);
+        }
+
+        free(slotArray);
+    }
+
+    string_map_free(&index);
+
+    return ret;
+}
+
+static int xcpkg_installed_db_read(const char * dbFilePath, XCPKGInstalledDB * db) {
+    int fd = open(dbFilePath, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1) {
+        if (errno == ENOENT) {
+            return XCPKG_ERROR_NOT_FOUND;
+        } else {
+            perror(dbFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        perror(dbFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    if (st.st_size == 0) {
+        close(fd);
+        return xcpkg_installed_db_replay(dbFilePath, "", 0U, db);
+    }
+
+    void * data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        perror(dbFilePath);
+        return XCPKG_ERROR;
+    }
+
+    int ret = xcpkg_installed_db_replay(dbFilePath, (const char *)data, (size_t)st.st_size, db);
+
+    munmap(data, (size_t)st.st_size);
+
+    return ret;
+}
+
+int xcpkg_installed_db_load(XCPKGInstalledDB * db) {
+    memset(db, 0, sizeof(XCPKGInstalledDB));
+
+    char dbFilePath[PATH_MAX];
+
+    int ret = xcpkg_installed_db_path(dbFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_installed_db_read(dbFilePath, db);
+
+    if (ret == XCPKG_ERROR_NOT_FOUND) {
+        ret = xcpkg_installed_db_rebuild();
+
+        if (ret == XCPKG_OK) {
+            ret = xcpkg_installed_db_read(dbFilePath, db);
+        }
+    }
+
+    return ret;
+}
+
+void xcpkg_installed_db_free(XCPKGInstalledDB * db) {
+    for (size_t i = 0U; i < db->packageArraySize; i++) {
+        free(db->packageArray[i].buf);
+    }
+
+    free(db->packageArray);
+
+    memset(db, 0, sizeof(XCPKGInstalledDB));
+}
+
+const XCPKGInstalledPackage * xcpkg_installed_db_find(const XCPKGInstalledDB * db, const char * packageName, const char * targetPlatformSpec) {
+    XCPKGInstalledPackage key = {
+        .targetPlatformSpec = (char*)targetPlatformSpec,
+        .packageName = (char*)packageName
+    };
+
+    return (const XCPKGInstalledPackage *)bsearch(&key, db->packageArray, db->packageArraySize, sizeof(XCPKGInstalledPackage), compare_installed_packages);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// a tab or a newline in a value would break the record apart
+static void write_a_value(FILE * file, const char * value) {
+    if (value == NULL) {
+        return;
+    }
+
+    for (const char * p = value; p[0] != '\0'; p++) {
+        fputc((p[0] == '\t' || p[0] == '\n') ? ' ' : p[0], file);
+    }
+}
+
+static void write_a_record(FILE * file, const XCPKGInstalledPackage * package) {
+    fprintf(file, "+\t%s\t%s\t%s\t%lld\t%zu\t", package->targetPlatformSpec, package->packageName, package->sha, (long long)package->installedAt, package->installedSize);
+    write_a_value(file, package->version);
+    fputc('\t', file);
+    write_a_value(file, package->dep_pkg);
+    fputc('\n', file);
+}
+
+static int xcpkg_installed_db_write(const char * dbFilePath, const XCPKGInstalledPackage packageArray[], const size_t packageArraySize) {
+    char tmpFilePath[PATH_MAX];
+
+    int ret = snprintf(tmpFilePath, PATH_MAX, "%s.%d.tmp", dbFilePath, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * file = fopen(tmpFilePath, "w");
+
+    if (file == NULL) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    fputs(XCPKG_INSTALLED_DB_HEADER, file);
+
+    for (size_t i = 0U; i < packageArraySize; i++) {
+        write_a_record(file, &packageArray[i]);
+    }
+
+    if (fflush(file) != 0 || ferror(file) || fsync(fileno(file)) != 0) {
+        perror(tmpFilePath);
+        fclose(file);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (fclose(file) != 0) {
+        perror(tmpFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (rename(tmpFilePath, dbFilePath) != 0) {
+        perror(dbFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_installed_db_append(const char * dbFilePath, const char * record, const size_t recordLength) {
+    int fd = open(dbFilePath, O_WRONLY | O_APPEND | O_CLOEXEC);
+
+    if (fd == -1) {
+        perror(dbFilePath);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        perror(dbFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    // terminate a torn append, so that it is skipped as an invalid record instead of swallowing this one
+    if (st.st_size > 0) {
+        int readFD = open(dbFilePath, O_RDONLY | O_CLOEXEC);
+
+        char c = '\n';
+
+        if (readFD != -1) {
+            if (pread(readFD, &c, 1, st.st_size - 1) != 1) {
+                c = '\n';
+            }
+
+            close(readFD);
+        }
+
+        if (c != '\n' && write(fd, "\n", 1) != 1) {
+            perror(dbFilePath);
+            close(fd);
+            return XCPKG_ERROR;
+        }
+    }
+
+    ssize_t writeSize = write(fd, record, recordLength);
+
+    if (writeSize == -1) {
+        perror(dbFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    if ((size_t)writeSize != recordLength) {
+        fprintf(stderr, "not fully written to %s\n", dbFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    if (fsync(fd) != 0) {
+        perror(dbFilePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    close(fd);
+
+    return XCPKG_OK;
+}
+
+// append the record, then compact the database if the superseded records outnumber the live ones
+static int xcpkg_installed_db_commit_locked(const char * record, const size_t recordLength) {
+    char dbFilePath[PATH_MAX];
+
+    int ret = xcpkg_installed_db_path(dbFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    XCPKGInstalledDB db = {0};
+
+    ret = xcpkg_installed_db_read(dbFilePath, &db);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_installed_db_append(dbFilePath, record, recordLength);
+
+    if (ret == XCPKG_OK && db.recordCount + 1U > (db.packageArraySize << 1) + 64U) {
+        xcpkg_installed_db_free(&db);
+
+        ret = xcpkg_installed_db_read(dbFilePath, &db);
+
+        if (ret == XCPKG_OK) {
+            ret = xcpkg_installed_db_write(dbFilePath, db.packageArray, db.packageArraySize);
+        }
+    }
+
+    xcpkg_installed_db_free(&db);
+
+    return ret;
+}
+
+// the compaction replaces the file
+static int xcpkg_installed_db_commit(const char * record, const size_t recordLength) {
+    int lockFD;
+
+    int ret = xcpkg_lock_named("installed.db", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_installed_db_commit_locked(record, recordLength);
+
+    xcpkg_unlock(lockFD);
+
+    // the filesystem already reflects this change
+    if (ret == XCPKG_ERROR_NOT_FOUND) {
+        return xcpkg_installed_db_rebuild();
+    }
+
+    return ret;
+}
+
+int xcpkg_installed_db_add(const XCPKGInstalledPackage * package) {
+    char * record = NULL;
+    size_t recordLength = 0U;
+
+    FILE * file = open_memstream(&record, &recordLength);
+
+    if (file == NULL) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    write_a_record(file, package);
+
+    if (fclose(file) != 0) {
+        perror(NULL);
+        free(record);
+        return XCPKG_ERROR;
+    }
+
+    int ret = xcpkg_installed_db_commit(record, recordLength);
+
+    free(record);
+
+    return ret;
+}
+
+int xcpkg_installed_db_remove(const char * packageName, const char * targetPlatformSpec) {
+    char record[PATH_MAX];
+
+    int ret = snprintf(record, PATH_MAX, "-\t%s\t%s\n", targetPlatformSpec, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return xcpkg_installed_db_commit(record, (size_t)ret);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the sum of the sizes of the files listed in the manifest of the given installed directory
+static size_t xcpkg_installed_size(const int dirFD, const char * manifestFilePath) {
+    FILE * file = fopen(manifestFilePath, "r");
+
+    if (file == NULL) {
+        return 0U;
+    }
+
+    size_t installedSize = 0U;
+
+    char * line = NULL;
+    size_t lineCapacity = 0U;
+
+    ssize_t n;
+
+    while ((n = getline(&line, &lineCapacity, file)) > 0) {
+        if (line[n - 1] == '\n') {
+            line[n - 1] = '\0';
+        }
+
+        if (line[0] != 'f' || line[1] != '|') {
+            continue;
+        }
+
+        struct stat st;
+
+        if (fstatat(dirFD, line + 2, &st, 0) == 0) {
+            installedSize += (size_t)st.st_size;
+        }
+    }
+
+    free(line);
+    fclose(file);
+
+    return installedSize;
+}
+
+typedef struct {
+    XCPKGInstalledPackage * packageArray;
+    size_t                  packageArraySize;
+    size_t                  packageArrayCapacity;
+} XCPKGInstalledPackageList;
+
+static int xcpkg_installed_db_scan_a_target(const char * targetDIR, const char * targetPlatformSpec, XCPKGInstalledPackageList * list) {
+    DIR * dir = opendir(targetDIR);
+
+    if (dir == NULL) {
+        return XCPKG_OK;
+    }
+
+    struct stat st;
+
+    for (;;) {
+        errno = 0;
+
+        struct dirent * dir_entry = readdir(dir);
+
+        if (dir_entry == NULL) {
+            if (errno == 0) {
+                closedir(dir);
+                return XCPKG_OK;
+            } else {
+                perror(targetDIR);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+
+        const char * packageName = dir_entry->d_name;
+
+        if (xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName) != XCPKG_OK) {
+            continue;
+        }
+
+        // installed packages are symlinks to their real installed directories
+        if (fstatat(dirfd(dir), packageName, &st, AT_SYMLINK_NOFOLLOW) != 0 || !S_ISLNK(st.st_mode)) {
+            continue;
+        }
+
+        char sha[65] = {0};
+
+        if (readlinkat(dirfd(dir), packageName, sha, 65) != 64) {
+            continue;
+        }
+
+        char receiptFilePath[PATH_MAX];
+
+        int ret = snprintf(receiptFilePath, PATH_MAX, "%s/%s", sha, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+        if (ret < 0) {
+            perror(NULL);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        if (fstatat(dirfd(dir), receiptFilePath, &st, 0) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        // the receipt is written once the package has been installed, builtAt is when its build started
+        time_t installedAt = st.st_mtime;
+
+        XCPKGReceipt * receipt = NULL;
+
+        if (xcpkg_receipt_parse(packageName, targetPlatformSpec, &receipt) != XCPKG_OK) {
+            continue;
+        }
+
+        char manifestFilePath[PATH_MAX];
+
+        ret = snprintf(manifestFilePath, PATH_MAX, "%s/%s/%s", targetDIR, sha, XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+        if (ret < 0) {
+            perror(NULL);
+            xcpkg_receipt_free(receipt);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        int packageDIRFD = openat(dirfd(dir), sha, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+        size_t installedSize = 0U;
+
+        if (packageDIRFD != -1) {
+            installedSize = xcpkg_installed_size(packageDIRFD, manifestFilePath);
+            close(packageDIRFD);
+        }
+
+        // the record is serialized then parsed back, so that it owns its strings in one buffer as the loaded ones do
+        XCPKGInstalledPackage package = {
+            .targetPlatformSpec = (char*)targetPlatformSpec,
+            .packageName = (char*)packageName,
+            .sha = sha,
+            .version = receipt->version,
+            .dep_pkg = receipt->dep_pkg,
+            .installedAt = installedAt,
+            .installedSize = installedSize
+        };
+
+        char * record = NULL;
+        size_t recordLength = 0U;
+
+        FILE * file = open_memstream(&record, &recordLength);
+
+        if (file == NULL) {
+            perror(NULL);
+            xcpkg_receipt_free(receipt);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        write_a_record(file, &package);
+
+        fclose(file);
+
+        xcpkg_receipt_free(receipt);
+
+        if (list->packageArraySize == list->packageArrayCapacity) {
+            size_t newCapacity = list->packageArrayCapacity == 0U ? 64U : (list->packageArrayCapacity << 1);
+
+            XCPKGInstalledPackage * p = (XCPKGInstalledPackage*)realloc(list->packageArray, newCapacity * sizeof(XCPKGInstalledPackage));
+
+            if (p == NULL) {
+                free(record);
+                closedir(dir);
+                return XCPKG_ERROR_MEMORY_ALLOCATE;
+            }
+
+            list->packageArray = p;
+            list->packageArrayCapacity = newCapacity;
+        }
+
+        char op;
+
+        // the trailing newline is not a part of the record
+        bool ok = record != NULL && xcpkg_installed_db_parse_record(record, recordLength - 1U, &op, &list->packageArray[list->packageArraySize]);
+
+        free(record);
+
+        if (ok) {
+            list->packageArraySize++;
+        }
+    }
+}
+
+static int xcpkg_installed_db_rebuild_locked() {
+    char dbFilePath[PATH_MAX];
+
+    int ret = xcpkg_installed_db_path(dbFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char packageInstalledRootDIR[PATH_MAX];
+
+    ret = snprintf(packageInstalledRootDIR, PATH_MAX, "%s/installed", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    ret = XCPKG_OK;
+
+    XCPKGInstalledPackageList list = {0};
+
+    DIR * dir = opendir(packageInstalledRootDIR);
+
+    if (dir == NULL) {
+        if (errno != ENOENT) {
+            perror(packageInstalledRootDIR);
+            return XCPKG_ERROR;
+        }
+    } else {
+        for (;;) {
+            errno = 0;
+
+            struct dirent * dir_entry = readdir(dir);
+
+            if (dir_entry == NULL) {
+                if (errno != 0) {
+                    perror(packageInstalledRootDIR);
+                    ret = XCPKG_ERROR;
+                }
+
+                break;
+            }
+
+            const char * targetPlatformSpec = dir_entry->d_name;
+
+            if (xcpkg_check_if_the_given_argument_matches_platform_spec_pattern(targetPlatformSpec) != XCPKG_OK) {
+                continue;
+            }
+
+            char targetDIR[PATH_MAX];
+
+            ret = snprintf(targetDIR, PATH_MAX, "%s/%s", packageInstalledRootDIR, targetPlatformSpec);
+
+            if (ret < 0) {
+                perror(NULL);
+                ret = XCPKG_ERROR;
+                break;
+            }
+
+            ret = xcpkg_installed_db_scan_a_target(targetDIR, targetPlatformSpec, &list);
+
+            if (ret != XCPKG_OK) {
+                break;
+            }
+        }
+
+        closedir(dir);
+    }
+
+    if (ret == XCPKG_OK) {
+        qsort(list.packageArray, list.packageArraySize, sizeof(XCPKGInstalledPackage), compare_installed_packages);
+
+        ret = xcpkg_installed_db_write(dbFilePath, list.packageArray, list.packageArraySize);
+    }
+
+    for (size_t i = 0U; i < list.packageArraySize; i++) {
+        free(list.packageArray[i].buf);
+    }
+
+    free(list.packageArray);
+
+    return ret;
+}
+
+int xcpkg_installed_db_rebuild() {
+    int lockFD;
+
+    int ret = xcpkg_lock_named("installed.db", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_installed_db_rebuild_locked();
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
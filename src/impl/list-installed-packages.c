@@ -1,184 +1,40 @@
-#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 
-#include <unistd.h>
-#include <dirent.h>
-
-#include <sys/stat.h>
-
 #include "../xcpkg.h"
 
-static int _scan_dir(const char * targetPlatformSpec, const bool verbose) {
-    DIR * dir = opendir(targetPlatformSpec);
-
-    if (dir == NULL) {
-        if (errno == ENOENT) {
-            XCPKG_OK;
-        }
-
-        if (errno == ENOTDIR) {
-            XCPKG_OK;
-        }
-
-        perror(targetPlatformSpec);
-        return XCPKG_ERROR;
-    }
-
-    size_t targetPlatformSpecLength = strlen(targetPlatformSpec);
-
-    struct stat st;
-
-loop:
-    errno = 0;
-
-    struct dirent * dir_entry = readdir(dir);
-
-    if (dir_entry == NULL) {
-        if (errno == 0) {
-            closedir(dir);
-            return XCPKG_OK;
-        } else {
-            perror(targetPlatformSpec);
-            closedir(dir);
-            return XCPKG_ERROR;
-        }
-    }
-
-    const char * p = dir_entry->d_name;
-
-    if ((strcmp(p, ".") == 0) || (strcmp(p, "..") == 0)) {
-        goto loop;
-    }
+int xcpkg_list_the_installed_packages(const char * targetPlatformName, const bool verbose) {
+    XCPKGInstalledDB db;
 
-    int ret = xcpkg_check_if_the_given_argument_matches_package_name_pattern(p);
+    int ret = xcpkg_installed_db_load(&db);
 
     if (ret != XCPKG_OK) {
-        goto loop;
+        return ret;
     }
 
-    size_t packageInstalledDIRCapacity = targetPlatformSpecLength + strlen(p) + 2U;
-    char   packageInstalledDIR[packageInstalledDIRCapacity];
+    for (size_t i = 0U; i < db.packageArraySize; i++) {
+        const XCPKGInstalledPackage * package = &db.packageArray[i];
 
-    ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", targetPlatformSpec, p);
+        const char * targetPlatformSpec = package->targetPlatformSpec;
 
-    if (ret < 0) {
-        perror(NULL);
-        closedir(dir);
-        return XCPKG_ERROR;
-    }
-
-    if (lstat(packageInstalledDIR, &st) == 0) {
-        if (!S_ISLNK(st.st_mode)) {
-            goto loop;
+        if (targetPlatformName != NULL && targetPlatformName[0] != '\0') {
+            if (strncmp(targetPlatformName, targetPlatformSpec, strlen(targetPlatformSpec)) != 0) {
+                continue;
+            }
         }
-    } else {
-        goto loop;
-    }
-
-    size_t receiptFilePathCapacity = packageInstalledDIRCapacity + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
-    char   receiptFilePath[receiptFilePathCapacity];
 
-    ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageInstalledDIR, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
-
-    if (ret < 0) {
-        perror(NULL);
-        closedir(dir);
-        return XCPKG_ERROR;
-    }
-
-    if (lstat(receiptFilePath, &st) == 0 && S_ISREG(st.st_mode)) {
         if (verbose) {
-            ret = xcpkg_show_installed_info(p, targetPlatformSpec, NULL);
+            ret = xcpkg_show_installed_info(package->packageName, targetPlatformSpec, NULL);
 
             if (ret != XCPKG_OK) {
-                closedir(dir);
-                return ret;
+                break;
             }
         } else {
-            puts(packageInstalledDIR);
+            printf("%s/%s\n", targetPlatformSpec, package->packageName);
         }
     }
 
-    goto loop;
-}
-
-int xcpkg_list_the_installed_packages(const char * targetPlatformName, const bool verbose) {
-    const char * xcpkgHomeDIR;
-    size_t xcpkgHomeDIRLength;
-
-    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
-    size_t packageInstalledRootDIRCapacity = xcpkgHomeDIRLength + 11U;
-    char   packageInstalledRootDIR[packageInstalledRootDIRCapacity];
-
-    ret = snprintf(packageInstalledRootDIR, packageInstalledRootDIRCapacity, "%s/installed", xcpkgHomeDIR);
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
-    if (chdir(packageInstalledRootDIR) != 0) {
-        if (errno == ENOENT) {
-            return XCPKG_OK;
-        } else {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
-    }
-
-    DIR * dir = opendir(".");
-
-    if (dir == NULL) {
-        perror(packageInstalledRootDIR);
-        return XCPKG_ERROR;
-    }
-
-loop:
-    errno = 0;
-
-    struct dirent * dir_entry = readdir(dir);
-
-    if (dir_entry == NULL) {
-        if (errno == 0) {
-            closedir(dir);
-            return XCPKG_OK;
-        } else {
-            perror(packageInstalledRootDIR);
-            closedir(dir);
-            return XCPKG_ERROR;
-        }
-    }
-
-    const char * p = dir_entry->d_name;
-
-    if ((strcmp(p, ".") == 0) || (strcmp(p, "..") == 0)) {
-        goto loop;
-    }
-
-    ret = xcpkg_check_if_the_given_argument_matches_platform_spec_pattern(p);
-
-    if (ret != XCPKG_OK) {
-        goto loop;
-    }
-
-    if (targetPlatformName != NULL && targetPlatformName[0] != '\0') {
-        if (strncmp(targetPlatformName, p, strlen(p)) != 0) {
-            goto loop;
-        }
-    }
-
-    ret = _scan_dir(p, verbose);
-
-    if (ret == XCPKG_OK) {
-        goto loop;
-    }
+    xcpkg_installed_db_free(&db);
 
-    closedir(dir);
     return ret;
 }
@@ -1,210 +1,188 @@
-#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 
-#include <unistd.h>
-#include <dirent.h>
+#include <jansson.h>
 
-#include <sys/stat.h>
+#include "../core/parallel.h"
 
 #include "../xcpkg.h"
 
-static int _scan_dir(const char * targetPlatformSpec) {
-    DIR * dir = opendir(targetPlatformSpec);
+#include "outdated.h"
 
-    if (dir == NULL) {
-        if (errno == ENOENT) {
-            XCPKG_OK;
-        }
+typedef struct {
+    XCPKGOutdatedPackage * packageArray;
+    size_t                 packageArraySize;
+    size_t                 packageArrayCapacity;
+
+    XCPKGFormulaRepoPathList formulaRepoPathList;
+} Payload;
+
+static int add_the_installed_package(Payload * payload, const XCPKGInstalledPackage * installedPackage) {
+    if (payload->packageArraySize == payload->packageArrayCapacity) {
+        size_t newCapacity = payload->packageArrayCapacity == 0U ? 64U : (payload->packageArrayCapacity << 1);
+
+        XCPKGOutdatedPackage * p = (XCPKGOutdatedPackage*)realloc(payload->packageArray, newCapacity * sizeof(XCPKGOutdatedPackage));
 
-        if (errno == ENOTDIR) {
-            XCPKG_OK;
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
         }
 
-        perror(targetPlatformSpec);
-        return XCPKG_ERROR;
+        payload->packageArray = p;
+        payload->packageArrayCapacity = newCapacity;
     }
 
-    size_t targetPlatformSpecLength = strlen(targetPlatformSpec);
+    XCPKGOutdatedPackage * package = &payload->packageArray[payload->packageArraySize];
 
-loop:
-    errno = 0;
+    memset(package, 0, sizeof(XCPKGOutdatedPackage));
 
-    struct dirent * dir_entry = readdir(dir);
+    package->packageName = strdup(installedPackage->packageName);
+    package->targetPlatformSpec = strdup(installedPackage->targetPlatformSpec);
+    package->installedVersion = strdup(installedPackage->version);
 
-    if (dir_entry == NULL) {
-        if (errno == 0) {
-            closedir(dir);
-            return XCPKG_OK;
-        } else {
-            perror(targetPlatformSpec);
-            closedir(dir);
-            return XCPKG_ERROR;
-        }
-    }
+    payload->packageArraySize++;
 
-    if ((strcmp(dir_entry->d_name, ".") == 0) || (strcmp(dir_entry->d_name, "..") == 0)) {
-        goto loop;
+    if (package->packageName == NULL || package->targetPlatformSpec == NULL || package->installedVersion == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
     }
 
-    size_t packageInstalledDIRCapacity = targetPlatformSpecLength + strlen(dir_entry->d_name) + 2U;
-    char   packageInstalledDIR[packageInstalledDIRCapacity];
+    return XCPKG_OK;
+}
 
-    int ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", targetPlatformSpec, dir_entry->d_name);
+static int check_the_outdated_package(size_t index, void * arg) {
+    Payload * payload = (Payload*)arg;
+    return xcpkg_outdated_package_check(&payload->formulaRepoPathList, &payload->packageArray[index]);
+}
 
-    if (ret < 0) {
-        perror(NULL);
-        closedir(dir);
-        return XCPKG_ERROR;
-    }
+static int print_the_outdated_packages(const Payload * payload, const bool verbose, const bool json) {
+    if (json) {
+        json_t * root = json_array();
 
-    struct stat st;
+        for (size_t i = 0U; i < payload->packageArraySize; i++) {
+            const XCPKGOutdatedPackage * package = &payload->packageArray[i];
 
-    if (lstat(packageInstalledDIR, &st) == 0) {
-        if (!S_ISLNK(st.st_mode)) {
-            goto loop;
-        }
-    } else {
-        goto loop;
-    }
+            if (package->ret != XCPKG_OK) {
+                continue;
+            }
 
-    size_t receiptFilePathCapacity = packageInstalledDIRCapacity + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
-    char   receiptFilePath[receiptFilePathCapacity];
+            json_t * item = json_object();
 
-    ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageInstalledDIR, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+            json_object_set_new(item, "pkgname", json_string(package->packageName));
+            json_object_set_new(item, "target", json_string(package->targetPlatformSpec));
+            json_object_set_new(item, "installed-version", json_string(package->installedVersion));
+            json_object_set_new(item, "available-version", json_string(package->availableVersion));
 
-    if (ret < 0) {
-        perror(NULL);
-        closedir(dir);
-        return XCPKG_ERROR;
-    }
+            json_array_append_new(root, item);
+        }
 
-    if (lstat(receiptFilePath, &st) != 0 || !S_ISREG(st.st_mode)) {
-        goto loop;
-    }
+        char * jsonStr = json_dumps(root, 0);
 
-    //printf("%s\n", dir_entry->d_name);
+        int ret = XCPKG_OK;
 
-    XCPKGReceipt * receipt = NULL;
+        if (jsonStr == NULL) {
+            ret = XCPKG_ERROR;
+        } else {
+            printf("%s\n", jsonStr);
+            free(jsonStr);
+        }
 
-    ret = xcpkg_receipt_parse(dir_entry->d_name, targetPlatformSpec, &receipt);
+        json_decref(root);
 
-    if (ret != XCPKG_OK) {
-        closedir(dir);
         return ret;
     }
 
-    char targetPlatformName[51];
+    for (size_t i = 0U; i < payload->packageArraySize; i++) {
+        const XCPKGOutdatedPackage * package = &payload->packageArray[i];
 
-    for (int i = 0; i < 50; i++) {
-        if (targetPlatformSpec[i] == '\0') {
-            return XCPKG_ERROR_ARG_IS_INVALID;
+        if (package->ret != XCPKG_OK) {
+            continue;
         }
 
-        if (targetPlatformSpec[i] == '-') {
-            targetPlatformName[i] = '\0';
-            break;
+        if (verbose) {
+            printf("%s/%s %s => %s\n", package->targetPlatformSpec, package->packageName, package->installedVersion, package->availableVersion);
+        } else {
+            printf("%s %s => %s\n", package->packageName, package->installedVersion, package->availableVersion);
         }
-
-        targetPlatformName[i] = targetPlatformSpec[i];
     }
 
-    XCPKGFormula * formula = NULL;
+    return XCPKG_OK;
+}
+
+int xcpkg_list_the__outdated_packages(const char * targetPlatformName, const bool verbose, const bool json) {
+    XCPKGInstalledDB db;
 
-    ret = xcpkg_formula_load(dir_entry->d_name, targetPlatformName, NULL, &formula);
+    int ret = xcpkg_installed_db_load(&db);
 
     if (ret != XCPKG_OK) {
-        closedir(dir);
-        xcpkg_receipt_free(receipt);
         return ret;
     }
 
-    if (receipt->version != NULL && formula->version != NULL && strcmp(receipt->version, formula->version) != 0) {
-        printf("%s %s => %s\n", dir_entry->d_name, receipt->version, formula->version);
-    }
-
-    xcpkg_formula_free(formula);
-    xcpkg_receipt_free(receipt);
-
-    goto loop;
-}
-
-int xcpkg_list_the__outdated_packages(const char * targetPlatformName, const bool verbose) {
-    const char * xcpkgHomeDIR;
-    size_t xcpkgHomeDIRLength;
+    size_t targetPlatformNameLength = targetPlatformName == NULL ? 0U : strlen(targetPlatformName);
 
-    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+    Payload payload = {0};
 
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
+    // the database is sorted by target then package name, the results are reported in this order no matter which worker finishes first
+    for (size_t i = 0U; i < db.packageArraySize; i++) {
+        const XCPKGInstalledPackage * installedPackage = &db.packageArray[i];
 
-    size_t packageInstalledRootDIRCapacity = xcpkgHomeDIRLength + 11U;
-    char   packageInstalledRootDIR[packageInstalledRootDIRCapacity];
+        const char * p = installedPackage->targetPlatformSpec;
 
-    ret = snprintf(packageInstalledRootDIR, packageInstalledRootDIRCapacity, "%s/installed", xcpkgHomeDIR);
+        if (targetPlatformNameLength != 0U) {
+            if (strncmp(targetPlatformName, p, targetPlatformNameLength) != 0 || p[targetPlatformNameLength] != '-') {
+                continue;
+            }
+        }
 
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
+        ret = add_the_installed_package(&payload, installedPackage);
 
-    if (chdir(packageInstalledRootDIR) != 0) {
-        if (errno == ENOENT) {
-            return XCPKG_OK;
-        } else {
-            perror(NULL);
-            return XCPKG_ERROR;
+        if (ret != XCPKG_OK) {
+            break;
         }
     }
 
-    DIR * dir = opendir(".");
+    xcpkg_installed_db_free(&db);
 
-    if (dir == NULL) {
-        perror(packageInstalledRootDIR);
-        return XCPKG_ERROR;
+    if (ret != XCPKG_OK) {
+        goto finalize;
     }
 
-loop:
-    errno = 0;
+    //////////////////////////////////////////////////////////////////////////////
 
-    struct dirent * dir_entry = readdir(dir);
+    ret = xcpkg_formula_repo_path_list_load(&payload.formulaRepoPathList);
 
-    if (dir_entry == NULL) {
-        if (errno == 0) {
-            closedir(dir);
-            return XCPKG_OK;
-        } else {
-            perror(packageInstalledRootDIR);
-            closedir(dir);
-            return XCPKG_ERROR;
-        }
+    if (ret != XCPKG_OK) {
+        goto finalize;
     }
 
-    const char * p = dir_entry->d_name;
-
-    if ((strcmp(p, ".") == 0) || (strcmp(p, "..") == 0)) {
-        goto loop;
+    // every package costs a formula parse, they are independent of each other
+    if (parallel_for(payload.packageArraySize, 0U, check_the_outdated_package, &payload) != 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+        goto finalize;
     }
 
-    ret = xcpkg_check_if_the_given_argument_matches_platform_spec_pattern(p);
+    ret = print_the_outdated_packages(&payload, verbose, json);
 
     if (ret != XCPKG_OK) {
-        goto loop;
+        goto finalize;
     }
 
-    if (targetPlatformName != NULL && targetPlatformName[0] != '\0') {
-        if (strncmp(targetPlatformName, p, strlen(p)) != 0) {
-            goto loop;
+    for (size_t i = 0U; i < payload.packageArraySize; i++) {
+        int r = payload.packageArray[i].ret;
+
+        if (r != XCPKG_OK && r != XCPKG_ERROR_PACKAGE_NOT_OUTDATED) {
+            ret = r;
+            break;
         }
     }
 
-    ret = _scan_dir(p);
-
-    if (ret == XCPKG_OK) {
-        goto loop;
+finalize:
+    for (size_t i = 0U; i < payload.packageArraySize; i++) {
+        xcpkg_outdated_package_free(&payload.packageArray[i]);
     }
 
-    closedir(dir);
+    free(payload.packageArray);
+
+    xcpkg_formula_repo_path_list_free(&payload.formulaRepoPathList);
+
     return ret;
 }
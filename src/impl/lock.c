@@ -0,0 +1,167 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+#include "../xcpkg.h"
+
+// if wait is false, fd is set to -1 instead of waiting for the process which is holding the lock
+static int xcpkg_lock_internal(const char * lockFilePath, const char * what, const bool wait, int * fd, bool * waited) {
+    if (lockFilePath == NULL || fd == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (lockFilePath[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    if (waited != NULL) {
+        (*waited) = false;
+    }
+
+    // O_CLOEXEC: the programs we run must not inherit the lock
+    int lockFD = open(lockFilePath, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+
+    if (lockFD == -1) {
+        perror(lockFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (flock(lockFD, LOCK_EX | LOCK_NB) == 0) {
+        (*fd) = lockFD;
+        return XCPKG_OK;
+    }
+
+    if (errno != EWOULDBLOCK) {
+        perror(lockFilePath);
+        close(lockFD);
+        return XCPKG_ERROR;
+    }
+
+    if (!wait) {
+        close(lockFD);
+        (*fd) = -1;
+        return XCPKG_OK;
+    }
+
+    if (what != NULL) {
+        fprintf(stderr, "waiting for another xcpkg process which is working on %s ...\n", what);
+    }
+
+    while (flock(lockFD, LOCK_EX) == -1) {
+        if (errno != EINTR) {
+            perror(lockFilePath);
+            close(lockFD);
+            return XCPKG_ERROR;
+        }
+    }
+
+    if (waited != NULL) {
+        (*waited) = true;
+    }
+
+    (*fd) = lockFD;
+
+    return XCPKG_OK;
+}
+
+int xcpkg_lock(const char * lockFilePath, const char * what, int * fd, bool * waited) {
+    return xcpkg_lock_internal(lockFilePath, what, true, fd, waited);
+}
+
+static int xcpkg_lock_named_internal(const char * name, const char * what, const bool wait, int * fd, bool * waited) {
+    if (name == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (name[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    size_t lockDIRCapacity = xcpkgHomeDIRLength + 7U;
+    char   lockDIR[lockDIRCapacity];
+
+    ret = snprintf(lockDIR, lockDIRCapacity, "%s/locks", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    ret = xcpkg_mkdir_p(lockDIR, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char lockFilePath[PATH_MAX];
+
+    ret = snprintf(lockFilePath, PATH_MAX, "%s/%s.lock", lockDIR, name);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return xcpkg_lock_internal(lockFilePath, what, wait, fd, waited);
+}
+
+int xcpkg_lock_named(const char * name, const char * what, int * fd, bool * waited) {
+    return xcpkg_lock_named_internal(name, what, true, fd, waited);
+}
+
+static int xcpkg_lock_the_installed_package_internal(const char * packageName, const char * targetPlatformSpec, const bool wait, int * fd, bool * waited) {
+    if (packageName == NULL || targetPlatformSpec == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    size_t lockNameCapacity = strlen(targetPlatformSpec) + strlen(packageName) + 12U;
+    char   lockName[lockNameCapacity];
+
+    int ret = snprintf(lockName, lockNameCapacity, "installed-%s-%s", targetPlatformSpec, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    size_t whatCapacity = lockNameCapacity;
+    char   what[whatCapacity];
+
+    ret = snprintf(what, whatCapacity, "%s/%s", targetPlatformSpec, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return xcpkg_lock_named_internal(lockName, what, wait, fd, waited);
+}
+
+int xcpkg_lock_the_installed_package(const char * packageName, const char * targetPlatformSpec, int * fd, bool * waited) {
+    return xcpkg_lock_the_installed_package_internal(packageName, targetPlatformSpec, true, fd, waited);
+}
+
+int xcpkg_trylock_the_installed_package(const char * packageName, const char * targetPlatformSpec, int * fd) {
+    return xcpkg_lock_the_installed_package_internal(packageName, targetPlatformSpec, false, fd, NULL);
+}
+
+void xcpkg_unlock(int fd) {
+    if (fd != -1) {
+        // closing the last descriptor of the open file description releases the lock
+        close(fd);
+    }
+}
@@ -0,0 +1,142 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "../core/trace.h"
+
+#include "../xcpkg.h"
+
+#include "manifest.h"
+
+static int generate_manifest_r(const char * dirPath, const size_t offset, FILE * installedManifestFile, uint64_t * statCount, size_t * installedSize) {
+    if (dirPath == NULL) {
+        return XCPKG_ERROR_ARG_IS_NULL;
+    }
+
+    if (dirPath[0] == '\0') {
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    DIR * dir = opendir(dirPath);
+
+    if (dir == NULL) {
+        perror(dirPath);
+        return XCPKG_ERROR;
+    }
+
+    size_t dirPathLength = strlen(dirPath);
+
+    int ret = XCPKG_OK;
+
+    struct stat st;
+
+    for (;;) {
+        errno = 0;
+
+        struct dirent * dir_entry = readdir(dir);
+
+        if (dir_entry == NULL) {
+            if (errno == 0) {
+                closedir(dir);
+                return XCPKG_OK;
+            } else {
+                perror(dirPath);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+
+        if ((strcmp(dir_entry->d_name, ".") == 0) || (strcmp(dir_entry->d_name, "..") == 0)) {
+            continue;
+        }
+
+        size_t filePathCapacity = dirPathLength + strlen(dir_entry->d_name) + 2U;
+        char   filePath[filePathCapacity];
+
+        ret = snprintf(filePath, filePathCapacity, "%s/%s", dirPath, dir_entry->d_name);
+
+        if (ret < 0) {
+            perror(NULL);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        (*statCount)++;
+
+        if (stat(filePath, &st) != 0) {
+            perror(filePath);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            ret = fprintf(installedManifestFile, "d|%s/\n", &filePath[offset]);
+
+            if (ret < 0) {
+                perror(NULL);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+
+            ret = generate_manifest_r(filePath, offset, installedManifestFile, statCount, installedSize);
+
+            if (ret != XCPKG_OK) {
+                closedir(dir);
+                return ret;
+            }
+        } else {
+            (*installedSize) += (size_t)st.st_size;
+
+            ret = fprintf(installedManifestFile, "f|%s\n", &filePath[offset]);
+
+            if (ret < 0) {
+                perror(NULL);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+    }
+}
+
+int generate_manifest(const char * installedDIRPath, size_t * installedSize) {
+    size_t installedDIRLength = strlen(installedDIRPath);
+
+    size_t installedManifestFilePathLength = installedDIRLength + sizeof(XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 1U;
+    char   installedManifestFilePath[installedManifestFilePathLength];
+
+    int ret = snprintf(installedManifestFilePath, installedManifestFilePathLength, "%s/%s", installedDIRPath, XCPKG_MANIFEST_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * installedManifestFile = fopen(installedManifestFilePath, "w");
+
+    if (installedManifestFile == NULL) {
+        perror(installedManifestFilePath);
+        return XCPKG_ERROR;
+    }
+
+    uint64_t startTime = trace_now();
+
+    uint64_t statCount = 0U;
+
+    size_t totalSize = 0U;
+
+    ret = generate_manifest_r(installedDIRPath, installedDIRLength + 1, installedManifestFile, &statCount, &totalSize);
+
+    if (installedSize != NULL) {
+        (*installedSize) = totalSize;
+    }
+
+    fclose(installedManifestFile);
+
+    trace_record("manifest", "generate_manifest", 1U, 0U, startTime);
+    trace_record("manifest", "stat", statCount, 0U, 0U);
+
+    return ret;
+}
@@ -0,0 +1,12 @@
+#ifndef XCPKG_MANIFEST_H
+#define XCPKG_MANIFEST_H
+
+#include <stddef.h>
+
+/** write every file and directory under installedDIRPath to <installedDIRPath>/.xcpkg/MANIFEST.txt, one per line, d|path/ for directories, f|path for the others.
+ *
+ *  if installedSize is not NULL, the sum of the sizes of the files is written to it.
+ */
+int generate_manifest(const char * installedDIRPath, size_t * installedSize);
+
+#endif
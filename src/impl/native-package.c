@@ -5,9 +5,17 @@
 #include <string.h>
 
 #include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdarg.h>
 #include <unistd.h>
+#include <dirent.h>
 
 #include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "../core/sysinfo.h"
+#include "../core/tar.h"
 
 #include "../base/sha256sum.h"
 
@@ -131,24 +139,22 @@ static int getNativePackageInfoByID(const int packageID, NativePackage * package
     return XCPKG_OK;
 }
 
-int install_native_package(
+static int build_native_package(
         const int packageID,
+        const NativePackage * nativePackage,
         const char * downloadsDIR,
         const size_t downloadsDIRLength,
         const char * sessionDIR,
         const size_t sessionDIRCapacity,
         const char * packageInstalledRootDIR,
         const size_t packageInstalledRootDIRCapacity,
+        const char * packageInstalledDIR,
+        const size_t packageInstalledDIRCapacity,
         const size_t njobs,
-        const XCPKGInstallOptions * installOptions,
-        const NativePackageInstalledCallback callback) {
-    NativePackage package = {0};
-
-    int ret = getNativePackageInfoByID(packageID, &package);
+        const XCPKGInstallOptions * installOptions) {
+    NativePackage package = *nativePackage;
 
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
+    int ret;
 
     //////////////////////////////////////////////////////////////////////////////
 
@@ -171,20 +177,6 @@ int install_native_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    for (int i = 0; i < 10; i++) {
-        if (package.depPackageIDArray[i] == 0) {
-            break;
-        }
-
-        ret = install_native_package(package.depPackageIDArray[i], downloadsDIR, downloadsDIRLength, sessionDIR, sessionDIRCapacity, packageInstalledRootDIR, packageInstalledRootDIRCapacity, njobs, installOptions, callback);
-
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
-    }
-
-    //////////////////////////////////////////////////////////////////////////////
-
     const char * packageName = package.name;
     const char * srcUrl      = package.srcUrl;
     const char * srcUri      = package.srcUri;
@@ -202,51 +194,6 @@ int install_native_package(
 
     size_t packageNameLength = strlen(packageName);
 
-    size_t receiptFilePathLength = packageInstalledRootDIRCapacity + packageNameLength + 14U;
-    char   receiptFilePath[receiptFilePathLength];
-
-    ret = snprintf(receiptFilePath, receiptFilePathLength, "%s/%s/receipt.txt", packageInstalledRootDIR, packageName);
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
-    struct stat st;
-
-    if (stat(receiptFilePath, &st) == 0) {
-        if (S_ISREG(st.st_mode)) {
-            char buf[65] = {0};
-
-            ret = xcpkg_read_the_first_n_bytes_of_a_file(receiptFilePath, 64, buf);
-
-            if (ret != XCPKG_OK) {
-                return ret;
-            }
-
-            if (strcmp(buf, srcSha) == 0) {
-                fprintf(stderr, "native package '%s' already has been installed.\n", packageName);
-
-                size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + packageNameLength + 2U;
-                char   packageInstalledDIR[packageInstalledDIRCapacity];
-
-                ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, packageName);
-
-                if (ret < 0) {
-                    perror(NULL);
-                    return XCPKG_ERROR;
-                }
-
-                return callback(packageInstalledDIR, packageInstalledDIRCapacity);
-            }
-        } else {
-            fprintf(stderr, "%s was expected to be a regular file, but it was not.\n", receiptFilePath);
-            return XCPKG_ERROR;
-        }
-    }
-
-    //////////////////////////////////////////////////////////////////////////////
-
     size_t packageWorkingTopDIRLength = sessionDIRCapacity + packageNameLength + 14U;
     char   packageWorkingTopDIR[packageWorkingTopDIRLength];
 
@@ -282,34 +229,6 @@ int install_native_package(
 
     //////////////////////////////////////////////////////////////////////////////
 
-    size_t strBufSize = packageNameLength + strlen(srcUrl) + strlen(srcSha) + 50U;
-    char   strBuf[strBufSize];
-
-    ret = snprintf(strBuf, strBufSize, "%s:%s:%s:%ld:%d", packageName, srcUrl, srcSha, time(NULL), getpid());
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
-    char packageInstalledSHA[65] = {0};
-
-    ret = sha256sum_of_string(packageInstalledSHA, strBuf);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
-    size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + 66U;
-    char   packageInstalledDIR[packageInstalledDIRCapacity];
-
-    ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, packageInstalledSHA);
-
-    if (ret < 0) {
-        perror(NULL);
-        return XCPKG_ERROR;
-    }
-
     size_t packageWorkingLibDIRLength = packageWorkingTopDIRLength + 5U;
     char   packageWorkingLibDIR[packageWorkingLibDIRLength];
 
@@ -487,7 +406,16 @@ int install_native_package(
             return ret;
         }
 
-        ret = xcpkg_posix_spawn2(3, "cmake", "--build", "build.d");
+        char njobsStr[21];
+
+        ret = snprintf(njobsStr, 21, "%zu", njobs);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        ret = xcpkg_posix_spawn2(5, "cmake", "--build", "build.d", "--parallel", njobsStr);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -523,7 +451,16 @@ int install_native_package(
             return ret;
         }
 
-        ret = xcpkg_posix_spawn2(4, "meson", "compile", "-C", "build.d");
+        char njobsStr[21];
+
+        ret = snprintf(njobsStr, 21, "%zu", njobs);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        ret = xcpkg_posix_spawn2(6, "meson", "compile", "-C", "build.d", "-j", njobsStr);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -635,47 +572,1329 @@ int install_native_package(
             break;
     }
 
-    //////////////////////////////////////////////////////////////////////////////
+    return XCPKG_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+#define NATIVE_PACKAGE_STATE_UNWANTED 0
+#define NATIVE_PACKAGE_STATE_PENDING  1
+#define NATIVE_PACKAGE_STATE_BUILDING 2
+#define NATIVE_PACKAGE_STATE_DONE     3
+
+// bump it whenever the layout of the cached archives changes
+#define NATIVE_PACKAGE_CACHE_VERSION 1
+
+#define NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY 4096
+
+typedef struct {
+    NativePackage package;
+
+    int    state;
 
-    ret = xcpkg_write_file("receipt.txt", srcSha, 64U);
+    // the process in which this package is being built
+    pid_t  pid;
+
+    // the part of the job budget taken by this build
+    size_t njobs;
+
+    char   cacheKey[65];
+    char   cacheKeyText[NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY];
+} NativePackageNode;
+
+static int add_native_package_node(NativePackageNode nodes[], const int packageID) {
+    if (packageID <= 0 || packageID > NATIVE_PACKAGE_ID_MAX) {
+        fprintf(stderr, "unknown native package id: %d\n", packageID);
+        return XCPKG_ERROR;
+    }
+
+    NativePackageNode * node = &nodes[packageID];
+
+    if (node->state != NATIVE_PACKAGE_STATE_UNWANTED) {
+        return XCPKG_OK;
+    }
+
+    int ret = getNativePackageInfoByID(packageID, &node->package);
 
     if (ret != XCPKG_OK) {
         return ret;
     }
 
-    //////////////////////////////////////////////////////////////////////////////
+    node->state = NATIVE_PACKAGE_STATE_PENDING;
 
-    if (chdir(packageInstalledRootDIR) != 0) {
-        perror(packageInstalledRootDIR);
+    for (int i = 0; i < 10; i++) {
+        if (node->package.depPackageIDArray[i] == 0) {
+            break;
+        }
+
+        ret = add_native_package_node(nodes, node->package.depPackageIDArray[i]);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    return XCPKG_OK;
+}
+
+static int native_package_installed(const NativePackage * package, const char * packageInstalledRootDIR, const size_t packageInstalledRootDIRCapacity, const NativePackageInstalledCallback callback) {
+    size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + strlen(package->name) + 2U;
+    char   packageInstalledDIR[packageInstalledDIRCapacity];
+
+    int ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, package->name);
+
+    if (ret < 0) {
+        perror(NULL);
         return XCPKG_ERROR;
     }
 
-    for (;;) {
-        if (symlink(packageInstalledSHA, packageName) == 0) {
-            fprintf(stderr, "native package '%s' was successfully installed.\n", packageName);
-            break;
+    return callback(packageInstalledDIR, packageInstalledDIRCapacity);
+}
+
+// append a formatted string to text, whose first *length bytes are used, a text which would be truncated is an error.
+static int text_append(char text[], const size_t capacity, size_t * length, const char * format, ...) __attribute__((format(printf, 4, 5)));
+
+static int text_append(char text[], const size_t capacity, size_t * length, const char * format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    int ret = vsnprintf(text + (*length), capacity - (*length), format, args);
+
+    va_end(args);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    if ((size_t)ret >= capacity - (*length)) {
+        fprintf(stderr, "the cache key text is longer than %zu bytes.\n", capacity - 1U);
+        return XCPKG_ERROR;
+    }
+
+    (*length) += (size_t)ret;
+
+    return XCPKG_OK;
+}
+
+// append the line 'name: value', where every fromArray[i] in value is replaced with toArray[i], so the paths which differ between machines do not make the key differ
+static int text_append_a_line(char text[], const size_t capacity, size_t * length, const char * name, const char * value, const char * const fromArray[], const char * const toArray[], const size_t n) {
+    int ret = text_append(text, capacity, length, "%s: ", name);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    for (const char * p = value == NULL ? "" : value; p[0] != '\0'; ) {
+        size_t i = 0U;
+
+        for (; i < n; i++) {
+            size_t fromLength = strlen(fromArray[i]);
+
+            if (fromLength != 0U && strncmp(p, fromArray[i], fromLength) == 0) {
+                break;
+            }
+        }
+
+        if (i == n) {
+            ret = text_append(text, capacity, length, "%c", p[0]);
+            p++;
         } else {
-            if (errno == EEXIST) {
-                if (lstat(packageName, &st) == 0) {
-                    if (S_ISDIR(st.st_mode)) {
-                        ret = xcpkg_rm_rf(packageName, false, installOptions->logLevel >= XCPKGLogLevel_verbose);
+            ret = text_append(text, capacity, length, "%s", toArray[i]);
+            p += strlen(fromArray[i]);
+        }
 
-                        if (ret != XCPKG_OK) {
-                            return ret;
-                        }
-                    } else {
-                        if (unlink(packageName) != 0) {
-                            perror(packageName);
-                            return XCPKG_ERROR;
-                        }
-                    }
-                }
-            } else {
-                perror(packageName);
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    return text_append(text, capacity, length, "\n");
+}
+
+// the toolchain part of the cache key text, it is the same for every native package built in this run.
+//
+// CC and CXX are the wrappers under $XCPKG_HOME, the real compilers XCPKG_CC and XCPKG_CXX are identified by the sha256sum of their binaries,
+// the sdk by the name of its real directory and the sha256sum of its SDKSettings.json, so an upgrade of either changes the key.
+// neither $XCPKG_HOME nor the path of the sdk is part of the text, so that the same toolchain gives the same key on every machine.
+static int generate_the_toolchain_key_text(char text[], const size_t capacity) {
+    const char * xcpkgHomeDIR = NULL;
+    size_t       xcpkgHomeDIRLength = 0U;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    size_t length = 0U;
+
+    text[0] = '\0';
+
+    const char * compilerNames[2] = { "XCPKG_CC", "XCPKG_CXX" };
+
+    for (int i = 0; i < 2; i++) {
+        const char * compiler = getenv(compilerNames[i]);
+
+        if (compiler == NULL || compiler[0] != '/') {
+            ret = text_append(text, capacity, &length, "%s: %s\n", compilerNames[i], compiler == NULL ? "" : compiler);
+        } else {
+            char sha256sum[65];
+
+            if (sha256sum_of_file(sha256sum, compiler) != 0) {
+                fprintf(stderr, "failed to calculate the sha256sum of %s\n", compiler);
                 return XCPKG_ERROR;
             }
+
+            ret = text_append(text, capacity, &length, "%s-sha: %s\n", compilerNames[i], sha256sum);
+        }
+
+        if (ret != XCPKG_OK) {
+            return ret;
         }
     }
 
-    return callback(packageInstalledDIR, packageInstalledDIRCapacity);
+    //////////////////////////////////////////////////////////////////////////////
+
+    // it is set by xcpkg_install_packages(), in the form of '-isysroot <SDK> -mmacosx-version-min=...'
+    const char * nativeFlags = getenv("XCPKG_NATIVE_FLAGS");
+
+    char sdkDIR[PATH_MAX]; sdkDIR[0] = '\0';
+
+    const char * p = nativeFlags == NULL ? NULL : strstr(nativeFlags, "-isysroot ");
+
+    if (p != NULL) {
+        p += 10;
+
+        size_t n = strcspn(p, " ");
+
+        if (n >= PATH_MAX) {
+            fprintf(stderr, "the sdk path in XCPKG_NATIVE_FLAGS is too long.\n");
+            return XCPKG_ERROR;
+        }
+
+        memcpy(sdkDIR, p, n);
+
+        sdkDIR[n] = '\0';
+    }
+
+    if (sdkDIR[0] != '\0') {
+        // MacOSX.sdk is usually a symlink to MacOSX<VERSION>.sdk
+        char sdkRealDIR[PATH_MAX];
+
+        if (realpath(sdkDIR, sdkRealDIR) == NULL) {
+            perror(sdkDIR);
+            return XCPKG_ERROR;
+        }
+
+        const char * sdkName = strrchr(sdkRealDIR, '/');
+
+        char sdkSettingsFilePath[PATH_MAX];
+
+        ret = snprintf(sdkSettingsFilePath, PATH_MAX, "%s/SDKSettings.json", sdkRealDIR);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        char sdkSettingsSHA[65]; sdkSettingsSHA[0] = '\0';
+
+        struct stat st;
+
+        if (stat(sdkSettingsFilePath, &st) == 0 && sha256sum_of_file(sdkSettingsSHA, sdkSettingsFilePath) != 0) {
+            fprintf(stderr, "failed to calculate the sha256sum of %s\n", sdkSettingsFilePath);
+            return XCPKG_ERROR;
+        }
+
+        ret = text_append(text, capacity, &length, "sdk: %s\nsdk-settings-sha: %s\n", sdkName == NULL ? sdkRealDIR : sdkName + 1, sdkSettingsSHA);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    const char * const fromArray[2] = { sdkDIR, xcpkgHomeDIR };
+    const char * const toArray[2]   = { "$SDKROOT", "$XCPKG_HOME" };
+
+    // CC, CXX and CPP are the wrappers, these are the flags they and the build systems pass to the real compilers
+    const char * envNames[7] = { "XCPKG_NATIVE_FLAGS", "XCPKG_NATIVE_CCFLAGS", "XCPKG_NATIVE_LDFLAGS", "CFLAGS", "CXXFLAGS", "CPPFLAGS", "LDFLAGS" };
+
+    for (int i = 0; i < 7; i++) {
+        ret = text_append_a_line(text, capacity, &length, envNames[i], getenv(envNames[i]), fromArray, toArray, 2U);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    return XCPKG_OK;
+}
+
+// the key of a native package is the sha256sum of this text, every line is a 'name: value' pair.
+// it covers everything that might change the installed files: the source, the build args, the keys of its dependencies and the toolchain of the building machine.
+static int generate_cache_key_text(NativePackageNode nodes[], const int packageID, const SysInfo * sysinfo, const char * toolchainKeyText) {
+    NativePackageNode * node = &nodes[packageID];
+
+    if (node->cacheKey[0] != '\0') {
+        return XCPKG_OK;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        int depPackageID = node->package.depPackageIDArray[i];
+
+        if (depPackageID == 0) {
+            break;
+        }
+
+        int ret = generate_cache_key_text(nodes, depPackageID, sysinfo, toolchainKeyText);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    char * p = node->cacheKeyText;
+
+    size_t capacity = NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY;
+
+    size_t length = 0U;
+
+    int ret = text_append(p, capacity, &length, "cache-version: %d\nsrc-sha: %s\nbuild-system: %d\nbuild-args: %s\n", NATIVE_PACKAGE_CACHE_VERSION, node->package.srcSha, node->package.buildSystem, node->package.buildArgs == NULL ? "" : node->package.buildArgs);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        int depPackageID = node->package.depPackageIDArray[i];
+
+        if (depPackageID == 0) {
+            break;
+        }
+
+        ret = text_append(p, capacity, &length, "dep-%s: %s\n", nodes[depPackageID].package.name, nodes[depPackageID].cacheKey);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    ret = text_append(p, capacity, &length, "os-arch: %s\nos-vers: %s\n%s", sysinfo->arch, sysinfo->vers, toolchainKeyText);
+
+    if (ret != XCPKG_OK) {
+        fprintf(stderr, "the cache key text of native package '%s' is too long.\n", node->package.name);
+        return ret;
+    }
+
+    return sha256sum_of_string(node->cacheKey, node->cacheKeyText);
+}
+
+// read a small text file into buf, which is always NUL terminated
+static int read_a_small_file(const char * filePath, char buf[], const size_t bufSize) {
+    int fd = open(filePath, O_RDONLY);
+
+    if (fd == -1) {
+        perror(filePath);
+        return XCPKG_ERROR;
+    }
+
+    size_t length = 0U;
+
+    while (length < bufSize - 1U) {
+        ssize_t n = read(fd, buf + length, bufSize - 1U - length);
+
+        if (n == -1) {
+            perror(filePath);
+            close(fd);
+            return XCPKG_ERROR;
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        length += (size_t)n;
+    }
+
+    close(fd);
+
+    buf[length] = '\0';
+
+    return XCPKG_OK;
+}
+
+// the value of the line 'name: value' in text, NULL is returned if there is no such line
+static const char * find_the_value_in_text(const char * text, const char * name, size_t * valueLength) {
+    size_t nameLength = strlen(name);
+
+    for (const char * p = text; p != NULL && p[0] != '\0'; ) {
+        const char * lineEnd = strchr(p, '\n');
+
+        if (strncmp(p, name, nameLength) == 0 && p[nameLength] == ':' && p[nameLength + 1] == ' ') {
+            const char * value = p + nameLength + 2;
+
+            *valueLength = lineEnd == NULL ? strlen(value) : (size_t)(lineEnd - value);
+
+            return value;
+        }
+
+        p = lineEnd == NULL ? NULL : lineEnd + 1;
+    }
+
+    return NULL;
+}
+
+// tell why the installed one can not be reused
+static void explain_the_cache_key_mismatch(const NativePackageNode * node, const char * receiptText) {
+    fprintf(stderr, "native package '%s' is to be rebuilt, because its cache key changed:\n", node->package.name);
+
+    if (strncmp(receiptText, "cache-version: ", 15) != 0 && strstr(receiptText, "\ncache-version: ") == NULL) {
+        fprintf(stderr, "    the installed one was not recorded with a cache key.\n");
+        return;
+    }
+
+    for (const char * p = node->cacheKeyText; p[0] != '\0'; ) {
+        const char * lineEnd = strchr(p, '\n');
+
+        const char * colon = strchr(p, ':');
+
+        if (lineEnd == NULL || colon == NULL || colon > lineEnd) {
+            break;
+        }
+
+        size_t nameLength = colon - p;
+
+        char name[nameLength + 1U];
+
+        memcpy(name, p, nameLength);
+
+        name[nameLength] = '\0';
+
+        const char * newValue = colon + 2;
+        size_t newValueLength = lineEnd - newValue;
+
+        size_t oldValueLength = 0U;
+
+        const char * oldValue = find_the_value_in_text(receiptText, name, &oldValueLength);
+
+        if (oldValue == NULL) {
+            fprintf(stderr, "    %s: (none) => %.*s\n", name, (int)newValueLength, newValue);
+        } else if (oldValueLength != newValueLength || strncmp(oldValue, newValue, newValueLength) != 0) {
+            fprintf(stderr, "    %s: %.*s => %.*s\n", name, (int)oldValueLength, oldValue, (int)newValueLength, newValue);
+        }
+
+        p = lineEnd + 1;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the cached archives could be shared by several machines via NFS or the like
+static int get_the_cache_dir(const char * packageInstalledRootDIR, char cacheDIR[], const size_t cacheDIRCapacity) {
+    const char * const dir = getenv("XCPKG_NATIVE_PACKAGE_CACHE_DIR");
+
+    int ret;
+
+    if (dir == NULL || dir[0] == '\0') {
+        ret = snprintf(cacheDIR, cacheDIRCapacity, "%s/.cache", packageInstalledRootDIR);
+    } else {
+        ret = snprintf(cacheDIR, cacheDIRCapacity, "%s", dir);
+    }
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    if ((size_t)ret >= cacheDIRCapacity) {
+        fprintf(stderr, "the path of the native package cache directory is too long.\n");
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static bool is_a_mach_o_file(const char * data, const size_t dataSize) {
+    if (dataSize < 4U) {
+        return false;
+    }
+
+    uint32_t magic;
+
+    memcpy(&magic, data, 4);
+
+    return magic == 0xfeedface || magic == 0xfeedfacf || magic == 0xcefaedfe || magic == 0xcffaedfe || magic == 0xcafebabe || magic == 0xbebafeca;
+}
+
+// replace every oldPrefix with newPrefix in the given file, newPrefix has been padded with leading slashes to the same length as oldPrefix, so the offsets in binaries are kept.
+static int relocate_a_file(const char * filePath, const char * oldPrefix, const char * newPrefix, const size_t prefixLength) {
+    int fd = open(filePath, O_RDWR);
+
+    if (fd == -1) {
+        perror(filePath);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        perror(filePath);
+        close(fd);
+        return XCPKG_ERROR;
+    }
+
+    size_t dataSize = (size_t)st.st_size;
+
+    if (dataSize < prefixLength) {
+        close(fd);
+        return XCPKG_OK;
+    }
+
+    char * data = (char*)malloc(dataSize);
+
+    if (data == NULL) {
+        close(fd);
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    for (size_t n = 0U; n < dataSize; ) {
+        ssize_t readSize = pread(fd, data + n, dataSize - n, (off_t)n);
+
+        if (readSize <= 0) {
+            perror(filePath);
+            free(data);
+            close(fd);
+            return XCPKG_ERROR;
+        }
+
+        n += (size_t)readSize;
+    }
+
+    bool changed = false;
+
+    for (char * p = data; ; ) {
+        p = (char*)memmem(p, dataSize - (p - data), oldPrefix, prefixLength);
+
+        if (p == NULL) {
+            break;
+        }
+
+        memcpy(p, newPrefix, prefixLength);
+
+        if (pwrite(fd, newPrefix, prefixLength, (off_t)(p - data)) != (ssize_t)prefixLength) {
+            perror(filePath);
+            free(data);
+            close(fd);
+            return XCPKG_ERROR;
+        }
+
+        changed = true;
+
+        p += prefixLength;
+    }
+
+    bool isMachO = changed && is_a_mach_o_file(data, dataSize);
+
+    free(data);
+    close(fd);
+
+#if defined (__APPLE__)
+    // the code signature of a modified Mach-O file is invalid, such a file would be killed on arm64
+    if (isMachO) {
+        return xcpkg_posix_spawn2(5, "codesign", "--force", "--sign", "-", filePath);
+    }
+#else
+    (void)isMachO;
+#endif
+
+    return XCPKG_OK;
+}
+
+static int relocate_a_dir(const char * dirPath, const char * oldPrefix, const char * newPrefix, const size_t prefixLength) {
+    DIR * dir = opendir(dirPath);
+
+    if (dir == NULL) {
+        perror(dirPath);
+        return XCPKG_ERROR;
+    }
+
+    size_t dirPathLength = strlen(dirPath);
+
+    for (;;) {
+        errno = 0;
+
+        struct dirent * dir_entry = readdir(dir);
+
+        if (dir_entry == NULL) {
+            if (errno == 0) {
+                closedir(dir);
+                return XCPKG_OK;
+            } else {
+                perror(dirPath);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+
+        if ((strcmp(dir_entry->d_name, ".") == 0) || (strcmp(dir_entry->d_name, "..") == 0)) {
+            continue;
+        }
+
+        size_t filePathCapacity = dirPathLength + strlen(dir_entry->d_name) + 2U;
+        char   filePath[filePathCapacity];
+
+        int ret = snprintf(filePath, filePathCapacity, "%s/%s", dirPath, dir_entry->d_name);
+
+        if (ret < 0) {
+            perror(NULL);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        struct stat st;
+
+        if (lstat(filePath, &st) != 0) {
+            perror(filePath);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            ret = relocate_a_dir(filePath, oldPrefix, newPrefix, prefixLength);
+        } else if (S_ISREG(st.st_mode)) {
+            ret = relocate_a_file(filePath, oldPrefix, newPrefix, prefixLength);
+        } else if (S_ISLNK(st.st_mode)) {
+            char target[PATH_MAX];
+
+            ssize_t n = readlink(filePath, target, PATH_MAX - 1);
+
+            if (n == -1) {
+                perror(filePath);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+
+            target[n] = '\0';
+
+            ret = XCPKG_OK;
+
+            if (strncmp(target, oldPrefix, prefixLength) == 0) {
+                char newTarget[PATH_MAX];
+
+                ret = snprintf(newTarget, PATH_MAX, "%s%s", newPrefix, target + prefixLength);
+
+                if (ret < 0) {
+                    perror(NULL);
+                    closedir(dir);
+                    return XCPKG_ERROR;
+                }
+
+                if (unlink(filePath) != 0 || symlink(newTarget, filePath) != 0) {
+                    perror(filePath);
+                    closedir(dir);
+                    return XCPKG_ERROR;
+                }
+
+                ret = XCPKG_OK;
+            }
+        } else {
+            ret = XCPKG_OK;
+        }
+
+        if (ret != XCPKG_OK) {
+            closedir(dir);
+            return ret;
+        }
+    }
+}
+
+static int write_the_receipt(const NativePackageNode * node, const char * packageInstalledDIR) {
+    size_t receiptFilePathCapacity = strlen(packageInstalledDIR) + 13U;
+    char   receiptFilePath[receiptFilePathCapacity];
+
+    int ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/receipt.txt", packageInstalledDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    size_t receiptCapacity = NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY + strlen(packageInstalledDIR) + 80U;
+    char   receipt[receiptCapacity];
+
+    // the first 64 bytes are the cache key, the installed prefix is recorded for relocating
+    ret = snprintf(receipt, receiptCapacity, "%s\n%sprefix: %s\n", node->cacheKey, node->cacheKeyText, packageInstalledDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return xcpkg_write_file(receiptFilePath, receipt, (size_t)ret);
+}
+
+// an archive can be restored only if the path it was installed to is not shorter than the path it is being restored to
+static int restore_from_the_cache(const NativePackageNode * node, const char * archiveFilePath, const char * packageInstalledDIR, const bool verbose) {
+    int ret = tar_extract(packageInstalledDIR, archiveFilePath, ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM, verbose, 1);
+
+    if (ret != 0) {
+        return abs(ret) + XCPKG_ERROR_ARCHIVE_BASE;
+    }
+
+    size_t receiptFilePathCapacity = strlen(packageInstalledDIR) + 13U;
+    char   receiptFilePath[receiptFilePathCapacity];
+
+    ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/receipt.txt", packageInstalledDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    char receiptText[NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY + PATH_MAX + 80U];
+
+    ret = read_a_small_file(receiptFilePath, receiptText, sizeof(receiptText));
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (strncmp(receiptText, node->cacheKey, 64) != 0) {
+        fprintf(stderr, "%s is not for the cache key %s\n", archiveFilePath, node->cacheKey);
+        return XCPKG_ERROR;
+    }
+
+    size_t oldPrefixLength = 0U;
+
+    const char * oldPrefix = find_the_value_in_text(receiptText, "prefix", &oldPrefixLength);
+
+    if (oldPrefix == NULL || oldPrefixLength >= PATH_MAX) {
+        fprintf(stderr, "no prefix was recorded in %s\n", receiptFilePath);
+        return XCPKG_ERROR;
+    }
+
+    size_t newPrefixLength = strlen(packageInstalledDIR);
+
+    if (oldPrefixLength != newPrefixLength || strncmp(oldPrefix, packageInstalledDIR, oldPrefixLength) != 0) {
+        if (newPrefixLength > oldPrefixLength) {
+            fprintf(stderr, "%s was installed to %.*s, it can not be relocated to a longer path %s\n", archiveFilePath, (int)oldPrefixLength, oldPrefix, packageInstalledDIR);
+            return XCPKG_ERROR;
+        }
+
+        char oldPrefixCopy[PATH_MAX];
+
+        memcpy(oldPrefixCopy, oldPrefix, oldPrefixLength);
+
+        oldPrefixCopy[oldPrefixLength] = '\0';
+
+        // a//b is the same as a/b
+        char paddedNewPrefix[PATH_MAX];
+
+        memset(paddedNewPrefix, '/', oldPrefixLength - newPrefixLength);
+        memcpy(paddedNewPrefix + oldPrefixLength - newPrefixLength, packageInstalledDIR, newPrefixLength + 1U);
+
+        ret = relocate_a_dir(packageInstalledDIR, oldPrefixCopy, paddedNewPrefix, oldPrefixLength);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    return write_the_receipt(node, packageInstalledDIR);
+}
+
+static int store_into_the_cache(const NativePackageNode * node, const char * cacheDIR, const char * archiveFilePath, const char * packageInstalledRootDIR) {
+    int ret = xcpkg_mkdir_p(cacheDIR, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    // the same pid might be running on the other machines which share this cache directory
+    char hostname[256];
+
+    if (gethostname(hostname, 256) != 0) {
+        perror("gethostname");
+        return XCPKG_ERROR;
+    }
+
+    hostname[255] = '\0';
+
+    size_t tmpFilePathCapacity = strlen(archiveFilePath) + strlen(hostname) + 30U;
+    char   tmpFilePath[tmpFilePathCapacity];
+
+    ret = snprintf(tmpFilePath, tmpFilePathCapacity, "%s.%s.%d.tmp", archiveFilePath, hostname, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    if (chdir(packageInstalledRootDIR) != 0) {
+        perror(packageInstalledRootDIR);
+        return XCPKG_ERROR;
+    }
+
+    ret = tar_create(node->cacheKey, tmpFilePath, ArchiveType_tar_xz, false);
+
+    if (ret != 0) {
+        unlink(tmpFilePath);
+        return abs(ret) + XCPKG_ERROR_ARCHIVE_BASE;
+    }
+
+    // other machines sharing this cache directory never see a partial archive
+    if (rename(tmpFilePath, archiveFilePath) != 0) {
+        perror(archiveFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+// run in a child process
+static int install_the_native_package(
+        const int packageID,
+        const NativePackageNode * node,
+        const char * downloadsDIR,
+        const size_t downloadsDIRLength,
+        const char * sessionDIR,
+        const size_t sessionDIRCapacity,
+        const char * packageInstalledRootDIR,
+        const size_t packageInstalledRootDIRCapacity,
+        const size_t njobs,
+        const XCPKGInstallOptions * installOptions) {
+    const char * packageName = node->package.name;
+
+    const bool verbose = installOptions->logLevel >= XCPKGLogLevel_verbose;
+
+    // the same cache key is always installed to the same path, so the restored ones need not be relocated on the same machine
+    size_t packageInstalledDIRCapacity = packageInstalledRootDIRCapacity + 66U;
+    char   packageInstalledDIR[packageInstalledDIRCapacity];
+
+    int ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, node->cacheKey);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (lstat(packageInstalledDIR, &st) == 0) {
+        ret = xcpkg_rm_rf(packageInstalledDIR, false, verbose);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    char cacheDIR[PATH_MAX];
+
+    ret = get_the_cache_dir(packageInstalledRootDIR, cacheDIR, PATH_MAX);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    size_t archiveFilePathCapacity = strlen(cacheDIR) + strlen(packageName) + 74U;
+    char   archiveFilePath[archiveFilePathCapacity];
+
+    ret = snprintf(archiveFilePath, archiveFilePathCapacity, "%s/%s-%s.tar.xz", cacheDIR, packageName, node->cacheKey);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    bool restored = false;
+
+    if (stat(archiveFilePath, &st) == 0 && S_ISREG(st.st_mode)) {
+        fprintf(stderr, "native package '%s' is being restored from %s\n", packageName, archiveFilePath);
+
+        ret = restore_from_the_cache(node, archiveFilePath, packageInstalledDIR, verbose);
+
+        if (ret == XCPKG_OK) {
+            restored = true;
+        } else {
+            fprintf(stderr, "failed to restore native package '%s' from the cache, it is to be built.\n", packageName);
+
+            if (lstat(packageInstalledDIR, &st) == 0) {
+                ret = xcpkg_rm_rf(packageInstalledDIR, false, verbose);
+
+                if (ret != XCPKG_OK) {
+                    return ret;
+                }
+            }
+        }
+    }
+
+    if (!restored) {
+        ret = build_native_package(packageID, &node->package, downloadsDIR, downloadsDIRLength, sessionDIR, sessionDIRCapacity, packageInstalledRootDIR, packageInstalledRootDIRCapacity, packageInstalledDIR, packageInstalledDIRCapacity, njobs, installOptions);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        ret = write_the_receipt(node, packageInstalledDIR);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        // a failure of caching does not fail the installation
+        if (store_into_the_cache(node, cacheDIR, archiveFilePath, packageInstalledRootDIR) != XCPKG_OK) {
+            fprintf(stderr, "failed to store native package '%s' into %s\n", packageName, cacheDIR);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t packageInstalledLinkPathCapacity = packageInstalledRootDIRCapacity + strlen(packageName) + 1U;
+    char   packageInstalledLinkPath[packageInstalledLinkPathCapacity];
+
+    ret = snprintf(packageInstalledLinkPath, packageInstalledLinkPathCapacity, "%s/%s", packageInstalledRootDIR, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    // the tree installed for a former cache key is superseded by this one
+    char oldCacheKey[66]; oldCacheKey[0] = '\0';
+
+    ssize_t oldCacheKeyLength = readlink(packageInstalledLinkPath, oldCacheKey, 65);
+
+    if (oldCacheKeyLength == 64) {
+        oldCacheKey[64] = '\0';
+    } else {
+        oldCacheKey[0] = '\0';
+    }
+
+    for (;;) {
+        if (symlink(node->cacheKey, packageInstalledLinkPath) == 0) {
+            fprintf(stderr, "native package '%s' was successfully installed.\n", packageName);
+
+            if (oldCacheKey[0] != '\0' && strcmp(oldCacheKey, node->cacheKey) != 0 && strchr(oldCacheKey, '/') == NULL) {
+                ret = snprintf(packageInstalledDIR, packageInstalledDIRCapacity, "%s/%s", packageInstalledRootDIR, oldCacheKey);
+
+                // a failure of removing it does not fail the installation
+                if (ret > 0 && lstat(packageInstalledDIR, &st) == 0 && xcpkg_rm_rf(packageInstalledDIR, false, verbose) != XCPKG_OK) {
+                    fprintf(stderr, "failed to remove the superseded %s\n", packageInstalledDIR);
+                }
+            }
+
+            return XCPKG_OK;
+        } else {
+            if (errno == EEXIST) {
+                if (lstat(packageInstalledLinkPath, &st) == 0) {
+                    if (S_ISDIR(st.st_mode)) {
+                        ret = xcpkg_rm_rf(packageInstalledLinkPath, false, verbose);
+
+                        if (ret != XCPKG_OK) {
+                            return ret;
+                        }
+                    } else {
+                        if (unlink(packageInstalledLinkPath) != 0) {
+                            perror(packageInstalledLinkPath);
+                            return XCPKG_ERROR;
+                        }
+                    }
+                }
+            } else {
+                perror(packageInstalledLinkPath);
+                return XCPKG_ERROR;
+            }
+        }
+    }
+}
+
+static int check_if_the_given_native_package_is_installed(const NativePackageNode * node, const char * packageInstalledRootDIR, const size_t packageInstalledRootDIRCapacity) {
+    size_t receiptFilePathLength = packageInstalledRootDIRCapacity + strlen(node->package.name) + 14U;
+    char   receiptFilePath[receiptFilePathLength];
+
+    int ret = snprintf(receiptFilePath, receiptFilePathLength, "%s/%s/receipt.txt", packageInstalledRootDIR, node->package.name);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (stat(receiptFilePath, &st) != 0) {
+        return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        fprintf(stderr, "%s was expected to be a regular file, but it was not.\n", receiptFilePath);
+        return XCPKG_ERROR;
+    }
+
+    char receiptText[NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY + PATH_MAX + 80U];
+
+    ret = read_a_small_file(receiptFilePath, receiptText, sizeof(receiptText));
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (strncmp(receiptText, node->cacheKey, 64) == 0) {
+        return XCPKG_OK;
+    }
+
+    explain_the_cache_key_mismatch(node, receiptText);
+
+    return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+}
+
+// run in a child process, one install per native package at a time
+static int install_the_native_package_exclusively(
+        const int packageID,
+        const NativePackageNode * node,
+        const char * downloadsDIR,
+        const size_t downloadsDIRLength,
+        const char * sessionDIR,
+        const size_t sessionDIRCapacity,
+        const char * packageInstalledRootDIR,
+        const size_t packageInstalledRootDIRCapacity,
+        const size_t njobs,
+        const XCPKGInstallOptions * installOptions) {
+    const char * packageName = node->package.name;
+
+    size_t lockNameCapacity = strlen(packageName) + 8U;
+    char   lockName[lockNameCapacity];
+
+    int ret = snprintf(lockName, lockNameCapacity, "native-%s", packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    size_t whatCapacity = strlen(packageName) + 18U;
+    char   what[whatCapacity];
+
+    ret = snprintf(what, whatCapacity, "native package %s", packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    int  lockFD;
+    bool waited;
+
+    ret = xcpkg_lock_named(lockName, what, &lockFD, &waited);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (waited && check_if_the_given_native_package_is_installed(node, packageInstalledRootDIR, packageInstalledRootDIRCapacity) == XCPKG_OK) {
+        fprintf(stderr, "native package %s was installed by another xcpkg process.\n", packageName);
+    } else {
+        ret = install_the_native_package(packageID, node, downloadsDIR, downloadsDIRLength, sessionDIR, sessionDIRCapacity, packageInstalledRootDIR, packageInstalledRootDIRCapacity, njobs, installOptions);
+    }
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
+static void print_the_build_log(const char * logFilePath) {
+    int fd = open(logFilePath, O_RDONLY);
+
+    if (fd == -1) {
+        perror(logFilePath);
+        return;
+    }
+
+    char buf[4096];
+
+    for (;;) {
+        ssize_t n = read(fd, buf, 4096);
+
+        if (n <= 0) {
+            break;
+        }
+
+        fwrite(buf, 1, n, stderr);
+    }
+
+    close(fd);
+}
+
+int install_native_packages(
+        const int packageIDArray[],
+        const size_t packageIDArraySize,
+        const char * downloadsDIR,
+        const size_t downloadsDIRLength,
+        const char * sessionDIR,
+        const size_t sessionDIRCapacity,
+        const char * packageInstalledRootDIR,
+        const size_t packageInstalledRootDIRCapacity,
+        const size_t njobs,
+        const XCPKGInstallOptions * installOptions,
+        const NativePackageInstalledCallback callback) {
+    NativePackageNode nodes[NATIVE_PACKAGE_ID_MAX + 1] = {0};
+
+    int ret;
+
+    for (size_t i = 0U; i < packageIDArraySize; i++) {
+        ret = add_native_package_node(nodes, packageIDArray[i]);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    SysInfo sysinfo = {0};
+
+    if (sysinfo_make(&sysinfo) != 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    char toolchainKeyText[NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY];
+
+    ret = generate_the_toolchain_key_text(toolchainKeyText, NATIVE_PACKAGE_CACHE_KEY_TEXT_CAPACITY);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    for (int id = 1; id <= NATIVE_PACKAGE_ID_MAX; id++) {
+        if (nodes[id].state == NATIVE_PACKAGE_STATE_PENDING) {
+            ret = generate_cache_key_text(nodes, id, &sysinfo, toolchainKeyText);
+
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t pendingCount = 0U;
+
+    for (int id = 1; id <= NATIVE_PACKAGE_ID_MAX; id++) {
+        NativePackageNode * node = &nodes[id];
+
+        if (node->state != NATIVE_PACKAGE_STATE_PENDING) {
+            continue;
+        }
+
+        ret = check_if_the_given_native_package_is_installed(node, packageInstalledRootDIR, packageInstalledRootDIRCapacity);
+
+        if (ret == XCPKG_OK) {
+            fprintf(stderr, "native package '%s' already has been installed.\n", node->package.name);
+
+            ret = native_package_installed(&node->package, packageInstalledRootDIR, packageInstalledRootDIRCapacity, callback);
+
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
+
+            node->state = NATIVE_PACKAGE_STATE_DONE;
+        } else if (ret == XCPKG_ERROR_PACKAGE_NOT_INSTALLED) {
+            pendingCount++;
+        } else {
+            return ret;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    // every package is built in a child process, because a build changes the current working directory and the environment variables.
+    // the outputs of concurrent builds are written to their own log files, otherwise they would be interleaved.
+    const bool logToFile = pendingCount > 1U && njobs > 1U;
+
+    // the job budget is shared by the concurrent builds, a build takes its part when it starts and gives back when it finishes
+    size_t freeJobs = njobs == 0U ? 1U : njobs;
+
+    size_t buildingCount = 0U;
+
+    ret = XCPKG_OK;
+
+    for (;;) {
+        if (ret == XCPKG_OK) {
+            int readyIDArray[NATIVE_PACKAGE_ID_MAX];
+            size_t readyCount = 0U;
+
+            for (int id = 1; id <= NATIVE_PACKAGE_ID_MAX; id++) {
+                if (nodes[id].state != NATIVE_PACKAGE_STATE_PENDING) {
+                    continue;
+                }
+
+                bool ready = true;
+
+                for (int i = 0; i < 10; i++) {
+                    int depID = nodes[id].package.depPackageIDArray[i];
+
+                    if (depID == 0) {
+                        break;
+                    }
+
+                    if (nodes[depID].state != NATIVE_PACKAGE_STATE_DONE) {
+                        ready = false;
+                        break;
+                    }
+                }
+
+                if (ready) {
+                    readyIDArray[readyCount++] = id;
+                }
+            }
+
+            size_t startCount = readyCount < freeJobs ? readyCount : freeJobs;
+
+            for (size_t i = 0U; i < startCount; i++) {
+                NativePackageNode * node = &nodes[readyIDArray[i]];
+
+                node->njobs = freeJobs / (startCount - i);
+
+                size_t logFilePathCapacity = sessionDIRCapacity + strlen(node->package.name) + 18U;
+                char   logFilePath[logFilePathCapacity];
+
+                int n = snprintf(logFilePath, logFilePathCapacity, "%s/native-build-%s.log", sessionDIR, node->package.name);
+
+                if (n < 0) {
+                    perror(NULL);
+                    ret = XCPKG_ERROR;
+                    break;
+                }
+
+                if (logToFile) {
+                    fprintf(stderr, "native package '%s' is being built with %zu jobs, log: %s\n", node->package.name, node->njobs, logFilePath);
+                }
+
+                fflush(stdout);
+                fflush(stderr);
+
+                pid_t pid = fork();
+
+                if (pid == -1) {
+                    perror(NULL);
+                    ret = XCPKG_ERROR;
+                    break;
+                }
+
+                if (pid == 0) {
+                    if (logToFile) {
+                        int fd = open(logFilePath, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+
+                        if (fd == -1) {
+                            perror(logFilePath);
+                            _exit(XCPKG_ERROR);
+                        }
+
+                        if (dup2(fd, STDOUT_FILENO) == -1 || dup2(fd, STDERR_FILENO) == -1) {
+                            perror(logFilePath);
+                            _exit(XCPKG_ERROR);
+                        }
+
+                        close(fd);
+                    }
+
+                    int r = install_the_native_package_exclusively(readyIDArray[i], node, downloadsDIR, downloadsDIRLength, sessionDIR, sessionDIRCapacity, packageInstalledRootDIR, packageInstalledRootDIRCapacity, node->njobs, installOptions);
+
+                    fflush(stdout);
+                    fflush(stderr);
+
+                    _exit(r);
+                }
+
+                node->pid = pid;
+                node->state = NATIVE_PACKAGE_STATE_BUILDING;
+
+                freeJobs -= node->njobs;
+
+                buildingCount++;
+            }
+        }
+
+        if (buildingCount == 0U) {
+            break;
+        }
+
+        //////////////////////////////////////////////////////////////////////////////
+
+        int status;
+
+        pid_t pid = waitpid(-1, &status, 0);
+
+        if (pid == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        NativePackageNode * node = NULL;
+
+        for (int id = 1; id <= NATIVE_PACKAGE_ID_MAX; id++) {
+            if (nodes[id].state == NATIVE_PACKAGE_STATE_BUILDING && nodes[id].pid == pid) {
+                node = &nodes[id];
+                break;
+            }
+        }
+
+        if (node == NULL) {
+            continue;
+        }
+
+        node->state = NATIVE_PACKAGE_STATE_DONE;
+
+        freeJobs += node->njobs;
+
+        buildingCount--;
+
+        int r;
+
+        if (WIFEXITED(status)) {
+            r = WEXITSTATUS(status);
+        } else {
+            fprintf(stderr, "building native package '%s' was killed by signal: %d\n", node->package.name, WTERMSIG(status));
+            r = XCPKG_ERROR;
+        }
+
+        if (logToFile && (r != XCPKG_OK || installOptions->logLevel >= XCPKGLogLevel_verbose)) {
+            size_t logFilePathCapacity = sessionDIRCapacity + strlen(node->package.name) + 18U;
+            char   logFilePath[logFilePathCapacity];
+
+            int n = snprintf(logFilePath, logFilePathCapacity, "%s/native-build-%s.log", sessionDIR, node->package.name);
+
+            if (n > 0) {
+                print_the_build_log(logFilePath);
+            }
+        }
+
+        if (r == XCPKG_OK) {
+            if (logToFile) {
+                fprintf(stderr, "native package '%s' was successfully installed.\n", node->package.name);
+            }
+
+            // the packages depend on this package are built after this, so they inherit the environment variables set by this callback
+            r = native_package_installed(&node->package, packageInstalledRootDIR, packageInstalledRootDIRCapacity, callback);
+        } else {
+            fprintf(stderr, "failed to install native package '%s'.\n", node->package.name);
+        }
+
+        // no more builds are started, but the running ones are waited for
+        if (r != XCPKG_OK && ret == XCPKG_OK) {
+            ret = r;
+        }
+    }
+
+    return ret;
 }
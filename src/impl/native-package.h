@@ -25,6 +25,8 @@
 #define NATIVE_PACKAGE_ID_AUTOCONF_ARCHIVE    14
 #define NATIVE_PACKAGE_ID_NETSURF_BUILDSYSTEM 15
 
+#define NATIVE_PACKAGE_ID_MAX 15
+
 typedef struct {
     const char * name;
 
@@ -41,8 +43,15 @@ typedef struct {
 
 typedef int (*NativePackageInstalledCallback)(const char * packageInstalledDIR, const size_t packageInstalledDIRCapacity);
 
-int install_native_package(
-        const int packageID,
+/** install the given native packages and their dependencies.
+ *
+ *  every package is built in its own process, the packages whose dependencies have been installed are built concurrently, they share the given njobs.
+ *
+ *  callback is called in this process once a package is installed, in the order they are installed.
+ */
+int install_native_packages(
+        const int packageIDArray[],
+        const size_t packageIDArraySize,
 
         const char * downloadsDIR,
         const size_t downloadsDIRLength,
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <limits.h>
+#include <sys/stat.h>
+
+#include "outdated.h"
+
+static int xcpkg_formula_repo_scan_callback(XCPKGFormulaRepo * formulaRepo, const void * p1 __attribute__((unused)), void * p2) {
+    XCPKGFormulaRepoPathList * list = (XCPKGFormulaRepoPathList*)p2;
+
+    if (list->pathArraySize == list->pathArrayCapacity) {
+        size_t newCapacity = list->pathArrayCapacity + 8U;
+
+        char * * p = (char**)realloc(list->pathArray, newCapacity * sizeof(char*));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        list->pathArray = p;
+        list->pathArrayCapacity = newCapacity;
+    }
+
+    char * path = strdup(formulaRepo->path);
+
+    if (path == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    list->pathArray[list->pathArraySize] = path;
+    list->pathArraySize++;
+
+    return XCPKG_OK;
+}
+
+int xcpkg_formula_repo_path_list_load(XCPKGFormulaRepoPathList * list) {
+    int ret = xcpkg_formula_repo_scan(xcpkg_formula_repo_scan_callback, NULL, list);
+
+    if (ret != XCPKG_OK) {
+        xcpkg_formula_repo_path_list_free(list);
+    }
+
+    return ret;
+}
+
+void xcpkg_formula_repo_path_list_free(XCPKGFormulaRepoPathList * list) {
+    for (size_t i = 0U; i < list->pathArraySize; i++) {
+        free(list->pathArray[i]);
+    }
+
+    free(list->pathArray);
+
+    list->pathArray = NULL;
+    list->pathArraySize = 0U;
+    list->pathArrayCapacity = 0U;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int xcpkg_outdated_package_check_(const XCPKGFormulaRepoPathList * list, XCPKGOutdatedPackage * package) {
+    const char * packageName = package->packageName;
+    const char * targetPlatformSpec = package->targetPlatformSpec;
+
+    char targetPlatformName[51];
+
+    for (int i = 0; ; i++) {
+        if (i == 50 || targetPlatformSpec[i] == '\0') {
+            return XCPKG_ERROR_ARG_IS_INVALID;
+        }
+
+        if (targetPlatformSpec[i] == '-') {
+            targetPlatformName[i] = '\0';
+            break;
+        }
+
+        targetPlatformName[i] = targetPlatformSpec[i];
+    }
+
+    int ret;
+
+    if (package->installedVersion == NULL) {
+        XCPKGInstalledDB db;
+
+        ret = xcpkg_installed_db_load(&db);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        const XCPKGInstalledPackage * installedPackage = xcpkg_installed_db_find(&db, packageName, targetPlatformSpec);
+
+        if (installedPackage == NULL) {
+            xcpkg_installed_db_free(&db);
+            return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+        }
+
+        package->installedVersion = strdup(installedPackage->version);
+
+        xcpkg_installed_db_free(&db);
+
+        if (package->installedVersion == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+    }
+
+    char formulaFilePath[PATH_MAX];
+
+    formulaFilePath[0] = '\0';
+
+    for (size_t i = 0U; i < list->pathArraySize; i++) {
+        ret = snprintf(formulaFilePath, PATH_MAX, "%s/formula/%s.yml", list->pathArray[i], packageName);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        struct stat st;
+
+        if (stat(formulaFilePath, &st) == 0 && S_ISREG(st.st_mode)) {
+            break;
+        }
+
+        formulaFilePath[0] = '\0';
+    }
+
+    if (formulaFilePath[0] == '\0') {
+        return XCPKG_ERROR_PACKAGE_NOT_AVAILABLE;
+    }
+
+    XCPKGFormula * formula = NULL;
+
+    ret = xcpkg_formula_load(packageName, targetPlatformName, formulaFilePath, &formula);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    if (package->installedVersion[0] == '\0' || formula->version == NULL || strcmp(package->installedVersion, formula->version) == 0) {
+        ret = XCPKG_ERROR_PACKAGE_NOT_OUTDATED;
+    } else {
+        package->availableVersion = strdup(formula->version);
+
+        if (package->availableVersion == NULL) {
+            ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+    }
+
+    xcpkg_formula_free(formula);
+
+    return ret;
+}
+
+int xcpkg_outdated_package_check(const XCPKGFormulaRepoPathList * list, XCPKGOutdatedPackage * package) {
+    package->ret = xcpkg_outdated_package_check_(list, package);
+    return package->ret;
+}
+
+void xcpkg_outdated_package_free(XCPKGOutdatedPackage * package) {
+    free(package->packageName);
+    free(package->targetPlatformSpec);
+    free(package->installedVersion);
+    free(package->availableVersion);
+
+    memset(package, 0, sizeof(XCPKGOutdatedPackage));
+}
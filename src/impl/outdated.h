@@ -0,0 +1,44 @@
+#ifndef _OUTDATED_H
+#define _OUTDATED_H
+
+#include <stdlib.h>
+
+#include "../xcpkg.h"
+
+/**
+ *  the paths of all the formula repositories, in the order xcpkg_formula_repo_scan() visits them.
+ *
+ *  looking a formula up in this list costs one stat() per repository, while xcpkg_formula_path() parses every repository config each time.
+ */
+typedef struct {
+    char * * pathArray;
+    size_t   pathArraySize;
+    size_t   pathArrayCapacity;
+} XCPKGFormulaRepoPathList;
+
+int  xcpkg_formula_repo_path_list_load(XCPKGFormulaRepoPathList * list);
+void xcpkg_formula_repo_path_list_free(XCPKGFormulaRepoPathList * list);
+
+typedef struct {
+    char * packageName;
+    char * targetPlatformSpec;
+
+    // the caller might set it from the installed-package database, otherwise it is looked up there
+    char * installedVersion;
+
+    // only set when this package is outdated
+    char * availableVersion;
+
+    // XCPKG_OK means outdated, XCPKG_ERROR_PACKAGE_NOT_OUTDATED means up to date, otherwise it is an error code
+    int    ret;
+} XCPKGOutdatedPackage;
+
+/** check if the given installed package is outdated, the result is stored into package->ret and returned.
+ *
+ *  it is safe to call this function concurrently on different packages sharing the same list.
+ */
+int  xcpkg_outdated_package_check(const XCPKGFormulaRepoPathList * list, XCPKGOutdatedPackage * package);
+
+void xcpkg_outdated_package_free(XCPKGOutdatedPackage * package);
+
+#endif
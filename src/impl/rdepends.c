@@ -0,0 +1,761 @@
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#include "../xcpkg.h"
+
+#include "search-index.h"
+
+#include "../core/string-map.h"
+
+// the reverse dependency index is a text file, every line is: <DEPENDENCY> <DEPENDENT>...
+//
+// for the available packages, the names are package names.
+// for the installed packages, the names are <TARGET-PLATFORM-SPEC>/<PACKAGE-NAME>
+//
+// it is loaded into a Graph, every edge is from a dependency to its dependent.
+
+typedef struct {
+    size_t * dependentIndexArray;
+    size_t   dependentIndexArraySize;
+    size_t   dependentIndexArrayCapacity;
+} DependentList;
+
+typedef struct {
+    // nameMap.entryArray[i].key is the name of the node i
+    StringMap nameMap;
+
+    // adjacencyArray[i] is the dependents of the node i
+    DependentList * adjacencyArray;
+    size_t          adjacencyArrayCapacity;
+} Graph;
+
+static void graph_free(Graph * graph) {
+    for (size_t i = 0U; i < graph->nameMap.entryArraySize; i++) {
+        free(graph->adjacencyArray[i].dependentIndexArray);
+    }
+
+    free(graph->adjacencyArray);
+
+    string_map_free(&graph->nameMap);
+}
+
+static int graph_add_node(Graph * graph, const char * name, const size_t nameLength, size_t * index) {
+    // grown in advance, so that every name in nameMap always has its DependentList
+    if (graph->nameMap.entryArraySize == graph->adjacencyArrayCapacity) {
+        size_t newCapacity = graph->adjacencyArrayCapacity == 0U ? 64U : (graph->adjacencyArrayCapacity << 1);
+
+        DependentList * p = (DependentList*)realloc(graph->adjacencyArray, newCapacity * sizeof(DependentList));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        graph->adjacencyArray = p;
+        graph->adjacencyArrayCapacity = newCapacity;
+    }
+
+    bool added;
+
+    if (string_map_add(&graph->nameMap, name, nameLength, index, &added) != 0) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    if (added) {
+        memset(&graph->adjacencyArray[*index], 0, sizeof(DependentList));
+    }
+
+    return XCPKG_OK;
+}
+
+static int graph_add_edge(Graph * graph, const size_t depIndex, const size_t dependentIndex) {
+    DependentList * list = &graph->adjacencyArray[depIndex];
+
+    for (size_t i = 0U; i < list->dependentIndexArraySize; i++) {
+        if (list->dependentIndexArray[i] == dependentIndex) {
+            return XCPKG_OK;
+        }
+    }
+
+    if (list->dependentIndexArraySize == list->dependentIndexArrayCapacity) {
+        size_t newCapacity = list->dependentIndexArrayCapacity + 8U;
+
+        size_t * p = (size_t*)realloc(list->dependentIndexArray, newCapacity * sizeof(size_t));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        list->dependentIndexArray = p;
+        list->dependentIndexArrayCapacity = newCapacity;
+    }
+
+    list->dependentIndexArray[list->dependentIndexArraySize++] = dependentIndex;
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_rdepends_index_path(const bool installed, char buf[]) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, true);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = snprintf(buf, PATH_MAX, "%s/rdepends-%s.txt", xcpkgHomeDIR, installed ? "installed" : "available");
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_rdepends_index_load(const char * indexFilePath, Graph * graph) {
+    FILE * file = fopen(indexFilePath, "r");
+
+    if (file == NULL) {
+        if (errno == ENOENT) {
+            return XCPKG_ERROR_NOT_FOUND;
+        } else {
+            perror(indexFilePath);
+            return XCPKG_ERROR;
+        }
+    }
+
+    int ret = XCPKG_OK;
+
+    char * line = NULL;
+    size_t lineCapacity = 0U;
+
+    while (getline(&line, &lineCapacity, file) > 0) {
+        bool   first = true;
+        size_t depIndex = 0U;
+
+        for (char * p = line; ;) {
+            while (p[0] == ' ' || p[0] == '\n') p++;
+
+            if (p[0] == '\0') break;
+
+            size_t n = 0U;
+
+            while (p[n] != ' ' && p[n] != '\n' && p[n] != '\0') n++;
+
+            size_t index;
+
+            ret = graph_add_node(graph, p, n, &index);
+
+            if (ret != XCPKG_OK) {
+                goto finalize;
+            }
+
+            if (first) {
+                first = false;
+                depIndex = index;
+            } else {
+                ret = graph_add_edge(graph, depIndex, index);
+
+                if (ret != XCPKG_OK) {
+                    goto finalize;
+                }
+            }
+
+            p += n;
+        }
+    }
+
+    if (ferror(file)) {
+        perror(indexFilePath);
+        ret = XCPKG_ERROR;
+    }
+
+finalize:
+    free(line);
+    fclose(file);
+    return ret;
+}
+
+static int xcpkg_rdepends_index_write(const char * indexFilePath, const Graph * graph) {
+    char tmpFilePath[PATH_MAX];
+
+    int ret = snprintf(tmpFilePath, PATH_MAX, "%s.%d.tmp", indexFilePath, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * file = fopen(tmpFilePath, "w");
+
+    if (file == NULL) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    const StringMapEntry * nameArray = graph->nameMap.entryArray;
+
+    for (size_t i = 0U; i < graph->nameMap.entryArraySize; i++) {
+        const DependentList * list = &graph->adjacencyArray[i];
+
+        if (list->dependentIndexArraySize == 0U) {
+            continue;
+        }
+
+        fprintf(file, "%s", nameArray[i].key);
+
+        for (size_t j = 0U; j < list->dependentIndexArraySize; j++) {
+            fprintf(file, " %s", nameArray[list->dependentIndexArray[j]].key);
+        }
+
+        fprintf(file, "\n");
+    }
+
+    if (ferror(file)) {
+        perror(tmpFilePath);
+        fclose(file);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (fclose(file) != 0) {
+        perror(tmpFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (rename(tmpFilePath, indexFilePath) != 0) {
+        perror(indexFilePath);
+        unlink(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+// add the edges from every package in depPackageNames to packageName, every name is prefixed with prefix/ if prefix is not NULL
+static int xcpkg_rdepends_index_add(Graph * graph, const char * prefix, const char * packageName, const char * depPackageNames) {
+    if (depPackageNames == NULL) {
+        return XCPKG_OK;
+    }
+
+    char key[PATH_MAX];
+
+    int ret = snprintf(key, PATH_MAX, "%s%s%s", prefix == NULL ? "" : prefix, prefix == NULL ? "" : "/", packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    size_t index;
+
+    ret = graph_add_node(graph, key, (size_t)ret, &index);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    for (const char * p = depPackageNames; ;) {
+        while (p[0] == ' ' || p[0] == '\n') p++;
+
+        if (p[0] == '\0') break;
+
+        size_t n = 0U;
+
+        while (p[n] != ' ' && p[n] != '\n' && p[n] != '\0') n++;
+
+        ret = snprintf(key, PATH_MAX, "%s%s%.*s", prefix == NULL ? "" : prefix, prefix == NULL ? "" : "/", (int)n, p);
+
+        if (ret < 0) {
+            perror(NULL);
+            return XCPKG_ERROR;
+        }
+
+        size_t depIndex;
+
+        ret = graph_add_node(graph, key, (size_t)ret, &depIndex);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        ret = graph_add_edge(graph, depIndex, index);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        p += n;
+    }
+
+    return XCPKG_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    Graph graph;
+
+    // the packages whose formula has been read, a formula in a former formula repository wins
+    StringMap loaded;
+
+    XCPKGSearchIndex searchIndex;
+} Payload;
+
+static int available_package_callback(const char * targetPlatformName __attribute__((unused)), const char * packageName, const char * formulaFilePath, const bool verbose __attribute__((unused)), const size_t index __attribute__((unused)), const void * p1 __attribute__((unused)), void * p2) {
+    Payload * payload = (Payload*)p2;
+
+    size_t i;
+    bool   added;
+
+    if (string_map_add(&payload->loaded, packageName, strlen(packageName), &i, &added) != 0) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    if (!added) {
+        return XCPKG_OK;
+    }
+
+    XCPKGFormula * formula = NULL;
+
+    // a broken formula should not prevent the others from being indexed
+    int ret = xcpkg_formula_load(packageName, NULL, formulaFilePath, &formula);
+
+    if (ret != XCPKG_OK) {
+        fprintf(stderr, "package '%s' was not indexed, because its formula %s failed to load, error code %d.\n", packageName, formulaFilePath, ret);
+        return XCPKG_OK;
+    }
+
+    ret = xcpkg_rdepends_index_add(&payload->graph, NULL, packageName, formula->dep_pkg);
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_search_index_add(&payload->searchIndex, packageName, formula);
+    }
+
+    xcpkg_formula_free(formula);
+
+    return ret;
+}
+
+static int xcpkg_rdepends_index_scan_the_installed_packages(Graph * graph) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, false);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    size_t packageInstalledRootDIRCapacity = xcpkgHomeDIRLength + 11U;
+    char   packageInstalledRootDIR[packageInstalledRootDIRCapacity];
+
+    ret = snprintf(packageInstalledRootDIR, packageInstalledRootDIRCapacity, "%s/installed", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    DIR * dir = opendir(packageInstalledRootDIR);
+
+    if (dir == NULL) {
+        if (errno == ENOENT) {
+            return XCPKG_OK;
+        } else {
+            perror(packageInstalledRootDIR);
+            return XCPKG_ERROR;
+        }
+    }
+
+    struct stat st;
+
+    for (;;) {
+        errno = 0;
+
+        struct dirent * dir_entry = readdir(dir);
+
+        if (dir_entry == NULL) {
+            if (errno == 0) {
+                closedir(dir);
+                return XCPKG_OK;
+            } else {
+                perror(packageInstalledRootDIR);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+        }
+
+        const char * targetPlatformSpec = dir_entry->d_name;
+
+        if (xcpkg_check_if_the_given_argument_matches_platform_spec_pattern(targetPlatformSpec) != XCPKG_OK) {
+            continue;
+        }
+
+        char targetDIR[PATH_MAX];
+
+        ret = snprintf(targetDIR, PATH_MAX, "%s/%s", packageInstalledRootDIR, targetPlatformSpec);
+
+        if (ret < 0) {
+            perror(NULL);
+            closedir(dir);
+            return XCPKG_ERROR;
+        }
+
+        DIR * dir2 = opendir(targetDIR);
+
+        if (dir2 == NULL) {
+            continue;
+        }
+
+        for (;;) {
+            errno = 0;
+
+            struct dirent * dir_entry2 = readdir(dir2);
+
+            if (dir_entry2 == NULL) {
+                if (errno == 0) {
+                    break;
+                } else {
+                    perror(targetDIR);
+                    closedir(dir2);
+                    closedir(dir);
+                    return XCPKG_ERROR;
+                }
+            }
+
+            const char * packageName = dir_entry2->d_name;
+
+            if (xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName) != XCPKG_OK) {
+                continue;
+            }
+
+            char receiptFilePath[PATH_MAX];
+
+            ret = snprintf(receiptFilePath, PATH_MAX, "%s/%s/%s", targetDIR, packageName, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+
+            if (ret < 0) {
+                perror(NULL);
+                closedir(dir2);
+                closedir(dir);
+                return XCPKG_ERROR;
+            }
+
+            if (stat(receiptFilePath, &st) != 0 || !S_ISREG(st.st_mode)) {
+                continue;
+            }
+
+            XCPKGReceipt * receipt = NULL;
+
+            if (xcpkg_receipt_parse(packageName, targetPlatformSpec, &receipt) != XCPKG_OK) {
+                continue;
+            }
+
+            ret = xcpkg_rdepends_index_add(graph, targetPlatformSpec, packageName, receipt->dep_pkg);
+
+            xcpkg_receipt_free(receipt);
+
+            if (ret != XCPKG_OK) {
+                closedir(dir2);
+                closedir(dir);
+                return ret;
+            }
+        }
+
+        closedir(dir2);
+    }
+}
+
+int xcpkg_available_index_rebuild() {
+    char indexFilePath[PATH_MAX];
+
+    int ret = xcpkg_rdepends_index_path(false, indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char searchIndexFilePath[PATH_MAX];
+
+    ret = xcpkg_search_index_path(searchIndexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    // every formula is read only once for both indexes and the completion cache
+    Payload payload = {0};
+
+    ret = xcpkg_scan_the_available_packages(NULL, false, available_package_callback, NULL, &payload);
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_rdepends_index_write(indexFilePath, &payload.graph);
+    }
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_search_index_write(&payload.searchIndex, searchIndexFilePath);
+    }
+
+    if (ret == XCPKG_OK) {
+        char * * packageNameArray = (char**)malloc((payload.loaded.entryArraySize + 1U) * sizeof(char*));
+
+        if (packageNameArray == NULL) {
+            ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        } else {
+            for (size_t i = 0U; i < payload.loaded.entryArraySize; i++) {
+                packageNameArray[i] = payload.loaded.entryArray[i].key;
+            }
+
+            ret = xcpkg_completion_cache_write_available(packageNameArray, payload.loaded.entryArraySize);
+
+            free(packageNameArray);
+        }
+    }
+
+    graph_free(&payload.graph);
+    string_map_free(&payload.loaded);
+    xcpkg_search_index_free(&payload.searchIndex);
+
+    return ret;
+}
+
+static int xcpkg_installed_rdepends_index_rebuild() {
+    char indexFilePath[PATH_MAX];
+
+    int ret = xcpkg_rdepends_index_path(true, indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    Graph graph = {0};
+
+    ret = xcpkg_rdepends_index_scan_the_installed_packages(&graph);
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_rdepends_index_write(indexFilePath, &graph);
+    }
+
+    graph_free(&graph);
+
+    return ret;
+}
+
+int xcpkg_rdepends_index_rebuild(const bool installed) {
+    if (!installed) {
+        return xcpkg_available_index_rebuild();
+    }
+
+    int lockFD;
+
+    int ret = xcpkg_lock_named("rdepends-installed", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_installed_rdepends_index_rebuild();
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
+static int xcpkg_rdepends_index_update_locked(const char * packageName, const char * targetPlatformSpec, const char * depPackageNames) {
+    char indexFilePath[PATH_MAX];
+
+    int ret = xcpkg_rdepends_index_path(true, indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    Graph graph = {0};
+
+    ret = xcpkg_rdepends_index_load(indexFilePath, &graph);
+
+    if (ret == XCPKG_ERROR_NOT_FOUND) {
+        return xcpkg_installed_rdepends_index_rebuild();
+    }
+
+    if (ret != XCPKG_OK) {
+        graph_free(&graph);
+        return ret;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    char key[PATH_MAX];
+
+    ret = snprintf(key, PATH_MAX, "%s/%s", targetPlatformSpec, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
+        graph_free(&graph);
+        return XCPKG_ERROR;
+    }
+
+    size_t index;
+
+    // drop the edges recorded by the last installation of this package
+    if (string_map_find(&graph.nameMap, key, (size_t)ret, &index)) {
+        for (size_t i = 0U; i < graph.nameMap.entryArraySize; i++) {
+            DependentList * list = &graph.adjacencyArray[i];
+
+            size_t n = 0U;
+
+            for (size_t j = 0U; j < list->dependentIndexArraySize; j++) {
+                if (list->dependentIndexArray[j] != index) {
+                    list->dependentIndexArray[n++] = list->dependentIndexArray[j];
+                }
+            }
+
+            list->dependentIndexArraySize = n;
+        }
+    }
+
+    ret = xcpkg_rdepends_index_add(&graph, targetPlatformSpec, packageName, depPackageNames);
+
+    if (ret == XCPKG_OK) {
+        ret = xcpkg_rdepends_index_write(indexFilePath, &graph);
+    }
+
+    graph_free(&graph);
+
+    return ret;
+}
+
+// the index is read, modified, then replaced
+int xcpkg_rdepends_index_update(const char * packageName, const char * targetPlatformSpec, const char * depPackageNames) {
+    int lockFD;
+
+    int ret = xcpkg_lock_named("rdepends-installed", NULL, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_rdepends_index_update_locked(packageName, targetPlatformSpec, depPackageNames);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
+
+int xcpkg_rdepends(const char * packageName, const bool installed, const bool transitive) {
+    int ret = xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    char indexFilePath[PATH_MAX];
+
+    ret = xcpkg_rdepends_index_path(installed, indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    Graph graph = {0};
+
+    ret = xcpkg_rdepends_index_load(indexFilePath, &graph);
+
+    if (ret == XCPKG_ERROR_NOT_FOUND) {
+        ret = xcpkg_rdepends_index_rebuild(installed);
+
+        if (ret == XCPKG_OK) {
+            ret = xcpkg_rdepends_index_load(indexFilePath, &graph);
+        }
+    }
+
+    if (ret != XCPKG_OK) {
+        graph_free(&graph);
+        return ret;
+    }
+
+    size_t nodeCount = graph.nameMap.entryArraySize;
+
+    if (nodeCount == 0U) {
+        graph_free(&graph);
+        return XCPKG_OK;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    bool   * visited = (bool*)calloc(nodeCount, sizeof(bool));
+    size_t * queue   = (size_t*)malloc(nodeCount * sizeof(size_t));
+
+    if (visited == NULL || queue == NULL) {
+        free(visited);
+        free(queue);
+        graph_free(&graph);
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    size_t head = 0U;
+    size_t tail = 0U;
+
+    size_t packageNameLength = strlen(packageName);
+
+    // the installed package may be installed for several targets
+    for (size_t i = 0U; i < nodeCount; i++) {
+        const char * name = graph.nameMap.entryArray[i].key;
+        size_t nameLength = graph.nameMap.entryArray[i].keyLength;
+
+        if (installed) {
+            const char * p = strchr(name, '/');
+
+            if (p == NULL) continue;
+
+            nameLength -= (size_t)(p + 1 - name);
+            name = p + 1;
+        }
+
+        if (nameLength == packageNameLength && strcmp(name, packageName) == 0) {
+            visited[i] = true;
+            queue[tail++] = i;
+        }
+    }
+
+    size_t rootCount = tail;
+
+    while (head < tail) {
+        size_t index = queue[head++];
+
+        if (!transitive && head > rootCount) {
+            continue;
+        }
+
+        const DependentList * list = &graph.adjacencyArray[index];
+
+        for (size_t j = 0U; j < list->dependentIndexArraySize; j++) {
+            size_t dependentIndex = list->dependentIndexArray[j];
+
+            if (!visited[dependentIndex]) {
+                visited[dependentIndex] = true;
+                queue[tail++] = dependentIndex;
+            }
+        }
+    }
+
+    for (size_t i = rootCount; i < tail; i++) {
+        puts(graph.nameMap.entryArray[queue[i]].key);
+    }
+
+    free(visited);
+    free(queue);
+
+    graph_free(&graph);
+
+    return XCPKG_OK;
+}
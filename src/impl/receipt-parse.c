@@ -7,6 +7,8 @@
 
 #include <yaml.h>
 
+#include "../core/trace.h"
+
 #include "../xcpkg.h"
 
 typedef enum {
@@ -497,56 +499,56 @@ static int xcpkg_receipt_set_value(XCPKGReceiptKeyCode keyCode, char * value, XC
     }
 
     switch (keyCode) {
-        case XCPKGReceiptKeyCode_summary: if (receipt->summary != NULL) free(receipt->summary); receipt->summary = strdup(value); break;
-        case XCPKGReceiptKeyCode_version: if (receipt->version != NULL) free(receipt->version); receipt->version = strdup(value); break;
-        case XCPKGReceiptKeyCode_license: if (receipt->license != NULL) free(receipt->license); receipt->license = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_web_url: if (receipt->web_url != NULL) free(receipt->web_url); receipt->web_url = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_git_url: if (receipt->git_url != NULL) free(receipt->git_url); receipt->git_url = strdup(value); break;
-        case XCPKGReceiptKeyCode_git_sha: if (receipt->git_sha != NULL) free(receipt->git_sha); receipt->git_sha = strdup(value); break;
-        case XCPKGReceiptKeyCode_git_ref: if (receipt->git_ref != NULL) free(receipt->git_ref); receipt->git_ref = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_src_url: if (receipt->src_url != NULL) free(receipt->src_url); receipt->src_url = strdup(value); break;
-        case XCPKGReceiptKeyCode_src_uri: if (receipt->src_uri != NULL) free(receipt->src_uri); receipt->src_uri = strdup(value); break;
-        case XCPKGReceiptKeyCode_src_sha: if (receipt->src_sha != NULL) free(receipt->src_sha); receipt->src_sha = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_fix_url: if (receipt->fix_url != NULL) free(receipt->fix_url); receipt->fix_url = strdup(value); break;
-        case XCPKGReceiptKeyCode_fix_uri: if (receipt->fix_uri != NULL) free(receipt->fix_uri); receipt->fix_uri = strdup(value); break;
-        case XCPKGReceiptKeyCode_fix_sha: if (receipt->fix_sha != NULL) free(receipt->fix_sha); receipt->fix_sha = strdup(value); break;
-        case XCPKGReceiptKeyCode_fix_opt: if (receipt->fix_opt != NULL) free(receipt->fix_opt); receipt->fix_opt = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_res_url: if (receipt->res_url != NULL) free(receipt->res_url); receipt->res_url = strdup(value); break;
-        case XCPKGReceiptKeyCode_res_uri: if (receipt->res_uri != NULL) free(receipt->res_uri); receipt->res_uri = strdup(value); break;
-        case XCPKGReceiptKeyCode_res_sha: if (receipt->res_sha != NULL) free(receipt->res_sha); receipt->res_sha = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_dep_pkg: if (receipt->dep_pkg != NULL) free(receipt->dep_pkg); receipt->dep_pkg = strdup(value); break;
-        case XCPKGReceiptKeyCode_dep_upp: if (receipt->dep_upp != NULL) free(receipt->dep_upp); receipt->dep_upp = strdup(value); break;
-        case XCPKGReceiptKeyCode_dep_pip: if (receipt->dep_pip != NULL) free(receipt->dep_pip); receipt->dep_pip = strdup(value); break;
-        case XCPKGReceiptKeyCode_dep_plm: if (receipt->dep_plm != NULL) free(receipt->dep_plm); receipt->dep_plm = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_ppflags: if (receipt->ppflags != NULL) free(receipt->ppflags); receipt->ppflags = strdup(value); break;
-        case XCPKGReceiptKeyCode_ccflags: if (receipt->ccflags != NULL) free(receipt->ccflags); receipt->ccflags = strdup(value); break;
-        case XCPKGReceiptKeyCode_xxflags: if (receipt->xxflags != NULL) free(receipt->xxflags); receipt->xxflags = strdup(value); break;
-        case XCPKGReceiptKeyCode_ldflags: if (receipt->ldflags != NULL) free(receipt->ldflags); receipt->ldflags = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_do12345: if (receipt->do12345 != NULL) free(receipt->do12345); receipt->do12345 = strdup(value); break;
-        case XCPKGReceiptKeyCode_dofetch: if (receipt->dofetch != NULL) free(receipt->dofetch); receipt->dofetch = strdup(value); break;
-        case XCPKGReceiptKeyCode_dopatch: if (receipt->dopatch != NULL) free(receipt->dopatch); receipt->dopatch = strdup(value); break;
-        case XCPKGReceiptKeyCode_prepare: if (receipt->prepare != NULL) free(receipt->prepare); receipt->prepare = strdup(value); break;
-        case XCPKGReceiptKeyCode_install: if (receipt->install != NULL) free(receipt->install); receipt->install = strdup(value); break;
-        case XCPKGReceiptKeyCode_dotweak: if (receipt->dotweak != NULL) free(receipt->dotweak); receipt->dotweak = strdup(value); break;
-        case XCPKGReceiptKeyCode_bindenv: if (receipt->bindenv != NULL) free(receipt->bindenv); receipt->bindenv = strdup(value); break;
-        case XCPKGReceiptKeyCode_caveats: if (receipt->caveats != NULL) free(receipt->caveats); receipt->caveats = strdup(value); break;
-        case XCPKGReceiptKeyCode_patches: if (receipt->patches != NULL) free(receipt->patches); receipt->patches = strdup(value); break;
-        case XCPKGReceiptKeyCode_reslist: if (receipt->reslist != NULL) free(receipt->reslist); receipt->reslist = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_bsystem: if (receipt->bsystem != NULL) free(receipt->bsystem); receipt->bsystem = strdup(value); break;
-        case XCPKGReceiptKeyCode_bscript: if (receipt->bscript != NULL) free(receipt->bscript); receipt->bscript = strdup(value); break;
-
-        case XCPKGReceiptKeyCode_builtby: if (receipt->builtBy != NULL) free(receipt->builtBy); receipt->builtBy = strdup(value); break;
-        case XCPKGReceiptKeyCode_builtat: if (receipt->builtAt != NULL) free(receipt->builtAt); receipt->builtAt = strdup(value); break;
-        case XCPKGReceiptKeyCode_builtfor: if (receipt->builtFor != NULL) free(receipt->builtFor); receipt->builtFor = strdup(value); break;
+        case XCPKGReceiptKeyCode_summary: if (receipt->summary != NULL) free(receipt->summary); receipt->summary = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_version: if (receipt->version != NULL) free(receipt->version); receipt->version = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_license: if (receipt->license != NULL) free(receipt->license); receipt->license = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_web_url: if (receipt->web_url != NULL) free(receipt->web_url); receipt->web_url = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_git_url: if (receipt->git_url != NULL) free(receipt->git_url); receipt->git_url = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_git_sha: if (receipt->git_sha != NULL) free(receipt->git_sha); receipt->git_sha = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_git_ref: if (receipt->git_ref != NULL) free(receipt->git_ref); receipt->git_ref = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_src_url: if (receipt->src_url != NULL) free(receipt->src_url); receipt->src_url = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_src_uri: if (receipt->src_uri != NULL) free(receipt->src_uri); receipt->src_uri = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_src_sha: if (receipt->src_sha != NULL) free(receipt->src_sha); receipt->src_sha = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_fix_url: if (receipt->fix_url != NULL) free(receipt->fix_url); receipt->fix_url = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_fix_uri: if (receipt->fix_uri != NULL) free(receipt->fix_uri); receipt->fix_uri = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_fix_sha: if (receipt->fix_sha != NULL) free(receipt->fix_sha); receipt->fix_sha = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_fix_opt: if (receipt->fix_opt != NULL) free(receipt->fix_opt); receipt->fix_opt = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_res_url: if (receipt->res_url != NULL) free(receipt->res_url); receipt->res_url = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_res_uri: if (receipt->res_uri != NULL) free(receipt->res_uri); receipt->res_uri = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_res_sha: if (receipt->res_sha != NULL) free(receipt->res_sha); receipt->res_sha = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_dep_pkg: if (receipt->dep_pkg != NULL) free(receipt->dep_pkg); receipt->dep_pkg = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dep_upp: if (receipt->dep_upp != NULL) free(receipt->dep_upp); receipt->dep_upp = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dep_pip: if (receipt->dep_pip != NULL) free(receipt->dep_pip); receipt->dep_pip = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dep_plm: if (receipt->dep_plm != NULL) free(receipt->dep_plm); receipt->dep_plm = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_ppflags: if (receipt->ppflags != NULL) free(receipt->ppflags); receipt->ppflags = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_ccflags: if (receipt->ccflags != NULL) free(receipt->ccflags); receipt->ccflags = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_xxflags: if (receipt->xxflags != NULL) free(receipt->xxflags); receipt->xxflags = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_ldflags: if (receipt->ldflags != NULL) free(receipt->ldflags); receipt->ldflags = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_do12345: if (receipt->do12345 != NULL) free(receipt->do12345); receipt->do12345 = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dofetch: if (receipt->dofetch != NULL) free(receipt->dofetch); receipt->dofetch = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dopatch: if (receipt->dopatch != NULL) free(receipt->dopatch); receipt->dopatch = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_prepare: if (receipt->prepare != NULL) free(receipt->prepare); receipt->prepare = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_install: if (receipt->install != NULL) free(receipt->install); receipt->install = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_dotweak: if (receipt->dotweak != NULL) free(receipt->dotweak); receipt->dotweak = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_bindenv: if (receipt->bindenv != NULL) free(receipt->bindenv); receipt->bindenv = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_caveats: if (receipt->caveats != NULL) free(receipt->caveats); receipt->caveats = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_patches: if (receipt->patches != NULL) free(receipt->patches); receipt->patches = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_reslist: if (receipt->reslist != NULL) free(receipt->reslist); receipt->reslist = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_bsystem: if (receipt->bsystem != NULL) free(receipt->bsystem); receipt->bsystem = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_bscript: if (receipt->bscript != NULL) free(receipt->bscript); receipt->bscript = trace_strdup("xcpkg_receipt_parse", value); break;
+
+        case XCPKGReceiptKeyCode_builtby: if (receipt->builtBy != NULL) free(receipt->builtBy); receipt->builtBy = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_builtat: if (receipt->builtAt != NULL) free(receipt->builtAt); receipt->builtAt = trace_strdup("xcpkg_receipt_parse", value); break;
+        case XCPKGReceiptKeyCode_builtfor: if (receipt->builtFor != NULL) free(receipt->builtFor); receipt->builtFor = trace_strdup("xcpkg_receipt_parse", value); break;
 
         case XCPKGReceiptKeyCode_git_nth:
             for (int i = 0; ; i++) {
@@ -713,7 +715,7 @@ static int xcpkg_receipt_check(XCPKGReceipt * receipt, const char * receiptFileP
     return XCPKG_OK;
 }
 
-int xcpkg_receipt_parse(const char * packageName, const char * targetPlatformSpec, XCPKGReceipt * * out) {
+static int xcpkg_receipt_parse_internal(const char * packageName, const char * targetPlatformSpec, XCPKGReceipt * * out) {
     int ret = xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName);
 
     if (ret != XCPKG_OK) {
@@ -734,7 +736,7 @@ int xcpkg_receipt_parse(const char * packageName, const char * targetPlatformSpe
     }
 
     size_t receiptFilePathLength = xcpkgHomeDIRLength + strlen(targetPlatformSpec) + strlen(packageName) + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 15U;
-    char * receiptFilePath = (char*)calloc(receiptFilePathLength, sizeof(char));
+    char * receiptFilePath = (char*)trace_calloc("xcpkg_receipt_parse", receiptFilePathLength, sizeof(char));
 
     if (receiptFilePath == NULL) {
         return XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -803,7 +805,7 @@ int xcpkg_receipt_parse(const char * packageName, const char * targetPlatformSpe
                     receiptKeyCode = xcpkg_receipt_key_code_from_key_name((char*)token.data.scalar.value);
                 } else if (lastTokenType == 2) {
                     if (receipt == NULL) {
-                        receipt = (XCPKGReceipt*)calloc(1, sizeof(XCPKGReceipt));
+                        receipt = (XCPKGReceipt*)trace_calloc("xcpkg_receipt_parse", 1, sizeof(XCPKGReceipt));
 
                         if (receipt == NULL) {
                             ret = XCPKG_ERROR_MEMORY_ALLOCATE;
@@ -899,3 +901,13 @@ finalize:
 
     return ret;
 }
+
+int xcpkg_receipt_parse(const char * packageName, const char * targetPlatformSpec, XCPKGReceipt * * out) {
+    uint64_t startTime = trace_now();
+
+    int ret = xcpkg_receipt_parse_internal(packageName, targetPlatformSpec, out);
+
+    trace_record("receipt", "xcpkg_receipt_parse", 1U, 0U, startTime);
+
+    return ret;
+}
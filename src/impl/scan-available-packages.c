@@ -84,12 +84,12 @@ loop:
 
     ////////////////////////////////////
 
-    p[0] = '/';
+    p[0] = '.';
 
     size_t formulaFilePathCapacity = formulaDIRCapacity +fileNameLength + 1U;
     char   formulaFilePath[formulaFilePathCapacity];
 
-    ret = snprintf(formulaFilePath, formulaFilePathCapacity, "%s/%s", formulaFilePath, fileName);
+    ret = snprintf(formulaFilePath, formulaFilePathCapacity, "%s/%s", formulaDIR, fileName);
 
     if (ret < 0) {
         perror(NULL);
@@ -0,0 +1,296 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <unistd.h>
+#include <limits.h>
+
+#include "search-index.h"
+
+int xcpkg_search_index_path(char buf[]) {
+    const char * xcpkgHomeDIR;
+    size_t xcpkgHomeDIRLength;
+
+    int ret = xcpkg_get_home_dir(&xcpkgHomeDIR, &xcpkgHomeDIRLength, true);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = snprintf(buf, PATH_MAX, "%s/search-index.txt", xcpkgHomeDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+static inline __attribute__((always_inline)) bool is_token_char(const char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+size_t xcpkg_search_index_next_token(const char * * p, char buf[], const size_t bufCapacity) {
+    const char * s = *p;
+
+    for (;;) {
+        while (s[0] != '\0' && !is_token_char(s[0])) s++;
+
+        if (s[0] == '\0') {
+            (*p) = s;
+            return 0U;
+        }
+
+        size_t n = 0U;
+
+        for (; is_token_char(s[0]); s++) {
+            if (n + 1U < bufCapacity) {
+                buf[n++] = (s[0] >= 'A' && s[0] <= 'Z') ? (s[0] + 32) : s[0];
+            }
+        }
+
+        buf[n] = '\0';
+
+        if (n >= 2U) {
+            (*p) = s;
+            return n;
+        }
+    }
+}
+
+static int xcpkg_search_index_add_posting(XCPKGSearchIndex * index, const char * token, const size_t tokenLength, const char field) {
+    if (index->postingArraySize == index->postingArrayCapacity) {
+        size_t newCapacity = index->postingArrayCapacity == 0U ? 1024U : (index->postingArrayCapacity << 1);
+
+        XCPKGSearchPosting * p = (XCPKGSearchPosting*)realloc(index->postingArray, newCapacity * sizeof(XCPKGSearchPosting));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        index->postingArray = p;
+        index->postingArrayCapacity = newCapacity;
+    }
+
+    char * s = (char*)malloc(tokenLength + 1U);
+
+    if (s == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    memcpy(s, token, tokenLength + 1U);
+
+    XCPKGSearchPosting * posting = &index->postingArray[index->postingArraySize++];
+
+    posting->token = s;
+    posting->recordIndex = index->recordArraySize - 1U;
+    posting->field = field;
+
+    return XCPKG_OK;
+}
+
+static int xcpkg_search_index_add_field(XCPKGSearchIndex * index, const char * value, const char field) {
+    if (value == NULL) {
+        return XCPKG_OK;
+    }
+
+    char token[64];
+
+    const char * p = value;
+
+    for (;;) {
+        size_t n = xcpkg_search_index_next_token(&p, token, 64U);
+
+        if (n == 0U) {
+            return XCPKG_OK;
+        }
+
+        // these appear in almost every web-url
+        if (field == XCPKG_SEARCH_INDEX_FIELD_WEB_URL) {
+            if (strcmp(token, "http") == 0 || strcmp(token, "https") == 0 || strcmp(token, "www") == 0) {
+                continue;
+            }
+        }
+
+        int ret = xcpkg_search_index_add_posting(index, token, n, field);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+    }
+}
+
+// tabs and newlines are field and record separators in the index file
+static inline __attribute__((always_inline)) void copy_field(char * * q, const char * value) {
+    char * p = *q;
+
+    if (value != NULL) {
+        for (; value[0] != '\0'; value++) {
+            p[0] = (value[0] == '\t' || value[0] == '\n' || value[0] == '\r') ? ' ' : value[0];
+            p++;
+        }
+    }
+
+    (*q) = p;
+}
+
+int xcpkg_search_index_add(XCPKGSearchIndex * index, const char * packageName, const XCPKGFormula * formula) {
+    if (index->recordArraySize == index->recordArrayCapacity) {
+        size_t newCapacity = index->recordArrayCapacity == 0U ? 256U : (index->recordArrayCapacity << 1);
+
+        char * * p = (char**)realloc(index->recordArray, newCapacity * sizeof(char*));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        index->recordArray = p;
+        index->recordArrayCapacity = newCapacity;
+    }
+
+    const char * values[5] = { packageName, formula->version, formula->summary, formula->license, formula->web_url };
+
+    size_t recordCapacity = 5U;
+
+    for (int i = 0; i < 5; i++) {
+        if (values[i] != NULL) {
+            recordCapacity += strlen(values[i]);
+        }
+    }
+
+    char * record = (char*)malloc(recordCapacity);
+
+    if (record == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    char * q = record;
+
+    for (int i = 0; i < 5; i++) {
+        if (i != 0) {
+            q[0] = '\t';
+            q++;
+        }
+
+        copy_field(&q, values[i]);
+    }
+
+    q[0] = '\0';
+
+    index->recordArray[index->recordArraySize++] = record;
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    int ret = xcpkg_search_index_add_field(index, packageName, XCPKG_SEARCH_INDEX_FIELD_NAME);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_search_index_add_field(index, formula->summary, XCPKG_SEARCH_INDEX_FIELD_SUMMARY);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_search_index_add_field(index, formula->license, XCPKG_SEARCH_INDEX_FIELD_LICENSE);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    return xcpkg_search_index_add_field(index, formula->web_url, XCPKG_SEARCH_INDEX_FIELD_WEB_URL);
+}
+
+static int compare_posting(const void * a, const void * b) {
+    const XCPKGSearchPosting * x = (const XCPKGSearchPosting *)a;
+    const XCPKGSearchPosting * y = (const XCPKGSearchPosting *)b;
+
+    int ret = strcmp(x->token, y->token);
+
+    if (ret != 0) {
+        return ret;
+    }
+
+    if (x->recordIndex != y->recordIndex) {
+        return x->recordIndex < y->recordIndex ? -1 : 1;
+    }
+
+    return (int)x->field - (int)y->field;
+}
+
+int xcpkg_search_index_write(XCPKGSearchIndex * index, const char * filePath) {
+    qsort(index->postingArray, index->postingArraySize, sizeof(XCPKGSearchPosting), compare_posting);
+
+    char tmpFilePath[PATH_MAX];
+
+    int ret = snprintf(tmpFilePath, PATH_MAX, "%s.%d.tmp", filePath, getpid());
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    FILE * file = fopen(tmpFilePath, "w");
+
+    if (file == NULL) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    for (size_t i = 0U; i < index->recordArraySize; i++) {
+        fprintf(file, "P\t%s\n", index->recordArray[i]);
+    }
+
+    for (size_t i = 0U; i < index->postingArraySize; i++) {
+        const XCPKGSearchPosting * posting = &index->postingArray[i];
+
+        if (i == 0U || strcmp(posting->token, index->postingArray[i - 1U].token) != 0) {
+            fprintf(file, i == 0U ? "T\t%s\t" : "\nT\t%s\t", posting->token);
+        } else if (compare_posting(posting, &index->postingArray[i - 1U]) == 0) {
+            // the same token appears more than once in one field
+            continue;
+        } else {
+            fputc(' ', file);
+        }
+
+        fprintf(file, "%zu%c", posting->recordIndex, posting->field);
+    }
+
+    if (index->postingArraySize != 0U) {
+        fputc('\n', file);
+    }
+
+    if (ferror(file)) {
+        perror(tmpFilePath);
+        fclose(file);
+        return XCPKG_ERROR;
+    }
+
+    if (fclose(file) != 0) {
+        perror(tmpFilePath);
+        return XCPKG_ERROR;
+    }
+
+    if (rename(tmpFilePath, filePath) != 0) {
+        perror(filePath);
+        return XCPKG_ERROR;
+    }
+
+    return XCPKG_OK;
+}
+
+void xcpkg_search_index_free(XCPKGSearchIndex * index) {
+    for (size_t i = 0U; i < index->recordArraySize; i++) {
+        free(index->recordArray[i]);
+    }
+
+    for (size_t i = 0U; i < index->postingArraySize; i++) {
+        free(index->postingArray[i].token);
+    }
+
+    free(index->recordArray);
+    free(index->postingArray);
+
+    memset(index, 0, sizeof(XCPKGSearchIndex));
+}
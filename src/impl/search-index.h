@@ -0,0 +1,54 @@
+#ifndef _SEARCH_INDEX_H
+#define _SEARCH_INDEX_H
+
+#include <stdlib.h>
+
+#include "../xcpkg.h"
+
+#define XCPKG_SEARCH_INDEX_FIELD_NAME    'n'
+#define XCPKG_SEARCH_INDEX_FIELD_SUMMARY 's'
+#define XCPKG_SEARCH_INDEX_FIELD_LICENSE 'l'
+#define XCPKG_SEARCH_INDEX_FIELD_WEB_URL 'w'
+
+typedef struct {
+    char * token;
+    size_t recordIndex;
+    char   field;
+} XCPKGSearchPosting;
+
+/**
+ *  the search index of the available packages, it is a text file, every line is one of:
+ *
+ *  P<TAB><PACKAGE-NAME><TAB><VERSION><TAB><SUMMARY><TAB><LICENSE><TAB><WEB-URL>
+ *  T<TAB><TOKEN><TAB><RECORD-INDEX><FIELD> <RECORD-INDEX><FIELD>...
+ *
+ *  all the P lines come first, <RECORD-INDEX> is the 0-based index of the P line.
+ *  <FIELD> is one of XCPKG_SEARCH_INDEX_FIELD_*, T lines are sorted by <TOKEN>.
+ */
+typedef struct {
+    char * * recordArray;
+    size_t   recordArraySize;
+    size_t   recordArrayCapacity;
+
+    XCPKGSearchPosting * postingArray;
+    size_t               postingArraySize;
+    size_t               postingArrayCapacity;
+} XCPKGSearchIndex;
+
+int  xcpkg_search_index_path(char buf[]);
+
+/** fetch the next token from (*p) into buf, a token is a run of ASCII letters and digits, it is lowercased and truncated to bufCapacity - 1.
+ *
+ *  tokens shorter than 2 characters are skipped, (*p) is advanced past the token, 0 is returned if there are no more tokens.
+ */
+size_t xcpkg_search_index_next_token(const char * * p, char buf[], const size_t bufCapacity);
+
+/** add the given package to the search index, the summary, license and web-url of the given formula are tokenized.
+ */
+int  xcpkg_search_index_add(XCPKGSearchIndex * index, const char * packageName, const XCPKGFormula * formula);
+
+int  xcpkg_search_index_write(XCPKGSearchIndex * index, const char * filePath);
+
+void xcpkg_search_index_free(XCPKGSearchIndex * index);
+
+#endif
@@ -1,34 +1,343 @@
 #include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-#include "../core/regex.h"
+#include <regex.h>
+#include <limits.h>
+#include <sys/stat.h>
 
 #include "../xcpkg.h"
 
-static int xcpkg_scan_the_available_packages_callback(const char * targetPlatformName, const char * packageName, const char * formulaFilePath, const bool verbose, size_t i, const void * regPattern, void * _) {
-    if (regex_matched(packageName, (const char *)regPattern) == 0) {
-        if (verbose) {
-            if (i != 0U) {
-                printf("\n");
-            }
+#include "search-index.h"
 
-            return xcpkg_print_available_info(packageName, targetPlatformName, NULL, formulaFilePath);
-        } else {
-            puts(packageName);
-            return XCPKG_OK;
+typedef struct {
+    char * name;
+    char * version;
+    char * summary;
+    char * license;
+    char * webUrl;
+
+    size_t score;
+} Record;
+
+typedef struct {
+    char * token;
+    char * postings;
+} TokenLine;
+
+typedef struct {
+    char * data;
+
+    Record * recordArray;
+    size_t   recordArraySize;
+
+    TokenLine * tokenLineArray;
+    size_t      tokenLineArraySize;
+} SearchIndex;
+
+static void search_index_free(SearchIndex * index) {
+    free(index->data);
+    free(index->recordArray);
+    free(index->tokenLineArray);
+}
+
+// split s at the first c, s is terminated there and the rest is returned
+static inline __attribute__((always_inline)) char* split(char * s, const char c) {
+    if (s == NULL) {
+        return NULL;
+    }
+
+    char * p = strchr(s, c);
+
+    if (p == NULL) {
+        return NULL;
+    }
+
+    p[0] = '\0';
+
+    return p + 1;
+}
+
+static int search_index_load(SearchIndex * index) {
+    char indexFilePath[PATH_MAX];
+
+    int ret = xcpkg_search_index_path(indexFilePath);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    struct stat st;
+
+    if (stat(indexFilePath, &st) != 0) {
+        if (errno != ENOENT) {
+            perror(indexFilePath);
+            return XCPKG_ERROR;
         }
-    } else {
-        if (errno == 0) {
-            return XCPKG_OK;
-        } else {
-            perror(NULL);
+
+        ret = xcpkg_available_index_rebuild();
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        if (stat(indexFilePath, &st) != 0) {
+            perror(indexFilePath);
             return XCPKG_ERROR;
         }
     }
+
+    FILE * file = fopen(indexFilePath, "r");
+
+    if (file == NULL) {
+        perror(indexFilePath);
+        return XCPKG_ERROR;
+    }
+
+    char * data = (char*)malloc((size_t)st.st_size + 1U);
+
+    if (data == NULL) {
+        fclose(file);
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    size_t size = fread(data, 1, (size_t)st.st_size, file);
+
+    if (ferror(file)) {
+        perror(indexFilePath);
+        fclose(file);
+        free(data);
+        return XCPKG_ERROR;
+    }
+
+    fclose(file);
+
+    data[size] = '\0';
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    size_t recordCount = 0U;
+    size_t tokenLineCount = 0U;
+
+    for (char * p = data; p[0] != '\0'; ) {
+        if (p[0] == 'P') recordCount++;
+        if (p[0] == 'T') tokenLineCount++;
+
+        p = strchr(p, '\n');
+
+        if (p == NULL) break;
+
+        p++;
+    }
+
+    index->data = data;
+    index->recordArray = (Record*)calloc(recordCount + 1U, sizeof(Record));
+    index->tokenLineArray = (TokenLine*)calloc(tokenLineCount + 1U, sizeof(TokenLine));
+
+    if (index->recordArray == NULL || index->tokenLineArray == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    for (char * p = data; p != NULL && p[0] != '\0'; ) {
+        char * line = p;
+
+        p = split(p, '\n');
+
+        char * q = split(line, '\t');
+
+        if (q == NULL) continue;
+
+        if (line[0] == 'P') {
+            Record * record = &index->recordArray[index->recordArraySize++];
+
+            record->name    = q;
+            record->version = q = split(q, '\t');
+            record->summary = q = split(q, '\t');
+            record->license = q = split(q, '\t');
+            record->webUrl  = split(q, '\t');
+        } else if (line[0] == 'T') {
+            TokenLine * tokenLine = &index->tokenLineArray[index->tokenLineArraySize++];
+
+            tokenLine->token = q;
+            tokenLine->postings = split(q, '\t');
+        }
+    }
+
+    return XCPKG_OK;
+}
+
+static void print_record(const Record * record, const bool verbose, const bool first) {
+    if (!verbose) {
+        puts(record->name);
+        return;
+    }
+
+    if (!first) {
+        printf("\n");
+    }
+
+    printf("pkgname: %s\n", record->name);
+
+    const char * keys[4]   = { "version", "summary", "license", "web-url" };
+    const char * values[4] = { record->version, record->summary, record->license, record->webUrl };
+
+    for (int i = 0; i < 4; i++) {
+        if (values[i] != NULL && values[i][0] != '\0') {
+            printf("%s: %s\n", keys[i], values[i]);
+        }
+    }
+}
+
+static int search_by_regex(const SearchIndex * index, const char * regPattern, const bool verbose) {
+    regex_t regex;
+
+    // the pattern is compiled only once for all the packages
+    if (regcomp(&regex, regPattern, REG_EXTENDED | REG_NOSUB) != 0) {
+        fprintf(stderr, "invalid regular expression: %s\n", regPattern);
+        return XCPKG_ERROR_ARG_IS_INVALID;
+    }
+
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < index->recordArraySize; i++) {
+        const Record * record = &index->recordArray[i];
+
+        if (regexec(&regex, record->name, 0, NULL, 0) == 0) {
+            print_record(record, verbose, n++ == 0U);
+        }
+    }
+
+    regfree(&regex);
+
+    return XCPKG_OK;
 }
 
-int xcpkg_search(const char * regPattern, const char * targetPlatformName, const bool verbose) {
+static inline __attribute__((always_inline)) size_t weight_of_field(const char field) {
+    switch (field) {
+        case XCPKG_SEARCH_INDEX_FIELD_NAME:    return 8U;
+        case XCPKG_SEARCH_INDEX_FIELD_SUMMARY: return 4U;
+        case XCPKG_SEARCH_INDEX_FIELD_LICENSE: return 2U;
+        default:                               return 1U;
+    }
+}
+
+static int compare_record(const void * a, const void * b) {
+    const Record * x = *((const Record * const *)a);
+    const Record * y = *((const Record * const *)b);
+
+    if (x->score != y->score) {
+        return x->score > y->score ? -1 : 1;
+    }
+
+    return strcmp(x->name, y->name);
+}
+
+static void score_token_line(SearchIndex * index, const TokenLine * tokenLine, const size_t factor) {
+    if (tokenLine->postings == NULL) {
+        return;
+    }
+
+    for (const char * q = tokenLine->postings; q[0] != '\0'; ) {
+        char * end;
+
+        size_t recordIndex = strtoul(q, &end, 10);
+
+        if (end == q || recordIndex >= index->recordArraySize) {
+            break;
+        }
+
+        index->recordArray[recordIndex].score += factor * weight_of_field(end[0]);
+
+        q = end[0] == '\0' ? end : end + 1;
+
+        while (q[0] == ' ') q++;
+    }
+}
+
+// the token lines are written in strcmp() order, so the first token that is not less than the query token is found by a binary search
+static size_t lower_bound_of_token(const SearchIndex * index, const char * queryToken) {
+    size_t lo = 0U;
+    size_t hi = index->tokenLineArraySize;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2U;
+
+        if (strcmp(index->tokenLineArray[mid].token, queryToken) < 0) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static int search_by_text(SearchIndex * index, const char * text, const bool verbose) {
+    char queryToken[64];
+
+    const char * p = text;
+
+    // every matched token scores the weight of its field, an exact match scores double
+    for (;;) {
+        size_t queryTokenLength = xcpkg_search_index_next_token(&p, queryToken, 64U);
+
+        if (queryTokenLength == 0U) break;
+
+        size_t matchedCount = 0U;
+
+        // the tokens that start with the query token are adjacent to each other
+        for (size_t i = lower_bound_of_token(index, queryToken); i < index->tokenLineArraySize; i++) {
+            const TokenLine * tokenLine = &index->tokenLineArray[i];
+
+            if (strncmp(tokenLine->token, queryToken, queryTokenLength) != 0) break;
+
+            score_token_line(index, tokenLine, tokenLine->token[queryTokenLength] == '\0' ? 2U : 1U);
+
+            matchedCount++;
+        }
+
+        if (matchedCount != 0U) continue;
+
+        // no token starts with the query token, it might be found in the middle of a token
+        for (size_t i = 0U; i < index->tokenLineArraySize; i++) {
+            const TokenLine * tokenLine = &index->tokenLineArray[i];
+
+            if (strstr(tokenLine->token, queryToken) != NULL) {
+                score_token_line(index, tokenLine, 1U);
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    const Record * * matched = (const Record * *)malloc((index->recordArraySize + 1U) * sizeof(Record *));
+
+    if (matched == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    size_t n = 0U;
+
+    for (size_t i = 0U; i < index->recordArraySize; i++) {
+        if (index->recordArray[i].score != 0U) {
+            matched[n++] = &index->recordArray[i];
+        }
+    }
+
+    qsort(matched, n, sizeof(Record *), compare_record);
+
+    for (size_t i = 0U; i < n; i++) {
+        print_record(matched[i], verbose, i == 0U);
+    }
+
+    free(matched);
+
+    return XCPKG_OK;
+}
+
+int xcpkg_search(const char * regPattern, const bool fullText, const bool verbose) {
+
     if (regPattern == NULL) {
         return XCPKG_ERROR_ARG_IS_NULL;
     }
@@ -37,5 +346,19 @@ int xcpkg_search(const char * regPattern, const char * targetPlatformName, const
         return XCPKG_ERROR_ARG_IS_EMPTY;
     }
 
-    return xcpkg_scan_the_available_packages(targetPlatformName, verbose, xcpkg_scan_the_available_packages_callback, regPattern, NULL);
+    SearchIndex index = {0};
+
+    int ret = search_index_load(&index);
+
+    if (ret == XCPKG_OK) {
+        if (fullText) {
+            ret = search_by_text(&index, regPattern, verbose);
+        } else {
+            ret = search_by_regex(&index, regPattern, verbose);
+        }
+    }
+
+    search_index_free(&index);
+
+    return ret;
 }
@@ -7,16 +7,10 @@
 
 #include "../xcpkg.h"
 
-int xcpkg_uninstall(const char * packageName, const char * targetPlatformSpec, const bool verbose) {
-    int ret = xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName);
-
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
-
+static int xcpkg_uninstall_locked(const char * packageName, const char * targetPlatformSpec, const bool verbose) {
     char packageInstalledRootDIR[PATH_MAX];
 
-    ret = snprintf(packageInstalledRootDIR, PATH_MAX, "%s/installed/%s", getenv("XCPKG_HOME"), targetPlatformSpec);
+    int ret = snprintf(packageInstalledRootDIR, PATH_MAX, "%s/installed/%s", getenv("XCPKG_HOME"), targetPlatformSpec);
 
     if (ret < 0) {
         perror(NULL);
@@ -35,71 +29,105 @@ int xcpkg_uninstall(const char * packageName, const char * targetPlatformSpec, c
         return XCPKG_ERROR;
     }
 
-    struct stat st;
+    // the link is switched before the record is appended, so the link wins if they disagree
+    char sha[65] = {0};
 
-    if (lstat(packageInstalledLinkDIR, &st) == 0) {
-        if (S_ISLNK(st.st_mode)) {
-            size_t receiptFilePathCapacity = packageInstalledLinkDIRCapacity + sizeof(XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT) + 2U;
-            char   receiptFilePath[receiptFilePathCapacity];
+    ssize_t readSize = readlink(packageInstalledLinkDIR, sha, 65);
 
-            ret = snprintf(receiptFilePath, receiptFilePathCapacity, "%s/%s", packageInstalledLinkDIR, XCPKG_RECEIPT_FILEPATH_RELATIVE_TO_INSTALLED_ROOT);
+    XCPKGInstalledDB db;
 
-            if (ret < 0) {
-                perror(NULL);
-                return XCPKG_ERROR;
-            }
+    ret = xcpkg_installed_db_load(&db);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    const XCPKGInstalledPackage * installedPackage = xcpkg_installed_db_find(&db, packageName, targetPlatformSpec);
+
+    bool recorded = installedPackage != NULL;
 
-            if (lstat(receiptFilePath, &st) == 0 && S_ISREG(st.st_mode)) {
-                char buf[256] = {0};
-
-                ssize_t readSize = readlink(packageInstalledLinkDIR, buf, 255);
-
-                if (readSize == -1) {
-                    perror(packageInstalledLinkDIR);
-                    return XCPKG_ERROR;
-                } else if (readSize != 64) {
-                    // package is broken by other tools?
-                    return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
-                }
-
-                size_t packageInstalledRealDIRCapacity = packageInstalledRootDIRCapacity + 66U;
-                char   packageInstalledRealDIR[packageInstalledRealDIRCapacity];
-
-                ret = snprintf(packageInstalledRealDIR, packageInstalledRealDIRCapacity, "%s/%s", packageInstalledRootDIR, buf);
-
-                if (ret < 0) {
-                    perror(NULL);
-                    return XCPKG_ERROR;
-                }
-
-                if (lstat(packageInstalledRealDIR, &st) == 0) {
-                    if (S_ISDIR(st.st_mode)) {
-                        if (unlink(packageInstalledLinkDIR) == 0) {
-                            if (verbose) {
-                                printf("rm %s\n", packageInstalledLinkDIR);
-                            }
-                        } else {
-                            perror(packageInstalledLinkDIR);
-                            return XCPKG_ERROR;
-                        }
-
-                        return xcpkg_rm_rf(packageInstalledRealDIR, false, verbose);
-                    } else {
-                        // package is broken by other tools?
-                        return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
-                    }
-                } else {
-                    // package is broken by other tools?
-                    return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
-                }
-            } else {
-                // package is broken. is not installed completely?
-                return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+    bool stale = recorded && (readSize != 64 || strcmp(installedPackage->sha, sha) != 0);
+
+    xcpkg_installed_db_free(&db);
+
+    size_t packageInstalledRealDIRCapacity = packageInstalledRootDIRCapacity + 66U;
+    char   packageInstalledRealDIR[packageInstalledRealDIRCapacity];
+
+    ret = snprintf(packageInstalledRealDIR, packageInstalledRealDIRCapacity, "%s/%s", packageInstalledRootDIR, sha);
+
+    if (ret < 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
+
+    struct stat st;
+
+    if (readSize == 64 && strchr(sha, '/') == NULL && lstat(packageInstalledRealDIR, &st) == 0 && S_ISDIR(st.st_mode)) {
+        if (stale || !recorded) {
+            fprintf(stderr, "the record of package '%s' in installed.db does not match %s, it is repaired.\n", packageName, packageInstalledLinkDIR);
+        }
+
+        if (unlink(packageInstalledLinkDIR) == 0) {
+            if (verbose) {
+                printf("rm %s\n", packageInstalledLinkDIR);
             }
         } else {
-            return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
+            perror(packageInstalledLinkDIR);
+            return XCPKG_ERROR;
         }
+
+        ret = xcpkg_rm_rf(packageInstalledRealDIR, false, verbose);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        ret = xcpkg_installed_db_remove(packageName, targetPlatformSpec);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        ret = xcpkg_rdepends_index_update(packageName, targetPlatformSpec, NULL);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        return xcpkg_completion_cache_update(packageName, targetPlatformSpec, false);
     } else {
+        // package is broken by other tools? drop the stale record.
+        if (recorded) {
+            ret = xcpkg_installed_db_remove(packageName, targetPlatformSpec);
+
+            if (ret != XCPKG_OK) {
+                return ret;
+            }
+        }
+
         return XCPKG_ERROR_PACKAGE_NOT_INSTALLED;
     }
 }
+
+int xcpkg_uninstall(const char * packageName, const char * targetPlatformSpec, const bool verbose) {
+    int ret = xcpkg_check_if_the_given_argument_matches_package_name_pattern(packageName);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    // the same lock as install
+    int lockFD;
+
+    ret = xcpkg_lock_the_installed_package(packageName, targetPlatformSpec, &lockFD, NULL);
+
+    if (ret != XCPKG_OK) {
+        return ret;
+    }
+
+    ret = xcpkg_uninstall_locked(packageName, targetPlatformSpec, verbose);
+
+    xcpkg_unlock(lockFD);
+
+    return ret;
+}
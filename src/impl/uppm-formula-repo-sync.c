@@ -62,7 +62,7 @@ static int uppm_formula_repo_url_of_official_core(char buf[], const size_t bufSi
     }
 }
 
-static int uppm_formula_repo_sync_official_core_internal(const char * formulaRepoDIR) {
+static int uppm_formula_repo_sync_official_core_internal(const char * formulaRepoDIR, FILE * logFile) {
     char formulaRepoUrl[120];
 
     int ret = uppm_formula_repo_url_of_official_core(formulaRepoUrl, 120);
@@ -71,9 +71,9 @@ static int uppm_formula_repo_sync_official_core_internal(const char * formulaRep
         return ret;
     }
 
-    fprintf(stderr, "uppm formula repository is being synced from %s\n", formulaRepoUrl);
+    fprintf(logFile == NULL ? stderr : logFile, "uppm formula repository is being synced from %s\n", formulaRepoUrl);
 
-    ret = xcpkg_git_sync(formulaRepoDIR, formulaRepoUrl, "refs/heads/master", "refs/remote/heads/master", "master", 0);
+    ret = xcpkg_git_sync_with_log(formulaRepoDIR, formulaRepoUrl, "refs/heads/master", "refs/remote/heads/master", "master", 0, logFile);
 
     if (ret != XCPKG_OK) {
         return ret;
@@ -118,6 +118,10 @@ static int uppm_formula_repo_sync_official_core_internal(const char * formulaRep
 }
 
 int uppm_formula_repo_sync_official_core(const char * uppmHomeDIR, const size_t uppmHomeDIRLength) {
+    return uppm_formula_repo_sync_official_core_with_log(uppmHomeDIR, uppmHomeDIRLength, NULL);
+}
+
+int uppm_formula_repo_sync_official_core_with_log(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, FILE * logFile) {
     size_t formulaRepoDIRCapacity = uppmHomeDIRLength + 23U;
     char   formulaRepoDIR[formulaRepoDIRCapacity];
 
@@ -235,7 +239,7 @@ int uppm_formula_repo_sync_official_core(const char * uppmHomeDIR, const size_t
         }
     }
 
-    ret = uppm_formula_repo_sync_official_core_internal(formulaRepoDIR);
+    ret = uppm_formula_repo_sync_official_core_internal(formulaRepoDIR, logFile);
 
     close(formulaRepoDIRfd);
 
@@ -10,9 +10,13 @@
 #include <limits.h>
 #include <libgen.h>
 #include <dirent.h>
+#include <pthread.h>
 #include <sys/stat.h>
 
+#include <curl/curl.h>
+
 #include "../core/sysinfo.h"
+#include "../core/parallel.h"
 #include "../core/tar.h"
 
 #include "../base/sha256sum.h"
@@ -141,6 +145,7 @@ static int generate_install_shell_script_file(
         "PATH=\"$UPPM_HOME/installed/$item/bin:$PATH\"\n"
         "fi\n"
         "done\n\n"
+        "cd \"$PKG_INSTALL_DIR\"\n\n"
         "pwd\n";
 
     ret = dprintf(fd, "%s\n%s\n", str, formula->install);
@@ -269,7 +274,7 @@ static int uppm_record_installed_files(const char * installedDIRPath) {
     return ret;
 }
 
-static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageName, const UPPMFormula * formula, const bool verbose, const bool force) {
+static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageName, const UPPMFormula * formula, const bool verbose, const bool showProgress, const bool force) {
     if (!force) {
         int ret = uppm_check_if_the_given_package_is_installed(packageName, uppmHomeDIR, uppmHomeDIRLength);
 
@@ -291,10 +296,11 @@ static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHome
 
     //////////////////////////////////////////////////////////////////////////
 
-    size_t tmpStrCapacity = strlen(formula->bin_url) + 30U;
+    // packages are installed concurrently in the same process, so the package name is a part of the session id too
+    size_t tmpStrCapacity = strlen(formula->bin_url) + strlen(packageName) + 31U;
     char   tmpStr[tmpStrCapacity];
 
-    int ret = snprintf(tmpStr, tmpStrCapacity, "%s|%ld|%d", formula->bin_url, time(NULL), getpid());
+    int ret = snprintf(tmpStr, tmpStrCapacity, "%s|%s|%ld|%d", formula->bin_url, packageName, time(NULL), getpid());
 
     if (ret < 0) {
         perror(NULL);
@@ -409,7 +415,7 @@ static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHome
             return XCPKG_ERROR;
         }
 
-        ret = xcpkg_http_fetch_to_file(formula->bin_url, tmpFilePath, verbose, verbose);
+        ret = xcpkg_http_fetch_to_file(formula->bin_url, tmpFilePath, verbose, showProgress);
 
         if (ret != XCPKG_OK) {
             return ret;
@@ -562,11 +568,6 @@ static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHome
         }
     }
 
-    if (chdir(packageInstalledRealDIR) != 0) {
-        perror(packageInstalledRealDIR);
-        return XCPKG_ERROR;
-    }
-
     if (formula->install != NULL) {
         size_t shellScriptFilePathCapacity = packageInstalledRealDIRCapacity + 16U;
         char   shellScriptFilePath[shellScriptFilePathCapacity];
@@ -683,27 +684,33 @@ static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHome
 
     close(receiptFD);
 
-    if (chdir (packageInstalledRootDIR) != 0) {
-        perror(packageInstalledRootDIR);
+    // the current working directory is shared by all threads, so it is never changed here
+    size_t packageInstalledLinkPathCapacity = packageInstalledRootDIRCapacity + strlen(packageName) + 1U;
+    char   packageInstalledLinkPath[packageInstalledLinkPathCapacity];
+
+    ret = snprintf(packageInstalledLinkPath, packageInstalledLinkPathCapacity, "%s/%s", packageInstalledRootDIR, packageName);
+
+    if (ret < 0) {
+        perror(NULL);
         return XCPKG_ERROR;
     }
 
     for (;;) {
-        if (symlink(sessionID, packageName) == 0) {
+        if (symlink(sessionID, packageInstalledLinkPath) == 0) {
             fprintf(stderr, "uppm package '%s' was successfully installed.\n", packageName);
             return XCPKG_OK;
         } else {
             if (errno == EEXIST) {
-                if (lstat(packageName, &st) == 0) {
+                if (lstat(packageInstalledLinkPath, &st) == 0) {
                     if (S_ISDIR(st.st_mode)) {
-                        ret = xcpkg_rm_rf(packageName, false, verbose);
+                        ret = xcpkg_rm_rf(packageInstalledLinkPath, false, verbose);
 
                         if (ret != XCPKG_OK) {
                             return ret;
                         }
                     } else {
-                        if (unlink(packageName) != 0) {
-                            perror(packageName);
+                        if (unlink(packageInstalledLinkPath) != 0) {
+                            perror(packageInstalledLinkPath);
                             return XCPKG_ERROR;
                         }
                     }
@@ -716,86 +723,324 @@ static int uppm_install_internal(const char * uppmHomeDIR, const size_t uppmHome
     }
 }
 
-int uppm_install(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageName, const bool verbose, const bool force) {
-    UPPMFormula * formula = NULL;
+typedef struct {
+    char * packageName;
 
-    int ret = uppm_formula_lookup(uppmHomeDIR, uppmHomeDIRLength, packageName, &formula);
+    UPPMFormula * formula;
 
-    if (ret != XCPKG_OK) {
-        return ret;
-    }
+    // indexes of the jobs of the packages this package depends on
+    size_t * depJobIndexArray;
+    size_t   depJobIndexArraySize;
 
-    //////////////////////////////////////////////////////////////////////////
+    // a package is installed after all of its dependencies, packages of the same level are installed concurrently
+    unsigned int level;
+
+    // 0: not visited, 1: resolving its dependencies, 2: resolved
+    int  state;
+
+    bool needInstall;
+
+    int  ret;
+} UPPMInstallJob;
+
+typedef struct {
+    UPPMInstallJob * jobArray;
+    size_t           jobArraySize;
+    size_t           jobArrayCapacity;
+
+    const char * uppmHomeDIR;
+    size_t       uppmHomeDIRLength;
+
+    bool verbose;
+    bool force;
+
+    // the indexes of the jobs of the current level
+    size_t * levelJobIndexArray;
+    size_t   levelJobIndexArraySize;
+
+    size_t finishedCount;
+    size_t totalCount;
+
+    pthread_mutex_t progressMutex;
+} UPPMInstallPayload;
+
+static int uppm_install_job_add(UPPMInstallPayload * payload, const char * packageName, size_t * jobIndex);
+
+static int uppm_install_job_add_dependencies(UPPMInstallPayload * payload, size_t jobIndex) {
+    const char * p = payload->jobArray[jobIndex].formula->dep_pkg;
+
+    if (p == NULL) {
+        return XCPKG_OK;
+    }
 
     char depPackageName[51];
 
-    size_t i;
+    for (;;) {
+        while (p[0] == ' ') p++;
+
+        if (p[0] == '\0') {
+            return XCPKG_OK;
+        }
+
+        size_t i;
+
+        for (i = 0U; p[i] != ' ' && p[i] != '\0'; i++) {
+            if (i == 50U) {
+                fprintf(stderr, "uppm package name must be no more than 50 characters\n");
+                return XCPKG_ERROR;
+            }
+
+            depPackageName[i] = p[i];
+        }
+
+        depPackageName[i] = '\0';
+
+        p += i;
+
+        size_t depJobIndex;
+
+        int ret = uppm_install_job_add(payload, depPackageName, &depJobIndex);
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
 
-    const char * p = formula->dep_pkg;
+        // the job array might have been reallocated
+        UPPMInstallJob * job = &payload->jobArray[jobIndex];
 
-    if (p == NULL) goto finally;
+        size_t * q = (size_t*)realloc(job->depJobIndexArray, (job->depJobIndexArraySize + 1U) * sizeof(size_t));
 
-loop:
-    if (p[0] == '\0') {
-        goto finally;
+        if (q == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
+        }
+
+        job->depJobIndexArray = q;
+        job->depJobIndexArray[job->depJobIndexArraySize] = depJobIndex;
+        job->depJobIndexArraySize++;
+
+        unsigned int level = payload->jobArray[depJobIndex].level + 1U;
+
+        if (job->level < level) {
+            job->level = level;
+        }
     }
+}
+
+static int uppm_install_job_add(UPPMInstallPayload * payload, const char * packageName, size_t * jobIndex) {
+    for (size_t i = 0U; i < payload->jobArraySize; i++) {
+        UPPMInstallJob * job = &payload->jobArray[i];
+
+        if (strcmp(job->packageName, packageName) == 0) {
+            if (job->state == 1) {
+                fprintf(stderr, "circular dependency detected on uppm package '%s'.\n", packageName);
+                return XCPKG_ERROR;
+            }
 
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
+            *jobIndex = i;
+            return XCPKG_OK;
+        }
     }
 
-    //////////////////////////////////////////////////////////////////////////////
+    //////////////////////////////////////////////////////////////////////////
 
-    for(i = 0U; p[i] != ' ' && p[i] != '\0'; i++) {
-        if (i == 50U) {
-            fprintf(stderr, "uppm package name must be no more than 50 characters\n");
-            return XCPKG_ERROR;
+    if (payload->jobArraySize == payload->jobArrayCapacity) {
+        size_t newCapacity = payload->jobArrayCapacity + 16U;
+
+        UPPMInstallJob * p = (UPPMInstallJob*)realloc(payload->jobArray, newCapacity * sizeof(UPPMInstallJob));
+
+        if (p == NULL) {
+            return XCPKG_ERROR_MEMORY_ALLOCATE;
         }
 
-        depPackageName[i] = p[i];
+        payload->jobArray = p;
+        payload->jobArrayCapacity = newCapacity;
     }
 
-    depPackageName[i] = '\0';
+    size_t index = payload->jobArraySize;
 
-    //////////////////////////////////////////////////////////////////////////////
+    UPPMInstallJob * job = &payload->jobArray[index];
 
-    fprintf(stderr, "depPackageName=%s\n", depPackageName);
-    ret = uppm_install(uppmHomeDIR, uppmHomeDIRLength, depPackageName, verbose, force);
+    memset(job, 0, sizeof(UPPMInstallJob));
+
+    payload->jobArraySize++;
+
+    job->packageName = strdup(packageName);
+
+    if (job->packageName == NULL) {
+        return XCPKG_ERROR_MEMORY_ALLOCATE;
+    }
+
+    int ret = uppm_formula_lookup(payload->uppmHomeDIR, payload->uppmHomeDIRLength, packageName, &job->formula);
 
     if (ret != XCPKG_OK) {
-        uppm_formula_free(formula);
         return ret;
     }
 
-    //////////////////////////////////////////////////////////////////////////////
+    job->state = 1;
 
-    p += i;
+    ret = uppm_install_job_add_dependencies(payload, index);
 
-    if (p[0] == ' ') {
-        p++;
-        goto loop;
+    if (ret != XCPKG_OK) {
+        return ret;
     }
 
-finally:
-    ret = uppm_install_internal(uppmHomeDIR, uppmHomeDIRLength, packageName, formula, verbose, force);
+    payload->jobArray[index].state = 2;
 
-    uppm_formula_free(formula);
+    *jobIndex = index;
 
-    return ret;
+    return XCPKG_OK;
+}
+
+static int uppm_install_job_run(size_t index, void * arg) {
+    UPPMInstallPayload * payload = (UPPMInstallPayload*)arg;
+
+    UPPMInstallJob * job = &payload->jobArray[payload->levelJobIndexArray[index]];
+
+    // the progress bars of concurrent downloads would be garbled
+    bool showProgress = payload->verbose && payload->levelJobIndexArraySize == 1U;
+
+    job->ret = uppm_install_internal(payload->uppmHomeDIR, payload->uppmHomeDIRLength, job->packageName, job->formula, payload->verbose, showProgress, payload->force);
+
+    pthread_mutex_lock(&payload->progressMutex);
+
+    payload->finishedCount++;
+
+    if (job->ret == XCPKG_OK) {
+        fprintf(stderr, "[%zu/%zu] uppm package '%s' installed.\n", payload->finishedCount, payload->totalCount, job->packageName);
+    } else {
+        fprintf(stderr, "[%zu/%zu] uppm package '%s' failed to install.\n", payload->finishedCount, payload->totalCount, job->packageName);
+    }
+
+    pthread_mutex_unlock(&payload->progressMutex);
+
+    return job->ret;
 }
 
-int uppm_install_the_given_packages(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageNames[], size_t size) {
-    for (size_t i = 0; i < size; i++) {
-        const char * packageName = packageNames[i];
+int uppm_install_the_given_packages(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageNames[], const size_t size, const bool verbose, const bool force) {
+    UPPMInstallPayload payload = {0};
+
+    payload.uppmHomeDIR = uppmHomeDIR;
+    payload.uppmHomeDIRLength = uppmHomeDIRLength;
+    payload.verbose = verbose;
+    payload.force = force;
 
-        UPPMFormula * formula = NULL;
+    int ret = XCPKG_OK;
 
-        int ret = uppm_formula_lookup(uppmHomeDIR, uppmHomeDIRLength, packageName, &formula);
+    for (size_t i = 0U; i < size; i++) {
+        size_t jobIndex;
+
+        ret = uppm_install_job_add(&payload, packageNames[i], &jobIndex);
 
         if (ret != XCPKG_OK) {
-            return ret;
+            goto finalize;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    unsigned int maxLevel = 0U;
+
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        UPPMInstallJob * job = &payload.jobArray[i];
+
+        if (force) {
+            job->needInstall = true;
+        } else {
+            ret = uppm_check_if_the_given_package_is_installed(job->packageName, uppmHomeDIR, uppmHomeDIRLength);
+
+            if (ret == XCPKG_OK) {
+                continue;
+            }
+
+            if (ret != UPPM_ERROR_PACKAGE_NOT_INSTALLED) {
+                goto finalize;
+            }
+
+            job->needInstall = true;
+        }
+
+        payload.totalCount++;
+
+        if (maxLevel < job->level) {
+            maxLevel = job->level;
+        }
+    }
+
+    ret = XCPKG_OK;
+
+    if (payload.totalCount == 0U) {
+        goto finalize;
+    }
+
+    payload.levelJobIndexArray = (size_t*)malloc(payload.jobArraySize * sizeof(size_t));
+
+    if (payload.levelJobIndexArray == NULL) {
+        ret = XCPKG_ERROR_MEMORY_ALLOCATE;
+        goto finalize;
+    }
+
+    if (pthread_mutex_init(&payload.progressMutex, NULL) != 0) {
+        perror(NULL);
+        ret = XCPKG_ERROR;
+        goto finalize;
+    }
+
+    // keep libcurl initialized during all the jobs, so that the curl_global_init() and curl_global_cleanup() of every download do not set up and tear down it concurrently
+    curl_global_init(CURL_GLOBAL_ALL);
+
+    for (unsigned int level = 0U; level <= maxLevel; level++) {
+        payload.levelJobIndexArraySize = 0U;
+
+        for (size_t i = 0U; i < payload.jobArraySize; i++) {
+            if (payload.jobArray[i].needInstall && payload.jobArray[i].level == level) {
+                payload.levelJobIndexArray[payload.levelJobIndexArraySize++] = i;
+            }
+        }
+
+        if (parallel_for(payload.levelJobIndexArraySize, parallel_network_jobs(), uppm_install_job_run, &payload) != 0) {
+            perror(NULL);
+            ret = XCPKG_ERROR;
+            break;
+        }
+
+        // the next level depends on this level, so it is not started if any job of this level failed
+        for (size_t i = 0U; i < payload.levelJobIndexArraySize; i++) {
+            const UPPMInstallJob * job = &payload.jobArray[payload.levelJobIndexArray[i]];
+
+            if (job->ret != XCPKG_OK) {
+                ret = job->ret;
+                break;
+            }
+        }
+
+        if (ret != XCPKG_OK) {
+            break;
+        }
+    }
+
+    curl_global_cleanup();
+
+    pthread_mutex_destroy(&payload.progressMutex);
+
+finalize:
+    for (size_t i = 0U; i < payload.jobArraySize; i++) {
+        UPPMInstallJob * job = &payload.jobArray[i];
+
+        free(job->packageName);
+        free(job->depJobIndexArray);
+
+        if (job->formula != NULL) {
+            uppm_formula_free(job->formula);
         }
     }
-    return 0;
+
+    free(payload.jobArray);
+    free(payload.levelJobIndexArray);
+
+    return ret;
+}
+
+int uppm_install(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageName, const bool verbose, const bool force) {
+    const char * packageNames[1] = { packageName };
+    return uppm_install_the_given_packages(uppmHomeDIR, uppmHomeDIRLength, packageNames, 1U, verbose, force);
 }
@@ -26,6 +26,7 @@ typedef struct {
 } UPPMFormulaRepo ;
 
 int  uppm_formula_repo_sync_official_core(const char * uppmHomeDIR, const size_t uppmHomeDIRLength);
+int  uppm_formula_repo_sync_official_core_with_log(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, FILE * logFile);
 int  uppm_formula_repo_parse(const char * formulaRepoConfigFilePath, UPPMFormulaRepo * * formulaRepo);
 void uppm_formula_repo_free(UPPMFormulaRepo * formulaRepo);
 void uppm_formula_repo_dump(UPPMFormulaRepo * formulaRepo);
@@ -71,6 +72,12 @@ void uppm_receipt_dump(UPPMReceipt * receipt);
 
 int uppm_install(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageName, const bool verbose, const bool force);
 
+/** install the given packages and their dependencies.
+ *
+ *  a package is installed after all of the packages in its dep_pkg, the packages which do not depend on each other are fetched and extracted concurrently.
+ */
+int uppm_install_the_given_packages(const char * uppmHomeDIR, const size_t uppmHomeDIRLength, const char * packageNames[], const size_t size, const bool verbose, const bool force);
+
 int uppm_check_if_the_given_argument_matches_package_name_pattern(const char * arg);
 
 int uppm_check_if_the_given_package_is_available(const char * packageName, const char * uppmHomeDIR, const size_t uppmHomeDIRLength);
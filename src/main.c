@@ -5,6 +5,7 @@
 #include "core/log.h"
 #include "core/printenv.h"
 #include "core/list-PATH.h"
+#include "core/trace.h"
 
 #include "main.h"
 #include "util.h"
@@ -53,9 +54,9 @@ int xcpkg_main_util(int argc, char* argv[]) {
 
     const XCPKGAction actions[] = {
         {"base16-encode",        xcpkg_util_base16_encode},
-        {"base16-encode",        xcpkg_util_base16_decode},
+        {"base16-decode",        xcpkg_util_base16_decode},
         {"base64-encode",        xcpkg_util_base64_encode},
-        {"base64-encode",        xcpkg_util_base64_decode},
+        {"base64-decode",        xcpkg_util_base64_decode},
         {"zlib-deflate",         xcpkg_util_zlib_deflate},
         {"zlib-inflate",         xcpkg_util_zlib_inflate},
         {"sha256sum",            xcpkg_util_sha256sum},
@@ -103,6 +104,11 @@ int main(int argc, char* argv[]) {
 
     ///////////////////////////////////////////////////
 
+    // XCPKG_TRACE=1 prints its summary at exit, the elapsed time is counted from here
+    trace_init();
+
+    ///////////////////////////////////////////////////
+
     int ret = xcpkg_setenv();
 
     if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
@@ -124,16 +130,20 @@ int main(int argc, char* argv[]) {
         {"info",         xcpkg_main_info_available},
         {"show",         xcpkg_main_info_installed},
         {"depends",      xcpkg_main_depends},
+        {"rdepends",     xcpkg_main_rdepends},
         {"fetch",        xcpkg_main_fetch},
         {"install",      xcpkg_main_install},
         {"reinstall",    xcpkg_main_reinstall},
         {"uninstall",    xcpkg_main_uninstall},
         {"upgrade",      xcpkg_main_upgrade},
         {"cleanup",      xcpkg_main_cleanup},
+        {"db",           xcpkg_main_db},
+        {"dedup",        xcpkg_main_dedup},
 
         {"tree",         xcpkg_main_tree},
         {"logs",         xcpkg_main_logs},
         {"bundle",       xcpkg_main_bundle},
+        {"bundle-extract", xcpkg_main_bundle_extract},
         {"xcinfo",       xcpkg_main_xcinfo},
         {"util",         xcpkg_main_util},
 
@@ -146,6 +156,7 @@ int main(int argc, char* argv[]) {
         {"is-outdated",  xcpkg_main_is_outdated},
 
         {"completion",   xcpkg_main_completion},
+        {"__complete",   xcpkg_main_complete},
         {"upgrade-self", xcpkg_main_upgrade_self},
 
         {"formula-cat",  xcpkg_main_formula_cat},
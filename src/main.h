@@ -6,6 +6,8 @@
 DECLARE_MAIN(about)
 DECLARE_MAIN(xcinfo)
 DECLARE_MAIN(cleanup)
+DECLARE_MAIN(db)
+DECLARE_MAIN(dedup)
 DECLARE_MAIN(completion)
 DECLARE_MAIN(util)
 
@@ -14,6 +16,8 @@ DECLARE_MAIN(update)
 
 DECLARE_MAIN(search)
 DECLARE_MAIN(depends)
+DECLARE_MAIN(rdepends)
+DECLARE_MAIN(complete)
 DECLARE_MAIN(info_available)
 DECLARE_MAIN(info_installed)
 DECLARE_MAIN(fetch)
@@ -26,6 +30,7 @@ DECLARE_MAIN(upgrade)
 DECLARE_MAIN(tree)
 DECLARE_MAIN(logs)
 DECLARE_MAIN(bundle)
+DECLARE_MAIN(bundle_extract)
 
 DECLARE_MAIN(ls_available)
 DECLARE_MAIN(ls_installed)
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../xcpkg.h"
+#include "../core/log.h"
+
+/**
+ *  xcpkg bundle-extract <BUNDLE-FILE> [<PATH>...] [-C <OUTPUT-DIR>] [-l] [-v]
+ */
+int xcpkg_main_bundle_extract(int argc, char* argv[]) {
+    if (argv[2] == NULL) {
+        fprintf(stderr, "Usage: %s bundle-extract <BUNDLE-FILE> [<PATH>...], <BUNDLE-FILE> is unspecified.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
+    }
+
+    if (argv[2][0] == '\0') {
+        fprintf(stderr, "Usage: %s bundle-extract <BUNDLE-FILE> [<PATH>...], <BUNDLE-FILE> must be a non-empty string.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    const char * outputDIR = NULL;
+
+    bool list = false;
+    bool verbose = false;
+
+    char * paths[argc];
+    size_t pathsCount = 0U;
+
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "-l") == 0) {
+            list = true;
+        } else if (strcmp(argv[i], "-C") == 0) {
+            outputDIR = argv[++i];
+
+            if (outputDIR == NULL) {
+                fprintf(stderr, "-C <OUTPUT-DIR>, <OUTPUT-DIR> is unspecified.\n");
+                return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
+            }
+
+            if (outputDIR[0] == '\0') {
+                fprintf(stderr, "-C <OUTPUT-DIR>, <OUTPUT-DIR> should be a non-empty string.\n");
+                return XCPKG_ERROR_ARG_IS_EMPTY;
+            }
+        } else if (argv[i][0] == '-') {
+            LOG_ERROR2("unknown argument: ", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        } else {
+            paths[pathsCount] = argv[i];
+            pathsCount++;
+        }
+    }
+
+    if (!list && pathsCount == 0U) {
+        fprintf(stderr, "Usage: %s bundle-extract <BUNDLE-FILE> <PATH>..., <PATH> is unspecified.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
+    }
+
+    int ret = xcpkg_bundle_extract(argv[2], outputDIR, paths, pathsCount, list, verbose);
+
+    if (ret == XCPKG_ERROR) {
+        fprintf(stderr, "occurs error.\n");
+    }
+
+    return ret;
+}
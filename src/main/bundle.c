@@ -43,6 +43,10 @@ int xcpkg_main_bundle(int argc, char* argv[]) {
             outputType = ArchiveType_tar_xz;
         } else if (strcmp(&argv[3][1], "tar.bz2") == 0) {
             outputType = ArchiveType_tar_bz2;
+        } else if (strcmp(&argv[3][1], "tar.zst") == 0) {
+            outputType = ArchiveType_tar_zst;
+        } else if (strcmp(&argv[3][1], "xsb") == 0) {
+            outputType = ArchiveType_seekable;
         } else {
             LOG_ERROR2("unknown bundle type: ", argv[3]);
             return XCPKG_ERROR_ARG_IS_UNKNOWN;
@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../xcpkg.h"
+#include "../core/log.h"
+
+/**
+ *  xcpkg __complete [PREFIX] [--installed]
+ *
+ *  this command is used by shell completion scripts, it is not intended to be used by humans.
+ */
+int xcpkg_main_complete(int argc, char* argv[]) {
+    const char * prefix = NULL;
+
+    bool installed = false;
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--installed") == 0) {
+            installed = true;
+        } else if (prefix == NULL) {
+            prefix = argv[i];
+        } else {
+            LOG_ERROR2("unknown argument: ", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        }
+    }
+
+    int ret = xcpkg_complete(prefix, installed);
+
+    if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
+        LOG_ERROR1("HOME environment variable is not set.");
+    } else if (ret == XCPKG_ERROR) {
+        LOG_ERROR1("occurs error.");
+    }
+
+    return ret;
+}
@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../xcpkg.h"
+#include "../core/log.h"
+
+/**
+ *  xcpkg db rebuild
+ */
+int xcpkg_main_db(int argc, char* argv[]) {
+    if (argv[2] == NULL) {
+        fprintf(stderr, "Usage: %s db rebuild, the sub-command is unspecified.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
+    }
+
+    if (strcmp(argv[2], "rebuild") != 0) {
+        LOG_ERROR2("unknown sub-command: ", argv[2]);
+        return XCPKG_ERROR_ARG_IS_UNKNOWN;
+    }
+
+    for (int i = 3; i < argc; i++) {
+        LOG_ERROR2("unknown argument: ", argv[i]);
+        return XCPKG_ERROR_ARG_IS_UNKNOWN;
+    }
+
+    int ret = xcpkg_installed_db_rebuild();
+
+    if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
+        fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
+    } else if (ret == XCPKG_ERROR) {
+        fprintf(stderr, "occurs error.\n");
+    }
+
+    return ret;
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../xcpkg.h"
+#include "../core/log.h"
+
+/**
+ *  xcpkg dedup [<PACKAGE-SPEC>] [--target=<TARGET-PLATFORM-SPEC>] [--hardlink] [--dry-run] [-v]
+ */
+int xcpkg_main_dedup(int argc, char* argv[]) {
+    const char * package = NULL;
+
+    const char * targetPlatformSpec = NULL;
+
+    XCPKGDedupMode mode = XCPKGDedupMode_reflink;
+
+    bool dryrun = false;
+    bool verbose = false;
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "--dry-run") == 0) {
+            dryrun = true;
+        } else if (strcmp(argv[i], "--hardlink") == 0) {
+            mode = XCPKGDedupMode_hardlink;
+        } else if (strncmp(argv[i], "--target=", 9) == 0) {
+            targetPlatformSpec = &argv[i][9];
+
+            if (targetPlatformSpec[0] == '\0') {
+                fprintf(stderr, "--target=<TARGET-PLATFORM-SPEC>, <TARGET-PLATFORM-SPEC> should be a non-empty string.\n");
+                return XCPKG_ERROR;
+            }
+        } else if (argv[i][0] == '-' || package != NULL) {
+            LOG_ERROR2("unknown argument: ", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        } else {
+            package = argv[i];
+        }
+    }
+
+    const char * packageName = NULL;
+
+    char buf[51];
+
+    if (package != NULL) {
+        const char * platformSpec = NULL;
+
+        int ret = xcpkg_inspect_package(package, targetPlatformSpec, &packageName, &platformSpec, buf);
+
+        if (ret == XCPKG_ERROR_ARG_IS_EMPTY) {
+            fprintf(stderr, "Usage: %s dedup <PACKAGE-NAME|PACKAGE-SPEC>, <PACKAGE-NAME|PACKAGE-SPEC> is empty string.\n", argv[0]);
+        } else if (ret == XCPKG_ERROR_PACKAGE_NAME_IS_INVALID) {
+            fprintf(stderr, "Usage: %s dedup <PACKAGE-NAME|PACKAGE-SPEC>, <PACKAGE-NAME|PACKAGE-SPEC> does not match pattern %s\n", argv[0], XCPKG_PACKAGE_NAME_PATTERN);
+        } else if (ret == XCPKG_ERROR_PLATFORM_SPEC_IS_INVALID) {
+            fprintf(stderr, "Usage: %s dedup <PACKAGE-NAME|PACKAGE-SPEC>, <TARGET-SPEC> does not match pattern A-B-C\n", argv[0]);
+        }
+
+        if (ret != XCPKG_OK) {
+            return ret;
+        }
+
+        targetPlatformSpec = platformSpec == NULL ? buf : platformSpec;
+    }
+
+    int ret = xcpkg_dedup(packageName, targetPlatformSpec, mode, dryrun, verbose);
+
+    if (ret == XCPKG_ERROR_PACKAGE_NOT_INSTALLED) {
+        fprintf(stderr, "package '%s' is not installed.\n", packageName);
+    } else if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
+        fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
+    } else if (ret == XCPKG_ERROR) {
+        fprintf(stderr, "occurs error.\n");
+    }
+
+    return ret;
+}
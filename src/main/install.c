@@ -57,6 +57,12 @@ int xcpkg_main_install(int argc, char* argv[]) {
             installOptions.dryrun = true;
         } else if (strcmp(argv[i], "-K") == 0) {
             installOptions.keepSessionDIR = true;
+        } else if (strcmp(argv[i], "--dedup") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_reflink;
+        } else if (strcmp(argv[i], "--dedup=hardlink") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_hardlink;
         } else if (strcmp(argv[i], "-E") == 0) {
             installOptions.exportCompileCommandsJson = true;
         } else if (strcmp(argv[i], "--enable-ccache") == 0) {
@@ -146,6 +152,11 @@ int xcpkg_main_install(int argc, char* argv[]) {
         return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
     }
 
+    const char * packageNames[packageIndexArraySize];
+    const char * platformSpecs[packageIndexArraySize];
+
+    char platformSpecBufs[packageIndexArraySize][51];
+
     for (int i = 0; i < packageIndexArraySize; i++) {
         const char * package = argv[packageIndexArray[i]];
 
@@ -153,9 +164,7 @@ int xcpkg_main_install(int argc, char* argv[]) {
 
         const char * platformSpec = NULL;
 
-        char buf[51];
-
-        int ret = xcpkg_inspect_package(package, targetPlatformSpec, &packageName, &platformSpec, buf);
+        int ret = xcpkg_inspect_package(package, targetPlatformSpec, &packageName, &platformSpec, platformSpecBufs[i]);
 
         if (ret == XCPKG_ERROR_ARG_IS_NULL) {
             fprintf(stderr, "Usage: %s %s <PACKAGE-NAME|PACKAGE-SPEC>, <PACKAGE-NAME|PACKAGE-SPEC> is not given.\n", argv[0], argv[1]);
@@ -172,29 +181,24 @@ int xcpkg_main_install(int argc, char* argv[]) {
         }
 
         if (platformSpec == NULL) {
-            platformSpec = buf;
+            platformSpec = platformSpecBufs[i];
         }
 
-        ret = xcpkg_install(packageName, platformSpec, &installOptions);
-
-        if (ret == XCPKG_ERROR_PACKAGE_NAME_IS_INVALID) {
-            fprintf(stderr, "Usage: %s %s <PACKAGE-NAME>, <PACKAGE-NAME> does not match pattern %s\n", argv[0], argv[1], XCPKG_PACKAGE_NAME_PATTERN);
-        } else if (ret == XCPKG_ERROR_PACKAGE_NOT_AVAILABLE) {
-            fprintf(stderr, "package '%s' is not available.\n", packageName);
-        } else if (ret == XCPKG_ERROR_PACKAGE_NOT_INSTALLED) {
-            fprintf(stderr, "package '%s' is not installed.\n", packageName);
-        } else if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
-            fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
-        } else if (ret == XCPKG_ERROR_ENV_PATH_NOT_SET) {
-            fprintf(stderr, "%s\n", "PATH environment variable is not set.\n");
-        } else if (ret == XCPKG_ERROR) {
-            fprintf(stderr, "occurs error.\n");
-        }
+        packageNames[i] = packageName;
+        platformSpecs[i] = platformSpec;
+    }
 
-        if (ret != XCPKG_OK) {
-            return ret;
-        }
+    int ret = xcpkg_install_packages(packageIndexArraySize, packageNames, platformSpecs, &installOptions);
+
+    if (ret == XCPKG_ERROR_PACKAGE_NAME_IS_INVALID) {
+        fprintf(stderr, "Usage: %s %s <PACKAGE-NAME>, <PACKAGE-NAME> does not match pattern %s\n", argv[0], argv[1], XCPKG_PACKAGE_NAME_PATTERN);
+    } else if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
+        fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
+    } else if (ret == XCPKG_ERROR_ENV_PATH_NOT_SET) {
+        fprintf(stderr, "%s\n", "PATH environment variable is not set.\n");
+    } else if (ret == XCPKG_ERROR) {
+        fprintf(stderr, "occurs error.\n");
     }
 
-    return XCPKG_OK;
+    return ret;
 }
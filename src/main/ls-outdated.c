@@ -6,21 +6,25 @@
 #include "../core/log.h"
 
 /**
- *  xcpkg ls-outdated [-v]
+ *  xcpkg ls-outdated [-v] [--json]
  */
 int xcpkg_main_ls_outdated(int argc, char* argv[]) {
     bool verbose = false;
 
+    bool json = false;
+
     for (int i = 2; i < argc; i++) {
         if (strcmp(argv[i], "-v") == 0) {
             verbose = true;
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = true;
         } else {
             LOG_ERROR2("unknown argument: ", argv[i]);
             return XCPKG_ERROR_ARG_IS_UNKNOWN;
         }
     }
 
-    int ret = xcpkg_list_the__outdated_packages(NULL, verbose);
+    int ret = xcpkg_list_the__outdated_packages(NULL, verbose, json);
 
     if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
         fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
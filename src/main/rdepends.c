@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../xcpkg.h"
+#include "../core/log.h"
+
+/**
+ *  xcpkg rdepends <PACKAGE-NAME> [--installed] [--transitive]
+ */
+int xcpkg_main_rdepends(int argc, char* argv[]) {
+    if (argv[2] == NULL) {
+        fprintf(stderr, "Usage: %s rdepends <PACKAGE-NAME>, <PACKAGE-NAME> is unspecified.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_UNSPECIFIED;
+    }
+
+    if (argv[2][0] == '\0') {
+        fprintf(stderr, "Usage: %s rdepends <PACKAGE-NAME>, <PACKAGE-NAME> should be a non-empty string.\n", argv[0]);
+        return XCPKG_ERROR_ARG_IS_EMPTY;
+    }
+
+    bool installed = false;
+    bool transitive = false;
+
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--installed") == 0) {
+            installed = true;
+        } else if (strcmp(argv[i], "--transitive") == 0) {
+            transitive = true;
+        } else {
+            LOG_ERROR2("unknown argument: ", argv[i]);
+            return XCPKG_ERROR_ARG_IS_UNKNOWN;
+        }
+    }
+
+    int ret = xcpkg_rdepends(argv[2], installed, transitive);
+
+    if (ret == XCPKG_ERROR_PACKAGE_NAME_IS_INVALID) {
+        fprintf(stderr, "Usage: %s rdepends <PACKAGE-NAME>, <PACKAGE-NAME> does not match pattern %s\n", argv[0], XCPKG_PACKAGE_NAME_PATTERN);
+    } else if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
+        fprintf(stderr, "%s\n", "HOME environment variable is not set.\n");
+    } else if (ret == XCPKG_ERROR) {
+        fprintf(stderr, "occurs error.\n");
+    }
+
+    return ret;
+}
@@ -41,6 +41,12 @@ int xcpkg_main_reinstall(int argc, char* argv[]) {
             installOptions.dryrun = true;
         } else if (strcmp(argv[i], "-K") == 0) {
             installOptions.keepSessionDIR = true;
+        } else if (strcmp(argv[i], "--dedup") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_reflink;
+        } else if (strcmp(argv[i], "--dedup=hardlink") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_hardlink;
         } else if (strcmp(argv[i], "-E") == 0) {
             installOptions.exportCompileCommandsJson = true;
         } else if (strcmp(argv[i], "--enable-ccache") == 0) {
@@ -140,8 +146,6 @@ int xcpkg_main_reinstall(int argc, char* argv[]) {
 
         if (ret == XCPKG_ERROR_PACKAGE_NAME_IS_INVALID) {
             fprintf(stderr, "Usage: %s %s <PACKAGE-NAME>, <PACKAGE-NAME> does not match pattern %s\n", argv[0], argv[1], XCPKG_PACKAGE_NAME_PATTERN);
-        } else if (ret == XCPKG_ERROR_PACKAGE_NOT_AVAILABLE) {
-            fprintf(stderr, "package '%s' is not available.\n", packageName);
         } else if (ret == XCPKG_ERROR_PACKAGE_NOT_INSTALLED) {
             fprintf(stderr, "package '%s' is not installed.\n", packageName);
         } else if (ret == XCPKG_ERROR_ENV_HOME_NOT_SET) {
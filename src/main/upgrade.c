@@ -41,6 +41,12 @@ int xcpkg_main_upgrade(int argc, char* argv[]) {
             installOptions.dryrun = true;
         } else if (strcmp(argv[i], "-K") == 0) {
             installOptions.keepSessionDIR = true;
+        } else if (strcmp(argv[i], "--dedup") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_reflink;
+        } else if (strcmp(argv[i], "--dedup=hardlink") == 0) {
+            installOptions.dedup = true;
+            installOptions.dedupMode = XCPKGDedupMode_hardlink;
         } else if (strcmp(argv[i], "-E") == 0) {
             installOptions.exportCompileCommandsJson = true;
         } else if (strcmp(argv[i], "--enable-ccache") == 0) {
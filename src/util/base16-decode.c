@@ -14,8 +14,16 @@
  */
 int xcpkg_util_base16_decode(int argc, char* argv[]) {
     if (argv[3] == NULL) {
-        fprintf(stderr, "Usage: %s %s %s <BASE16-ENCODED-STR> , <BASE16-ENCODED-STR> is unspecified.\n", argv[0], argv[1], argv[2]);
-        return XCPKG_ERROR_ARG_IS_NULL;
+        if (base16_decode_stream(STDIN_FILENO, STDOUT_FILENO) != 0) {
+            perror(NULL);
+            return errno == EINVAL ? XCPKG_ERROR_ARG_IS_INVALID : XCPKG_ERROR;
+        }
+
+        if (isatty(STDOUT_FILENO)) {
+            printf("\n");
+        }
+
+        return XCPKG_OK;
     }
 
     if (argv[3][0] == '\0') {
@@ -9,44 +9,16 @@
 #include "../util.h"
 
 static inline int xcpkg_util_base16_encode_stdin() {
-    unsigned char inputBuf[1024];
-
-    for (;;) {
-        ssize_t readSizeInBytes = read(STDIN_FILENO, inputBuf, 1024);
-
-        if (readSizeInBytes == -1) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
-
-        if (readSizeInBytes == 0) {
-            if (isatty(STDOUT_FILENO)) {
-                printf("\n");
-            }
-
-            return XCPKG_OK;
-        }
-
-        size_t outputBufSizeInBytes = readSizeInBytes << 1;
-        char   outputBuf[outputBufSizeInBytes];
-
-        if (base16_encode(outputBuf, inputBuf, readSizeInBytes, true) != 0) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
-
-        ssize_t writeSizeInBytes = write(STDOUT_FILENO, outputBuf, outputBufSizeInBytes);
-
-        if (writeSizeInBytes == -1) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
+    if (base16_encode_stream(STDIN_FILENO, STDOUT_FILENO, true) != 0) {
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
 
-        if ((size_t)writeSizeInBytes != outputBufSizeInBytes) {
-            fprintf(stderr, "not fully written to stdout.\n");
-            return XCPKG_ERROR;
-        }
+    if (isatty(STDOUT_FILENO)) {
+        printf("\n");
     }
+
+    return XCPKG_OK;
 }
 
 static inline int xcpkg_util_base16_encode_string(const char * s) {
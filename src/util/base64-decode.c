@@ -1,68 +1,41 @@
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 
 #include <unistd.h>
 
-#include <openssl/evp.h>
+#include "../core/base64.h"
 
 #include "../xcpkg.h"
 
 #include "../util.h"
 
 static inline int xcpkg_util_base64_decode_stdin() {
-    unsigned char readBuf[1024];
-
-    for (;;) {
-        ssize_t readSizeInBytes = read(STDIN_FILENO, readBuf, 1024);
-
-        if (readSizeInBytes == -1) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
-
-        if (readSizeInBytes == 0) {
-            if (isatty(STDOUT_FILENO)) {
-                printf("\n");
-            }
-
-            return XCPKG_OK;
-        }
-
-        unsigned int  outputBufSizeInBytes = (readSizeInBytes >> 2) * 3;
-        unsigned char outputBuf[outputBufSizeInBytes];
-
-        // EVP_DecodeBlock() returns the length of the data decoded or -1 on error.
-        int n = EVP_DecodeBlock(outputBuf, readBuf, readSizeInBytes);
-
-        if (n < 0) {
+    if (base64_decode_stream(STDIN_FILENO, STDOUT_FILENO) != 0) {
+        if (errno == EINVAL) {
+            fprintf(stderr, "invalid base64 encoded data.\n");
             return XCPKG_ERROR_ARG_IS_INVALID;
         }
 
-        ssize_t writeSizeInBytes = write(STDOUT_FILENO, outputBuf, outputBufSizeInBytes);
-
-        if (writeSizeInBytes == -1) {
-            perror(NULL);
-            return XCPKG_ERROR;
-        }
+        perror(NULL);
+        return XCPKG_ERROR;
+    }
 
-        if ((size_t)writeSizeInBytes != outputBufSizeInBytes) {
-            fprintf(stderr, "not fully written to stdout.\n");
-            return XCPKG_ERROR;
-        }
+    if (isatty(STDOUT_FILENO)) {
+        printf("\n");
     }
+
+    return XCPKG_OK;
 }
 
 static inline int xcpkg_util_base64_decode_string(const char * s) {
-    unsigned char * inputBuf = (unsigned char *)s;
-    unsigned int    inputBufSizeInBytes = strlen(s);
-
-    unsigned int  outputBufSizeInBytes = (inputBufSizeInBytes >> 2) * 3;
-    unsigned char outputBuf[outputBufSizeInBytes];
+    size_t inputBufSizeInBytes = strlen(s);
 
-    // EVP_DecodeBlock() returns the length of the data decoded or -1 on error.
-    int n = EVP_DecodeBlock(outputBuf, inputBuf, inputBufSizeInBytes);
+    size_t        outputBufSizeInBytes = (inputBufSizeInBytes >> 2) * 3U;
+    unsigned char outputBuf[outputBufSizeInBytes + 1U];
 
-    if (n < 0) {
+    if (base64_decode(outputBuf, &outputBufSizeInBytes, s, inputBufSizeInBytes) != 0) {
+        fprintf(stderr, "invalid base64 encoded data.\n");
         return XCPKG_ERROR_ARG_IS_INVALID;
     }
 
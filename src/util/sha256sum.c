@@ -24,9 +24,11 @@ int xcpkg_util_sha256sum(int argc, char* argv[]) {
     }
 
     if (strcmp(argv[3], "-h") == 0 || strcmp(argv[3], "--help") == 0) {
-        fprintf(stderr, "Usage: %s %s %s [FILEPATH]\n", argv[0], argv[1], argv[2]);
+        fprintf(stderr, "Usage: %s %s %s [FILEPATH...]\n", argv[0], argv[1], argv[2]);
         return XCPKG_OK;
-    } else {
+    }
+
+    if (argv[4] == NULL) {
         char outputBuf[65] = {0};
 
         if (sha256sum_of_file(outputBuf, argv[3]) == 0) {
@@ -36,4 +38,24 @@ int xcpkg_util_sha256sum(int argc, char* argv[]) {
             return XCPKG_ERROR;
         }
     }
+
+    // more than one file are given, hash them concurrently and print them in the format of sha256sum(1)
+    size_t n = (size_t)(argc - 3);
+
+    char outputBufs[n][65];
+    int  rets[n];
+
+    for (size_t i = 0U; i < n; i++) {
+        rets[i] = XCPKG_ERROR;
+    }
+
+    int ret = sha256sum_of_files(outputBufs, rets, (const char * const *)&argv[3], n, 0U);
+
+    for (size_t i = 0U; i < n; i++) {
+        if (rets[i] == XCPKG_OK) {
+            printf("%s  %s\n", outputBufs[i], argv[i + 3]);
+        }
+    }
+
+    return ret;
 }
@@ -1,5 +1,7 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 
 #include "../core/zlib-flate.h"
 #include "../core/log.h"
@@ -8,39 +10,75 @@
 #include "../util.h"
 
 /**
- *  xcpkg util zlib-deflate -L <LEVEL> < input/file/path
+ *  xcpkg util zlib-deflate [-L <LEVEL>] [-j <N>] [--gzip] < input/file/path
+ *
+ *  -j 1 without --gzip produces exactly the same stream as zlib's deflate() does.
  */
 int xcpkg_util_zlib_deflate(int argc, char* argv[]) {
     int level = 1;
 
+    // 0 means as many threads as cpus
+    unsigned int njobs = 0U;
+
+    bool gzip = false;
+
     for (int i = 3; i < argc; i++) {
         if (strcmp(argv[i], "-L") == 0) {
             char * p = argv[i + 1];
 
             if (p == NULL) {
-                fprintf(stderr, "Usage: %s %s %s [-L N] (N>=1 && N <=9) , The smaller the N, the faster the speed and the lower the compression ratio.\n", argv[0], argv[1], argv[2]);
+                fprintf(stderr, "Usage: %s %s %s [-L N] [-j N] [--gzip] , -L N (N>=0 && N <=9) : The smaller the N, the faster the speed and the lower the compression ratio. -j N : compress with N threads.\n", argv[0], argv[1], argv[2]);
                 return XCPKG_ERROR;
             }
 
             if (strlen(p) != 1) {
-                fprintf(stderr, "Usage: %s %s %s [-L N] (N>=1 && N <=9) , The smaller the N, the faster the speed and the lower the compression ratio.\n", argv[0], argv[1], argv[2]);
+                fprintf(stderr, "Usage: %s %s %s [-L N] [-j N] [--gzip] , -L N (N>=0 && N <=9) : The smaller the N, the faster the speed and the lower the compression ratio. -j N : compress with N threads.\n", argv[0], argv[1], argv[2]);
                 return XCPKG_ERROR;
             }
 
-            if (p[0] < '1' || p[0] > '9') {
-                fprintf(stderr, "Usage: %s %s %s [-L N] (N>=1 && N <=9) , The smaller the N, the faster the speed and the lower the compression ratio.\n", argv[0], argv[1], argv[2]);
+            if (p[0] < '0' || p[0] > '9') {
+                fprintf(stderr, "Usage: %s %s %s [-L N] [-j N] [--gzip] , -L N (N>=0 && N <=9) : The smaller the N, the faster the speed and the lower the compression ratio. -j N : compress with N threads.\n", argv[0], argv[1], argv[2]);
                 return XCPKG_ERROR;
             }
 
             level = atoi(p);
 
             i++;
+        } else if (strcmp(argv[i], "-j") == 0) {
+            char * p = argv[i + 1];
+
+            if (p == NULL || p[0] == '\0') {
+                fprintf(stderr, "Usage: %s %s %s [-j N] , N should be a positive integer.\n", argv[0], argv[1], argv[2]);
+                return XCPKG_ERROR;
+            }
+
+            for (size_t j = 0U; p[j] != '\0'; j++) {
+                if (p[j] < '0' || p[j] > '9') {
+                    fprintf(stderr, "Usage: %s %s %s [-j N] , N should be a positive integer.\n", argv[0], argv[1], argv[2]);
+                    return XCPKG_ERROR;
+                }
+            }
+
+            njobs = (unsigned int)atoi(p);
+
+            if (njobs == 0U) {
+                fprintf(stderr, "Usage: %s %s %s [-j N] , N should be a positive integer.\n", argv[0], argv[1], argv[2]);
+                return XCPKG_ERROR;
+            }
+
+            i++;
+        } else if (strcmp(argv[i], "--gzip") == 0) {
+            gzip = true;
         } else {
             LOG_ERROR2("unknown argument: ", argv[i]);
-            fprintf(stderr, "Usage: %s %s %s [-L N] (N>=1 && N <=9) , The smaller the N, the faster the speed and the lower the compression ratio.\n", argv[0], argv[1], argv[2]);
+            fprintf(stderr, "Usage: %s %s %s [-L N] [-j N] [--gzip] , -L N (N>=0 && N <=9) : The smaller the N, the faster the speed and the lower the compression ratio. -j N : compress with N threads.\n", argv[0], argv[1], argv[2]);
             return XCPKG_ERROR;
         }
     }
 
-    return zlib_deflate_file_to_file(stdin, stdout, level);
+    if (njobs == 1U && !gzip) {
+        return zlib_deflate_file_to_file(stdin, stdout, level);
+    }
+
+    return zlib_deflate_file_to_file_parallel(stdin, stdout, level, gzip, njobs);
 }
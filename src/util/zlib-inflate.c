@@ -6,6 +6,8 @@
 
 /**
  *  xcpkg util zlib-inflate < input/file/path
+ *
+ *  both zlib and gzip streams are accepted.
  */
 int xcpkg_util_zlib_inflate(int argc, char* argv[]) {
     return zlib_inflate_file_to_file(stdin, stdout);
@@ -1,6 +1,7 @@
 #ifndef XCPKG_H
 #define XCPKG_H
 
+#include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -304,6 +305,10 @@ void xcpkg_formula_repo_dump(XCPKGFormulaRepo * formulaRepo);
 int  xcpkg_formula_repo_info(XCPKGFormulaRepo * formulaRepo);
 int  xcpkg_formula_repo_sync(XCPKGFormulaRepo * formulaRepo);
 
+/** same as xcpkg_formula_repo_sync(), but all the messages are written to logFile, NULL means stdout and stderr.
+ */
+int  xcpkg_formula_repo_sync_with_log(XCPKGFormulaRepo * formulaRepo, FILE * logFile);
+
 int  xcpkg_formula_repo_scan(XCPKGFormulaRepoScanCallback callback, const void * p1, void * p2);
 
 int  xcpkg_formula_repo_list();
@@ -447,6 +452,39 @@ int xcpkg_get_home_dir(const char ** p, size_t * len, bool create);
  */
 int xcpkg_get_session_dir(char buf[], size_t * len);
 
+/** take the exclusive lock of the given lock file, it is created if it does not exist.
+ *
+ *  if the lock is being held by another xcpkg process, a message mentioning what is printed, then it blocks until that process releases the lock, and waited is set to true.
+ *
+ *  what can be null for the locks which are held only for a moment, then nothing is printed.
+ *
+ *  waited can be null if you do not care about it.
+ *
+ *  on success, 0 is returned and fd refers to the lock file, pass it to xcpkg_unlock() to release the lock.
+ *
+ *  the lock is associated with the open file description, so do not take the same lock twice in one process, it blocks forever.
+ *
+ *  the locks serialize the xcpkg processes which work on the same thing at the same time:
+ *  a file which is read, modified then replaced, such as an index, would lose the updates made by the others meanwhile;
+ *  a package or a file which is being installed or fetched would be done twice, so the one which waited checks whether
+ *  the process it waited for has done it, and reuses the result if so.
+ */
+int  xcpkg_lock(const char * lockFilePath, const char * what, int * fd, bool * waited);
+
+/** same as xcpkg_lock(), the lock file is <XCPKG_HOME>/locks/<name>.lock
+ */
+int  xcpkg_lock_named(const char * name, const char * what, int * fd, bool * waited);
+
+/** same as xcpkg_lock_named(), it is the lock held while the given package is being installed or uninstalled for the given target.
+ */
+int  xcpkg_lock_the_installed_package(const char * packageName, const char * targetPlatformSpec, int * fd, bool * waited);
+
+/** same as xcpkg_lock_the_installed_package(), but it does not wait, fd is set to -1 if the lock is being held by another xcpkg process.
+ */
+int  xcpkg_trylock_the_installed_package(const char * packageName, const char * targetPlatformSpec, int * fd);
+
+void xcpkg_unlock(int fd);
+
 //////////////////////////////////////////////////////////////////////
 
 int xcpkg_setenv();
@@ -469,7 +507,7 @@ int xcpkg_completion_zsh ();
 int xcpkg_completion_bash();
 int xcpkg_completion_fish();
 
-int xcpkg_search(const char * regPattern, const char * targetPlatformName, const bool verbose);
+int xcpkg_search(const char * regPattern, const bool fullText, const bool verbose);
 
 int xcpkg_fetch(const char * packageName, const char * targetPlatformName, const bool verbose);
 
@@ -487,6 +525,12 @@ int xcpkg_logs(const char * packageName, const char * targetPlatformSpec);
 
 int xcpkg_bundle(const char * packageName, const char * targetPlatformSpec, ArchiveType outputType, const char * outputPath, const bool verbose);
 
+/** extract the given paths from the given seekable bundle (.xsb) into outputDIR, only the needed parts of the bundle are read.
+ *
+ *  if list is true, the paths in the bundle are printed instead.
+ */
+int xcpkg_bundle_extract(const char * bundleFilePath, const char * outputDIR, char * const paths[], const size_t pathsCount, const bool list, const bool verbose);
+
 typedef enum {
     XCPKGDependsOutputType_D2,
     XCPKGDependsOutputType_DOT,
@@ -502,6 +546,122 @@ typedef enum {
 
 int xcpkg_depends(const char * packageName, const char * targetPlatformName, XCPKGDependsOutputType outputType, const char * outputPath, XCPKGDependsOutputDiagramEngine engine);
 
+/** print the packages that depend on the given package, answered from the reverse dependency index
+ *
+ *  installed: query the installed packages instead of the available packages, every result is printed as <TARGET-PLATFORM-SPEC>/<PACKAGE-NAME>
+ *  transitive: also print the packages that depend on the given package indirectly
+ */
+int xcpkg_rdepends(const char * packageName, const bool installed, const bool transitive);
+
+/** rebuild the reverse dependency index of the installed packages or the available packages from scratch
+ */
+int xcpkg_rdepends_index_rebuild(const bool installed);
+
+/** rebuild the indexes of the available packages, which are the reverse dependency index and the search index, in one pass over all the formulas
+ */
+int xcpkg_available_index_rebuild();
+
+/** update the reverse dependency index of the installed packages after the given package is installed or uninstalled
+ *
+ *  depPackageNames is the direct dependencies of the given package separated by space, NULL means the given package is uninstalled.
+ */
+int xcpkg_rdepends_index_update(const char * packageName, const char * targetPlatformSpec, const char * depPackageNames);
+
+//////////////////////////////////////////////////////////////////////
+
+/** rebuild the completion cache of the installed packages or the available packages from scratch
+ */
+int xcpkg_completion_cache_rebuild(const bool installed);
+
+/** replace the completion cache of the available packages with the given package names, packageNameArray is sorted in place
+ */
+int xcpkg_completion_cache_write_available(char * packageNameArray[], const size_t packageNameArraySize);
+
+/** update the completion cache of the installed packages after the given package is installed or uninstalled
+ */
+int xcpkg_completion_cache_update(const char * packageName, const char * targetPlatformSpec, const bool installed);
+
+/** print the names in the completion cache of the installed packages or the available packages which start with the given prefix
+ */
+int xcpkg_complete(const char * prefix, const bool installed);
+
+//////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    char * targetPlatformSpec;
+    char * packageName;
+
+    // the name of the real installed directory <XCPKG_HOME>/installed/<TARGET-PLATFORM-SPEC>/<SHA>, which <PACKAGE-NAME> links to
+    char * sha;
+
+    char * version;
+
+    // the direct dependencies separated by space, an empty string if there is none
+    char * dep_pkg;
+
+    // the modification time of the receipt if the record was recovered by xcpkg_installed_db_rebuild()
+    time_t installedAt;
+    size_t installedSize;
+
+    // all the strings above live in this buffer
+    char * buf;
+} XCPKGInstalledPackage;
+
+/** the installed-package database, which is <XCPKG_HOME>/installed.db
+ *
+ *  the queries about what are installed read only this database, install and uninstall append a record to it, it is compacted when most of its records are superseded.
+ */
+typedef struct {
+    // sorted by targetPlatformSpec then packageName
+    XCPKGInstalledPackage * packageArray;
+    size_t                  packageArraySize;
+
+    // the count of the records in the file, including the superseded ones
+    size_t recordCount;
+} XCPKGInstalledDB;
+
+/** load the installed-package database, it is rebuilt from the receipts if it does not exist.
+ */
+int  xcpkg_installed_db_load(XCPKGInstalledDB * db);
+
+void xcpkg_installed_db_free(XCPKGInstalledDB * db);
+
+/** look up the given installed package, NULL is returned if it is not installed.
+ */
+const XCPKGInstalledPackage * xcpkg_installed_db_find(const XCPKGInstalledDB * db, const char * packageName, const char * targetPlatformSpec);
+
+/** record that the given package has been installed, it replaces the former record of the same package.
+ *
+ *  dep_pkg and version might be NULL, buf is not used.
+ */
+int  xcpkg_installed_db_add(const XCPKGInstalledPackage * package);
+
+/** record that the given package has been uninstalled.
+ */
+int  xcpkg_installed_db_remove(const char * packageName, const char * targetPlatformSpec);
+
+/** rebuild the installed-package database from the receipts of the installed packages.
+ */
+int  xcpkg_installed_db_rebuild();
+
+//////////////////////////////////////////////////////////////////////
+
+typedef enum {
+    // the duplicates share the data blocks, but remain independent files, it needs a filesystem which supports cloning, such as APFS, Btrfs and XFS
+    XCPKGDedupMode_reflink,
+
+    // the duplicates become the same file, which can not be modified without affecting all the packages sharing it
+    XCPKGDedupMode_hardlink
+} XCPKGDedupMode;
+
+/** replace the files of the given installed package which are identical to the files of other installed packages with reflinks or hardlinks.
+ *
+ *  if packageName is NULL, all the installed packages of the given targetPlatformSpec are processed, if targetPlatformSpec is also NULL, all the installed packages are processed.
+ *
+ *  the sha256sum of every processed file is remembered in <XCPKG_HOME>/dedup.idx, a file is hashed again only if it is changed.
+ */
+int xcpkg_dedup(const char * packageName, const char * targetPlatformSpec, const XCPKGDedupMode mode, const bool dryrun, const bool verbose);
+
 //////////////////////////////////////////////////////////////////////
 
 typedef enum {
@@ -536,6 +696,10 @@ typedef struct {
 
     bool debug_bs;
 
+    // deduplicate the files of the installed packages against the other installed packages
+    bool dedup;
+    XCPKGDedupMode dedupMode;
+
     size_t parallelJobsCount;
 
     XCPKGLogLevel logLevel;
@@ -544,6 +708,15 @@ typedef struct {
 
 int xcpkg_install  (const char * packageName, const char * targetPlatformSpec, const XCPKGInstallOptions * options);
 
+/** install the given packages and their recursive dependencies in one session
+ *
+ *  the setup of the session and toolchain is done only once, each formula is only loaded once,
+ *  the dependencies shared between the given packages are only installed once.
+ *
+ *  targetPlatformSpecs[i] is the target platform spec for packageNames[i]
+ */
+int xcpkg_install_packages(const size_t packageCount, const char * packageNames[], const char * targetPlatformSpecs[], const XCPKGInstallOptions * options);
+
 int xcpkg_upgrade  (const char * packageName, const char * targetPlatformSpec, const XCPKGInstallOptions * options);
 
 int xcpkg_reinstall(const char * packageName, const char * targetPlatformSpec, const XCPKGInstallOptions * options);
@@ -558,7 +731,7 @@ int xcpkg_scan_the_available_packages(const char * targetPlatformName, const boo
 int xcpkg_list_the_available_packages(const char * targetPlatformName, const bool verbose);
 int xcpkg_list_the_installed_packages(const char * targetPlatformName, const bool verbose);
 
-int xcpkg_list_the__outdated_packages(const char * targetPlatformName, const bool verbose);
+int xcpkg_list_the__outdated_packages(const char * targetPlatformName, const bool verbose, const bool json);
 
 //////////////////////////////////////////////////////////////////////
 
@@ -573,6 +746,28 @@ int xcpkg_check_if_the_given_package_is_outdated (const char * packageName, cons
 
 int xcpkg_git_sync(const char * gitRepositoryDIRPath, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRef, const char * checkoutToBranchName, const size_t fetchDepth);
 
+/** same as xcpkg_git_sync(), but all the messages are written to logFile, NULL means stdout and stderr.
+ *
+ *  it is safe to call this function concurrently on different repositories.
+ */
+int xcpkg_git_sync_with_log(const char * gitRepositoryDIRPath, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRef, const char * checkoutToBranchName, const size_t fetchDepth, FILE * logFile);
+
+/** fetch remoteRef of remoteUrl into the bare mirror of remoteUrl, which is located at mirrorRootDIR/git-mirrors/<sha256sum of remoteUrl>.git
+ *
+ *  the mirror is created on the first use, and then updated incrementally. if remoteRef is a 40-characters commit id and the mirror already has it, the network is not touched at all.
+ *
+ *  on success, the path of the mirror is written into mirrorDIR, whose capacity must be PATH_MAX, and the fetched commit id is written into commitId, each of them may be NULL.
+ */
+int xcpkg_git_mirror_fetch(const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const size_t fetchDepth, char mirrorDIR[], char commitId[41]);
+
+/** same as xcpkg_git_sync(), but the objects are fetched into the mirror of remoteUrl via xcpkg_git_mirror_fetch(), and gitRepositoryDIRPath borrows them from the mirror through objects/info/alternates instead of copying them.
+ */
+int xcpkg_git_sync_via_mirror(const char * gitRepositoryDIRPath, const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRef, const char * checkoutToBranchName, const size_t fetchDepth);
+
+/** same as xcpkg_git_sync_via_mirror(), but all the messages are written to logFile, NULL means stdout and stderr.
+ */
+int xcpkg_git_sync_via_mirror_with_log(const char * gitRepositoryDIRPath, const char * mirrorRootDIR, const char * remoteUrl, const char * remoteRef, const char * remoteTrackingRef, const char * checkoutToBranchName, const size_t fetchDepth, FILE * logFile);
+
 int xcpkg_extract_filetype_from_url(const char * url, char buf[], const size_t bufSize);
 
 int xcpkg_extract_filename_from_url(const char * url, char buf[], const size_t bufSize);
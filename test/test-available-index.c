@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../src/xcpkg.h"
+
+#include "test.h"
+
+static const char * const formulas[] = {
+    "foo",
+    "summary: foo is a library for testing the available index\n"
+    "web-url: https://example.invalid/foo\n"
+    "src-url: https://example.invalid/foo-1.0.0.tar.gz\n"
+    "src-sha: 0000000000000000000000000000000000000000000000000000000000000000\n"
+    "license: MIT\n"
+    "dep-pkg: zlib\n"
+    "bsystem: cmake\n",
+    NULL
+};
+
+// the reverse dependency index built from a one-formula repo has the edge zlib -> foo
+static int test_rdepends_available(const char * xcpkgHomeDIR) {
+    CHECK(xcpkg_available_index_rebuild() == XCPKG_OK);
+
+    char indexFilePath[PATH_MAX];
+
+    snprintf(indexFilePath, PATH_MAX, "%s/rdepends-available.txt", xcpkgHomeDIR);
+
+    char * content = test_read_file(indexFilePath);
+
+    CHECK(content != NULL);
+
+    bool found = strncmp(content, "zlib foo\n", 9) == 0 || strstr(content, "\nzlib foo\n") != NULL;
+
+    if (!found) {
+        fprintf(stderr, "%s:\n%s\n", indexFilePath, content);
+    }
+
+    free(content);
+
+    CHECK(found);
+
+    return 0;
+}
+
+int main() {
+    char xcpkgHomeDIR[PATH_MAX];
+
+    if (test_home_dir_create(xcpkgHomeDIR) != 0) {
+        return 1;
+    }
+
+    int ret = test_formula_repo_create("test", formulas) == 0 ? 0 : 1;
+
+    if (ret == 0) {
+        ret = test_rdepends_available(xcpkgHomeDIR);
+    }
+
+    xcpkg_rm_rf(xcpkgHomeDIR, false, false);
+
+    return ret;
+}
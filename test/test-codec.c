@@ -0,0 +1,173 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openssl/evp.h>
+
+#include "../src/core/base16.h"
+#include "../src/core/base64.h"
+
+#include "test.h"
+
+// random inputs of every length up to this, so that every tail of every kernel is covered
+#define SHORT_INPUT_MAX_SIZE 300U
+
+#define LONG_INPUT_MAX_SIZE  70000U
+
+#define ROUND_COUNT 2000U
+
+// xorshift64*, a fixed seed makes a failure reproducible
+static uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t next_random() {
+    uint64_t x = randomState;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+
+    randomState = x;
+
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static void fill_randomly(unsigned char * buf, const size_t size) {
+    for (size_t i = 0U; i < size; i++) {
+        buf[i] = (unsigned char)(next_random() >> 56);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// the reference, one byte at a time
+static void base16_encode_reference(char * output, const unsigned char * input, const size_t size, const bool isToUpper) {
+    const char * const table = isToUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    for (size_t i = 0U; i < size; i++) {
+        output[i << 1]        = table[input[i] >> 4];
+        output[(i << 1) + 1U] = table[input[i] & 0x0F];
+    }
+}
+
+static int test_base16(const unsigned char * input, const size_t size, char * encoded, char * expected, unsigned char * decoded) {
+    const bool isToUpper = (next_random() & 1U) != 0U;
+
+    CHECK(base16_encode(encoded, input, size, isToUpper) == 0);
+
+    base16_encode_reference(expected, input, size, isToUpper);
+
+    CHECK(memcmp(encoded, expected, size << 1) == 0);
+
+    // the decoder accepts both cases, even mixed
+    for (size_t i = 0U; i < (size << 1); i++) {
+        if ((next_random() & 3U) == 0U && encoded[i] >= 'a' && encoded[i] <= 'f') {
+            encoded[i] -= 32;
+        }
+    }
+
+    CHECK(base16_decode(decoded, encoded, size << 1) == 0);
+    CHECK(memcmp(decoded, input, size) == 0);
+
+    // one invalid digit anywhere is reported, wherever the kernels stop
+    size_t k = (size_t)(next_random() % (size << 1));
+
+    const char c = encoded[k];
+
+    const char invalids[] = { 'g', 'G', '/', ':', '@', '`', ' ', '\0', (char)0x80, (char)0xC6 };
+
+    encoded[k] = invalids[next_random() % sizeof(invalids)];
+
+    errno = 0;
+
+    CHECK(base16_decode(decoded, encoded, size << 1) == -1);
+    CHECK(errno == EINVAL);
+
+    encoded[k] = c;
+
+    return 0;
+}
+
+static int test_base64(const unsigned char * input, const size_t size, char * encoded, char * expected, unsigned char * decoded) {
+    size_t n = base64_encode(encoded, input, size);
+
+    CHECK(n == (size + 2U) / 3U * 4U);
+
+    // OpenSSL is the reference
+    CHECK(EVP_EncodeBlock((unsigned char *)expected, input, (int)size) == (int)n);
+    CHECK(memcmp(encoded, expected, n) == 0);
+
+    size_t decodedSize = 0U;
+
+    CHECK(base64_decode(decoded, &decodedSize, encoded, n) == 0);
+    CHECK(decodedSize == size);
+    CHECK(memcmp(decoded, input, size) == 0);
+
+    // one non-base64 character anywhere is reported, wherever the kernels stop
+    size_t k = (size_t)(next_random() % n);
+
+    const char c = encoded[k];
+
+    const char invalids[] = { '-', '_', '.', ' ', '\n', '\0', '@', '[', '{', (char)0x80, (char)0xFF };
+
+    encoded[k] = invalids[next_random() % sizeof(invalids)];
+
+    errno = 0;
+
+    CHECK(base64_decode(decoded, &decodedSize, encoded, n) == -1);
+    CHECK(errno == EINVAL);
+
+    // a padding is only allowed at the end
+    if (k + 4U < n) {
+        encoded[k] = '=';
+
+        CHECK(base64_decode(decoded, &decodedSize, encoded, n) == -1);
+    }
+
+    encoded[k] = c;
+
+    return 0;
+}
+
+int main() {
+    unsigned char * input   = (unsigned char *)malloc(LONG_INPUT_MAX_SIZE);
+    unsigned char * decoded = (unsigned char *)malloc(LONG_INPUT_MAX_SIZE);
+    char          * encoded = (char *)malloc((LONG_INPUT_MAX_SIZE << 1) + 1U);
+    char          * expected = (char *)malloc((LONG_INPUT_MAX_SIZE << 1) + 1U);
+
+    if (input == NULL || decoded == NULL || encoded == NULL || expected == NULL) {
+        perror(NULL);
+        return 1;
+    }
+
+    int ret = 0;
+
+    for (size_t round = 0U; ret == 0 && round < ROUND_COUNT; round++) {
+        size_t size;
+
+        if (round <= SHORT_INPUT_MAX_SIZE) {
+            size = round == 0U ? 1U : round;
+        } else {
+            size = 1U + (size_t)(next_random() % LONG_INPUT_MAX_SIZE);
+        }
+
+        fill_randomly(input, size);
+
+        ret = test_base16(input, size, encoded, expected, decoded);
+
+        if (ret == 0) {
+            ret = test_base64(input, size, encoded, expected, decoded);
+        }
+
+        if (ret != 0) {
+            fprintf(stderr, "failed at round %zu, input size %zu.\n", round, size);
+        }
+    }
+
+    free(input);
+    free(decoded);
+    free(encoded);
+    free(expected);
+
+    return ret;
+}
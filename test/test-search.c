@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../src/xcpkg.h"
+
+#include "test.h"
+
+static const char * const formulas[] = {
+    "foo",
+    "summary: foo is a compression library\n"
+    "web-url: https://example.invalid/foo\n"
+    "src-url: https://example.invalid/foo-1.0.0.tar.gz\n"
+    "src-sha: 0000000000000000000000000000000000000000000000000000000000000000\n"
+    "license: MIT\n"
+    "bsystem: cmake\n",
+
+    "foobar",
+    "summary: foobar is a http client\n"
+    "web-url: https://example.invalid/foobar\n"
+    "src-url: https://example.invalid/foobar-2.0.0.tar.gz\n"
+    "src-sha: 0000000000000000000000000000000000000000000000000000000000000000\n"
+    "license: Apache-2.0\n"
+    "dep-pkg: foo\n"
+    "bsystem: cmake\n",
+    NULL
+};
+
+// run xcpkg search and return what it printed, the caller should free it
+static char * search(const char * xcpkgHomeDIR, const char * pattern, const bool fullText, const bool verbose, int * ret) {
+    char outputFilePath[PATH_MAX];
+
+    snprintf(outputFilePath, PATH_MAX, "%s/search-output.txt", xcpkgHomeDIR);
+
+    int savedFD;
+
+    if (test_stdout_redirect(outputFilePath, &savedFD) != 0) {
+        return NULL;
+    }
+
+    (*ret) = xcpkg_search(pattern, fullText, verbose);
+
+    if (test_stdout_restore(savedFD) != 0) {
+        return NULL;
+    }
+
+    return test_read_file(outputFilePath);
+}
+
+static int test_search(const char * xcpkgHomeDIR) {
+    int ret;
+
+    // the search index does not exist yet, it is built from the formulas on demand
+    char * output = search(xcpkgHomeDIR, "^foo", false, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "foo\nfoobar\n") == 0 || strcmp(output, "foobar\nfoo\n") == 0);
+
+    free(output);
+
+    output = search(xcpkgHomeDIR, "bar$", false, true, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "pkgname: foobar\nversion: 2.0.0\nsummary: foobar is a http client\nlicense: Apache-2.0\nweb-url: https://example.invalid/foobar\n") == 0);
+
+    free(output);
+
+    output = search(xcpkgHomeDIR, "compression", true, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "foo\n") == 0);
+
+    free(output);
+
+    // a prefix is found by the binary search, a substring by the fallback scan
+    output = search(xcpkgHomeDIR, "compr", true, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "foo\n") == 0);
+
+    free(output);
+
+    output = search(xcpkgHomeDIR, "ompress", true, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "foo\n") == 0);
+
+    free(output);
+
+    // a name match outranks a summary match
+    output = search(xcpkgHomeDIR, "foobar", true, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(strcmp(output, "foobar\n") == 0);
+
+    free(output);
+
+    output = search(xcpkgHomeDIR, "^nothing$", false, false, &ret);
+
+    CHECK(output != NULL);
+    CHECK(ret == XCPKG_OK);
+    CHECK(output[0] == '\0');
+
+    free(output);
+
+    return 0;
+}
+
+int main() {
+    char xcpkgHomeDIR[PATH_MAX];
+
+    if (test_home_dir_create(xcpkgHomeDIR) != 0) {
+        return 1;
+    }
+
+    int ret = test_formula_repo_create("test", formulas) == 0 ? 0 : 1;
+
+    if (ret == 0) {
+        ret = test_search(xcpkgHomeDIR);
+    }
+
+    xcpkg_rm_rf(xcpkgHomeDIR, false, false);
+
+    return ret;
+}
@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include <openssl/sha.h>
+
+#include "../src/core/seekable-bundle.h"
+#include "../src/xcpkg.h"
+
+#include "test.h"
+
+static int read_the_trailer(const char * filePath, unsigned char trailer[]) {
+    FILE * file = fopen(filePath, "rb");
+
+    CHECK(file != NULL);
+    CHECK(fseek(file, -(long)SEEKABLE_BUNDLE_TRAILER_SIZE, SEEK_END) == 0);
+    CHECK(fread(trailer, 1, SEEKABLE_BUNDLE_TRAILER_SIZE, file) == SEEKABLE_BUNDLE_TRAILER_SIZE);
+    CHECK(fclose(file) == 0);
+
+    return 0;
+}
+
+// overwrite the little-endian uint64 at the given offset of the trailer
+static int patch_the_trailer(const char * filePath, const size_t offset, const uint64_t value) {
+    FILE * file = fopen(filePath, "r+b");
+
+    CHECK(file != NULL);
+    CHECK(fseek(file, -(long)(SEEKABLE_BUNDLE_TRAILER_SIZE - offset), SEEK_END) == 0);
+
+    for (int i = 0; i < 8; i++) {
+        CHECK(fputc((int)((value >> (i << 3)) & 0xFF), file) != EOF);
+    }
+
+    CHECK(fclose(file) == 0);
+
+    return 0;
+}
+
+static int copy_a_file(const char * fromFilePath, const char * toFilePath) {
+    FILE * from = fopen(fromFilePath, "rb");
+    FILE * to   = fopen(toFilePath, "wb");
+
+    CHECK(from != NULL);
+    CHECK(to != NULL);
+
+    char buf[4096];
+
+    for (size_t n; (n = fread(buf, 1, 4096, from)) != 0U; ) {
+        CHECK(fwrite(buf, 1, n, to) == n);
+    }
+
+    CHECK(fclose(from) == 0);
+    CHECK(fclose(to) == 0);
+
+    return 0;
+}
+
+// a bundled directory is extracted as it is, a bundle with a broken trailer is rejected
+static int test_bundle(const char * tmpDIR) {
+    char inputDIR[PATH_MAX];
+    char outputDIR[PATH_MAX];
+    char bundleFilePath[PATH_MAX];
+    char brokenFilePath[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    snprintf(inputDIR, PATH_MAX, "%s/input", tmpDIR);
+    snprintf(outputDIR, PATH_MAX, "%s/output", tmpDIR);
+    snprintf(bundleFilePath, PATH_MAX, "%s/input.xsb", tmpDIR);
+    snprintf(brokenFilePath, PATH_MAX, "%s/broken.xsb", tmpDIR);
+
+    snprintf(filePath, PATH_MAX, "%s/x/y/z.txt", inputDIR);
+
+    CHECK(test_write_file(filePath, "hello") == 0);
+
+    snprintf(filePath, PATH_MAX, "%s/x/l", inputDIR);
+
+    CHECK(symlink("y/z.txt", filePath) == 0);
+
+    CHECK(seekable_bundle_create(inputDIR, bundleFilePath, false) == 0);
+    CHECK(seekable_bundle_extract(bundleFilePath, outputDIR, NULL, 0U, false) == 0);
+
+    snprintf(filePath, PATH_MAX, "%s/x/l", outputDIR);
+
+    char * content = test_read_file(filePath);
+
+    CHECK(content != NULL);
+    CHECK(strcmp(content, "hello") == 0);
+
+    free(content);
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    unsigned char trailer[SEEKABLE_BUNDLE_TRAILER_SIZE];
+
+    CHECK(read_the_trailer(bundleFilePath, trailer) == 0);
+
+    uint64_t indexOffset = 0U;
+
+    for (int i = 7; i >= 0; i--) {
+        indexOffset = (indexOffset << 8) | trailer[8 + i];
+    }
+
+    struct stat st;
+
+    CHECK(stat(bundleFilePath, &st) == 0);
+
+    // offset, frame size, uncompressed size
+    const struct { size_t offset; uint64_t value; } patches[] = {
+        // malloc(indexSize + 1) wraps around
+        { 24U, UINT64_MAX },
+        // larger than the frame is able to hold
+        { 24U, (uint64_t)st.st_size * 2000U },
+        // the offset plus the frame size wraps around to the right file size
+        {  8U, indexOffset + (UINT64_MAX - (uint64_t)st.st_size) + 1U },
+        { 16U, UINT64_MAX },
+    };
+
+    for (size_t i = 0U; i < sizeof(patches) / sizeof(patches[0]); i++) {
+        CHECK(copy_a_file(bundleFilePath, brokenFilePath) == 0);
+        CHECK(patch_the_trailer(brokenFilePath, patches[i].offset, patches[i].value) == 0);
+
+        if (patches[i].offset == 8U) {
+            // the frame size which makes the sum of the offset, the frame size and the trailer size equal to the file size
+            CHECK(patch_the_trailer(brokenFilePath, 16U, (uint64_t)st.st_size - SEEKABLE_BUNDLE_TRAILER_SIZE - patches[i].value) == 0);
+        }
+
+        CHECK(seekable_bundle_list(brokenFilePath) != 0);
+    }
+
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// a bundle is written by hand, so its index is able to contain entries that seekable_bundle_create() never writes
+static int write_a_bundle(const char * filePath, const unsigned char * frame, const size_t frameSize, const char * index) {
+    FILE * file = fopen(filePath, "wb");
+
+    CHECK(file != NULL);
+    CHECK(fwrite(frame, 1, frameSize, file) == frameSize);
+
+    size_t indexSize = strlen(index);
+
+    unsigned char indexFrame[1024];
+
+    uLongf indexFrameSize = 1024U;
+
+    CHECK(compress(indexFrame, &indexFrameSize, (const unsigned char *)index, indexSize) == Z_OK);
+    CHECK(fwrite(indexFrame, 1, indexFrameSize, file) == indexFrameSize);
+
+    const uint64_t values[3] = { frameSize, indexFrameSize, indexSize };
+
+    CHECK(fwrite(SEEKABLE_BUNDLE_MAGIC, 1, 8, file) == 8U);
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 8; j++) {
+            CHECK(fputc((int)((values[i] >> (j << 3)) & 0xFF), file) != EOF);
+        }
+    }
+
+    CHECK(fclose(file) == 0);
+
+    return 0;
+}
+
+// nothing is written through a symlink in the bundle, its target is outside of the output directory
+static int test_extract_through_a_symlink(const char * tmpDIR) {
+    char outsideDIR[PATH_MAX];
+    char bundleFilePath[PATH_MAX];
+    char outputDIR[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    snprintf(outsideDIR, PATH_MAX, "%s/outside", tmpDIR);
+    snprintf(filePath, PATH_MAX, "%s/secret", outsideDIR);
+
+    CHECK(test_write_file(filePath, "secret") == 0);
+
+    const char * const data = "evil";
+
+    unsigned char md[SHA256_DIGEST_LENGTH];
+
+    SHA256((const unsigned char *)data, strlen(data), md);
+
+    char sha256sum[65];
+
+    for (int i = 0; i < SHA256_DIGEST_LENGTH; i++) {
+        snprintf(sha256sum + (i << 1), 3, "%02x", md[i]);
+    }
+
+    unsigned char frame[1024];
+
+    uLongf frameSize = 1024U;
+
+    CHECK(compress(frame, &frameSize, (const unsigned char *)data, strlen(data)) == Z_OK);
+
+    char fileEntry[256];
+    char deepFileEntry[256];
+
+    snprintf(fileEntry,     256, "f\t644\t0\t%lu\t4\t%s\ta/evil\n",   (unsigned long)frameSize, sha256sum);
+    snprintf(deepFileEntry, 256, "f\t644\t0\t%lu\t4\t%s\ta/b/evil\n", (unsigned long)frameSize, sha256sum);
+
+    // after the symlink a which points to outsideDIR: a/evil is written, a/b is created, the mode of a is applied
+    const char * const entries[] = { fileEntry, deepFileEntry, "d\t700\t0\t0\t0\t-\ta\n" };
+
+    for (size_t i = 0U; i < sizeof(entries) / sizeof(entries[0]); i++) {
+        char index[PATH_MAX + 512];
+
+        snprintf(index, sizeof(index), "l\t777\t0\t0\t0\t-\ta\t%s\n%s", outsideDIR, entries[i]);
+
+        snprintf(bundleFilePath, PATH_MAX, "%s/evil-%zu.xsb", tmpDIR, i);
+        snprintf(outputDIR, PATH_MAX, "%s/evil-%zu", tmpDIR, i);
+
+        CHECK(chmod(outsideDIR, 0755) == 0);
+
+        CHECK(write_a_bundle(bundleFilePath, frame, frameSize, index) == 0);
+
+        CHECK(seekable_bundle_extract(bundleFilePath, outputDIR, NULL, 0U, false) != 0);
+
+        DIR * dir = opendir(outsideDIR);
+
+        CHECK(dir != NULL);
+
+        for (struct dirent * dirEntry; (dirEntry = readdir(dir)) != NULL; ) {
+            if (strcmp(dirEntry->d_name, ".") != 0 && strcmp(dirEntry->d_name, "..") != 0 && strcmp(dirEntry->d_name, "secret") != 0) {
+                fprintf(stderr, "%s/%s is created.\n", outsideDIR, dirEntry->d_name);
+                closedir(dir);
+                return 1;
+            }
+        }
+
+        closedir(dir);
+
+        struct stat st;
+
+        CHECK(stat(outsideDIR, &st) == 0);
+        CHECK((st.st_mode & 0777) == 0755);
+    }
+
+    return 0;
+}
+
+int main() {
+    char tmpDIR[PATH_MAX];
+
+    if (test_home_dir_create(tmpDIR) != 0) {
+        return 1;
+    }
+
+    int ret = test_bundle(tmpDIR);
+
+    if (ret == 0) {
+        ret = test_extract_through_a_symlink(tmpDIR);
+    }
+
+    xcpkg_rm_rf(tmpDIR, false, false);
+
+    return ret;
+}
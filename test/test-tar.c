@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <archive.h>
+#include <archive_entry.h>
+
+#include "../src/core/tar.h"
+#include "../src/xcpkg.h"
+
+#include "test.h"
+
+typedef struct {
+    const char * path;
+    mode_t       type;
+    // the content of a regular file, the target of a symlink or a hardlink
+    const char * data;
+} Entry;
+
+static int write_a_tarball(const char * filePath, const Entry entries[]) {
+    struct archive * ar = archive_write_new();
+
+    CHECK(ar != NULL);
+    CHECK(archive_write_set_format_pax_restricted(ar) == ARCHIVE_OK);
+    CHECK(archive_write_open_filename(ar, filePath) == ARCHIVE_OK);
+
+    for (size_t i = 0U; entries[i].path != NULL; i++) {
+        struct archive_entry * entry = archive_entry_new();
+
+        CHECK(entry != NULL);
+
+        archive_entry_set_pathname(entry, entries[i].path);
+        archive_entry_set_mtime(entry, 1000000000, 0);
+
+        size_t size = 0U;
+
+        if (entries[i].type == AE_IFLNK) {
+            archive_entry_set_filetype(entry, AE_IFLNK);
+            archive_entry_set_perm(entry, 0777);
+            archive_entry_set_symlink(entry, entries[i].data);
+        } else if (entries[i].type == 0) {
+            archive_entry_set_filetype(entry, AE_IFREG);
+            archive_entry_set_perm(entry, 0644);
+            archive_entry_set_hardlink(entry, entries[i].data);
+        } else if (entries[i].type == AE_IFDIR) {
+            archive_entry_set_filetype(entry, AE_IFDIR);
+            archive_entry_set_perm(entry, 0700);
+        } else {
+            size = strlen(entries[i].data);
+
+            archive_entry_set_filetype(entry, AE_IFREG);
+            archive_entry_set_perm(entry, 0644);
+            archive_entry_set_size(entry, (la_int64_t)size);
+        }
+
+        CHECK(archive_write_header(ar, entry) == ARCHIVE_OK);
+
+        if (size != 0U) {
+            CHECK(archive_write_data(ar, entries[i].data, size) == (la_ssize_t)size);
+        }
+
+        archive_entry_free(entry);
+    }
+
+    CHECK(archive_write_close(ar) == ARCHIVE_OK);
+    CHECK(archive_write_free(ar) == ARCHIVE_OK);
+
+    return 0;
+}
+
+// a regular archive is extracted as it is
+static int test_extract(const char * tmpDIR) {
+    char archiveFilePath[PATH_MAX];
+    char outputDIR[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    snprintf(archiveFilePath, PATH_MAX, "%s/regular.tar", tmpDIR);
+    snprintf(outputDIR, PATH_MAX, "%s/regular", tmpDIR);
+
+    const Entry entries[] = {
+        { "x/",        AE_IFDIR, NULL },
+        { "x/y/z.txt", AE_IFREG, "hello" },
+        { "x/l",       AE_IFLNK, "y/z.txt" },
+        { "x/h",       0,        "x/y/z.txt" },
+        { NULL,        0,        NULL }
+    };
+
+    CHECK(write_a_tarball(archiveFilePath, entries) == 0);
+
+    CHECK(tar_extract(outputDIR, archiveFilePath, ARCHIVE_EXTRACT_TIME, false, 0) == ARCHIVE_OK);
+
+    const char * const paths[] = { "x/y/z.txt", "x/l", "x/h", NULL };
+
+    for (size_t i = 0U; paths[i] != NULL; i++) {
+        snprintf(filePath, PATH_MAX, "%s/%s", outputDIR, paths[i]);
+
+        char * content = test_read_file(filePath);
+
+        CHECK(content != NULL);
+        CHECK(strcmp(content, "hello") == 0);
+
+        free(content);
+    }
+
+    struct stat st;
+
+    snprintf(filePath, PATH_MAX, "%s/x", outputDIR);
+
+    CHECK(lstat(filePath, &st) == 0);
+    CHECK(S_ISDIR(st.st_mode));
+    CHECK((st.st_mode & 0777) == 0700);
+    CHECK(st.st_mtime == 1000000000);
+
+    return 0;
+}
+
+// nothing is written through a symlink in the archive, its target is outside of the output directory
+static int test_extract_through_a_symlink(const char * tmpDIR, const char * name, const Entry entries[]) {
+    char archiveFilePath[PATH_MAX];
+    char outputDIR[PATH_MAX];
+    char outsideDIR[PATH_MAX];
+    char filePath[PATH_MAX];
+
+    snprintf(archiveFilePath, PATH_MAX, "%s/%s.tar", tmpDIR, name);
+    snprintf(outputDIR, PATH_MAX, "%s/%s", tmpDIR, name);
+    snprintf(outsideDIR, PATH_MAX, "%s/outside", tmpDIR);
+    snprintf(filePath, PATH_MAX, "%s/secret", outsideDIR);
+
+    CHECK(test_write_file(filePath, "secret") == 0);
+    CHECK(chmod(outsideDIR, 0755) == 0);
+
+    // the symlink entry a points to outsideDIR
+    Entry evilEntries[8];
+
+    size_t n = 0U;
+
+    evilEntries[n++] = (Entry){ "a", AE_IFLNK, outsideDIR };
+
+    for (size_t i = 0U; entries[i].path != NULL && n < 7U; i++) {
+        evilEntries[n++] = entries[i];
+    }
+
+    evilEntries[n] = (Entry){ NULL, 0, NULL };
+
+    CHECK(write_a_tarball(archiveFilePath, evilEntries) == 0);
+
+    CHECK(tar_extract(outputDIR, archiveFilePath, ARCHIVE_EXTRACT_TIME, false, 0) != ARCHIVE_OK);
+
+    // outsideDIR still only has the secret file
+    DIR * dir = opendir(outsideDIR);
+
+    CHECK(dir != NULL);
+
+    for (struct dirent * dirEntry; (dirEntry = readdir(dir)) != NULL; ) {
+        if (strcmp(dirEntry->d_name, ".") != 0 && strcmp(dirEntry->d_name, "..") != 0 && strcmp(dirEntry->d_name, "secret") != 0) {
+            fprintf(stderr, "%s/%s is created.\n", outsideDIR, dirEntry->d_name);
+            closedir(dir);
+            return 1;
+        }
+    }
+
+    closedir(dir);
+
+    struct stat st;
+
+    CHECK(stat(outsideDIR, &st) == 0);
+    CHECK((st.st_mode & 0777) == 0755);
+    CHECK(st.st_mtime != 1000000000);
+
+    snprintf(filePath, PATH_MAX, "%s/secret", outsideDIR);
+
+    char * content = test_read_file(filePath);
+
+    CHECK(content != NULL);
+    CHECK(strcmp(content, "secret") == 0);
+
+    free(content);
+
+    return 0;
+}
+
+int main() {
+    char tmpDIR[PATH_MAX];
+
+    if (test_home_dir_create(tmpDIR) != 0) {
+        return 1;
+    }
+
+    // a/evil is written into outsideDIR
+    const Entry writeEntries[] = {
+        { "a/evil", AE_IFREG, "evil" },
+        { NULL,     0,        NULL }
+    };
+
+    // a/b/evil creates b in outsideDIR
+    const Entry mkdirEntries[] = {
+        { "a/b/evil", AE_IFREG, "evil" },
+        { NULL,       0,        NULL }
+    };
+
+    // the mode and mtime of the directory entry a are applied to outsideDIR
+    const Entry dirEntries[] = {
+        { "a/", AE_IFDIR, NULL },
+        { NULL, 0,        NULL }
+    };
+
+    // evil is a hardlink to outsideDIR/secret, then it is overwritten
+    const Entry hardlinkEntries[] = {
+        { "evil", 0,        "a/secret" },
+        { "evil", AE_IFREG, "evil" },
+        { NULL,   0,        NULL }
+    };
+
+    int ret = test_extract(tmpDIR);
+
+    if (ret == 0) {
+        ret = test_extract_through_a_symlink(tmpDIR, "write", writeEntries);
+    }
+
+    if (ret == 0) {
+        ret = test_extract_through_a_symlink(tmpDIR, "mkdir", mkdirEntries);
+    }
+
+    if (ret == 0) {
+        ret = test_extract_through_a_symlink(tmpDIR, "dir", dirEntries);
+    }
+
+    if (ret == 0) {
+        ret = test_extract_through_a_symlink(tmpDIR, "hardlink", hardlinkEntries);
+    }
+
+    xcpkg_rm_rf(tmpDIR, false, false);
+
+    return ret;
+}
@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../src/xcpkg.h"
+
+#include "test.h"
+
+int test_home_dir_create(char buf[]) {
+    const char * tmpDIR = getenv("TMPDIR");
+
+    if (tmpDIR == NULL || tmpDIR[0] == '\0') {
+        tmpDIR = "/tmp";
+    }
+
+    int ret = snprintf(buf, PATH_MAX, "%s/xcpkg-test-XXXXXX", tmpDIR);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    if (mkdtemp(buf) == NULL) {
+        perror(buf);
+        return -1;
+    }
+
+    if (setenv("XCPKG_HOME", buf, 1) != 0) {
+        perror("XCPKG_HOME");
+        return -1;
+    }
+
+    return 0;
+}
+
+int test_write_file(const char * filePath, const char * content) {
+    char dirPath[PATH_MAX];
+
+    strncpy(dirPath, filePath, PATH_MAX - 1U);
+    dirPath[PATH_MAX - 1U] = '\0';
+
+    char * p = strrchr(dirPath, '/');
+
+    if (p != NULL && p != dirPath) {
+        p[0] = '\0';
+
+        if (xcpkg_mkdir_p(dirPath, false) != XCPKG_OK) {
+            return -1;
+        }
+    }
+
+    FILE * file = fopen(filePath, "w");
+
+    if (file == NULL) {
+        perror(filePath);
+        return -1;
+    }
+
+    fputs(content, file);
+
+    if (fclose(file) != 0) {
+        perror(filePath);
+        return -1;
+    }
+
+    return 0;
+}
+
+char * test_read_file(const char * filePath) {
+    FILE * file = fopen(filePath, "r");
+
+    if (file == NULL) {
+        perror(filePath);
+        return NULL;
+    }
+
+    size_t size = 0U;
+    size_t capacity = 4096U;
+
+    char * buf = (char*)malloc(capacity);
+
+    while (buf != NULL) {
+        size += fread(buf + size, 1, capacity - size - 1U, file);
+
+        if (size + 1U < capacity) {
+            break;
+        }
+
+        capacity <<= 1;
+
+        char * p = (char*)realloc(buf, capacity);
+
+        if (p == NULL) {
+            free(buf);
+        }
+
+        buf = p;
+    }
+
+    if (buf == NULL) {
+        perror(NULL);
+    } else {
+        buf[size] = '\0';
+    }
+
+    fclose(file);
+
+    return buf;
+}
+
+int test_formula_repo_create(const char * repoName, const char * const formulas[]) {
+    const char * xcpkgHomeDIR = getenv("XCPKG_HOME");
+
+    char filePath[PATH_MAX];
+
+    int ret = snprintf(filePath, PATH_MAX, "%s/repos.d/%s/%s", xcpkgHomeDIR, repoName, XCPKG_FORMULA_REPO_CONFIG_FILENAME);
+
+    if (ret < 0) {
+        perror(NULL);
+        return -1;
+    }
+
+    if (test_write_file(filePath, "url: https://example.invalid/test.git\nbranch: master\npinned: 0\nenabled: 1\ncreated: 1700000000\nupdated: 1700000000\n") != 0) {
+        return -1;
+    }
+
+    for (size_t i = 0U; formulas[i] != NULL; i += 2U) {
+        ret = snprintf(filePath, PATH_MAX, "%s/repos.d/%s/formula/%s.yml", xcpkgHomeDIR, repoName, formulas[i]);
+
+        if (ret < 0) {
+            perror(NULL);
+            return -1;
+        }
+
+        if (test_write_file(filePath, formulas[i + 1U]) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int test_stdout_redirect(const char * filePath, int * savedFD) {
+    fflush(stdout);
+
+    int fd = open(filePath, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+
+    if (fd == -1) {
+        perror(filePath);
+        return -1;
+    }
+
+    int stdoutFD = dup(STDOUT_FILENO);
+
+    if (stdoutFD == -1) {
+        perror(NULL);
+        close(fd);
+        return -1;
+    }
+
+    if (dup2(fd, STDOUT_FILENO) == -1) {
+        perror(NULL);
+        close(fd);
+        close(stdoutFD);
+        return -1;
+    }
+
+    close(fd);
+
+    (*savedFD) = stdoutFD;
+
+    return 0;
+}
+
+int test_stdout_restore(const int savedFD) {
+    fflush(stdout);
+
+    if (dup2(savedFD, STDOUT_FILENO) == -1) {
+        perror(NULL);
+        close(savedFD);
+        return -1;
+    }
+
+    close(savedFD);
+
+    return 0;
+}
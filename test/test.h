@@ -0,0 +1,48 @@
+#ifndef XCPKG_TEST_H
+#define XCPKG_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// on failure, the failed condition is printed and the test function returns 1
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: CHECK(%s) failed.\n", __FILE__, __LINE__, #cond); \
+        return 1; \
+    } \
+} while (0)
+
+/** create an empty temporary directory and export it as XCPKG_HOME, its path is written to buf whose capacity must be PATH_MAX.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int test_home_dir_create(char buf[]);
+
+/** write the given string to the given file, its parent directories are created if they do not exist.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int test_write_file(const char * filePath, const char * content);
+
+/** read the whole given file into a null-terminated buffer, the caller should free it.
+ *
+ *  On error, NULL is returned and the error message has been printed.
+ */
+char * test_read_file(const char * filePath);
+
+/** create a formula repository named repoName under $XCPKG_HOME/repos.d, formulas is a NULL-terminated list of name and content pairs.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int test_formula_repo_create(const char * repoName, const char * const formulas[]);
+
+/** redirect the standard output to the given file until test_stdout_restore(*savedFD) is called.
+ *
+ *  On success, 0 is returned. On error, -1 is returned and the error message has been printed.
+ */
+int test_stdout_redirect(const char * filePath, int * savedFD);
+
+int test_stdout_restore(const int savedFD);
+
+#endif